@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// File: ComponentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming reader class for ipxact:component element.
+//-----------------------------------------------------------------------------
+
+#include "ComponentStreamReader.h"
+#include "Component.h"
+
+#include <IPXACTmodels/common/DocumentStreamParser.h>
+
+#include <IPXACTmodels/Component/AddressBlockReader.h>
+#include <IPXACTmodels/Component/AddressSpaceReader.h>
+#include <IPXACTmodels/Component/BusInterfaceReader.h>
+#include <IPXACTmodels/Component/FileSetReader.h>
+#include <IPXACTmodels/Component/PortReader.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Model.h>
+
+#include <QMap>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: insertStreamedItems()
+    //-----------------------------------------------------------------------------
+    template <typename T>
+    void insertStreamedItems(QSharedPointer<QList<QSharedPointer<T> > > target,
+        QList<QSharedPointer<T> > const& streamedItems)
+    {
+        // Streamed items precede anything added from the shell, e.g. from vendor extensions.
+        *target = streamedItems + *target;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::ComponentStreamReader()
+//-----------------------------------------------------------------------------
+ComponentStreamReader::ComponentStreamReader(): ComponentReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::~ComponentStreamReader()
+//-----------------------------------------------------------------------------
+ComponentStreamReader::~ComponentStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::createComponentFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> ComponentStreamReader::createComponentFrom(QIODevice* device) const
+{
+    QList<QSharedPointer<BusInterface> > busInterfaces;
+    QList<QSharedPointer<AddressSpace> > addressSpaces;
+    QMap<int, QList<QSharedPointer<MemoryBlockBase> > > addressBlocks;
+    QList<QSharedPointer<Port> > ports;
+    QList<QSharedPointer<FileSet> > fileSets;
+
+    BusinterfaceReader busReader;
+    AddressSpaceReader spaceReader;
+    AddressBlockReader blockReader;
+    PortReader portReader;
+    FileSetReader setReader;
+
+    DocumentStreamParser parser;
+    parser.addItemHandler(QStringLiteral("ipxact:busInterfaces/ipxact:busInterface"),
+        [&busInterfaces, &busReader](QDomElement const& busElement, int)
+    {
+        busInterfaces.append(busReader.createbusinterfaceFrom(busElement));
+    });
+
+    parser.addItemHandler(QStringLiteral("ipxact:addressSpaces/ipxact:addressSpace"),
+        [&addressSpaces, &spaceReader](QDomElement const& spaceElement, int)
+    {
+        addressSpaces.append(spaceReader.createAddressSpaceFrom(spaceElement));
+    });
+
+    parser.addItemHandler(QStringLiteral("ipxact:memoryMaps/ipxact:memoryMap/ipxact:addressBlock"),
+        [&addressBlocks, &blockReader](QDomElement const& blockElement, int memoryMapIndex)
+    {
+        addressBlocks[memoryMapIndex].append(blockReader.createAddressBlockFrom(blockElement));
+    });
+
+    parser.addItemHandler(QStringLiteral("ipxact:model/ipxact:ports/ipxact:port"),
+        [&ports, &portReader](QDomElement const& portElement, int)
+    {
+        ports.append(portReader.createPortFrom(portElement));
+    });
+
+    parser.addItemHandler(QStringLiteral("ipxact:fileSets/ipxact:fileSet"),
+        [&fileSets, &setReader](QDomElement const& fileSetElement, int)
+    {
+        fileSets.append(setReader.createFileSetFrom(fileSetElement));
+    });
+
+    QDomDocument shellDocument;
+    if (parser.parse(device, shellDocument) == false)
+    {
+        return QSharedPointer<Component>();
+    }
+
+    QSharedPointer<Component> newComponent = ComponentReader::createComponentFrom(shellDocument);
+
+    insertStreamedItems(newComponent->getBusInterfaces(), busInterfaces);
+    insertStreamedItems(newComponent->getAddressSpaces(), addressSpaces);
+    insertStreamedItems(newComponent->getFileSets(), fileSets);
+
+    QSharedPointer<QList<QSharedPointer<MemoryMap> > > memoryMaps = newComponent->getMemoryMaps();
+    for (auto blocks = addressBlocks.cbegin(); blocks != addressBlocks.cend(); ++blocks)
+    {
+        if (blocks.key() < memoryMaps->size())
+        {
+            insertStreamedItems(memoryMaps->at(blocks.key())->getMemoryBlocks(), blocks.value());
+        }
+    }
+
+    if (ports.isEmpty() == false && newComponent->getModel())
+    {
+        insertStreamedItems(newComponent->getModel()->getPorts(), ports);
+    }
+
+    return newComponent;
+}
@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------------
+// File: ComponentStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming reader class for ipxact:component element.
+//-----------------------------------------------------------------------------
+
+#ifndef COMPONENTSTREAMREADER_H
+#define COMPONENTSTREAMREADER_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <IPXACTmodels/Component/ComponentReader.h>
+
+#include <QSharedPointer>
+
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Streaming reader class for ipxact:component element.
+//
+// Bus interfaces, address spaces, address blocks, ports and file sets are read one at a time from the
+// stream, so the whole document is never held in memory as a DOM tree.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT ComponentStreamReader : public ComponentReader
+{
+public:
+
+    //! The constructor.
+    ComponentStreamReader();
+
+    //! The destructor.
+    ~ComponentStreamReader();
+
+    using ComponentReader::createComponentFrom;
+
+    /*!
+     *  Creates a new component by reading the given device.
+     *
+     *      @param [in] device  The device containing the component XML.
+     *
+     *      @return The created component or null, if the XML could not be read.
+     */
+    QSharedPointer<Component> createComponentFrom(QIODevice* device) const;
+
+private:
+
+    //! No copying allowed.
+    ComponentStreamReader(ComponentStreamReader const& rhs);
+    ComponentStreamReader& operator=(ComponentStreamReader const& rhs);
+};
+
+#endif // COMPONENTSTREAMREADER_H
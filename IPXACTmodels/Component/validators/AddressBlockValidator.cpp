@@ -21,10 +21,13 @@
 #include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/Component/RegisterBase.h>
 #include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/RegisterFile.h>
 #include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/common/Parameter.h>
 
+#include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: AddressBlockValidator::AddressBlockValidator()
@@ -78,14 +81,22 @@ QSharedPointer<RegisterFileValidator> AddressBlockValidator::getRegisterFileVali
 bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits)
     const
 {
+    return validate(addressBlock, addressUnitBits, true);
+}
 
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::validate()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits,
+    bool validateRegisters) const
+{
     return  hasValidName(addressBlock) &&
             hasValidIsPresent(addressBlock) &&
             hasValidBaseAddress(addressBlock) &&
             hasValidRange(addressBlock) &&
             hasValidWidth(addressBlock) &&
             hasValidParameters(addressBlock) &&
-            hasValidRegisterData(addressBlock, addressUnitBits) &&
+            hasValidRegisterData(addressBlock, addressUnitBits, validateRegisters) &&
             hasValidUsage(addressBlock);
 }
 
@@ -192,25 +203,36 @@ bool AddressBlockValidator::hasValidParameters(QSharedPointer<AddressBlock> addr
 //-----------------------------------------------------------------------------
 bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock,
     QString const& addressUnitBits) const
+{
+    return hasValidRegisterData(addressBlock, addressUnitBits, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::hasValidRegisterData()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock,
+    QString const& addressUnitBits, bool validateRegisters) const
 {
     if (!addressBlock->getRegisterData()->isEmpty())
     {
-        QStringList registerNames;
+        QSet<QString> registerNames;
 
-        QStringList typeIdentifiers;
+        // The index of the first register with each type identifier.
+        QHash<QString, int> typeIdentifierIndexes;
         MemoryReserve reservedArea;
 
         bool aubChangeOk = true;
         qint64 aubInt = expressionParser_->parseExpression(addressUnitBits).toLongLong(&aubChangeOk);
         qint64 addressBlockRange = expressionParser_->parseExpression(addressBlock->getRange()).toLongLong();
 
-        foreach (QSharedPointer<RegisterBase> registerData, *addressBlock->getRegisterData())
+        for (int registerIndex = 0; registerIndex < addressBlock->getRegisterData()->size(); ++registerIndex)
         {
+            QSharedPointer<RegisterBase> registerData = addressBlock->getRegisterData()->at(registerIndex);
             QSharedPointer<Register> targetRegister = registerData.dynamicCast<Register>();
             if (targetRegister)
             {
                 if (registerNames.contains(targetRegister->name()) ||
-                    !registerValidator_->validate(targetRegister) ||
+                    (validateRegisters && !registerValidator_->validate(targetRegister)) ||
                     registerSizeIsNotWithinBlockWidth(targetRegister, addressBlock) ||
                     !hasValidVolatileForRegister(addressBlock, targetRegister) ||
                     !hasValidAccessWithRegister(addressBlock, targetRegister))
@@ -220,9 +242,9 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                 else
                 {
                     if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                        typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                        typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
                     {
-                        int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                        int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
                         if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock,
                             typeIdentifierIndex))
                         {
@@ -245,16 +267,23 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                         }
 
 
-                        if(targetRegister->getIsPresent().isEmpty() || expressionParser_->parseExpression(targetRegister->getIsPresent()).toInt())
+                        if (registerDataIsPresent(targetRegister))
                         {
-                          reservedArea.addArea(targetRegister->name(), registerBegin, registerEnd);
+                            reservedArea.addArea(targetRegister->name(), registerBegin, registerEnd);
                         }
                     }
 
-                    registerNames.append(targetRegister->name());
-                    typeIdentifiers.append(targetRegister->getTypeIdentifier());
+                    registerNames.insert(targetRegister->name());
+                    if (!typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
+                    {
+                        typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+                    }
                 }
             }
+            else if (aubChangeOk && aubInt != 0)
+            {
+                reserveRegisterFileArea(reservedArea, registerData.dynamicCast<RegisterFile>());
+            }
         }
 
         return !reservedArea.hasOverlap();
@@ -521,17 +550,20 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
 {
     if (!addressBlock->getRegisterData()->isEmpty())
     {
-        QStringList registerNames;
-        QStringList duplicateNames;
-        QStringList typeIdentifiers;
+        QSet<QString> registerNames;
+        QSet<QString> duplicateNames;
+
+        // The index of the first register with each type identifier.
+        QHash<QString, int> typeIdentifierIndexes;
 
         MemoryReserve reservedArea;
         bool aubChangeOk = true;
         qint64 aubInt = expressionParser_->parseExpression(addressUnitBits).toLongLong(&aubChangeOk);
         qint64 addressBlockRange = expressionParser_->parseExpression(addressBlock->getRange()).toLongLong();
 
-        foreach (QSharedPointer<RegisterBase> registerData, *addressBlock->getRegisterData())
+        for (int registerIndex = 0; registerIndex < addressBlock->getRegisterData()->size(); ++registerIndex)
         {
+            QSharedPointer<RegisterBase> registerData = addressBlock->getRegisterData()->at(registerIndex);
             QSharedPointer<Register> targetRegister = registerData.dynamicCast<Register>();
             if (targetRegister)
             {
@@ -540,11 +572,11 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                 {
                     errors.append(QObject::tr("Name %1 of registers in addressBlock %2 is not unique.")
                         .arg(targetRegister->name()).arg(addressBlock->name()));
-                    duplicateNames.append(targetRegister->name());
+                    duplicateNames.insert(targetRegister->name());
                 }
                 else
                 {
-                    registerNames.append(targetRegister->name());
+                    registerNames.insert(targetRegister->name());
                 }
 
                 registerValidator_->findErrorsIn(errors, targetRegister, context);
@@ -562,9 +594,9 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                 }
 
                 if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                    typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                    typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
                 {
-                    int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                    int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
 
                     if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock, typeIdentifierIndex))
                     {
@@ -572,7 +604,10 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                             "similar register definitions within %1").arg(context));
                     }
                 }
-                typeIdentifiers.append(targetRegister->getTypeIdentifier());
+                if (!typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
+                {
+                    typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+                }
 
                 if (!hasValidAccessWithRegister(addressBlock, targetRegister))
                 {
@@ -593,9 +628,9 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
 
                     qint64 registerEnd = registerBegin + registerSize - 1;
 
-                    if(targetRegister->getIsPresent().isEmpty() || expressionParser_->parseExpression(targetRegister->getIsPresent()).toInt())
+                    if (registerDataIsPresent(targetRegister))
                     {
-                      reservedArea.addArea(targetRegister->name(), registerBegin, registerEnd);
+                        reservedArea.addArea(targetRegister->name(), registerBegin, registerEnd);
                     }
 
                     if ( registerBegin < 0 || registerBegin + registerSize > addressBlockRange)
@@ -605,6 +640,10 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                     }
                 }
             }
+            else if (aubChangeOk && aubInt != 0)
+            {
+                reserveRegisterFileArea(reservedArea, registerData.dynamicCast<RegisterFile>());
+            }
         }
 
         reservedArea.findErrorsInOverlap(errors, QLatin1String("Registers"), context);
@@ -632,3 +671,34 @@ qint64 AddressBlockValidator::getRegisterSizeInLAU(QSharedPointer<Register> targ
 
     return trueSize;}
 
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::reserveRegisterFileArea()
+//-----------------------------------------------------------------------------
+void AddressBlockValidator::reserveRegisterFileArea(MemoryReserve& reservedArea,
+    QSharedPointer<RegisterFile> targetRegisterFile) const
+{
+    if (targetRegisterFile && registerDataIsPresent(targetRegisterFile))
+    {
+        qint64 range = expressionParser_->parseExpression(targetRegisterFile->getRange()).toLongLong();
+        qint64 dimension = expressionParser_->parseExpression(targetRegisterFile->getDimension()).toLongLong();
+        if (dimension == 0)
+        {
+            dimension = 1;
+        }
+
+        qint64 registerFileBegin =
+            expressionParser_->parseExpression(targetRegisterFile->getAddressOffset()).toLongLong();
+
+        reservedArea.addArea(targetRegisterFile->name(), registerFileBegin, registerFileBegin + range * dimension - 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::registerDataIsPresent()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::registerDataIsPresent(QSharedPointer<RegisterBase> registerData) const
+{
+    return registerData->getIsPresent().isEmpty() ||
+        expressionParser_->parseExpression(registerData->getIsPresent()).toInt();
+}
+
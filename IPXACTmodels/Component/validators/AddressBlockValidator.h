@@ -20,6 +20,9 @@
 class ExpressionParser;
 class AddressBlock;
 class Register;
+class RegisterBase;
+class RegisterFile;
+class MemoryReserve;
 class ResetType;
 
 class RegisterValidator;
@@ -78,6 +81,20 @@ public:
      */
     bool validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits) const;
 
+    /*!
+     *  Validates the given address block, optionally without validating each register on its own. The placement
+     *  of the registers within the block is checked in both cases. Used when the validity of the registers is
+     *  known.
+     *
+     *      @param [in] addressBlock        The address block to validate.
+     *      @param [in] addressUnitBits     The address unit bits of a memory map.
+     *      @param [in] validateRegisters   If true, the registers are validated, otherwise only their placement.
+     *
+     *      @return True, if the address block is valid IP-XACT, otherwise false.
+     */
+    bool validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits,
+        bool validateRegisters) const;
+
     /*!
      *  Check if the address block contains a valid name.
      *
@@ -142,6 +159,19 @@ public:
      */
     bool hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits) const;
 
+    /*!
+     *  Check if the address block contains valid register data, optionally without validating each register on
+     *  its own.
+     *
+     *      @param [in] addressBlock        The selected address block.
+     *      @param [in] addressUnitBits     The address unit bits of a memory map.
+     *      @param [in] validateRegisters   If true, the registers are validated, otherwise only their placement.
+     *
+     *      @return True, if the register data is valid, otherwise false.
+     */
+    bool hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits,
+        bool validateRegisters) const;
+
     /*!
      *  Check if the register size is not within address block width.
      *
@@ -223,6 +253,25 @@ private:
      */
     qint64 getRegisterSizeInLAU(QSharedPointer<Register> targetRegister, int addressUnitBits) const;
 
+    /*!
+     *  Reserves the addresses of a register file and all its dimensions, so that the registers overlapping it
+     *  are found.
+     *
+     *      @param [in] reservedArea        The addresses reserved within the address block.
+     *      @param [in] targetRegisterFile  The selected register file, or null for other register data.
+     */
+    void reserveRegisterFileArea(MemoryReserve& reservedArea, QSharedPointer<RegisterFile> targetRegisterFile)
+        const;
+
+    /*!
+     *  Check if a register or a register file is present.
+     *
+     *      @param [in] registerData    The selected register or register file.
+     *
+     *      @return True, if the register data is present, otherwise false.
+     */
+    bool registerDataIsPresent(QSharedPointer<RegisterBase> registerData) const;
+
     /*!
      *  Find errors within a name.
      *
@@ -11,6 +11,7 @@
 
 #include "AddressSpaceValidator.h"
 
+#include <editors/ComponentEditor/common/BigInteger.h>
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 
 #include <IPXACTmodels/Component/validators/MemoryReserve.h>
@@ -390,13 +391,18 @@ void AddressSpaceValidator::findErrorsInSegments(QVector<QString>& errors,
                     .arg(segment->name()).arg(context));
             }
 
-            qint64 segmentBegin = expressionParser_->parseExpression(segment->getAddressOffset()).toLongLong();
-            qint64 segmentRange = expressionParser_->parseExpression(segment->getRange()).toLongLong();
+            QString segmentOffsetValue = expressionParser_->parseExpression(segment->getAddressOffset());
+            QString segmentRangeValue = expressionParser_->parseExpression(segment->getRange());
+
+            qint64 segmentBegin = segmentOffsetValue.toLongLong();
+            qint64 segmentRange = segmentRangeValue.toLongLong();
             qint64 segmentEnd = segmentBegin + segmentRange - 1;
 
             reservedArea.addArea(segment->name(), segmentBegin, segmentEnd);
 
-            if (segmentEnd > addressSpaceRange)
+            // Values wider than 64 bits are valid expressions, but always outside the address space.
+            if (BigInteger::isWiderThan64Bits(segmentOffsetValue) ||
+                BigInteger::isWiderThan64Bits(segmentRangeValue) || segmentEnd > addressSpaceRange)
             {
                 errors.append(QObject::tr("Segment %1 is not contained within %2")
                     .arg(segment->name()).arg(context));
@@ -58,13 +58,105 @@
 #include <IPXACTmodels/common/Parameter.h>
 #include <IPXACTmodels/common/Assertion.h>
 
+#include <QAtomicInt>
+#include <QFuture>
+#include <QHash>
+#include <QPair>
 #include <QRegularExpression>
+#include <QThread>
+#include <QtConcurrent/QtConcurrentRun>
+
+namespace
+{
+    //! The smallest number of ports validated in a parallel task of their own.
+    const int PORTS_PER_TASK = 256;
+
+    //! The smallest number of memory maps validated in a parallel task of their own.
+    const int MEMORY_MAPS_PER_TASK = 1;
+
+    /*!
+     *  Splits a list of items into ranges for the parallel validation tasks.
+     *
+     *      @param [in] itemCount       The number of items in the list.
+     *      @param [in] minimumSize     The smallest number of items in a range.
+     *
+     *      @return The first index and the number of items of each range in the list order.
+     */
+    QVector<QPair<int, int> > splitIntoRanges(int itemCount, int minimumSize)
+    {
+        int rangeCount = qBound(1, itemCount / minimumSize, qMax(1, QThread::idealThreadCount()));
+
+        QVector<QPair<int, int> > ranges;
+        for (int i = 0; i < rangeCount; ++i)
+        {
+            int firstIndex = itemCount * i / rangeCount;
+            int nextIndex = itemCount * (i + 1) / rangeCount;
+            ranges.append(qMakePair(firstIndex, nextIndex - firstIndex));
+        }
+
+        return ranges;
+    }
+
+    //! The sections of a component in the validation order.
+    enum ComponentSection
+    {
+        SECTION_VLNV = 0,
+        SECTION_BUS_INTERFACES,
+        SECTION_INDIRECT_INTERFACES,
+        SECTION_CHANNELS,
+        SECTION_REMAP_STATES,
+        SECTION_ADDRESS_SPACES,
+        SECTION_MEMORY_MAPS,
+        SECTION_VIEWS,
+        SECTION_COMPONENT_INSTANTIATIONS,
+        SECTION_DESIGN_INSTANTIATIONS,
+        SECTION_DESIGN_CONFIGURATION_INSTANTIATIONS,
+        SECTION_PORTS,
+        SECTION_COMPONENT_GENERATORS,
+        SECTION_CHOICES,
+        SECTION_FILE_SETS,
+        SECTION_CPUS,
+        SECTION_OTHER_CLOCK_DRIVERS,
+        SECTION_RESET_TYPES,
+        SECTION_PARAMETERS,
+        SECTION_ASSERTIONS,
+        SECTION_COUNT
+    };
+
+    //! The element names of the component sections in the order of ComponentSection.
+    const char* const SECTION_NAMES[SECTION_COUNT] =
+    {
+        "vlnv",
+        "busInterfaces",
+        "indirectInterfaces",
+        "channels",
+        "remapStates",
+        "addressSpaces",
+        "memoryMaps",
+        "views",
+        "componentInstantiations",
+        "designInstantiations",
+        "designConfigurationInstantiations",
+        "ports",
+        "componentGenerators",
+        "choices",
+        "fileSets",
+        "cpus",
+        "otherClockDrivers",
+        "resetTypes",
+        "parameters",
+        "assertions"
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: ComponentValidator::ComponentValidator()
 //-----------------------------------------------------------------------------
 ComponentValidator::ComponentValidator(QSharedPointer<ExpressionParser> parser, LibraryInterface* library):
 component_(),
+library_(library),
+parserFactory_(),
+taskValidators_(),
 busInterfaceValidator_(),
 indirectInterfaceValidator_(),
 channelValidator_(),
@@ -154,6 +246,23 @@ ComponentValidator::~ComponentValidator()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::setParallelValidation()
+//-----------------------------------------------------------------------------
+void ComponentValidator::setParallelValidation(ParserFactory const& parserFactory)
+{
+    parserFactory_ = parserFactory;
+    taskValidators_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::isParallelValidationEnabled()
+//-----------------------------------------------------------------------------
+bool ComponentValidator::isParallelValidationEnabled() const
+{
+    return static_cast<bool>(parserFactory_);
+}
+
 //-----------------------------------------------------------------------------
 // Function: OtherClockDriverValidator::validate()
 //-----------------------------------------------------------------------------
@@ -695,31 +804,190 @@ bool ComponentValidator::hasValidAssertions(QSharedPointer<Component> component)
 // Function: ComponentValidator::findErrorsIn()
 //-----------------------------------------------------------------------------
 void ComponentValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component)
+{
+    for (QVector<QString> const& sectionErrors : findErrorsInSections(component))
+    {
+        errors += sectionErrors;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::findDiagnosticsIn()
+//-----------------------------------------------------------------------------
+void ComponentValidator::findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics,
+    QSharedPointer<Component> component)
+{
+    QVector<QVector<QString> > sectionErrors = findErrorsInSections(component);
+
+    QString componentPath = component->getVlnv().toString();
+    for (int section = 0; section < SECTION_COUNT; ++section)
+    {
+        QString sectionPath = componentPath;
+        if (section != SECTION_VLNV)
+        {
+            sectionPath += QLatin1Char('/') + QLatin1String(SECTION_NAMES[section]);
+        }
+
+        // The sections report only the problems failing their validity checks, so each message is an error.
+        ValidationDiagnostic::appendMessages(diagnostics, sectionErrors.at(section), sectionPath,
+            ValidationDiagnostic::SEVERITY_ERROR);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::findErrorsInSections()
+//-----------------------------------------------------------------------------
+QVector<QVector<QString> > ComponentValidator::findErrorsInSections(QSharedPointer<Component> component)
 {
     changeComponent(component);
 
     QString context = QObject::tr("component %1").arg(component->getVlnv().toString());
+    bool parallel = isParallelValidationEnabled();
+
+    typedef void (ComponentValidator::*Section)(QVector<QString>&, QSharedPointer<Component>, QString const&) const;
+    typedef void (ComponentValidator::*SectionRange)(QVector<QString>&, QSharedPointer<Component>, QString const&,
+        int, int) const;
+    typedef std::function<void(ComponentValidator const&, QVector<QString>&)> ValidationTask;
+
+    // The tasks are listed in the section order and each task collects its errors separately. Merging the errors
+    // in the task order keeps the result independent of the scheduling.
+    QVector<ValidationTask> tasks;
+    QVector<int> taskSections;
+    auto addSection = [&tasks, &taskSections, component, &context](int section, Section findErrors)
+    {
+        tasks.append([findErrors, component, &context](ComponentValidator const& validator,
+            QVector<QString>& taskErrors)
+        {
+            (validator.*findErrors)(taskErrors, component, context);
+        });
+        taskSections.append(section);
+    };
+
+    // Large sections are split into ranges validated in parallel tasks of their own.
+    auto addRanges = [&tasks, &taskSections, component, &context](int section, int itemCount, int minimumSize,
+        SectionRange findErrors)
+    {
+        for (QPair<int, int> const& range : splitIntoRanges(itemCount, minimumSize))
+        {
+            tasks.append([findErrors, component, &context, range](ComponentValidator const& validator,
+                QVector<QString>& taskErrors)
+            {
+                (validator.*findErrors)(taskErrors, component, context, range.first, range.second);
+            });
+            taskSections.append(section);
+        }
+    };
+
+    tasks.append([component](ComponentValidator const& validator, QVector<QString>& taskErrors)
+    {
+        validator.findErrorsInVLNV(taskErrors, component);
+    });
+    taskSections.append(SECTION_VLNV);
 
-    findErrorsInVLNV(errors, component);
-    findErrorsInBusInterface(errors, component, context);
-    findErrorsInIndirectInterfaces(errors, component, context);
-    findErrorsInChannels(errors, component, context);
-    findErrorsInRemapStates(errors, component, context);
-    findErrorsInAddressSpaces(errors, component, context);
-    findErrorsInMemoryMaps(errors, component, context);
-    findErrorsInViews(errors, component, context);
-    findErrorsInComponentInstantiations(errors, component, context);
-    findErrorsInDesignInstantiations(errors, component, context);
-    findErrorsInDesignConfigurationInstantiations(errors, component, context);
-    findErrorsInPorts(errors, component, context);
-    findErrorsInComponentGenerators(errors, component, context);
-    findErrorsInChoices(errors, component, context);
-    findErrorsInFileSets(errors, component, context);
-    findErrorsInCPUs(errors, component, context);
-    findErrorsInOtherClockDrivers(errors, component, context);
-    findErrorsInResetTypes(errors, component, context);
-    findErrorsInParameters(errors, component, context);
-    findErrorsInAssertions(errors, component, context);
+    addSection(SECTION_BUS_INTERFACES, &ComponentValidator::findErrorsInBusInterface);
+    addSection(SECTION_INDIRECT_INTERFACES, &ComponentValidator::findErrorsInIndirectInterfaces);
+    addSection(SECTION_CHANNELS, &ComponentValidator::findErrorsInChannels);
+    addSection(SECTION_REMAP_STATES, &ComponentValidator::findErrorsInRemapStates);
+    addSection(SECTION_ADDRESS_SPACES, &ComponentValidator::findErrorsInAddressSpaces);
+
+    if (parallel)
+    {
+        addRanges(SECTION_MEMORY_MAPS, component->getMemoryMaps()->count(), MEMORY_MAPS_PER_TASK,
+            &ComponentValidator::findErrorsInMemoryMapRange);
+    }
+    else
+    {
+        addSection(SECTION_MEMORY_MAPS, &ComponentValidator::findErrorsInMemoryMaps);
+    }
+
+    addSection(SECTION_VIEWS, &ComponentValidator::findErrorsInViews);
+    addSection(SECTION_COMPONENT_INSTANTIATIONS, &ComponentValidator::findErrorsInComponentInstantiations);
+    addSection(SECTION_DESIGN_INSTANTIATIONS, &ComponentValidator::findErrorsInDesignInstantiations);
+    addSection(SECTION_DESIGN_CONFIGURATION_INSTANTIATIONS,
+        &ComponentValidator::findErrorsInDesignConfigurationInstantiations);
+
+    if (parallel)
+    {
+        addRanges(SECTION_PORTS, component->getPorts()->count(), PORTS_PER_TASK,
+            &ComponentValidator::findErrorsInPortRange);
+    }
+    else
+    {
+        addSection(SECTION_PORTS, &ComponentValidator::findErrorsInPorts);
+    }
+
+    addSection(SECTION_COMPONENT_GENERATORS, &ComponentValidator::findErrorsInComponentGenerators);
+    addSection(SECTION_CHOICES, &ComponentValidator::findErrorsInChoices);
+    addSection(SECTION_FILE_SETS, &ComponentValidator::findErrorsInFileSets);
+    addSection(SECTION_CPUS, &ComponentValidator::findErrorsInCPUs);
+    addSection(SECTION_OTHER_CLOCK_DRIVERS, &ComponentValidator::findErrorsInOtherClockDrivers);
+    addSection(SECTION_RESET_TYPES, &ComponentValidator::findErrorsInResetTypes);
+    addSection(SECTION_PARAMETERS, &ComponentValidator::findErrorsInParameters);
+    addSection(SECTION_ASSERTIONS, &ComponentValidator::findErrorsInAssertions);
+
+    QVector<QVector<QString> > taskErrors(tasks.count());
+    if (parallel)
+    {
+        runInParallel(tasks, taskErrors, component);
+    }
+    else
+    {
+        for (int i = 0; i < tasks.count(); ++i)
+        {
+            tasks.at(i)(*this, taskErrors[i]);
+        }
+    }
+
+    QVector<QVector<QString> > sectionErrors(SECTION_COUNT);
+    for (int i = 0; i < tasks.count(); ++i)
+    {
+        sectionErrors[taskSections.at(i)] += taskErrors.at(i);
+    }
+
+    return sectionErrors;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::runInParallel()
+//-----------------------------------------------------------------------------
+void ComponentValidator::runInParallel(QVector<ValidationTask> const& tasks, QVector<QVector<QString> >& taskErrors,
+    QSharedPointer<Component> component) const
+{
+    // Workers pick the next task until all are done. Each task writes to its own slot, so no locking is needed.
+    QAtomicInt nextIndex(0);
+    auto worker = [&tasks, &taskErrors, &nextIndex](ComponentValidator const& validator)
+    {
+        for (int i = nextIndex.fetchAndAddRelaxed(1); i < tasks.count(); i = nextIndex.fetchAndAddRelaxed(1))
+        {
+            tasks.at(i)(validator, taskErrors[i]);
+        }
+    };
+
+    // The calling thread works on the tasks as well, so the validation proceeds even if the pool is busy.
+    int workerCount = qBound(1, QThread::idealThreadCount(), tasks.count());
+
+    // The parsers cache the evaluated values without locking, so each pooled worker has its own parser and
+    // validators. They are created once and reused for the following components.
+    while (taskValidators_.count() < workerCount - 1)
+    {
+        taskValidators_.append(QSharedPointer<ComponentValidator>(new ComponentValidator(parserFactory_(), library_)));
+    }
+
+    QVector<QFuture<void> > workers;
+    for (int i = 1; i < workerCount; ++i)
+    {
+        QSharedPointer<ComponentValidator> validator = taskValidators_.at(i - 1);
+        validator->changeComponent(component);
+
+        workers.append(QtConcurrent::run([worker, validator]() { worker(*validator); }));
+    }
+
+    worker(*this);
+
+    for (QFuture<void>& pooledWorker : workers)
+    {
+        pooledWorker.waitForFinished();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -758,7 +1026,8 @@ void ComponentValidator::findErrorsInBusInterface(QVector<QString>& errors, QSha
 //-----------------------------------------------------------------------------
 // Function: ComponentValidator::findErrorsInIndirectInterfaces()
 //-----------------------------------------------------------------------------
-void ComponentValidator::findErrorsInIndirectInterfaces(QVector<QString>& errors, QSharedPointer<Component> component, QString const& context)
+void ComponentValidator::findErrorsInIndirectInterfaces(QVector<QString>& errors,
+    QSharedPointer<Component> component, QString const& context) const
 {
     QVector<QString> interfaceNames;
     QVector<QString> duplicateNames;
@@ -872,22 +1141,34 @@ void ComponentValidator::findErrorsInAddressSpaces(QVector<QString>& errors, QSh
 void ComponentValidator::findErrorsInMemoryMaps(QVector<QString>& errors, QSharedPointer<Component> component,
     QString const& context) const
 {
-    if (!component->getMemoryMaps()->isEmpty())
+    findErrorsInMemoryMapRange(errors, component, context, 0, component->getMemoryMaps()->count());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::findErrorsInMemoryMapRange()
+//-----------------------------------------------------------------------------
+void ComponentValidator::findErrorsInMemoryMapRange(QVector<QString>& errors, QSharedPointer<Component> component,
+    QString const& context, int firstIndex, int count) const
+{
+    QList<QSharedPointer<MemoryMap> > const& memoryMaps = *component->getMemoryMaps();
+
+    // A repeated name is reported at its second occurrence, so the names before the range are counted first.
+    QHash<QString, int> nameCounts;
+    for (int i = 0; i < firstIndex; ++i)
     {
-        QVector<QString> mapNames;
-        QVector<QString> duplicateNames;
-        foreach (QSharedPointer<MemoryMap> memoryMap, *component->getMemoryMaps())
-        {
-            if (mapNames.contains(memoryMap->name()) && !duplicateNames.contains(memoryMap->name()))
-            {
-                errors.append(QObject::tr("Memory map name %1 within %2 is not unique.")
-                    .arg(memoryMap->name()).arg(context));
-                duplicateNames.append(memoryMap->name());
-            }
+        nameCounts[memoryMaps.at(i)->name()]++;
+    }
 
-            mapNames.append(memoryMap->name());
-            memoryMapValidator_->findErrorsIn(errors, memoryMap, context);
+    for (int i = firstIndex; i < firstIndex + count; ++i)
+    {
+        QSharedPointer<MemoryMap> memoryMap = memoryMaps.at(i);
+        if (++nameCounts[memoryMap->name()] == 2)
+        {
+            errors.append(QObject::tr("Memory map name %1 within %2 is not unique.")
+                .arg(memoryMap->name()).arg(context));
         }
+
+        memoryMapValidator_->findErrorsIn(errors, memoryMap, context);
     }
 }
 
@@ -1000,21 +1281,33 @@ void ComponentValidator::findErrorsInDesignConfigurationInstantiations(QVector<Q
 void ComponentValidator::findErrorsInPorts(QVector<QString>& errors, QSharedPointer<Component> component,
     QString const& context) const
 {
-    if (!component->getPorts()->isEmpty())
+    findErrorsInPortRange(errors, component, context, 0, component->getPorts()->count());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::findErrorsInPortRange()
+//-----------------------------------------------------------------------------
+void ComponentValidator::findErrorsInPortRange(QVector<QString>& errors, QSharedPointer<Component> component,
+    QString const& context, int firstIndex, int count) const
+{
+    QList<QSharedPointer<Port> > const& ports = *component->getPorts();
+
+    // A repeated name is reported at its second occurrence, so the names before the range are counted first.
+    QHash<QString, int> nameCounts;
+    for (int i = 0; i < firstIndex; ++i)
     {
-        QVector<QString> portNames;
-        QVector<QString> duplicateNames;
-        foreach (QSharedPointer<Port> port, *component->getPorts())
-        {
-            if (portNames.contains(port->name()) && !duplicateNames.contains(port->name()))
-            {
-                errors.append(QObject::tr("Port name %1 within %2 is not unique.").arg(port->name()).arg(context));
-                duplicateNames.append(port->name());
-            }
+        nameCounts[ports.at(i)->name()]++;
+    }
 
-            portNames.append(port->name());
-            portValidator_->findErrorsIn(errors, port, context);
+    for (int i = firstIndex; i < firstIndex + count; ++i)
+    {
+        QSharedPointer<Port> port = ports.at(i);
+        if (++nameCounts[port->name()] == 2)
+        {
+            errors.append(QObject::tr("Port name %1 within %2 is not unique.").arg(port->name()).arg(context));
         }
+
+        portValidator_->findErrorsIn(errors, port, context);
     }
 }
 
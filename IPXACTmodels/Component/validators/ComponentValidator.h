@@ -14,10 +14,14 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <IPXACTmodels/common/validators/ValidationDiagnostic.h>
+
 #include <QSharedPointer>
 #include <QString>
 #include <QVector>
 
+#include <functional>
+
 class Component;
 class ResetType;
 
@@ -58,6 +62,25 @@ public:
 
 	//! The destructor.
 	~ComponentValidator();
+
+    //! Creates an expression parser for a validation task run in parallel with other tasks.
+    typedef std::function<QSharedPointer<ExpressionParser>()> ParserFactory;
+
+    /*!
+     *  Sets the sections of a component to be validated in parallel when locating errors. The parsers keep the
+     *  evaluated values in a cache without locking, so each parallel task uses its own parser and validators.
+     *
+     *      @param [in] parserFactory   Creates the parsers for the parallel tasks. An empty factory sets the
+     *                                  sections to be validated in sequence.
+     */
+    void setParallelValidation(ParserFactory const& parserFactory);
+
+    /*!
+     *  Checks if the sections of a component are validated in parallel when locating errors.
+     *
+     *      @return True, if the sections are validated in parallel, otherwise false.
+     */
+    bool isParallelValidationEnabled() const;
     
     /*!
      *  Validates the given component.
@@ -267,12 +290,44 @@ public:
      */
     void findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component);
 
+    /*!
+     *  Locate the problems within a component in a single pass. Each problem is reported with the path of the
+     *  component section containing it. The problems fail the validation, so they are reported as errors.
+     *
+     *      @param [in] diagnostics     List of found problems.
+     *      @param [in] component       The selected component.
+     */
+    void findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics, QSharedPointer<Component> component);
+
 private:
 
 	// Disable copying.
 	ComponentValidator(ComponentValidator const& rhs);
 	ComponentValidator& operator=(ComponentValidator const& rhs);
 
+    //! Finds the errors in a part of a component section using the given validator.
+    typedef std::function<void(ComponentValidator const&, QVector<QString>&)> ValidationTask;
+
+    /*!
+     *  Locate errors within the sections of a component. The sections are validated in parallel tasks, if
+     *  enabled, and the errors are listed in the same order as when the sections are validated in sequence.
+     *
+     *      @param [in] component   The selected component.
+     *
+     *      @return The errors found in each section in the validation order.
+     */
+    QVector<QVector<QString> > findErrorsInSections(QSharedPointer<Component> component);
+
+    /*!
+     *  Runs the given validation tasks in parallel. The calling thread runs the tasks with this validator.
+     *
+     *      @param [in] tasks           The tasks to run.
+     *      @param [out] taskErrors     The errors found by each task.
+     *      @param [in] component       The validated component.
+     */
+    void runInParallel(QVector<ValidationTask> const& tasks, QVector<QVector<QString> >& taskErrors,
+        QSharedPointer<Component> component) const;
+
     /*!
      *  Find errors in component VLNV.
      *
@@ -298,7 +353,8 @@ private:
      *      @param [in] component   The selected component.
      *      @param [in] context     Context to help locate the error.
      */
-    void findErrorsInIndirectInterfaces(QVector<QString>& errors, QSharedPointer<Component> component, QString const& context);
+    void findErrorsInIndirectInterfaces(QVector<QString>& errors, QSharedPointer<Component> component,
+        QString const& context) const;
 
     /*!
      *  Find errors in channels.
@@ -340,6 +396,18 @@ private:
     void findErrorsInMemoryMaps(QVector<QString>& errors, QSharedPointer<Component> component,
         QString const& context) const;
 
+    /*!
+     *  Find errors in a range of memory maps.
+     *
+     *      @param [in] errors      List of found errors.
+     *      @param [in] component   The selected component.
+     *      @param [in] context     Context to help locate the error.
+     *      @param [in] firstIndex  Index of the first memory map in the range.
+     *      @param [in] count       The number of memory maps in the range.
+     */
+    void findErrorsInMemoryMapRange(QVector<QString>& errors, QSharedPointer<Component> component,
+        QString const& context, int firstIndex, int count) const;
+
     /*!
      *  Find errors in views.
      *
@@ -390,6 +458,18 @@ private:
     void findErrorsInPorts(QVector<QString>& errors, QSharedPointer<Component> component, QString const& context)
         const;
 
+    /*!
+     *  Find errors in a range of ports.
+     *
+     *      @param [in] errors      List of found errors.
+     *      @param [in] component   The selected component.
+     *      @param [in] context     Context to help locate the error.
+     *      @param [in] firstIndex  Index of the first port in the range.
+     *      @param [in] count       The number of ports in the range.
+     */
+    void findErrorsInPortRange(QVector<QString>& errors, QSharedPointer<Component> component,
+        QString const& context, int firstIndex, int count) const;
+
     /*!
      *  Find errors in component generators.
      *
@@ -484,6 +564,15 @@ private:
     //! The last validated component.
     QSharedPointer<Component> component_;
 
+    //! The used library interface.
+    LibraryInterface* library_;
+
+    //! Creates the parsers for the parallel validation tasks. Empty, if the sections are validated in sequence.
+    ParserFactory parserFactory_;
+
+    //! The validators of the pooled workers in the parallel validation, reused for each validated component.
+    mutable QVector<QSharedPointer<ComponentValidator> > taskValidators_;
+
     //! The used bus interface validator.
     QSharedPointer<BusInterfaceValidator> busInterfaceValidator_;
 
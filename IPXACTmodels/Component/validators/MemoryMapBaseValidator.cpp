@@ -20,6 +20,49 @@
 #include <IPXACTmodels/Component/AddressBlock.h>
 
 #include <QRegularExpression>
+#include <QSet>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    //! The addresses of an address block.
+    struct BlockArea
+    {
+        //! The index of the block in the memory map.
+        int blockIndex;
+
+        //! The first address of the block.
+        quint64 begin;
+
+        //! The last address of the block.
+        quint64 end;
+    };
+
+    //! Orders the block areas by their first address.
+    bool beginsBefore(BlockArea const& first, BlockArea const& second)
+    {
+        return first.begin < second.begin || (first.begin == second.begin && first.blockIndex < second.blockIndex);
+    }
+
+    //! Checks if an address is within a block area.
+    bool containsAddress(BlockArea const& area, quint64 address)
+    {
+        return address >= area.begin && address <= area.end;
+    }
+
+    //! Finds the last address of a block. Blocks reaching past the 64-bit address space end at its last address.
+    quint64 lastAddress(quint64 begin, quint64 range)
+    {
+        if (range - 1 > std::numeric_limits<quint64>::max() - begin)
+        {
+            return std::numeric_limits<quint64>::max();
+        }
+
+        return begin + range - 1;
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseValidator::MemoryMapBaseValidator()
@@ -61,9 +104,18 @@ QSharedPointer<AddressBlockValidator> MemoryMapBaseValidator::getAddressBlockVal
 //-----------------------------------------------------------------------------
 bool MemoryMapBaseValidator::validate(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits)
     const
+{
+    return validate(memoryMapBase, addressUnitBits, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::validate()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::validate(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits,
+    bool validateAddressBlocks) const
 {
     return hasValidName(memoryMapBase) && hasValidIsPresent(memoryMapBase) &&
-        hasValidMemoryBlocks(memoryMapBase, addressUnitBits);
+        hasValidMemoryBlocks(memoryMapBase, addressUnitBits, validateAddressBlocks);
 }
 
 //-----------------------------------------------------------------------------
@@ -109,36 +161,36 @@ bool MemoryMapBaseValidator::hasValidIsPresent(QSharedPointer<MemoryMapBase> mem
 //-----------------------------------------------------------------------------
 bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase,
     QString const& addressUnitBits) const
+{
+    return hasValidMemoryBlocks(memoryMapBase, addressUnitBits, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::hasValidMemoryBlocks()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase,
+    QString const& addressUnitBits, bool validateAddressBlocks) const
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList addressBlockNames;
-        for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
+        QSet<QString> addressBlockNames;
+        foreach (QSharedPointer<MemoryBlockBase> blockData, *memoryMapBase->getMemoryBlocks())
         {
-            QSharedPointer<MemoryBlockBase> blockData = memoryMapBase->getMemoryBlocks()->at(blockIndex);
             QSharedPointer<AddressBlock> addressBlock = blockData.dynamicCast<AddressBlock>();
             if (addressBlock)
             {
                 if (addressBlockNames.contains(addressBlock->name()) ||
-                    !addressBlockValidator_->validate(addressBlock, addressUnitBits))
+                    (validateAddressBlocks && !addressBlockValidator_->validate(addressBlock, addressUnitBits)) ||
+                    !addressBlockWidthIsMultiplicationOfAUB(addressUnitBits, addressBlock))
                 {
                     return false;
                 }
-                else
-                {
-                    addressBlockNames.append(addressBlock->name());
-
-                    if (addressBlockOverlaps(addressBlock, memoryMapBase, blockIndex))
-                    {
-                        return false;
-                    }
-                    if (!addressBlockWidthIsMultiplicationOfAUB(addressUnitBits, addressBlock))
-                    {
-                        return false;
-                    }
-                }
+
+                addressBlockNames.insert(addressBlock->name());
             }
         }
+
+        return findOverlappingBlocks(memoryMapBase, true).isEmpty();
     }
 
     return true;
@@ -165,54 +217,100 @@ bool MemoryMapBaseValidator::addressBlockWidthIsMultiplicationOfAUB(QString cons
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::addressBlockOverlap()
+// Function: MemoryMapBaseValidator::findOverlappingBlocks()
 //-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::addressBlockOverlaps(QSharedPointer<AddressBlock> addressBlock,
-    QSharedPointer<MemoryMapBase> memoryMapBase, int addressBlockIndex) const
+QVector<QPair<int, int> > MemoryMapBaseValidator::findOverlappingBlocks(
+    QSharedPointer<MemoryMapBase> memoryMapBase, bool firstOnly) const
 {
-    for (int blockIndex = addressBlockIndex + 1; blockIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++blockIndex)
+    // Blocks with a non-positive range have their last address before the first. They overlap a block containing
+    // either of the addresses, and are compared separately with all the other blocks.
+    QVector<BlockArea> areas;
+    QVector<BlockArea> emptyAreas;
+
+    QSharedPointer<QList<QSharedPointer<MemoryBlockBase> > > memoryBlocks = memoryMapBase->getMemoryBlocks();
+    for (int blockIndex = 0; blockIndex < memoryBlocks->size(); ++blockIndex)
     {
-        QSharedPointer<MemoryBlockBase> blockData = memoryMapBase->getMemoryBlocks()->at(blockIndex);
-        QSharedPointer<AddressBlock> comparedBlock = blockData.dynamicCast<AddressBlock>();
-        if (comparedBlock)
+        QSharedPointer<AddressBlock> addressBlock = memoryBlocks->at(blockIndex).dynamicCast<AddressBlock>();
+        if (addressBlock && (addressBlock->getIsPresent().isEmpty() ||
+            expressionParser_->parseExpression(addressBlock->getIsPresent()).toInt()))
         {
-            if (twoAddressBlocksOverlap(addressBlock, comparedBlock))
+            // Blocks with a base address not fitting in 64 bits are reported by the address block validator.
+            BlockArea area;
+            area.blockIndex = blockIndex;
+
+            bool baseAddressOk = false;
+            area.begin = expressionParser_->parseExpression(addressBlock->getBaseAddress()).toULongLong(&baseAddressOk);
+            if (baseAddressOk == false)
             {
-                return true;
+                continue;
+            }
+
+            QString rangeValue = expressionParser_->parseExpression(addressBlock->getRange());
+
+            bool rangeOk = false;
+            quint64 range = rangeValue.toULongLong(&rangeOk);
+            if (rangeOk && range > 0)
+            {
+                area.end = lastAddress(area.begin, range);
+                areas.append(area);
+            }
+            else
+            {
+                // The last address is the base address added with the range and decreased by one. Without a
+                // last address within the address space, only the base address is compared.
+                quint64 distance = 1 - static_cast<quint64>(rangeValue.toLongLong());
+                area.end = distance <= area.begin ? area.begin - distance : area.begin;
+                emptyAreas.append(area);
             }
         }
     }
 
-    return false;
-}
+    std::sort(areas.begin(), areas.end(), beginsBefore);
 
-//-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::twoAddressBlocksOverlap()
-//-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::twoAddressBlocksOverlap(QSharedPointer<AddressBlock> addressBlock,
-    QSharedPointer<AddressBlock> comparedBlock) const
-{
-    int blockBegin    = expressionParser_->parseExpression(addressBlock->getBaseAddress()).toInt();
-    int blockEnd      = blockBegin + expressionParser_->parseExpression(addressBlock->getRange()).toInt() - 1;
-    bool blockPresent = addressBlock->getIsPresent().isEmpty() || expressionParser_->parseExpression(addressBlock->getIsPresent()).toInt();
-
-
-    int compareBegin    = expressionParser_->parseExpression(comparedBlock->getBaseAddress()).toInt();
-    int compareEnd      = compareBegin + expressionParser_->parseExpression(comparedBlock->getRange()).toInt() - 1;
-    bool comparedPresent = comparedBlock->getIsPresent().isEmpty() || expressionParser_->parseExpression(comparedBlock->getIsPresent()).toInt();
-
-    if (blockPresent && comparedPresent) {
-      if (((blockBegin >= compareBegin && blockBegin <= compareEnd) ||
-          (blockEnd >= compareBegin && blockEnd <= compareEnd)) ||
-          ((compareBegin >= blockBegin && compareBegin <= blockEnd) ||
-          (compareEnd >= blockBegin && compareEnd <= blockEnd)))
-      {
-          return true;
-      }
+    QVector<QPair<int, int> > overlappingBlocks;
+
+    // The areas that have begun and may still contain the first address of the next area in the address order.
+    QVector<BlockArea> openAreas;
+    for (BlockArea const& area : areas)
+    {
+        int remainingCount = 0;
+        for (BlockArea const& openArea : openAreas)
+        {
+            if (openArea.end >= area.begin)
+            {
+                openAreas[remainingCount++] = openArea;
+
+                overlappingBlocks.append(qMakePair(qMin(openArea.blockIndex, area.blockIndex),
+                    qMax(openArea.blockIndex, area.blockIndex)));
+                if (firstOnly)
+                {
+                    return overlappingBlocks;
+                }
+            }
+        }
+
+        openAreas.resize(remainingCount);
+        openAreas.append(area);
     }
 
-    return false;
+    for (BlockArea const& emptyArea : emptyAreas)
+    {
+        for (BlockArea const& area : areas)
+        {
+            if (containsAddress(area, emptyArea.begin) || containsAddress(area, emptyArea.end))
+            {
+                overlappingBlocks.append(qMakePair(qMin(emptyArea.blockIndex, area.blockIndex),
+                    qMax(emptyArea.blockIndex, area.blockIndex)));
+                if (firstOnly)
+                {
+                    return overlappingBlocks;
+                }
+            }
+        }
+    }
+
+    std::sort(overlappingBlocks.begin(), overlappingBlocks.end());
+    return overlappingBlocks;
 }
 
 //-----------------------------------------------------------------------------
@@ -264,7 +362,10 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList addressBlockNames;
+        QVector<QPair<int, int> > overlappingBlocks = findOverlappingBlocks(memoryMapBase, false);
+        int overlapIndex = 0;
+
+        QSet<QString> addressBlockNames;
         for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
         {
             QSharedPointer<MemoryBlockBase> memoryBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
@@ -280,7 +381,16 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     .arg(addressBlock->name()).arg(context));
             }
 
-            findErrorsInOverlappingBlocks(errors, memoryMapBase, addressBlock, blockIndex, context);
+            // The overlaps are reported with the block of the lower index, as when comparing the blocks in pairs.
+            for (; overlapIndex < overlappingBlocks.size() && overlappingBlocks.at(overlapIndex).first == blockIndex;
+                ++overlapIndex)
+            {
+                QSharedPointer<MemoryBlockBase> comparisonBlock =
+                    memoryMapBase->getMemoryBlocks()->at(overlappingBlocks.at(overlapIndex).second);
+
+                errors.append(QObject::tr("Address blocks %1 and %2 overlap in %3")
+                    .arg(addressBlock->name()).arg(comparisonBlock->name()).arg(context));
+            }
 
             if (!addressBlockWidthIsMultiplicationOfAUB(addressUnitBits, addressBlock))
             {
@@ -289,30 +399,7 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     .arg(addressBlock->name()).arg(memoryMapBase->elementName()).arg(memoryMapBase->name()));
             }
 
-            addressBlockNames.append(addressBlock->name());
-        }
-    }
-}
-
-//-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::findErrorsInOverlappingBlocks()
-//-----------------------------------------------------------------------------
-void MemoryMapBaseValidator::findErrorsInOverlappingBlocks(QVector<QString>& errors,
-    QSharedPointer<MemoryMapBase> memoryMapBase, QSharedPointer<AddressBlock> addressBlock, int blockIndex,
-    QString const& context) const
-{
-    for (int comparisonIndex = blockIndex + 1; comparisonIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++comparisonIndex)
-    {
-        QSharedPointer<MemoryBlockBase> blockData = memoryMapBase->getMemoryBlocks()->at(comparisonIndex);
-        QSharedPointer<AddressBlock> comparisonBlock = blockData.dynamicCast<AddressBlock>();
-        if (comparisonBlock)
-        {
-            if (twoAddressBlocksOverlap(addressBlock, comparisonBlock))
-            {
-                errors.append(QObject::tr("Address blocks %1 and %2 overlap in %3")
-                    .arg(addressBlock->name()).arg(comparisonBlock->name()).arg(context));
-            }
+            addressBlockNames.insert(addressBlock->name());
         }
     }
 }
@@ -14,8 +14,10 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <QPair>
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 
 class ExpressionParser;
 class MemoryMapBase;
@@ -65,6 +67,20 @@ public:
      */
     virtual bool validate(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits) const;
 
+    /*!
+     *  Validates the given memory map base, optionally without validating each address block on its own. The
+     *  placement of the address blocks is checked in both cases. Used when the validity of the blocks is known.
+     *
+     *      @param [in] memoryMapBase           The memory map base to validate.
+     *      @param [in] addressUnitBits         The address unit bits used by the memory map.
+     *      @param [in] validateAddressBlocks   If true, the address blocks are validated, otherwise only their
+     *                                          placement.
+     *
+     *      @return True, if the memory map base is valid IP-XACT, otherwise false.
+     */
+    bool validate(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits,
+        bool validateAddressBlocks) const;
+
     /*!
      *  Check if the memory map base contains a valid name.
      *
@@ -93,6 +109,20 @@ public:
      */
     bool hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits) const;
 
+    /*!
+     *  Check if the memory map base contains valid memory blocks, optionally without validating each address
+     *  block on its own.
+     *
+     *      @param [in] memoryMapBase           The selected memory map base.
+     *      @param [in] addressUnitBits         The address unit bits used by the memory map.
+     *      @param [in] validateAddressBlocks   If true, the address blocks are validated, otherwise only their
+     *                                          placement.
+     *
+     *      @return True, if the memory blocks are valid, otherwise false.
+     */
+    bool hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits,
+        bool validateAddressBlocks) const;
+
     /*!
      *  Locate errors within a memory map base.
      *
@@ -120,25 +150,18 @@ private:
 	MemoryMapBaseValidator& operator=(MemoryMapBaseValidator const& rhs);
 
     /*!
-     *  Check if the address block overlaps with another address block.
+     *  Find the overlapping address blocks of a memory map base.
      *
-     *      @param [in] addressBlock        The selected address block.
-     *      @param [in] memoryMapBase       The selected memory map base.
-     *      @param [in] addressBlockIndex   The index of the address block.
+     *  The addresses of each block are evaluated once and the blocks are compared in the order of their base
+     *  addresses, so only the blocks that can overlap are compared with each other.
      *
-     *      @return True, if the address blocks overlap, otherwise false.
-     */
-    bool addressBlockOverlaps(QSharedPointer<AddressBlock> addressBlock,
-        QSharedPointer<MemoryMapBase> memoryMapBase, int addressBlockIndex) const;
-
-    /*!
-     *  Check if two address blocks overlap.
+     *      @param [in] memoryMapBase   The selected memory map base.
+     *      @param [in] firstOnly       If true, the search stops at the first overlapping pair.
      *
-     *      @param [in] addressBlock    The selected address block.
-     *      @param [in] comparedBlock   The compared address block.
+     *      @return The indexes of the overlapping blocks, the lower index first, in the order of the indexes.
      */
-    bool twoAddressBlocksOverlap(QSharedPointer<AddressBlock> addressBlock,
-        QSharedPointer<AddressBlock> comparedBlock) const;
+    QVector<QPair<int, int> > findOverlappingBlocks(QSharedPointer<MemoryMapBase> memoryMapBase,
+        bool firstOnly) const;
 
     /*!
      *  Check if the address block width is a multiplication of address unit bits.
@@ -182,18 +205,6 @@ private:
     void findErrorsInAddressBlocks(QVector<QString>& errors, QSharedPointer<MemoryMapBase> memoryMapBase,
         QString const& addressUnitBits, QString const& context) const;
 
-    /*!
-     *  Find errors within overlapping address blocks.
-     *
-     *      @param [in] errors          List of found errors.
-     *      @param [in] memoryMapBase   The selected memory map base.
-     *      @param [in] addressBlock    The selected address block.
-     *      @param [in] blockIndex      The index of the address block.
-     *      @param [in] context         Context to help locate the error.
-     */
-    void findErrorsInOverlappingBlocks(QVector<QString>& errors, QSharedPointer<MemoryMapBase> memoryMapBase,
-        QSharedPointer<AddressBlock> addressBlock, int blockIndex, QString const& context) const;
-
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
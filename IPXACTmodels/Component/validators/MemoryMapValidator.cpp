@@ -53,8 +53,16 @@ void MemoryMapValidator::componentChange(QSharedPointer<QList<QSharedPointer<Rem
 //-----------------------------------------------------------------------------
 bool MemoryMapValidator::validate(QSharedPointer<MemoryMap> memoryMap) const
 {
-    return MemoryMapBaseValidator::validate(memoryMap, memoryMap->getAddressUnitBits()) &&
-        hasValidAddressUnitBits(memoryMap) && hasValidMemoryRemaps(memoryMap);
+    return validate(memoryMap, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapValidator::validate()
+//-----------------------------------------------------------------------------
+bool MemoryMapValidator::validate(QSharedPointer<MemoryMap> memoryMap, bool validateAddressBlocks) const
+{
+    return MemoryMapBaseValidator::validate(memoryMap, memoryMap->getAddressUnitBits(), validateAddressBlocks) &&
+        hasValidAddressUnitBits(memoryMap) && hasValidMemoryRemaps(memoryMap, validateAddressBlocks);
 }
 
 //-----------------------------------------------------------------------------
@@ -85,6 +93,15 @@ bool MemoryMapValidator::hasValidAddressUnitBits(QSharedPointer<MemoryMap> memor
 // Function: MemoryMapValidator::hasValidMemoryRemaps()
 //-----------------------------------------------------------------------------
 bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap) const
+{
+    return hasValidMemoryRemaps(memoryMap, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapValidator::hasValidMemoryRemaps()
+//-----------------------------------------------------------------------------
+bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap, bool validateAddressBlocks)
+    const
 {
     if (!memoryMap->getMemoryRemaps()->isEmpty())
     {
@@ -95,7 +112,8 @@ bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMa
             if (remapNames.contains(memoryRemap->name()) ||
                 remapStates.contains(memoryRemap->getRemapState()) ||
                 remapStateIsNotValid(memoryRemap) ||
-                !MemoryMapBaseValidator::validate(memoryRemap, memoryMap->getAddressUnitBits()))
+                !MemoryMapBaseValidator::validate(memoryRemap, memoryMap->getAddressUnitBits(),
+                    validateAddressBlocks))
             {
                 return false;
             }
@@ -64,6 +64,18 @@ public:
      */
     virtual bool validate(QSharedPointer<MemoryMap> memoryMap) const;
 
+    /*!
+     *  Validates the given memory map, optionally without validating each address block on its own. The
+     *  placement of the address blocks is checked in both cases. Used when the validity of the blocks is known.
+     *
+     *      @param [in] memoryMap               The memory map to validate.
+     *      @param [in] validateAddressBlocks   If true, the address blocks are validated, otherwise only their
+     *                                          placement.
+     *
+     *      @return True, if the memory map is valid IP-XACT, otherwise false.
+     */
+    bool validate(QSharedPointer<MemoryMap> memoryMap, bool validateAddressBlocks) const;
+
     /*!
      *  Check if the memory map contains valid address unit bits.
      *
@@ -82,6 +94,18 @@ public:
      */
     bool hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap) const;
 
+    /*!
+     *  Check if the memory map contains valid memory remaps, optionally without validating each address block
+     *  of the remaps on its own.
+     *
+     *      @param [in] memoryMap               The selected memory map.
+     *      @param [in] validateAddressBlocks   If true, the address blocks are validated, otherwise only their
+     *                                          placement.
+     *
+     *      @return True, if the memory remaps are valid, otherwise false.
+     */
+    bool hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap, bool validateAddressBlocks) const;
+
     /*!
      *  Check if the memory remap remap state is valid.
      *
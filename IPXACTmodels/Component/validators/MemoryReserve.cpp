@@ -11,11 +11,14 @@
 
 #include "MemoryReserve.h"
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // Function: MemoryReserve::MemoryReserve()
 //-----------------------------------------------------------------------------
 MemoryReserve::MemoryReserve():
-reservedArea_()
+reservedArea_(),
+    sorted_(true)
 {
 
 }
@@ -62,6 +65,7 @@ void MemoryReserve::addArea(QString const& newId, qint64 newBegin, qint64 newEnd
     newArea.end_ = newEnd;
 
     reservedArea_.append(newArea);
+    sorted_ = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -71,7 +75,7 @@ bool MemoryReserve::hasOverlap()
 {
     if (!reservedArea_.isEmpty())
     {
-        qSort(reservedArea_);
+        sortAreas();
 
         for (int areaIndex = 0; areaIndex < reservedArea_.size(); ++areaIndex)
         {
@@ -103,7 +107,7 @@ bool MemoryReserve::hasIdDependantOverlap()
 {
     if (!reservedArea_.isEmpty())
     {
-        qSort(reservedArea_);
+        sortAreas();
 
         for (int areaIndex = 0; areaIndex < reservedArea_.size(); ++areaIndex)
         {
@@ -139,7 +143,7 @@ void MemoryReserve::findErrorsInOverlap(QVector<QString>& errors, QString const&
 {
     if (!reservedArea_.isEmpty())
     {
-        qSort(reservedArea_);
+        sortAreas();
 
         for (int i = 0; i < reservedArea_.size(); ++i)
         {
@@ -171,7 +175,7 @@ void MemoryReserve::findErrorsInIdDependantOverlap(QVector<QString>& errors, QSt
 {
     if (!reservedArea_.isEmpty())
     {
-        qSort(reservedArea_);
+        sortAreas();
 
         for (int i = 0; i < reservedArea_.size(); ++i)
         {
@@ -193,4 +197,18 @@ void MemoryReserve::findErrorsInIdDependantOverlap(QVector<QString>& errors, QSt
             }
         }
     }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryReserve::sortAreas()
+//-----------------------------------------------------------------------------
+void MemoryReserve::sortAreas()
+{
+    // Areas beginning at the same address keep the order they were added in, so the overlaps are always
+    // reported in the same order.
+    if (!sorted_)
+    {
+        std::stable_sort(reservedArea_.begin(), reservedArea_.end());
+        sorted_ = true;
+    }
 }
\ No newline at end of file
@@ -81,6 +81,9 @@ private:
 	MemoryReserve(MemoryReserve const& rhs);
 	MemoryReserve& operator=(MemoryReserve const& rhs);
 
+    //! Sorts the reserved areas by their start points, unless already sorted.
+    void sortAreas();
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -116,6 +119,9 @@ private:
 
     //! The currently reserved memory areas.
     QVector<MemoryArea> reservedArea_;
+
+    //! True, if the reserved areas are sorted by their start points.
+    bool sorted_;
 };
 
 #endif // MEMORYRESERVE_H
@@ -11,6 +11,7 @@
 
 #include "RegisterValidator.h"
 
+#include <editors/ComponentEditor/common/BigInteger.h>
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 #include <IPXACTmodels/Component/validators/FieldValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
@@ -25,7 +26,9 @@
 #include <IPXACTmodels/Component/WriteValueConstraint.h>
 
 
+#include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: RegisterValidator::RegisterValidator()
@@ -66,10 +69,18 @@ QSharedPointer<FieldValidator> RegisterValidator::getFieldValidator() const
 // Function: RegisterValidator::validate()
 //-----------------------------------------------------------------------------
 bool RegisterValidator::validate(QSharedPointer<Register> selectedRegister) const
+{
+    return validate(selectedRegister, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::validate()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::validate(QSharedPointer<Register> selectedRegister, bool validateFields) const
 {
     return RegisterBaseValidator::validate(selectedRegister) &&
            hasValidSize(selectedRegister) &&
-           hasValidFields(selectedRegister, selectedRegister->getSize()) &&
+           hasValidFields(selectedRegister, selectedRegister->getSize(), validateFields) &&
            hasValidAlternateRegisters(selectedRegister);
 }
 
@@ -92,6 +103,15 @@ bool RegisterValidator::hasValidSize(QSharedPointer<Register> selectedRegister)
 //-----------------------------------------------------------------------------
 bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister,
     QString const& registerSize) const
+{
+    return hasValidFields(selectedRegister, registerSize, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::hasValidFields()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister,
+    QString const& registerSize, bool validateFields) const
 {
     if (selectedRegister->getFields()->isEmpty())
     {
@@ -102,12 +122,14 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
 
     MemoryReserve reservedArea;
 
-    QVector<QString> fieldNames;
-    QVector<QString> fieldTypeIdentifiers;
+    QSet<QString> fieldNames;
+
+    // The index of the first field with each type identifier.
+    QHash<QString, int> fieldTypeIdentifierIndexes;
     for (int fieldIndex = 0; fieldIndex < selectedRegister->getFields()->size(); ++fieldIndex)
     {
         QSharedPointer<Field> field = selectedRegister->getFields()->at(fieldIndex);
-        if (!fieldValidator_->validate(field) || fieldNames.contains(field->name()))
+        if ((validateFields && !fieldValidator_->validate(field)) || fieldNames.contains(field->name()))
         {
             return false;
         }
@@ -131,9 +153,10 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
               reservedArea.addArea(field->name(), rangeBegin, rangeEnd);
             }
 
-            if (!field->getTypeIdentifier().isEmpty() && fieldTypeIdentifiers.contains(field->getTypeIdentifier()))
+            if (!field->getTypeIdentifier().isEmpty() &&
+                fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
             {
-                int typeIdIndex = fieldTypeIdentifiers.indexOf(field->getTypeIdentifier());
+                int typeIdIndex = fieldTypeIdentifierIndexes.value(field->getTypeIdentifier());
 
                 QSharedPointer<Field> comparedField = selectedRegister->getFields()->at(typeIdIndex);
                 if (!fieldsHaveSimilarDefinitionGroups(field, comparedField))
@@ -142,8 +165,11 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
                 }
             }
 
-            fieldNames.append(field->name());
-            fieldTypeIdentifiers.append(field->getTypeIdentifier());
+            fieldNames.insert(field->name());
+            if (!fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
+            {
+                fieldTypeIdentifierIndexes.insert(field->getTypeIdentifier(), fieldIndex);
+            }
 
             if (field->getVolatile().toBool() == true && selectedRegister->getVolatile() == QLatin1String("false"))
             {
@@ -330,14 +356,17 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
 {
     if (!selectedRegister->getFields()->isEmpty())
     {
-        QStringList fieldNames;
-        QStringList fieldTypeIdentifiers;
+        QSet<QString> fieldNames;
+
+        // The index of the first field with each type identifier.
+        QHash<QString, int> fieldTypeIdentifierIndexes;
 
         qint64 registerSizeInt = expressionParser_->parseExpression(registerSize).toLongLong();
         MemoryReserve reservedArea;
 
-        foreach (QSharedPointer<Field> field, *selectedRegister->getFields())
+        for (int fieldIndex = 0; fieldIndex < selectedRegister->getFields()->size(); ++fieldIndex)
         {
+            QSharedPointer<Field> field = selectedRegister->getFields()->at(fieldIndex);
             fieldValidator_->findErrorsIn(errors, field, context);
 
             if (fieldNames.contains(field->name()))
@@ -346,14 +375,19 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
                     QObject::tr("Name %1 of fields in %2 is not unique.").arg(field->name()).arg(context));
             }
 
-            qint64 bitWidth = expressionParser_->parseExpression(field->getBitWidth()).toLongLong();
+            QString bitWidthValue = expressionParser_->parseExpression(field->getBitWidth());
+            QString bitOffsetValue = expressionParser_->parseExpression(field->getBitOffset());
 
-            qint64 rangeBegin = expressionParser_->parseExpression(field->getBitOffset()).toLongLong();
+            qint64 bitWidth = bitWidthValue.toLongLong();
+
+            qint64 rangeBegin = bitOffsetValue.toLongLong();
             qint64 rangeEnd = rangeBegin + bitWidth - 1;
 
             qint64 fieldEndPosition = registerSizeInt - bitWidth;
 
-            if (rangeBegin < 0 || rangeBegin > fieldEndPosition)
+            // Values wider than 64 bits are valid expressions, but never fit in a register.
+            if (BigInteger::isWiderThan64Bits(bitWidthValue) || BigInteger::isWiderThan64Bits(bitOffsetValue) ||
+                rangeBegin < 0 || rangeBegin > fieldEndPosition)
             {
                 errors.append(QObject::tr("Field %1 is not contained within %2").arg(field->name()).
                     arg(selectedRegister->name()));
@@ -364,9 +398,10 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
               reservedArea.addArea(field->name(), rangeBegin, rangeEnd);
             }
 
-            if (!field->getTypeIdentifier().isEmpty() && fieldTypeIdentifiers.contains(field->getTypeIdentifier()))
+            if (!field->getTypeIdentifier().isEmpty() &&
+                fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
             {
-                int typeIdIndex = fieldTypeIdentifiers.indexOf(field->getTypeIdentifier());
+                int typeIdIndex = fieldTypeIdentifierIndexes.value(field->getTypeIdentifier());
                 QSharedPointer<Field> comparedField = selectedRegister->getFields()->at(typeIdIndex);
                 if (!fieldsHaveSimilarDefinitionGroups(field, comparedField))
                 {
@@ -376,8 +411,11 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
                 }
             }
 
-            fieldNames.append(field->name());
-            fieldTypeIdentifiers.append(field->getTypeIdentifier());
+            fieldNames.insert(field->name());
+            if (!fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
+            {
+                fieldTypeIdentifierIndexes.insert(field->getTypeIdentifier(), fieldIndex);
+            }
 
             if (field->getVolatile().toBool() == true && selectedRegister->getVolatile() == QLatin1String("false"))
             {
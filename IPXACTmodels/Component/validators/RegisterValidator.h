@@ -74,6 +74,17 @@ public:
      */
     bool validate(QSharedPointer<Register> selectedRegister) const;
 
+    /*!
+     *  Validates the given register, optionally without validating each field on its own. The placement of the
+     *  fields within the register is checked in both cases. Used when the validity of the fields is known.
+     *
+     *      @param [in] selectedRegister    The register to validate.
+     *      @param [in] validateFields      If true, the fields are validated, otherwise only their placement.
+     *
+     *      @return True, if the register is valid IP-XACT, otherwise false.
+     */
+    bool validate(QSharedPointer<Register> selectedRegister, bool validateFields) const;
+
     /*!
      *  Check if the register contains a valid size.
      *
@@ -93,6 +104,18 @@ public:
      */
     bool hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister, QString const& registerSize) const;
 
+    /*!
+     *  Check if the register contains valid fields, optionally without validating each field on its own.
+     *
+     *      @param [in] selectedRegister    The selected register definition.
+     *      @param [in] registerSize        Size of the containing register.
+     *      @param [in] validateFields      If true, the fields are validated, otherwise only their placement.
+     *
+     *      @return True, if the fields are valid, otherwise false.
+     */
+    bool hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister, QString const& registerSize,
+        bool validateFields) const;
+
     /*!
      *  Check if the register contains valid alternate registers.
      *
@@ -47,6 +47,24 @@ public:
      */
     QSharedPointer<Design> createDesignFrom(QDomDocument const& document) const;
 
+protected:
+
+    /*!
+     *  Reads a single interconnection from XML.
+     *
+     *      @param [in] interconnectionNode     The XML description of the interconnection.
+     *      @param [in] newDesign               The new design item.
+     */
+    void parseSingleInterconnection(QDomNode const& interconnectionNode, QSharedPointer<Design> newDesign) const;
+
+    /*!
+     *  Reads a single ad-hoc connection.
+     *
+     *      @param [in] adHocNode   XML description of an ad-hoc connection.
+     *      @param [in] newDesign   The new design item.
+     */
+    void parseSingleAdHocConnection(const QDomNode& adHocNode, QSharedPointer<Design> newDesign) const;
+
 private:
 
     // Disable copying.
@@ -69,14 +87,6 @@ private:
      */
     void parseInterconnections(QDomNode const& designNode, QSharedPointer<Design> newDesign) const;
 
-    /*!
-     *  Reads a single interconnection from XML.
-     *
-     *      @param [in] interconnectionNode     The XML description of the interconnection.
-     *      @param [in] newDesign               The new design item.
-     */
-    void parseSingleInterconnection(QDomNode const& interconnectionNode, QSharedPointer<Design> newDesign) const;
-
     /*!
      *  Reads an interconnection between components.
      *
@@ -143,14 +153,6 @@ private:
      */
     void parseAdHocConnections(QDomNode const& designNode, QSharedPointer<Design> newDesign) const;
 
-    /*!
-     *  Reads a single ad-hoc connection.
-     *
-     *      @param [in] adHocNode   XML description of an ad-hoc connection.
-     *      @param [in] newDesign   The new design item.
-     */
-    void parseSingleAdHocConnection(const QDomNode& adHocNode, QSharedPointer<Design> newDesign) const;
-
     /*!
      *  Reads the internal port references.
      *
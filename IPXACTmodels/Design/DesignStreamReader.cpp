@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------
+// File: DesignStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming XML reader class for IP-XACT design element.
+//-----------------------------------------------------------------------------
+
+#include "DesignStreamReader.h"
+#include "ComponentInstanceReader.h"
+
+#include <IPXACTmodels/common/DocumentStreamParser.h>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: insertStreamedItems()
+    //-----------------------------------------------------------------------------
+    template <typename T>
+    void insertStreamedItems(QSharedPointer<QList<QSharedPointer<T> > > target,
+        QSharedPointer<QList<QSharedPointer<T> > > streamedItems)
+    {
+        // Streamed items precede anything added from the shell, e.g. software instances from extensions.
+        *target = *streamedItems + *target;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::DesignStreamReader()
+//-----------------------------------------------------------------------------
+DesignStreamReader::DesignStreamReader(): DesignReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::~DesignStreamReader()
+//-----------------------------------------------------------------------------
+DesignStreamReader::~DesignStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::createDesignFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> DesignStreamReader::createDesignFrom(QIODevice* device) const
+{
+    // Collects the streamed items until the rest of the design has been read.
+    QSharedPointer<Design> streamedItems(new Design());
+
+    ComponentInstanceReader instanceReader;
+
+    DocumentStreamParser parser;
+    parser.addItemHandler(QStringLiteral("ipxact:componentInstances/ipxact:componentInstance"),
+        [&streamedItems, &instanceReader](QDomElement const& instanceElement, int)
+    {
+        streamedItems->getComponentInstances()->append(instanceReader.createComponentInstanceFrom(instanceElement));
+    });
+
+    auto interconnectionHandler = [this, &streamedItems](QDomElement const& interconnectionElement, int)
+    {
+        parseSingleInterconnection(interconnectionElement, streamedItems);
+    };
+    parser.addItemHandler(QStringLiteral("ipxact:interconnections/ipxact:interconnection"),
+        interconnectionHandler);
+    parser.addItemHandler(QStringLiteral("ipxact:interconnections/ipxact:monitorInterconnection"),
+        interconnectionHandler);
+
+    parser.addItemHandler(QStringLiteral("ipxact:adHocConnections/ipxact:adHocConnection"),
+        [this, &streamedItems](QDomElement const& adHocElement, int)
+    {
+        parseSingleAdHocConnection(adHocElement, streamedItems);
+    });
+
+    QDomDocument shellDocument;
+    if (parser.parse(device, shellDocument) == false)
+    {
+        return QSharedPointer<Design>();
+    }
+
+    QSharedPointer<Design> newDesign = DesignReader::createDesignFrom(shellDocument);
+
+    insertStreamedItems(newDesign->getComponentInstances(), streamedItems->getComponentInstances());
+    insertStreamedItems(newDesign->getInterconnections(), streamedItems->getInterconnections());
+    insertStreamedItems(newDesign->getMonitorInterconnecions(), streamedItems->getMonitorInterconnecions());
+    insertStreamedItems(newDesign->getAdHocConnections(), streamedItems->getAdHocConnections());
+
+    return newDesign;
+}
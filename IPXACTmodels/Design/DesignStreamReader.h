@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// File: DesignStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming XML reader class for IP-XACT design element.
+//-----------------------------------------------------------------------------
+
+#ifndef DESIGNSTREAMREADER_H
+#define DESIGNSTREAMREADER_H
+
+#include "DesignReader.h"
+
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Streaming XML reader class for IP-XACT design element.
+//
+// Component instances, interconnections and ad-hoc connections are read one at a time from the stream,
+// so the whole document is never held in memory as a DOM tree.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DesignStreamReader : public DesignReader
+{
+public:
+
+    //! The constructor.
+    DesignStreamReader();
+
+    //! The destructor.
+    ~DesignStreamReader();
+
+    using DesignReader::createDesignFrom;
+
+    /*!
+     *  Creates a design by reading the given device.
+     *
+     *      @param [in] device  The device containing the design XML.
+     *
+     *      @return The created design or null, if the XML could not be read.
+     */
+    QSharedPointer<Design> createDesignFrom(QIODevice* device) const;
+
+private:
+
+    // Disable copying.
+    DesignStreamReader(DesignStreamReader const& rhs);
+    DesignStreamReader& operator=(DesignStreamReader const& rhs);
+};
+
+#endif // DESIGNSTREAMREADER_H
@@ -238,6 +238,39 @@ void DesignValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Desi
     findErrorsInAssertions(errors, design, context);
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignValidator::findDiagnosticsIn()
+//-----------------------------------------------------------------------------
+void DesignValidator::findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics, QSharedPointer<Design> design)
+    const
+{
+    QString context = QObject::tr("design %1").arg(design->getVlnv().toString());
+    QString designPath = design->getVlnv().toString();
+
+    QVector<QString> vlnvErrors;
+    findErrorsInVLNV(vlnvErrors, design);
+    ValidationDiagnostic::appendMessages(diagnostics, vlnvErrors, designPath, ValidationDiagnostic::SEVERITY_ERROR);
+
+    typedef void (DesignValidator::*Section)(QVector<QString>&, QSharedPointer<Design>, QString const&) const;
+
+    // The sections report only the problems failing their validity checks, so each message is an error.
+    auto findInSection = [this, &diagnostics, design, &context, &designPath](QString const& sectionName,
+        Section findErrors)
+    {
+        QVector<QString> sectionErrors;
+        (this->*findErrors)(sectionErrors, design, context);
+        ValidationDiagnostic::appendMessages(diagnostics, sectionErrors, designPath + QLatin1Char('/') + sectionName,
+            ValidationDiagnostic::SEVERITY_ERROR);
+    };
+
+    findInSection(QStringLiteral("componentInstances"), &DesignValidator::findErrorsInComponentInstances);
+    findInSection(QStringLiteral("interconnections"), &DesignValidator::findErrorsInInterconnections);
+    findInSection(QStringLiteral("monitorInterconnections"), &DesignValidator::findErrorsInMonitorInterconnections);
+    findInSection(QStringLiteral("adHocConnections"), &DesignValidator::findErrorsInAdHocConnections);
+    findInSection(QStringLiteral("parameters"), &DesignValidator::findErrorsInParameters);
+    findInSection(QStringLiteral("assertions"), &DesignValidator::findErrorsInAssertions);
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignValidator::findErrorsInVLNV()
 //-----------------------------------------------------------------------------
@@ -14,6 +14,8 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <IPXACTmodels/common/validators/ValidationDiagnostic.h>
+
 #include <QSharedPointer>
 #include <QString>
 #include <QVector>
@@ -127,6 +129,15 @@ public:
      */
     void findErrorsIn(QVector<QString>& errors, QSharedPointer<Design> design) const;
 
+    /*!
+     *  Locate the problems within a design in a single pass. Each problem is reported with the path of the
+     *  design section containing it. The problems fail the validation, so they are reported as errors.
+     *
+     *      @param [in] diagnostics     List of found problems.
+     *      @param [in] design          The selected design.
+     */
+    void findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics, QSharedPointer<Design> design) const;
+
 private:
 
 	// Disable copying.
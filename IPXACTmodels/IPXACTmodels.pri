@@ -72,6 +72,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/CommonItemsReader.h \
     ./common/CommonItemsWriter.h \
     ./common/DocumentReader.h \
+    ./common/DocumentStreamParser.h \
     ./common/DocumentWriter.h \
     ./common/FileBuilderReader.h \
     ./common/FileBuilderWriter.h \
@@ -89,6 +90,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/validators/ParameterValidator.h \
     ./common/validators/ProtocolValidator.h \
     ./common/validators/TimingConstraintValidator.h \
+    ./common/validators/ValidationDiagnostic.h \
     ./common/validators/ValueFormatter.h \
     ./common/validators/namevalidator.h \
     ./common/validators/NMTokenValidator.h \
@@ -116,6 +118,7 @@ HEADERS += ./generaldeclarations.h \
     ./designConfiguration/MultipleAbstractorInstances.h \
     ./designConfiguration/ViewConfiguration.h \
     ./designConfiguration/DesignConfigurationReader.h \
+    ./designConfiguration/DesignConfigurationStreamReader.h \
     ./designConfiguration/DesignConfigurationWriter.h \
     ./designConfiguration/validators/DesignConfigurationValidator.h \
     ./designConfiguration/validators/InterconnectionConfigurationValidator.h \
@@ -132,6 +135,7 @@ HEADERS += ./generaldeclarations.h \
     ./Design/ComponentInstanceReader.h \
     ./Design/ComponentInstanceWriter.h \
     ./Design/DesignReader.h \
+    ./Design/DesignStreamReader.h \
     ./Design/DesignWriter.h \
     ./Design/validator/AdHocConnectionValidator.h \
     ./Design/validator/ComponentInstanceValidator.h \
@@ -196,6 +200,7 @@ HEADERS += ./generaldeclarations.h \
     ./Component/ComponentGeneratorReader.h \
     ./Component/ComponentGeneratorWriter.h \
     ./Component/ComponentReader.h \
+    ./Component/ComponentStreamReader.h \
     ./Component/ComponentWriter.h \
     ./Component/CPUReader.h \
     ./Component/CPUWriter.h \
@@ -303,6 +308,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./common/DirectionTypes.cpp \
     ./common/Document.cpp \
     ./common/DocumentReader.cpp \
+    ./common/DocumentStreamParser.cpp \
     ./common/DocumentWriter.cpp \
     ./common/Enumeration.cpp \
     ./common/Extendable.cpp \
@@ -361,6 +367,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./designConfiguration/AbstractorInstance.cpp \
     ./designConfiguration/DesignConfiguration.cpp \
     ./designConfiguration/DesignConfigurationReader.cpp \
+    ./designConfiguration/DesignConfigurationStreamReader.cpp \
     ./designConfiguration/DesignConfigurationWriter.cpp \
     ./designConfiguration/InterconnectionConfiguration.cpp \
     ./designConfiguration/InterfaceRef.cpp \
@@ -376,6 +383,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./Design/ComponentInstanceWriter.cpp \
     ./Design/Design.cpp \
     ./Design/DesignReader.cpp \
+    ./Design/DesignStreamReader.cpp \
     ./Design/DesignWriter.cpp \
     ./Design/HierInterface.cpp \
     ./Design/Interconnection.cpp \
@@ -409,6 +417,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./Component/ComponentGeneratorWriter.cpp \
     ./Component/ComponentInstantiation.cpp \
     ./Component/ComponentReader.cpp \
+    ./Component/ComponentStreamReader.cpp \
     ./Component/ComponentWriter.cpp \
     ./Component/Cpu.cpp \
     ./Component/CPUReader.cpp \
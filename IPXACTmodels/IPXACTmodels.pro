@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = IPXACTmodels
 
-QT += core xml gui
+QT += core xml gui concurrent
 CONFIG += c++11 release
 
 DEFINES += IPXACTMODELS_LIB QT_NO_CAST_FROM_ASCII
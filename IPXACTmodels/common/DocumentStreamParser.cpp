@@ -0,0 +1,274 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamParser.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Pull parser splitting an XML document into a document shell and separately handled items.
+//-----------------------------------------------------------------------------
+
+#include "DocumentStreamParser.h"
+
+#include <QIODevice>
+#include <QVector>
+#include <QXmlStreamReader>
+
+namespace
+{
+    //! An open element in the document shell.
+    struct ShellFrame
+    {
+        QDomNode node;                      //!< The element node in the shell.
+        QString path;                       //!< The element path relative to the document element.
+        int index = 0;                      //!< The index among identically named siblings.
+        QHash<QString, int> childCounts;    //!< The number of child elements by name so far.
+    };
+
+    //-----------------------------------------------------------------------------
+    // Function: createElement()
+    //-----------------------------------------------------------------------------
+    QDomElement createElement(QDomDocument& document, QXmlStreamReader const& reader)
+    {
+        QDomElement element = document.createElement(reader.qualifiedName().toString());
+
+        for (QXmlStreamAttribute const& attribute : reader.attributes())
+        {
+            element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+
+        return element;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::DocumentStreamParser()
+//-----------------------------------------------------------------------------
+DocumentStreamParser::DocumentStreamParser():
+itemHandlers_(),
+    errorString_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::addItemHandler()
+//-----------------------------------------------------------------------------
+void DocumentStreamParser::addItemHandler(QString const& path, ItemHandler handler)
+{
+    itemHandlers_.insert(path, handler);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::parse()
+//-----------------------------------------------------------------------------
+bool DocumentStreamParser::parse(QIODevice* device, QDomDocument& shellDocument)
+{
+    errorString_.clear();
+    shellDocument = QDomDocument();
+
+    if (device == nullptr || (device->isOpen() == false && device->open(QIODevice::ReadOnly) == false))
+    {
+        errorString_ = QStringLiteral("Could not open the document for reading.");
+        return false;
+    }
+
+    QXmlStreamReader reader(device);
+    reader.setNamespaceProcessing(false);
+
+    QVector<ShellFrame> openElements;
+
+    // The item currently being read. Only one item is held in memory at a time.
+    QDomDocument itemDocument;
+    QDomNode itemNode;
+    int itemDepth = 0;
+    ItemHandler const* itemHandler = nullptr;
+    int itemParentIndex = 0;
+
+    while (reader.atEnd() == false)
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+
+        if (token == QXmlStreamReader::StartElement)
+        {
+            if (itemDepth > 0)
+            {
+                QDomElement element = createElement(itemDocument, reader);
+                itemNode.appendChild(element);
+                itemNode = element;
+                ++itemDepth;
+                continue;
+            }
+
+            QString name = reader.qualifiedName().toString();
+
+            ShellFrame frame;
+            if (openElements.isEmpty() == false)
+            {
+                ShellFrame& parent = openElements.last();
+                frame.path = parent.path.isEmpty() ? name : parent.path + QLatin1Char('/') + name;
+                frame.index = parent.childCounts[name]++;
+            }
+
+            auto handler = openElements.isEmpty() ? itemHandlers_.constEnd() : itemHandlers_.constFind(frame.path);
+            if (handler != itemHandlers_.constEnd())
+            {
+                itemDocument = QDomDocument();
+                itemNode = itemDocument.appendChild(createElement(itemDocument, reader));
+                itemDepth = 1;
+                itemHandler = &handler.value();
+                itemParentIndex = openElements.last().index;
+                continue;
+            }
+
+            frame.node = createElement(shellDocument, reader);
+            if (openElements.isEmpty())
+            {
+                shellDocument.appendChild(frame.node);
+            }
+            else
+            {
+                openElements.last().node.appendChild(frame.node);
+            }
+
+            openElements.append(frame);
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            if (itemDepth > 0)
+            {
+                --itemDepth;
+                if (itemDepth == 0)
+                {
+                    (*itemHandler)(itemDocument.documentElement(), itemParentIndex);
+
+                    itemNode = QDomNode();
+                    itemDocument = QDomDocument();
+                    itemHandler = nullptr;
+                }
+                else
+                {
+                    itemNode = itemNode.parentNode();
+                }
+            }
+            else if (openElements.isEmpty() == false)
+            {
+                openElements.removeLast();
+            }
+        }
+        else if (token == QXmlStreamReader::Characters || token == QXmlStreamReader::EntityReference)
+        {
+            QString text = reader.text().toString();
+            if (itemDepth > 0)
+            {
+                appendCharacters(itemDocument, itemNode, text, reader.isCDATA());
+            }
+            else if (openElements.isEmpty() == false)
+            {
+                appendCharacters(shellDocument, openElements.last().node, text, reader.isCDATA());
+            }
+        }
+        else if (token == QXmlStreamReader::Comment)
+        {
+            QString text = reader.text().toString();
+            if (itemDepth > 0)
+            {
+                itemNode.appendChild(itemDocument.createComment(text));
+            }
+            else if (openElements.isEmpty() == false)
+            {
+                openElements.last().node.appendChild(shellDocument.createComment(text));
+            }
+            else
+            {
+                shellDocument.appendChild(shellDocument.createComment(text));
+            }
+        }
+        else if (token == QXmlStreamReader::ProcessingInstruction)
+        {
+            QString target = reader.processingInstructionTarget().toString();
+            QString data = reader.processingInstructionData().toString();
+            if (itemDepth > 0)
+            {
+                itemNode.appendChild(itemDocument.createProcessingInstruction(target, data));
+            }
+            else if (openElements.isEmpty() == false)
+            {
+                openElements.last().node.appendChild(shellDocument.createProcessingInstruction(target, data));
+            }
+            else
+            {
+                shellDocument.appendChild(shellDocument.createProcessingInstruction(target, data));
+            }
+        }
+    }
+
+    if (reader.hasError())
+    {
+        errorString_ = QStringLiteral("%1 on line %2, column %3.").arg(reader.errorString()).arg(
+            reader.lineNumber()).arg(reader.columnNumber());
+        shellDocument = QDomDocument();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::errorString()
+//-----------------------------------------------------------------------------
+QString DocumentStreamParser::errorString() const
+{
+    return errorString_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::readDocumentElementName()
+//-----------------------------------------------------------------------------
+QString DocumentStreamParser::readDocumentElementName(QIODevice* device)
+{
+    if (device == nullptr || (device->isOpen() == false && device->open(QIODevice::ReadOnly) == false))
+    {
+        return QString();
+    }
+
+    QXmlStreamReader reader(device);
+    reader.setNamespaceProcessing(false);
+
+    if (reader.readNextStartElement())
+    {
+        return reader.qualifiedName().toString();
+    }
+
+    return QString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamParser::appendCharacters()
+//-----------------------------------------------------------------------------
+void DocumentStreamParser::appendCharacters(QDomDocument& document, QDomNode& parent, QString const& text,
+    bool isCDATA)
+{
+    if (isCDATA)
+    {
+        parent.appendChild(document.createCDATASection(text));
+        return;
+    }
+
+    // The stream may report the text of a single node in several parts, e.g. around entity references.
+    QDomNode previous = parent.lastChild();
+    if (previous.isText() && previous.isCDATASection() == false)
+    {
+        previous.toText().appendData(text);
+        return;
+    }
+
+    // Whitespace between elements is dropped as in QDomDocument::setContent().
+    if (text.trimmed().isEmpty())
+    {
+        return;
+    }
+
+    parent.appendChild(document.createTextNode(text));
+}
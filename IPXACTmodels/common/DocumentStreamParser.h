@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamParser.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Pull parser splitting an XML document into a document shell and separately handled items.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSTREAMPARSER_H
+#define DOCUMENTSTREAMPARSER_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QDomDocument>
+#include <QDomElement>
+#include <QHash>
+#include <QString>
+
+#include <functional>
+
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Pull parser splitting an XML document into a document shell and separately handled items.
+//
+// The document is read with QXmlStreamReader. Elements in the registered item paths are built into
+// a document of their own one at a time and given to the item handler, after which they are released.
+// Everything else is collected into the shell document, which matches the document read by
+// QDomDocument::setContent() without the handled items.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DocumentStreamParser
+{
+public:
+
+    /*!
+     *  Handler for a single item element read from the stream.
+     *
+     *      @param [in] itemElement     The XML description of the item.
+     *      @param [in] parentIndex     The index of the item's parent among its identically named siblings.
+     */
+    using ItemHandler = std::function<void(QDomElement const& itemElement, int parentIndex)>;
+
+    //! The constructor.
+    DocumentStreamParser();
+
+    //! The destructor.
+    ~DocumentStreamParser() = default;
+
+    /*!
+     *  Registers a handler for the elements in the given path.
+     *
+     *      @param [in] path        The element path relative to the document element, e.g.
+     *                              "ipxact:model/ipxact:ports/ipxact:port".
+     *      @param [in] handler     The handler for the elements.
+     */
+    void addItemHandler(QString const& path, ItemHandler handler);
+
+    /*!
+     *  Reads the document from the given device.
+     *
+     *      @param [in] device          The device to read.
+     *      @param [out] shellDocument  The document without the handled items.
+     *
+     *      @return True, if the document was read successfully, otherwise false.
+     */
+    bool parse(QIODevice* device, QDomDocument& shellDocument);
+
+    /*!
+     *  Get the description of the error in the last parse.
+     *
+     *      @return The error description.
+     */
+    QString errorString() const;
+
+    /*!
+     *  Reads the name of the document element from the given device.
+     *
+     *      @param [in] device  The device to read.
+     *
+     *      @return The qualified name of the document element or empty, if none was found.
+     */
+    static QString readDocumentElementName(QIODevice* device);
+
+private:
+
+    // Disable copying.
+    DocumentStreamParser(DocumentStreamParser const& rhs);
+    DocumentStreamParser& operator=(DocumentStreamParser const& rhs);
+
+    /*!
+     *  Appends character data to the given node, merging it into a preceding text node.
+     *
+     *      @param [in] document    The document owning the node.
+     *      @param [in] parent      The node to append to.
+     *      @param [in] text        The character data.
+     *      @param [in] isCDATA     Flag for CDATA sections.
+     */
+    static void appendCharacters(QDomDocument& document, QDomNode& parent, QString const& text, bool isCDATA);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The item handlers keyed by the element paths.
+    QHash<QString, ItemHandler> itemHandlers_;
+
+    //! The error in the last parse.
+    QString errorString_;
+};
+
+#endif // DOCUMENTSTREAMPARSER_H
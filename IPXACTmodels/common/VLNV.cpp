@@ -11,6 +11,7 @@
 
 #include "VLNV.h"
 
+#include <QHash>
 #include <QString>
 #include <QStringList>
 #include <QObject>
@@ -440,3 +441,11 @@ QString VLNV::IPXactType2String(IPXactType const& type)
         return QStringLiteral("invalid");
 	}
 }
+
+//-----------------------------------------------------------------------------
+// Function: qHash()
+//-----------------------------------------------------------------------------
+uint qHash(VLNV const& vlnv, uint seed)
+{
+    return qHash(vlnv.toString().toLower(), seed);
+}
@@ -259,6 +259,17 @@ private:
 	IPXactType type_;
 };
 
+/*! Calculates the hash of a VLNV, so VLNVs can be used in QSet and QHash.
+ *
+ *  The hash ignores the case and the type of the VLNV, as the comparison does.
+ *
+ *      @param [in] vlnv    The VLNV to hash.
+ *      @param [in] seed    The seed for the hash.
+ *
+ *      @return The hash of the VLNV.
+ */
+IPXACTMODELS_EXPORT uint qHash(VLNV const& vlnv, uint seed = 0);
+
 // With this declaration, VLNV can be used as a QVariant.
 Q_DECLARE_METATYPE(VLNV);
 
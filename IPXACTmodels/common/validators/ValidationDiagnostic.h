@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------------
+// File: ValidationDiagnostic.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// A problem found when validating a document.
+//-----------------------------------------------------------------------------
+
+#ifndef VALIDATIONDIAGNOSTIC_H
+#define VALIDATIONDIAGNOSTIC_H
+
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! A problem found when validating a document.
+//-----------------------------------------------------------------------------
+struct ValidationDiagnostic
+{
+    //! The severity of the problem.
+    enum Severity
+    {
+        SEVERITY_WARNING,   //!< The document is valid, but may not work as intended.
+        SEVERITY_ERROR      //!< The document is not valid.
+    };
+
+    //! The constructor for an empty diagnostic.
+    ValidationDiagnostic() = default;
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] diagnosticSeverity  The severity of the problem.
+     *      @param [in] path                The path of the element containing the problem.
+     *      @param [in] text                The description of the problem.
+     */
+    ValidationDiagnostic(Severity diagnosticSeverity, QString const& path, QString const& text):
+        severity(diagnosticSeverity), elementPath(path), message(text)
+    {
+
+    }
+
+    /*!
+     *  Adds the messages found in an element as diagnostics of the given severity.
+     *
+     *      @param [in/out] diagnostics     The list to add the diagnostics to.
+     *      @param [in] messages            The messages found in the element.
+     *      @param [in] elementPath         The path of the element.
+     *      @param [in] messageSeverity     The severity reported for the messages.
+     */
+    static void appendMessages(QVector<ValidationDiagnostic>& diagnostics, QVector<QString> const& messages,
+        QString const& elementPath, Severity messageSeverity)
+    {
+        for (QString const& message : messages)
+        {
+            diagnostics.append(ValidationDiagnostic(messageSeverity, elementPath, message));
+        }
+    }
+
+    //! The severity of the problem.
+    Severity severity = SEVERITY_ERROR;
+
+    //! The path of the element containing the problem, e.g. the VLNV of the document followed by the section
+    //! containing the problem, or a file path.
+    QString elementPath;
+
+    //! The description of the problem.
+    QString message;
+};
+
+#endif // VALIDATIONDIAGNOSTIC_H
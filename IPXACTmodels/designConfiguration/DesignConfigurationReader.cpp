@@ -255,35 +255,43 @@ void DesignConfigurationReader::parseViewConfigurations(QDomDocument const& desi
 
     for (int i = 0; i < viewConfigurationNodes.size(); ++i)
     {
-        QDomNode singleViewConfigurationNode = viewConfigurationNodes.at(i);
+        newDesignConfiguration->getViewConfigurations()->append(
+            parseSingleViewConfiguration(viewConfigurationNodes.at(i)));
+    }
+}
 
-        QSharedPointer<ViewConfiguration> newViewConfiguration (new ViewConfiguration());
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationReader::parseSingleViewConfiguration()
+//-----------------------------------------------------------------------------
+QSharedPointer<ViewConfiguration> DesignConfigurationReader::parseSingleViewConfiguration(
+    QDomNode const& singleViewConfigurationNode) const
+{
+    QSharedPointer<ViewConfiguration> newViewConfiguration (new ViewConfiguration());
 
-        newViewConfiguration->setInstanceName(
-            singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:instanceName")).firstChild().nodeValue());
-        newViewConfiguration->setIsPresent(
-            singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue());
+    newViewConfiguration->setInstanceName(
+        singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:instanceName")).firstChild().nodeValue());
+    newViewConfiguration->setIsPresent(
+        singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue());
 
-        QDomNode viewNode = singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:view"));
-        
-        QDomNamedNodeMap attributeMap = viewNode.attributes();
+    QDomNode viewNode = singleViewConfigurationNode.firstChildElement(QStringLiteral("ipxact:view"));
+    
+    QDomNamedNodeMap attributeMap = viewNode.attributes();
 
-        newViewConfiguration->setViewReference(attributeMap.namedItem(QStringLiteral("viewRef")).nodeValue());
+    newViewConfiguration->setViewReference(attributeMap.namedItem(QStringLiteral("viewRef")).nodeValue());
 
-        QDomNode multipleConfigurableElementsNode = viewNode.firstChildElement(QStringLiteral("ipxact:configurableElementValues"));
+    QDomNode multipleConfigurableElementsNode = viewNode.firstChildElement(QStringLiteral("ipxact:configurableElementValues"));
 
-        QDomNodeList configurableElementNodes = multipleConfigurableElementsNode.childNodes();
+    QDomNodeList configurableElementNodes = multipleConfigurableElementsNode.childNodes();
 
-        for (int i = 0; i < configurableElementNodes.size(); ++i)
-        {
-            QSharedPointer<ConfigurableElementValue> newConfigurableElementValue =
-                parseConfigurableElementValue(configurableElementNodes.at(i));
-
-            newViewConfiguration->getViewConfigurableElements()->append(newConfigurableElementValue);
-        }
+    for (int i = 0; i < configurableElementNodes.size(); ++i)
+    {
+        QSharedPointer<ConfigurableElementValue> newConfigurableElementValue =
+            parseConfigurableElementValue(configurableElementNodes.at(i));
 
-        newDesignConfiguration->getViewConfigurations()->append(newViewConfiguration);
+        newViewConfiguration->getViewConfigurableElements()->append(newConfigurableElementValue);
     }
+
+    return newViewConfiguration;
 }
 
 //-----------------------------------------------------------------------------
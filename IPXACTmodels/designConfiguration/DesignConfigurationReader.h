@@ -44,6 +44,17 @@ public:
     QSharedPointer<DesignConfiguration> createDesignConfigurationFrom(
         QDomDocument const& document) const;
 
+protected:
+
+    /*!
+     *  Reads a single view configuration from XML.
+     *
+     *      @param [in] viewConfigurationNode   The XML description of the view configuration.
+     *
+     *      @return The created view configuration.
+     */
+    QSharedPointer<ViewConfiguration> parseSingleViewConfiguration(QDomNode const& viewConfigurationNode) const;
+
 private:
 
     // Disable copying.
@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+// File: DesignConfigurationStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming XML reader class for IP-XACT design configuration element.
+//-----------------------------------------------------------------------------
+
+#include "DesignConfigurationStreamReader.h"
+
+#include <IPXACTmodels/common/DocumentStreamParser.h>
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::DesignConfigurationStreamReader()
+//-----------------------------------------------------------------------------
+DesignConfigurationStreamReader::DesignConfigurationStreamReader(): DesignConfigurationReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::~DesignConfigurationStreamReader()
+//-----------------------------------------------------------------------------
+DesignConfigurationStreamReader::~DesignConfigurationStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::createDesignConfigurationFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<DesignConfiguration> DesignConfigurationStreamReader::createDesignConfigurationFrom(
+    QIODevice* device) const
+{
+    QList<QSharedPointer<ViewConfiguration> > viewConfigurations;
+
+    DocumentStreamParser parser;
+    parser.addItemHandler(QStringLiteral("ipxact:viewConfiguration"),
+        [this, &viewConfigurations](QDomElement const& viewConfigurationElement, int)
+    {
+        viewConfigurations.append(parseSingleViewConfiguration(viewConfigurationElement));
+    });
+
+    QDomDocument shellDocument;
+    if (parser.parse(device, shellDocument) == false)
+    {
+        return QSharedPointer<DesignConfiguration>();
+    }
+
+    QSharedPointer<DesignConfiguration> newDesignConfiguration =
+        DesignConfigurationReader::createDesignConfigurationFrom(shellDocument);
+
+    QSharedPointer<QList<QSharedPointer<ViewConfiguration> > > shellViewConfigurations =
+        newDesignConfiguration->getViewConfigurations();
+    *shellViewConfigurations = viewConfigurations + *shellViewConfigurations;
+
+    return newDesignConfiguration;
+}
@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// File: DesignConfigurationStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Streaming XML reader class for IP-XACT design configuration element.
+//-----------------------------------------------------------------------------
+
+#ifndef DESIGNCONFIGURATIONSTREAMREADER_H
+#define DESIGNCONFIGURATIONSTREAMREADER_H
+
+#include "DesignConfigurationReader.h"
+
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Streaming XML reader class for IP-XACT design configuration element.
+//
+// View configurations are read one at a time from the stream, so the whole document is never held in
+// memory as a DOM tree.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DesignConfigurationStreamReader : public DesignConfigurationReader
+{
+public:
+
+    //! The constructor.
+    DesignConfigurationStreamReader();
+
+    //! The destructor.
+    ~DesignConfigurationStreamReader();
+
+    using DesignConfigurationReader::createDesignConfigurationFrom;
+
+    /*!
+     *  Creates a design configuration by reading the given device.
+     *
+     *      @param [in] device  The device containing the design configuration XML.
+     *
+     *      @return The created design configuration or null, if the XML could not be read.
+     */
+    QSharedPointer<DesignConfiguration> createDesignConfigurationFrom(QIODevice* device) const;
+
+private:
+
+    // Disable copying.
+    DesignConfigurationStreamReader(DesignConfigurationStreamReader const& rhs);
+    DesignConfigurationStreamReader& operator=(DesignConfigurationStreamReader const& rhs);
+};
+
+#endif // DESIGNCONFIGURATIONSTREAMREADER_H
@@ -271,6 +271,44 @@ void DesignConfigurationValidator::findErrorsIn(QVector<QString>& errors,
     findErrorsInAssertions(errors, designConfiguration, context);
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationValidator::findDiagnosticsIn()
+//-----------------------------------------------------------------------------
+void DesignConfigurationValidator::findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics,
+    QSharedPointer<DesignConfiguration> designConfiguration)
+{
+    QString context = QObject::tr("design configuration %1").arg(designConfiguration->getVlnv().toString());
+    QString configurationPath = designConfiguration->getVlnv().toString();
+
+    QVector<QString> vlnvErrors;
+    findErrorsInVLNV(vlnvErrors, designConfiguration);
+    ValidationDiagnostic::appendMessages(diagnostics, vlnvErrors, configurationPath,
+        ValidationDiagnostic::SEVERITY_ERROR);
+
+    typedef void (DesignConfigurationValidator::*Section)(QVector<QString>&, QSharedPointer<DesignConfiguration>,
+        QString const&) const;
+
+    // The sections report only the problems failing their validity checks, so each message is an error.
+    auto findInSection = [this, &diagnostics, designConfiguration, &context, &configurationPath](
+        QString const& sectionName, Section findErrors)
+    {
+        QVector<QString> sectionErrors;
+        (this->*findErrors)(sectionErrors, designConfiguration, context);
+        ValidationDiagnostic::appendMessages(diagnostics, sectionErrors,
+            configurationPath + QLatin1Char('/') + sectionName, ValidationDiagnostic::SEVERITY_ERROR);
+    };
+
+    findInSection(QStringLiteral("designRef"), &DesignConfigurationValidator::findErrorsInDesignReference);
+    findInSection(QStringLiteral("generatorChainConfigurations"),
+        &DesignConfigurationValidator::findErrorsInGeneratorChainConfigurations);
+    findInSection(QStringLiteral("interconnectionConfigurations"),
+        &DesignConfigurationValidator::findErrorsInInterconnectionConfigurations);
+    findInSection(QStringLiteral("viewConfigurations"),
+        &DesignConfigurationValidator::findErrorsInViewConfigurations);
+    findInSection(QStringLiteral("parameters"), &DesignConfigurationValidator::findErrorsInParameters);
+    findInSection(QStringLiteral("assertions"), &DesignConfigurationValidator::findErrorsInAssertions);
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignConfigurationValidator::findErrorsInVLNV()
 //-----------------------------------------------------------------------------
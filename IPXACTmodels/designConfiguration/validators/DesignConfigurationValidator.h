@@ -14,6 +14,8 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <IPXACTmodels/common/validators/ValidationDiagnostic.h>
+
 #include <QSharedPointer>
 #include <QString>
 #include <QVector>
@@ -126,6 +128,17 @@ public:
      */
     void findErrorsIn(QVector<QString>& errors, QSharedPointer<DesignConfiguration> designConfiguration);
 
+    /*!
+     *  Locate the problems within a design configuration in a single pass. Each problem is reported with the
+     *  path of the design configuration section containing it. The problems fail the validation, so they are
+     *  reported as errors.
+     *
+     *      @param [in] diagnostics             List of found problems.
+     *      @param [in] designConfiguration     The selected design configuration.
+     */
+    void findDiagnosticsIn(QVector<ValidationDiagnostic>& diagnostics,
+        QSharedPointer<DesignConfiguration> designConfiguration);
+
 protected:
 
     /*!
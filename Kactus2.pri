@@ -12,6 +12,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./VersionHelper.h \
     ./editors/ComponentEditor/common/ComponentParameterFinder.h \
     ./editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h \
+    ./editors/ComponentEditor/referenceCounter/ParameterReferenceIndex.h \
     ./editors/ComponentEditor/referenceCounter/ReferenceCounter.h \
     ./common/NameGenerationPolicy.h \
     ./common/Global.h \
@@ -215,6 +216,8 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./library/DocumentFileAccess.h \
     ./library/DocumentValidator.h \
     ./library/LibraryInterface.h \
+    ./library/DocumentCache.h \
+    ./library/DependencyGraph.h \
     ./library/LibraryItemSelectionFactory.h \
     ./library/LibraryUtils.h \
     ./library/TableViewDialog.h \
@@ -227,6 +230,8 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./library/LibraryTreeWidget.h \
     ./library/LibraryTreeView.h \
     ./library/LibraryLoader.h \
+    ./library/LibraryIndex.h \
+    ./library/LibraryFileWatcher.h \
     ./library/LibraryWidget.h \
     ./library/VLNVDialer/dialerwidget.h \
     ./library/VLNVDialer/filterwidget.h \
@@ -459,6 +464,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/treeStructure/componenteditorparametersitem.h \
     ./editors/ComponentEditor/treeStructure/componenteditorportsitem.h \
     ./editors/ComponentEditor/treeStructure/componenteditorregisteritem.h \
+    ./editors/ComponentEditor/treeStructure/ElementValidityCache.h \
     ./editors/ComponentEditor/visualization/fieldgapitem.h \
     ./editors/ComponentEditor/visualization/memorygapitem.h \
     ./editors/ComponentEditor/visualization/memoryvisualizationitem.h \
@@ -480,6 +486,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/common/NullParser.h \
     ./editors/ComponentEditor/common/ParameterFinder.h \
     ./editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ./editors/ComponentEditor/common/BigInteger.h \
     ./editors/ComponentEditor/common/SystemVerilogSyntax.h \
     ./editors/ComponentEditor/common/AbstractParameterModel.h \
     ./editors/ComponentEditor/common/CompleterPopupTable.h \
@@ -488,6 +495,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/common/InstantiationConfigurableElementEditor.h \
     ./editors/ComponentEditor/common/MultilineDescriptionDelegate.h \
     ./editors/ComponentEditor/common/ParameterCache.h \
+    ./editors/ComponentEditor/common/ParameterDependencyGraph.h \
     ./editors/ComponentEditor/common/ParameterCompleter.h \
     ./editors/ComponentEditor/common/ParameterizableTable.h \
     ./editors/ComponentEditor/common/ReferencingTableModel.h \
@@ -955,6 +963,8 @@ SOURCES += ./VersionHelper.cpp \
     ./Plugins/common/LanguageHighlighter.cpp \
     ./Plugins/common/SourceHighlightStyle.cpp \
     ./library/DocumentFileAccess.cpp \
+    ./library/DocumentCache.cpp \
+    ./library/DependencyGraph.cpp \
     ./library/DocumentValidator.cpp \
     ./library/LibraryErrorModel.cpp \
     ./library/LibraryFilter.cpp \
@@ -962,6 +972,8 @@ SOURCES += ./VersionHelper.cpp \
     ./library/LibraryItem.cpp \
     ./library/LibraryItemSelectionFactory.cpp \
     ./library/LibraryLoader.cpp \
+    ./library/LibraryIndex.cpp \
+    ./library/LibraryFileWatcher.cpp \
     ./library/LibraryTreeFilter.cpp \
     ./library/LibraryTreeModel.cpp \
     ./library/LibraryTreeView.cpp \
@@ -1243,13 +1255,16 @@ SOURCES += ./VersionHelper.cpp \
     ./editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ./editors/ComponentEditor/common/NullParser.cpp \
     ./editors/ComponentEditor/common/ParameterCache.cpp \
+    ./editors/ComponentEditor/common/ParameterDependencyGraph.cpp \
     ./editors/ComponentEditor/common/ParameterCompleter.cpp \
     ./editors/ComponentEditor/common/ParameterizableTable.cpp \
     ./editors/ComponentEditor/common/ReferencingTableModel.cpp \
     ./editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ./editors/ComponentEditor/common/BigInteger.cpp \
     ./editors/ComponentEditor/common/ReferenceSelector/ReferenceSelector.cpp \
     ./editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.cpp \
     ./editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.cpp \
+    ./editors/ComponentEditor/referenceCounter/ParameterReferenceIndex.cpp \
     ./editors/ComponentEditor/parameterReferenceTree/ComponentParameterReferenceTree.cpp \
     ./editors/ComponentEditor/parameterReferenceTree/ParameterReferenceTree.cpp \
     ./editors/ComponentEditor/parameterReferenceTree/ParameterReferenceTreeWindow.cpp \
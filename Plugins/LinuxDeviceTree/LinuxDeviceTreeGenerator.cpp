@@ -209,8 +209,8 @@ void LinuxDeviceTreeGenerator::writePath(QTextStream& outputStream,
     if (endMemoryItem)
     {
         QString endItemName = endMemoryItem->getName();
-        quint64 endItemBaseAddress = pathVariables.remappedAddress_;
-        quint64 endItemLastAddress = pathVariables.remappedEndAddress_;
+        BigInteger endItemBaseAddress = pathVariables.remappedAddress_;
+        BigInteger endItemLastAddress = pathVariables.remappedEndAddress_;
         writeItem(outputStream, endItemName, endItemBaseAddress, endItemLastAddress);
     }
 
@@ -272,8 +272,8 @@ void LinuxDeviceTreeGenerator::writeMultipleItems(QTextStream& outputStream,
             QSharedPointer<MemoryItem> spaceMemory = spaceInterface->getConnectedMemory();
             QString spaceName = spaceMemory->getName();
 
-            quint64 offset = spaceChain.spaceConnectionBaseAddress_;
-            quint64 spaceEndAddress = spaceMemory->getRange().toULongLong() + offset - 1;
+            BigInteger offset = spaceChain.spaceConnectionBaseAddress_;
+            BigInteger spaceEndAddress = BigInteger::fromString(spaceMemory->getRange()) + offset - BigInteger(1);
 
             writeItem(outputStream, spaceName, offset, spaceEndAddress);
         }
@@ -283,12 +283,11 @@ void LinuxDeviceTreeGenerator::writeMultipleItems(QTextStream& outputStream,
 //-----------------------------------------------------------------------------
 // Function: LinuxDeviceTreeGenerator::writeItem()
 //-----------------------------------------------------------------------------
-void LinuxDeviceTreeGenerator::writeItem(QTextStream& outputStream, QString const& itemName, quint64 baseAddress,
-    quint64 lastAddress)
+void LinuxDeviceTreeGenerator::writeItem(QTextStream& outputStream, QString const& itemName,
+    BigInteger const& baseAddress, BigInteger const& lastAddress)
 {
-    outputStream << "\t" << itemName << "@" << QString::number(baseAddress, 16) << " {" << endl;
-    outputStream << "\t\treg = <0x" << QString::number(baseAddress, 16) << " 0x" <<
-        QString::number(lastAddress, 16) << ">;" << endl;
+    outputStream << "\t" << itemName << "@" << baseAddress.toString(16) << " {" << endl;
+    outputStream << "\t\treg = <0x" << baseAddress.toString(16) << " 0x" << lastAddress.toString(16) << ">;" << endl;
 
     writeLineEnding(outputStream, QString("\t"));
     outputStream << endl;
@@ -178,7 +178,8 @@ private:
      *		@param [in]	baseAddress     Base address of the selected item.
      *		@param [in]	lastAddress     Last address of the selected item.
      */
-    void writeItem(QTextStream& outputStream, QString const& itemName, quint64 baseAddress, quint64 lastAddress);
+    void writeItem(QTextStream& outputStream, QString const& itemName, BigInteger const& baseAddress,
+        BigInteger const& lastAddress);
 
     /*!
      *	Write the unconnected CPUs of the design.
@@ -7,6 +7,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/MemoryDesigner/ConnectivityComponent.h \
     ../../editors/MemoryDesigner/ConnectivityConnection.h \
     ../../editors/MemoryDesigner/ConnectivityGraph.h \
@@ -31,6 +32,7 @@ SOURCES += ../../editors/common/ComponentInstanceParameterFinder.cpp \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../editors/ComponentEditor/common/ParameterCache.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../editors/MemoryDesigner/ConnectivityComponent.cpp \
     ../../editors/MemoryDesigner/ConnectivityConnection.cpp \
     ../../editors/MemoryDesigner/ConnectivityGraph.cpp \
@@ -6,6 +6,7 @@ HEADERS += ../../common/NameGenerationPolicy.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/ComponentEditor/common/SystemVerilogSyntax.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ./MakeCommon.h \
@@ -22,6 +23,7 @@ SOURCES += ../../common/NameGenerationPolicy.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../editors/ComponentEditor/common/ListParameterFinder.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../PluginSystem/GeneratorPlugin/FileOutputWidget.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ./MakeConfiguration.cpp \
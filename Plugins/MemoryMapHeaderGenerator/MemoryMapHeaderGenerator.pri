@@ -12,6 +12,7 @@ HEADERS += ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ./memorymapheadergenerator_global.h \
     ./systemheadersavemodel.h \
     ./memorymapheadergenerator.h \
@@ -26,6 +27,7 @@ SOURCES += ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../editors/ComponentEditor/common/ListParameterFinder.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ./BaseMemoryMapHeaderWriter.cpp \
     ./globalheadersavemodel.cpp \
     ./GlobalMemoryMapHeaderWriter.cpp \
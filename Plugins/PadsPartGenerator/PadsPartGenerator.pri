@@ -9,12 +9,14 @@ HEADERS += ./PadsAsciiSyntax.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../editors/ComponentEditor/common/ParameterFinder.h \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h
 
 SOURCES += ./PadsPartGenerator.cpp \
     ./PadsPartGeneratorDialog.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp
 
 RESOURCES += PadsPartGenerator.qrc
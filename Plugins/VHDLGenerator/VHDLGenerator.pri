@@ -17,6 +17,7 @@ HEADERS += ../../common/utils.h \
     ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../common/HDLParser/HDLCommandLineParser.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ./vhdlcomponentdeclaration.h \
@@ -46,6 +47,7 @@ SOURCES += ../../common/utils.cpp \
     ../../editors/ComponentEditor/common/ListParameterFinder.cpp \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../common/HDLParser/HDLCommandLineParser.cpp \
     ../LinuxDeviceTree/LinuxDeviceTreeDialog.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
@@ -12,6 +12,7 @@ HEADERS += ../../common/NameGenerationPolicy.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../editors/ComponentEditor/common/NullParser.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../common/HDLmath.h \
     ./VerilogParameterParser.h \
     ./VerilogPortParser.h \
@@ -23,6 +24,7 @@ SOURCES += ../../common/NameGenerationPolicy.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../editors/ComponentEditor/common/NullParser.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ./VerilogImporter.cpp \
     ./VerilogParameterParser.cpp \
     ./VerilogPortParser.cpp \
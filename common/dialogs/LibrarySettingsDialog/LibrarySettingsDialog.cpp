@@ -14,6 +14,8 @@
 
 #include <common/dialogs/LibrarySettingsDialog/LibrarySettingsColumns.h>
 
+#include <library/DocumentCache.h>
+
 #include <QCheckBox>
 #include <QDialogButtonBox>
 #include <QFileDialog>
@@ -24,6 +26,7 @@
 #include <QIcon>
 #include <QLabel>
 #include <QStringList>
+#include <QThread>
 #include <QVBoxLayout>
 
 //-----------------------------------------------------------------------------
@@ -36,6 +39,10 @@ iconProvider_(),
 libLocationsTable_(0),
 addLocationButton_(new QPushButton(QIcon(":/icons/common/graphics/add.png"), QString(), this)),
 removeLocationButton_(new QPushButton(QIcon(":/icons/common/graphics/remove.png"), QString(), this)),
+scanThreadEditor_(new QSpinBox(this)),
+streamingReaderBox_(new QCheckBox(tr("Use streaming readers for components and designs"), this)),
+cacheBudgetEditor_(new QSpinBox(this)),
+parallelValidationBox_(new QCheckBox(tr("Validate components in parallel"), this)),
 changed_(false),
 checkMarkIcon_(":/icons/common/graphics/checkMark.png")
 {
@@ -90,6 +97,37 @@ checkMarkIcon_(":/icons/common/graphics/checkMark.png")
     locationLayout->addWidget(libLocationsTable_);
     locationLayout->addWidget(listButtonBox);
 
+    QGroupBox* scanGroup = new QGroupBox(tr("Library scan"), this);
+
+    scanThreadEditor_->setRange(1, 64);
+    scanThreadEditor_->setToolTip(tr("Number of threads used to read the library files and to check "
+        "the library integrity. Use 1 to read the files sequentially."));
+
+    streamingReaderBox_->setToolTip(tr("Read components, designs and design configurations without "
+        "building the whole document in memory. Reduces memory use for large documents."));
+
+    cacheBudgetEditor_->setRange(0, 1024 * 1024);
+    cacheBudgetEditor_->setSingleStep(256);
+    cacheBudgetEditor_->setSuffix(tr(" MB"));
+    cacheBudgetEditor_->setSpecialValueText(tr("Unlimited"));
+    cacheBudgetEditor_->setToolTip(tr("Memory budget for the parsed library documents. "
+        "The least recently used documents are released when the budget is exceeded."));
+
+    parallelValidationBox_->setToolTip(tr("Validate the parts of each component, e.g. the ports and the memory "
+        "maps, in parallel threads. Speeds up the integrity check of libraries with large components."));
+
+    QHBoxLayout* scanLayout = new QHBoxLayout(scanGroup);
+    scanLayout->addWidget(new QLabel(tr("Scan threads:"), scanGroup));
+    scanLayout->addWidget(scanThreadEditor_);
+    scanLayout->addSpacing(20);
+    scanLayout->addWidget(streamingReaderBox_);
+    scanLayout->addSpacing(20);
+    scanLayout->addWidget(new QLabel(tr("Document cache:"), scanGroup));
+    scanLayout->addWidget(cacheBudgetEditor_);
+    scanLayout->addSpacing(20);
+    scanLayout->addWidget(parallelValidationBox_);
+    scanLayout->addStretch(1);
+
     QGroupBox* separator = new QGroupBox(this);
     separator->setFlat(true);
 
@@ -99,6 +137,7 @@ checkMarkIcon_(":/icons/common/graphics/checkMark.png")
     QVBoxLayout* topLayout = new QVBoxLayout(this);
     topLayout->addWidget(introWidget);
     topLayout->addWidget(locationGroup, 1);
+    topLayout->addWidget(scanGroup);
     topLayout->addWidget(separator);
     topLayout->addWidget(buttonBox);
 
@@ -294,6 +333,10 @@ void LibrarySettingsDialog::accept()
     settings_.setValue("Library/Locations", locations);
     settings_.setValue("Library/DefaultLocation", defaultLocation);
     settings_.setValue("Library/ActiveLocations", activeLocations);
+    settings_.setValue("Library/ScanThreadCount", scanThreadEditor_->value());
+    settings_.setValue("Library/StreamingReaders", streamingReaderBox_->isChecked());
+    settings_.setValue("Library/CacheBudget", cacheBudgetEditor_->value());
+    settings_.setValue("Library/ParallelValidation", parallelValidationBox_->isChecked());
 
     if (changed_)
     {
@@ -328,6 +371,14 @@ void LibrarySettingsDialog::loadSettings()
 
     libLocationsTable_->setCurrentIndex(QModelIndex());
 
+    scanThreadEditor_->setValue(
+        settings_.value(QStringLiteral("Library/ScanThreadCount"), QThread::idealThreadCount()).toInt());
+    streamingReaderBox_->setChecked(settings_.value(QStringLiteral("Library/StreamingReaders"), false).toBool());
+    cacheBudgetEditor_->setValue(
+        settings_.value(QStringLiteral("Library/CacheBudget"), DocumentCache::DEFAULT_BUDGET_MB).toInt());
+    parallelValidationBox_->setChecked(
+        settings_.value(QStringLiteral("Library/ParallelValidation"), false).toBool());
+
     changed_ = false;
 }
 
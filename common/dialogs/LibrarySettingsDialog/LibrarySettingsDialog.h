@@ -12,10 +12,12 @@
 #ifndef LIBRARYSETTINGSDIALOG_H
 #define LIBRARYSETTINGSDIALOG_H
 
+#include <QCheckBox>
 #include <QDialog>
 #include <QFileIconProvider>
 #include <QPushButton>
 #include <QSettings>
+#include <QSpinBox>
 #include <QTableWidget>
 #include <QTableWidgetItem>
 #include <QIcon>
@@ -148,6 +150,18 @@ private:
 	 //! Remove location button.
 	 QPushButton* removeLocationButton_;
 
+     //! Editor for the number of threads used in library scan.
+     QSpinBox* scanThreadEditor_;
+
+     //! Selection for reading documents with the streaming readers.
+     QCheckBox* streamingReaderBox_;
+
+     //! Editor for the memory budget of the parsed document cache.
+     QSpinBox* cacheBudgetEditor_;
+
+     //! Selection for validating the sections of the components in parallel.
+     QCheckBox* parallelValidationBox_;
+
 	 //! OK button.
 	 QPushButton* okButton_;
 
@@ -0,0 +1,790 @@
+//-----------------------------------------------------------------------------
+// File: BigInteger.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Signed integer of arbitrary width.
+//-----------------------------------------------------------------------------
+
+#include "BigInteger.h"
+
+#include <algorithm>
+
+namespace
+{
+    //! The number of bits in a digit of the magnitude.
+    const int DIGIT_BITS = 32;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::BigInteger()
+//-----------------------------------------------------------------------------
+BigInteger::BigInteger():
+negative_(false),
+    magnitude_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::BigInteger()
+//-----------------------------------------------------------------------------
+BigInteger::BigInteger(qint64 value):
+negative_(value < 0),
+    magnitude_()
+{
+    // The magnitude is calculated in unsigned arithmetic, so the smallest value does not overflow.
+    quint64 magnitude = negative_ ? ~static_cast<quint64>(value) + 1 : static_cast<quint64>(value);
+    while (magnitude != 0)
+    {
+        magnitude_.append(static_cast<quint32>(magnitude));
+        magnitude >>= DIGIT_BITS;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::fromUnsigned()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::fromUnsigned(quint64 value)
+{
+    Digits magnitude;
+    while (value != 0)
+    {
+        magnitude.append(static_cast<quint32>(value));
+        value >>= DIGIT_BITS;
+    }
+
+    return fromMagnitude(false, magnitude);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::fromString()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::fromString(QString const& text, int base, bool* ok)
+{
+    if (ok != nullptr)
+    {
+        *ok = false;
+    }
+
+    if (base < 2 || base > 16)
+    {
+        return BigInteger();
+    }
+
+    int index = 0;
+    bool negative = false;
+    if (index < text.size() && (text.at(index) == QLatin1Char('-') || text.at(index) == QLatin1Char('+')))
+    {
+        negative = text.at(index) == QLatin1Char('-');
+        ++index;
+    }
+
+    Digits magnitude;
+    bool hasDigits = false;
+    for (; index < text.size(); ++index)
+    {
+        QChar character = text.at(index);
+
+        int digit = -1;
+        if (character >= QLatin1Char('0') && character <= QLatin1Char('9'))
+        {
+            digit = character.unicode() - '0';
+        }
+        else if (character >= QLatin1Char('a') && character <= QLatin1Char('f'))
+        {
+            digit = character.unicode() - 'a' + 10;
+        }
+        else if (character >= QLatin1Char('A') && character <= QLatin1Char('F'))
+        {
+            digit = character.unicode() - 'A' + 10;
+        }
+
+        if (digit < 0 || digit >= base)
+        {
+            return BigInteger();
+        }
+
+        multiplyAdd(magnitude, base, digit);
+        hasDigits = true;
+    }
+
+    if (hasDigits == false)
+    {
+        return BigInteger();
+    }
+
+    if (ok != nullptr)
+    {
+        *ok = true;
+    }
+
+    return fromMagnitude(negative, magnitude);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::toString()
+//-----------------------------------------------------------------------------
+QString BigInteger::toString(int base) const
+{
+    if (base < 2 || base > 16)
+    {
+        base = 10;
+    }
+
+    if (isZero())
+    {
+        return QStringLiteral("0");
+    }
+
+    static const char DIGIT_CHARACTERS[] = "0123456789abcdef";
+
+    // The digits are collected least significant first and reversed in the end.
+    QString reversed;
+    Digits remaining = magnitude_;
+    while (remaining.isEmpty() == false)
+    {
+        reversed.append(QLatin1Char(DIGIT_CHARACTERS[divideByDigit(remaining, base)]));
+    }
+
+    if (negative_)
+    {
+        reversed.append(QLatin1Char('-'));
+    }
+
+    std::reverse(reversed.begin(), reversed.end());
+    return reversed;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::isZero()
+//-----------------------------------------------------------------------------
+bool BigInteger::isZero() const
+{
+    return magnitude_.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::isNegative()
+//-----------------------------------------------------------------------------
+bool BigInteger::isNegative() const
+{
+    return negative_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::fitsInLongLong()
+//-----------------------------------------------------------------------------
+bool BigInteger::fitsInLongLong() const
+{
+    int bits = bitLength();
+    if (bits < 64)
+    {
+        return true;
+    }
+
+    // The smallest 64-bit value has the magnitude 2^63.
+    return negative_ && bits == 64 && magnitude_.at(0) == 0 && magnitude_.at(1) == 0x80000000u;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::toLongLong()
+//-----------------------------------------------------------------------------
+qint64 BigInteger::toLongLong() const
+{
+    return static_cast<qint64>(toULongLong());
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::toULongLong()
+//-----------------------------------------------------------------------------
+quint64 BigInteger::toULongLong() const
+{
+    quint64 lowBits = 0;
+    if (magnitude_.size() > 0)
+    {
+        lowBits = magnitude_.at(0);
+    }
+    if (magnitude_.size() > 1)
+    {
+        lowBits |= static_cast<quint64>(magnitude_.at(1)) << DIGIT_BITS;
+    }
+
+    if (negative_)
+    {
+        return ~lowBits + 1;
+    }
+
+    return lowBits;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::toDouble()
+//-----------------------------------------------------------------------------
+double BigInteger::toDouble() const
+{
+    double value = 0;
+    for (int i = magnitude_.size() - 1; i >= 0; --i)
+    {
+        value = value * 4294967296.0 + magnitude_.at(i);
+    }
+
+    return negative_ ? -value : value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::bitLength()
+//-----------------------------------------------------------------------------
+int BigInteger::bitLength() const
+{
+    if (isZero())
+    {
+        return 0;
+    }
+
+    int bits = (magnitude_.size() - 1) * DIGIT_BITS;
+    for (quint32 highest = magnitude_.last(); highest != 0; highest >>= 1)
+    {
+        ++bits;
+    }
+
+    return bits;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator-()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator-() const
+{
+    return fromMagnitude(!negative_, magnitude_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator~()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator~() const
+{
+    // In two's complement ~x equals -x - 1.
+    return -*this - BigInteger(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator+()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator+(BigInteger const& other) const
+{
+    if (negative_ == other.negative_)
+    {
+        return fromMagnitude(negative_, addMagnitudes(magnitude_, other.magnitude_));
+    }
+
+    int comparison = compareMagnitudes(magnitude_, other.magnitude_);
+    if (comparison == 0)
+    {
+        return BigInteger();
+    }
+    else if (comparison > 0)
+    {
+        return fromMagnitude(negative_, subtractMagnitudes(magnitude_, other.magnitude_));
+    }
+
+    return fromMagnitude(other.negative_, subtractMagnitudes(other.magnitude_, magnitude_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator-()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator-(BigInteger const& other) const
+{
+    return *this + (-other);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator*()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator*(BigInteger const& other) const
+{
+    return fromMagnitude(negative_ != other.negative_, multiplyMagnitudes(magnitude_, other.magnitude_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator/()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator/(BigInteger const& other) const
+{
+    if (other.isZero())
+    {
+        return BigInteger();
+    }
+
+    Digits quotient;
+    Digits remainder;
+    divideMagnitudes(magnitude_, other.magnitude_, quotient, remainder);
+
+    return fromMagnitude(negative_ != other.negative_, quotient);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator%()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator%(BigInteger const& other) const
+{
+    if (other.isZero())
+    {
+        return BigInteger();
+    }
+
+    Digits quotient;
+    Digits remainder;
+    divideMagnitudes(magnitude_, other.magnitude_, quotient, remainder);
+
+    // The remainder has the sign of the dividend, as with the built-in integers.
+    return fromMagnitude(negative_, remainder);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator&()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator&(BigInteger const& other) const
+{
+    int digitCount = bitwiseDigitCount(other);
+    Digits result = toTwosComplement(digitCount);
+    Digits otherDigits = other.toTwosComplement(digitCount);
+
+    for (int i = 0; i < digitCount; ++i)
+    {
+        result[i] &= otherDigits.at(i);
+    }
+
+    return fromTwosComplement(result);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator|()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator|(BigInteger const& other) const
+{
+    int digitCount = bitwiseDigitCount(other);
+    Digits result = toTwosComplement(digitCount);
+    Digits otherDigits = other.toTwosComplement(digitCount);
+
+    for (int i = 0; i < digitCount; ++i)
+    {
+        result[i] |= otherDigits.at(i);
+    }
+
+    return fromTwosComplement(result);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator^()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator^(BigInteger const& other) const
+{
+    int digitCount = bitwiseDigitCount(other);
+    Digits result = toTwosComplement(digitCount);
+    Digits otherDigits = other.toTwosComplement(digitCount);
+
+    for (int i = 0; i < digitCount; ++i)
+    {
+        result[i] ^= otherDigits.at(i);
+    }
+
+    return fromTwosComplement(result);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator<<()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator<<(int shift) const
+{
+    if (shift < 0)
+    {
+        return *this >> -shift;
+    }
+
+    if (isZero() || shift == 0)
+    {
+        return *this;
+    }
+
+    int digitShift = shift / DIGIT_BITS;
+    int bitShift = shift % DIGIT_BITS;
+
+    Digits shifted(digitShift, 0);
+    quint32 carry = 0;
+    for (quint32 digit : magnitude_)
+    {
+        if (bitShift == 0)
+        {
+            shifted.append(digit);
+        }
+        else
+        {
+            shifted.append((digit << bitShift) | carry);
+            carry = digit >> (DIGIT_BITS - bitShift);
+        }
+    }
+
+    if (carry != 0)
+    {
+        shifted.append(carry);
+    }
+
+    return fromMagnitude(negative_, shifted);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator>>()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::operator>>(int shift) const
+{
+    if (shift < 0)
+    {
+        return *this << -shift;
+    }
+
+    // Negative values are shifted as in two's complement, i.e. rounded towards negative infinity.
+    if (negative_)
+    {
+        return ~((~*this) >> shift);
+    }
+
+    int digitShift = shift / DIGIT_BITS;
+    int bitShift = shift % DIGIT_BITS;
+    if (digitShift >= magnitude_.size())
+    {
+        return BigInteger();
+    }
+
+    Digits shifted;
+    for (int i = digitShift; i < magnitude_.size(); ++i)
+    {
+        quint32 digit = magnitude_.at(i) >> bitShift;
+        if (bitShift != 0 && i + 1 < magnitude_.size())
+        {
+            digit |= magnitude_.at(i + 1) << (DIGIT_BITS - bitShift);
+        }
+
+        shifted.append(digit);
+    }
+
+    return fromMagnitude(false, shifted);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator==()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator==(BigInteger const& other) const
+{
+    return negative_ == other.negative_ && magnitude_ == other.magnitude_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator!=()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator!=(BigInteger const& other) const
+{
+    return !(*this == other);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator<()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator<(BigInteger const& other) const
+{
+    if (negative_ != other.negative_)
+    {
+        return negative_;
+    }
+
+    int comparison = compareMagnitudes(magnitude_, other.magnitude_);
+    return negative_ ? comparison > 0 : comparison < 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator<=()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator<=(BigInteger const& other) const
+{
+    return !(other < *this);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator>()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator>(BigInteger const& other) const
+{
+    return other < *this;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::operator>=()
+//-----------------------------------------------------------------------------
+bool BigInteger::operator>=(BigInteger const& other) const
+{
+    return !(*this < other);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::fromMagnitude()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::fromMagnitude(bool negative, Digits const& magnitude)
+{
+    BigInteger integer;
+    integer.magnitude_ = magnitude;
+    trim(integer.magnitude_);
+    integer.negative_ = negative && integer.magnitude_.isEmpty() == false;
+
+    return integer;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::trim()
+//-----------------------------------------------------------------------------
+void BigInteger::trim(Digits& magnitude)
+{
+    while (magnitude.isEmpty() == false && magnitude.last() == 0)
+    {
+        magnitude.removeLast();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::compareMagnitudes()
+//-----------------------------------------------------------------------------
+int BigInteger::compareMagnitudes(Digits const& first, Digits const& second)
+{
+    if (first.size() != second.size())
+    {
+        return first.size() < second.size() ? -1 : 1;
+    }
+
+    for (int i = first.size() - 1; i >= 0; --i)
+    {
+        if (first.at(i) != second.at(i))
+        {
+            return first.at(i) < second.at(i) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::addMagnitudes()
+//-----------------------------------------------------------------------------
+BigInteger::Digits BigInteger::addMagnitudes(Digits const& first, Digits const& second)
+{
+    Digits const& longer = first.size() >= second.size() ? first : second;
+    Digits const& shorter = first.size() >= second.size() ? second : first;
+
+    Digits sum;
+    sum.reserve(longer.size() + 1);
+
+    quint64 carry = 0;
+    for (int i = 0; i < longer.size(); ++i)
+    {
+        carry += longer.at(i);
+        if (i < shorter.size())
+        {
+            carry += shorter.at(i);
+        }
+
+        sum.append(static_cast<quint32>(carry));
+        carry >>= DIGIT_BITS;
+    }
+
+    if (carry != 0)
+    {
+        sum.append(static_cast<quint32>(carry));
+    }
+
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::subtractMagnitudes()
+//-----------------------------------------------------------------------------
+BigInteger::Digits BigInteger::subtractMagnitudes(Digits const& first, Digits const& second)
+{
+    Digits difference;
+    difference.reserve(first.size());
+
+    qint64 borrow = 0;
+    for (int i = 0; i < first.size(); ++i)
+    {
+        qint64 digit = static_cast<qint64>(first.at(i)) - borrow;
+        if (i < second.size())
+        {
+            digit -= second.at(i);
+        }
+
+        borrow = 0;
+        if (digit < 0)
+        {
+            digit += Q_INT64_C(1) << DIGIT_BITS;
+            borrow = 1;
+        }
+
+        difference.append(static_cast<quint32>(digit));
+    }
+
+    trim(difference);
+    return difference;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::multiplyMagnitudes()
+//-----------------------------------------------------------------------------
+BigInteger::Digits BigInteger::multiplyMagnitudes(Digits const& first, Digits const& second)
+{
+    if (first.isEmpty() || second.isEmpty())
+    {
+        return Digits();
+    }
+
+    Digits product(first.size() + second.size(), 0);
+    for (int i = 0; i < first.size(); ++i)
+    {
+        quint64 carry = 0;
+        for (int j = 0; j < second.size(); ++j)
+        {
+            carry += static_cast<quint64>(first.at(i)) * second.at(j) + product.at(i + j);
+            product[i + j] = static_cast<quint32>(carry);
+            carry >>= DIGIT_BITS;
+        }
+
+        product[i + second.size()] = static_cast<quint32>(carry);
+    }
+
+    trim(product);
+    return product;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::divideMagnitudes()
+//-----------------------------------------------------------------------------
+void BigInteger::divideMagnitudes(Digits const& dividend, Digits const& divisor, Digits& quotient,
+    Digits& remainder)
+{
+    if (divisor.size() == 1)
+    {
+        quotient = dividend;
+        quint32 digitRemainder = divideByDigit(quotient, divisor.first());
+
+        remainder.clear();
+        if (digitRemainder != 0)
+        {
+            remainder.append(digitRemainder);
+        }
+        return;
+    }
+
+    // Long division one bit at a time. The widths in hardware descriptions keep this fast enough.
+    quotient = Digits(dividend.size(), 0);
+    remainder.clear();
+
+    for (int bit = dividend.size() * DIGIT_BITS - 1; bit >= 0; --bit)
+    {
+        multiplyAdd(remainder, 2, (dividend.at(bit / DIGIT_BITS) >> (bit % DIGIT_BITS)) & 1);
+
+        if (compareMagnitudes(remainder, divisor) >= 0)
+        {
+            remainder = subtractMagnitudes(remainder, divisor);
+            quotient[bit / DIGIT_BITS] |= 1u << (bit % DIGIT_BITS);
+        }
+    }
+
+    trim(quotient);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::multiplyAdd()
+//-----------------------------------------------------------------------------
+void BigInteger::multiplyAdd(Digits& magnitude, quint32 multiplier, quint32 addend)
+{
+    quint64 carry = addend;
+    for (int i = 0; i < magnitude.size(); ++i)
+    {
+        carry += static_cast<quint64>(magnitude.at(i)) * multiplier;
+        magnitude[i] = static_cast<quint32>(carry);
+        carry >>= DIGIT_BITS;
+    }
+
+    if (carry != 0)
+    {
+        magnitude.append(static_cast<quint32>(carry));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::divideByDigit()
+//-----------------------------------------------------------------------------
+quint32 BigInteger::divideByDigit(Digits& magnitude, quint32 divisor)
+{
+    quint64 remainder = 0;
+    for (int i = magnitude.size() - 1; i >= 0; --i)
+    {
+        remainder = (remainder << DIGIT_BITS) | magnitude.at(i);
+        magnitude[i] = static_cast<quint32>(remainder / divisor);
+        remainder %= divisor;
+    }
+
+    trim(magnitude);
+    return static_cast<quint32>(remainder);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::toTwosComplement()
+//-----------------------------------------------------------------------------
+BigInteger::Digits BigInteger::toTwosComplement(int digitCount) const
+{
+    Digits digits = magnitude_;
+    digits.resize(digitCount);
+
+    if (negative_)
+    {
+        quint64 carry = 1;
+        for (int i = 0; i < digitCount; ++i)
+        {
+            carry += static_cast<quint32>(~digits.at(i));
+            digits[i] = static_cast<quint32>(carry);
+            carry >>= DIGIT_BITS;
+        }
+    }
+
+    return digits;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::fromTwosComplement()
+//-----------------------------------------------------------------------------
+BigInteger BigInteger::fromTwosComplement(Digits digits)
+{
+    bool negative = digits.isEmpty() == false && (digits.last() & 0x80000000u) != 0;
+    if (negative)
+    {
+        quint64 carry = 1;
+        for (int i = 0; i < digits.size(); ++i)
+        {
+            carry += static_cast<quint32>(~digits.at(i));
+            digits[i] = static_cast<quint32>(carry);
+            carry >>= DIGIT_BITS;
+        }
+    }
+
+    return fromMagnitude(negative, digits);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::bitwiseDigitCount()
+//-----------------------------------------------------------------------------
+int BigInteger::bitwiseDigitCount(BigInteger const& other) const
+{
+    // One extra digit keeps the sign bit clear of the magnitude.
+    return qMax(magnitude_.size(), other.magnitude_.size()) + 1;
+}
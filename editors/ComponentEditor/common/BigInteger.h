@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// File: BigInteger.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Signed integer of arbitrary width.
+//-----------------------------------------------------------------------------
+
+#ifndef BIGINTEGER_H
+#define BIGINTEGER_H
+
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Signed integer of arbitrary width.
+//
+// The value is stored as a sign and a magnitude of 32-bit digits, least significant digit first. Division and
+// remainder truncate towards zero, and the bitwise operations and the right shift behave as on two's complement
+// numbers of unlimited width, like the corresponding operations on 64-bit integers.
+//-----------------------------------------------------------------------------
+class BigInteger
+{
+public:
+
+    //! The constructor. Creates a zero.
+    BigInteger();
+
+    /*! The constructor.
+     *
+     *      @param [in] value   The value of the integer.
+     */
+    explicit BigInteger(qint64 value);
+
+    //! The destructor.
+    ~BigInteger() = default;
+
+    /*! Creates an integer from an unsigned 64-bit value.
+     *
+     *      @param [in] value   The value of the integer.
+     *
+     *      @return The created integer.
+     */
+    static BigInteger fromUnsigned(quint64 value);
+
+    /*! Creates an integer from text, e.g. "-1234" or "FFFFFFFF" in base 16.
+     *
+     *      @param [in]  text   The digits with an optional sign.
+     *      @param [in]  base   The base of the digits, 2 to 16.
+     *      @param [out] ok     Set to true, if the text was a valid integer, otherwise false.
+     *
+     *      @return The created integer, or zero if the text was not valid.
+     */
+    static BigInteger fromString(QString const& text, int base = 10, bool* ok = nullptr);
+
+    /*! Checks if a text is a decimal integer, which is too wide for a signed 64-bit integer. The check does not
+     *  need the integer itself, so it is also usable where the rest of the class is not linked.
+     *
+     *      @param [in] text    The text to check, e.g. an evaluated expression.
+     *
+     *      @return True, if the text is an integer not fitting in 64 bits, otherwise false.
+     */
+    static bool isWiderThan64Bits(QString const& text);
+
+    /*! Get the integer as text.
+     *
+     *      @param [in] base    The base of the digits, 2 to 16.
+     *
+     *      @return The digits of the integer in lower case, with a minus sign for negative values.
+     */
+    QString toString(int base = 10) const;
+
+    /*! Checks if the integer is zero.
+     *
+     *      @return True, if the integer is zero, otherwise false.
+     */
+    bool isZero() const;
+
+    /*! Checks if the integer is negative.
+     *
+     *      @return True, if the integer is negative, otherwise false.
+     */
+    bool isNegative() const;
+
+    /*! Checks if the integer fits in a signed 64-bit integer.
+     *
+     *      @return True, if the integer fits, otherwise false.
+     */
+    bool fitsInLongLong() const;
+
+    /*! Get the lowest 64 bits of the integer as a signed integer.
+     *
+     *      @return The lowest 64 bits of the integer in two's complement.
+     */
+    qint64 toLongLong() const;
+
+    /*! Get the lowest 64 bits of the integer as an unsigned integer.
+     *
+     *      @return The lowest 64 bits of the integer in two's complement.
+     */
+    quint64 toULongLong() const;
+
+    /*! Get the nearest floating point value of the integer.
+     *
+     *      @return The integer as a floating point value. Integers too large for the type give infinity.
+     */
+    double toDouble() const;
+
+    /*! Get the number of bits needed for the magnitude of the integer.
+     *
+     *      @return The number of bits in the magnitude. Zero has no bits.
+     */
+    int bitLength() const;
+
+    BigInteger operator-() const;
+    BigInteger operator~() const;
+
+    BigInteger operator+(BigInteger const& other) const;
+    BigInteger operator-(BigInteger const& other) const;
+    BigInteger operator*(BigInteger const& other) const;
+
+    //! Division by zero gives zero.
+    BigInteger operator/(BigInteger const& other) const;
+
+    //! Remainder of division by zero gives zero.
+    BigInteger operator%(BigInteger const& other) const;
+
+    BigInteger operator&(BigInteger const& other) const;
+    BigInteger operator|(BigInteger const& other) const;
+    BigInteger operator^(BigInteger const& other) const;
+
+    BigInteger operator<<(int shift) const;
+    BigInteger operator>>(int shift) const;
+
+    bool operator==(BigInteger const& other) const;
+    bool operator!=(BigInteger const& other) const;
+    bool operator<(BigInteger const& other) const;
+    bool operator<=(BigInteger const& other) const;
+    bool operator>(BigInteger const& other) const;
+    bool operator>=(BigInteger const& other) const;
+
+private:
+
+    //! The digits of a magnitude, least significant first.
+    typedef QVector<quint32> Digits;
+
+    /*! Creates an integer from a sign and a magnitude.
+     *
+     *      @param [in] negative    The sign of the integer.
+     *      @param [in] magnitude   The magnitude of the integer.
+     *
+     *      @return The created integer.
+     */
+    static BigInteger fromMagnitude(bool negative, Digits const& magnitude);
+
+    //! Removes the leading zero digits of the magnitude.
+    static void trim(Digits& magnitude);
+
+    /*! Compares two magnitudes.
+     *
+     *      @return Negative, zero or positive, if the first magnitude is smaller, equal or larger.
+     */
+    static int compareMagnitudes(Digits const& first, Digits const& second);
+
+    //! Adds two magnitudes.
+    static Digits addMagnitudes(Digits const& first, Digits const& second);
+
+    //! Subtracts the smaller second magnitude from the first.
+    static Digits subtractMagnitudes(Digits const& first, Digits const& second);
+
+    //! Multiplies two magnitudes.
+    static Digits multiplyMagnitudes(Digits const& first, Digits const& second);
+
+    /*! Divides two magnitudes.
+     *
+     *      @param [in]  dividend   The magnitude to divide.
+     *      @param [in]  divisor    The non-zero magnitude to divide with.
+     *      @param [out] quotient   The quotient of the division.
+     *      @param [out] remainder  The remainder of the division.
+     */
+    static void divideMagnitudes(Digits const& dividend, Digits const& divisor, Digits& quotient,
+        Digits& remainder);
+
+    //! Multiplies a magnitude with a single digit and adds another digit to it.
+    static void multiplyAdd(Digits& magnitude, quint32 multiplier, quint32 addend);
+
+    //! Divides a magnitude with a single digit, returning the remainder.
+    static quint32 divideByDigit(Digits& magnitude, quint32 divisor);
+
+    /*! Get the integer in two's complement.
+     *
+     *      @param [in] digitCount  The number of digits to get, including the sign.
+     *
+     *      @return The digits in two's complement.
+     */
+    Digits toTwosComplement(int digitCount) const;
+
+    //! Creates an integer from digits in two's complement.
+    static BigInteger fromTwosComplement(Digits digits);
+
+    //! The number of digits needed for a bitwise operation of this and the other integer.
+    int bitwiseDigitCount(BigInteger const& other) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The sign of the integer. Zero is never negative.
+    bool negative_;
+
+    //! The magnitude of the integer without leading zero digits. Zero has no digits.
+    Digits magnitude_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: BigInteger::isWiderThan64Bits()
+//-----------------------------------------------------------------------------
+inline bool BigInteger::isWiderThan64Bits(QString const& text)
+{
+    bool fits = false;
+    text.toLongLong(&fits);
+    if (fits)
+    {
+        return false;
+    }
+
+    int firstDigit = (text.startsWith(QLatin1Char('+')) || text.startsWith(QLatin1Char('-'))) ? 1 : 0;
+    if (firstDigit == text.size())
+    {
+        return false;
+    }
+
+    for (int i = firstDigit; i < text.size(); ++i)
+    {
+        if (text.at(i) < QLatin1Char('0') || text.at(i) > QLatin1Char('9'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif // BIGINTEGER_H
@@ -22,11 +22,16 @@
 #include <IPXACTmodels/Component/RegisterBase.h>
 #include <IPXACTmodels/common/Parameter.h>
 
+#include <QAbstractItemModel>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterFinder::ComponentParameterFinder()
 //-----------------------------------------------------------------------------
-ComponentParameterFinder::ComponentParameterFinder(QSharedPointer<Component const> component) : component_(component)
+ComponentParameterFinder::ComponentParameterFinder(QSharedPointer<Component const> component) :
+component_(component),
+parameterIndex_()
 {
+    rebuildIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -148,9 +153,12 @@ int ComponentParameterFinder::getNumberOfParameters() const
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterFinder::registerParameterModel()
 //-----------------------------------------------------------------------------
-void ComponentParameterFinder::registerParameterModel(QAbstractItemModel const* /*model*/)
+void ComponentParameterFinder::registerParameterModel(QAbstractItemModel const* model)
 {
-    // Nothing to do.
+    // The model is the context of the connections, as the models keep their finders alive.
+    QObject::connect(model, &QAbstractItemModel::modelReset, model, [this]() { rebuildIndex(); });
+    QObject::connect(model, &QAbstractItemModel::rowsInserted, model, [this]() { rebuildIndex(); });
+    QObject::connect(model, &QAbstractItemModel::rowsRemoved, model, [this]() { rebuildIndex(); });
 }
 
 //-----------------------------------------------------------------------------
@@ -159,65 +167,69 @@ void ComponentParameterFinder::registerParameterModel(QAbstractItemModel const*
 void ComponentParameterFinder::setComponent(QSharedPointer<Component const> component)
 {
     component_ = component;
+    rebuildIndex();
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterFinder::searchParameter()
+// Function: ComponentParameterFinder::rebuildIndex()
 //-----------------------------------------------------------------------------
-QSharedPointer<Parameter> ComponentParameterFinder::searchParameter(QString const& parameterId) const
+void ComponentParameterFinder::rebuildIndex()
 {
-    if (component_)
+    parameterIndex_.clear();
+
+    // The first parameter with an id is kept, as in the search order of allParameters().
+    foreach (QSharedPointer<Parameter> parameter, allParameters())
     {
-        foreach (QSharedPointer<Parameter> parameter, *component_->getParameters())
+        QString const& id = parameter->getValueId();
+        if (!id.isEmpty() && !parameterIndex_.contains(id))
         {
-            if (parameter->getValueId() == parameterId)
-            {
-                return parameter;
-            }
+            parameterIndex_.insert(id, parameter);
         }
+    }
+}
 
-        foreach (QSharedPointer<Parameter> busInterfaceParameter, allBusInterfaceParameters())
-        {
-            if (busInterfaceParameter->getValueId() == parameterId)
-            {
-                return busInterfaceParameter;
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::getParameterIndex()
+//-----------------------------------------------------------------------------
+QHash<QString, QSharedPointer<Parameter> > const& ComponentParameterFinder::getParameterIndex() const
+{
+    return parameterIndex_;
+}
 
-        foreach (QSharedPointer<Parameter> cpuParameter, allCpuParameters())
-        {
-            if (cpuParameter->getValueId() == parameterId)
-            {
-                return cpuParameter;
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::searchParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> ComponentParameterFinder::searchParameter(QString const& parameterId) const
+{
+    // An id missing from the index is not in the component, so misses are as cheap as hits. The id of an
+    // indexed parameter is checked in case it was changed after the index was built.
+    QSharedPointer<Parameter> parameter = parameterIndex_.value(parameterId);
+    if (parameter && parameter->getValueId() == parameterId)
+    {
+        return parameter;
+    }
 
-        foreach (QSharedPointer<Parameter> generatorParameter, allGeneratorParameters())
-        {
-            if (generatorParameter->getValueId() == parameterId)
-            {
-                return generatorParameter;
-            }
-        }
+    return QSharedPointer<Parameter>();
+}
 
-        foreach (QSharedPointer<Parameter> addressSpaceParameter, allAddressSpaceParameters())
-        {
-            if (addressSpaceParameter->getValueId() == parameterId)
-            {
-                return addressSpaceParameter;
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::allParameters()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<Parameter> > ComponentParameterFinder::allParameters() const
+{
+    QList<QSharedPointer<Parameter> > parameters;
 
-        foreach (QSharedPointer<Parameter> registerParameter, allRegisterParameters())
-        {
-            if (registerParameter->getValueId() == parameterId)
-            {
-                return registerParameter;
-            }
-        }
-    }    
+    if (component_)
+    {
+        parameters.append(*component_->getParameters());
+        parameters.append(allBusInterfaceParameters());
+        parameters.append(allCpuParameters());
+        parameters.append(allGeneratorParameters());
+        parameters.append(allAddressSpaceParameters());
+        parameters.append(allRegisterParameters());
+    }
 
-    return QSharedPointer<Parameter>();
+    return parameters;
 }
 
 //-----------------------------------------------------------------------------
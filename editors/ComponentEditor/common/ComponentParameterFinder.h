@@ -14,6 +14,8 @@
 
 #include "ParameterFinder.h"
 
+#include <QHash>
+
 class AbstractParameterModel;
 class Component;
 
@@ -105,6 +107,20 @@ public:
      */
     virtual void setComponent(QSharedPointer<Component const> component);
 
+    /*!
+     *  Rebuilds the index of the parameters by id. The index is rebuilt when the component is set and when the
+     *  rows of a registered parameter model change. Other changes to the parameters of the component need a
+     *  call to this before searching for the changed ids.
+     */
+    void rebuildIndex();
+
+    /*!
+     *  Finds all the parameters in the component.
+     *
+     *      @return The parameters in the order they are searched for an id.
+     */
+    QList<QSharedPointer<Parameter> > allParameters() const;
+
     /*!
      *  Returns all the parameters in component address spaces.
      */
@@ -134,6 +150,15 @@ public:
      */
     QList<QSharedPointer<Parameter> > allRegisterParameters() const;
 
+protected:
+
+    /*!
+     *  Gets the index of the parameters.
+     *
+     *      @return The first parameter with each id in the component. Key is the parameter id.
+     */
+    QHash<QString, QSharedPointer<Parameter> > const& getParameterIndex() const;
+
 private:
 
 	/*!
@@ -157,6 +182,9 @@ private:
 
     //! The parameters are searched from this component.
     QSharedPointer<Component const> component_;
+
+    //! The first parameter with each id in the component. Key is the parameter id.
+    QHash<QString, QSharedPointer<Parameter> > parameterIndex_;
 };
 
 #endif // COMPONENTPARAMETERFINDER_H
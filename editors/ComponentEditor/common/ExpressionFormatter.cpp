@@ -16,14 +16,26 @@
 #include <IPXACTmodels/common/validators/ValueFormatter.h>
 
 #include <QStringList>
-#include <QRegularExpression>
 
+namespace
+{
+    //! Checks if a character can be part of a parameter id.
+    bool isIdCharacter(QChar const& character)
+    {
+        ushort code = character.unicode();
+        return (code >= 'a' && code <= 'z') || (code >= 'A' && code <= 'Z') || (code >= '0' && code <= '9') ||
+            code == ':' || code == '_' || code == '.';
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: ExpressionFormatter::ExpressionFormatter()
 //-----------------------------------------------------------------------------
 ExpressionFormatter::ExpressionFormatter(QSharedPointer<ParameterFinder> parameterFinder):
-parameterFinder_(parameterFinder)
+parameterFinder_(parameterFinder),
+formattedExpressions_(),
+usageOrder_(),
+cachedRevision_(-1)
 {
 
 }
@@ -60,17 +72,88 @@ QString ExpressionFormatter::format(QString const& expression, QSharedPointer<Ex
 //-----------------------------------------------------------------------------
 QString ExpressionFormatter::formatReferringExpression(QString const& expression) const
 {
-    static const QRegularExpression NON_ALPHA_CHARACTERS("[^a-zA-Z0-9:_.]+");
+    // Without change tracking a cached name could be outdated, so nothing is cached.
+    int revision = parameterFinder_->getParameterRevision();
+    if (revision < 0)
+    {
+        return replaceIds(expression);
+    }
+
+    if (revision != cachedRevision_)
+    {
+        formattedExpressions_.clear();
+        usageOrder_.clear();
+        cachedRevision_ = revision;
+    }
 
-    QString formattedExpression = expression;
+    auto cached = formattedExpressions_.find(expression);
+    if (cached != formattedExpressions_.end())
+    {
+        usageOrder_.splice(usageOrder_.begin(), usageOrder_, cached->usage);
+        return cached->formatted;
+    }
 
-    for (QString const& valueID : expression.split(NON_ALPHA_CHARACTERS, QString::SkipEmptyParts))
+    if (formattedExpressions_.size() >= MAX_CACHED_EXPRESSIONS)
     {
-        if (parameterFinder_->hasId(valueID))
+        formattedExpressions_.remove(usageOrder_.back());
+        usageOrder_.pop_back();
+    }
+
+    usageOrder_.push_front(expression);
+
+    FormattedExpression formattedExpression;
+    formattedExpression.formatted = replaceIds(expression);
+    formattedExpression.usage = usageOrder_.begin();
+    formattedExpressions_.insert(expression, formattedExpression);
+
+    return formattedExpression.formatted;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionFormatter::replaceIds()
+//-----------------------------------------------------------------------------
+QString ExpressionFormatter::replaceIds(QString const& expression) const
+{
+    QString formatted;
+    formatted.reserve(expression.size());
+
+    // Each distinct token is looked up once. The tokens that are not parameter ids replace themselves.
+    QHash<QString, QString> replacements;
+
+    int position = 0;
+    while (position < expression.size())
+    {
+        int tokenEnd = position;
+        while (tokenEnd < expression.size() && isIdCharacter(expression.at(tokenEnd)))
         {
-            formattedExpression.replace(valueID, parameterFinder_->nameForId(valueID));
+            ++tokenEnd;
         }
+
+        if (tokenEnd == position)
+        {
+            formatted.append(expression.at(position));
+            ++position;
+            continue;
+        }
+
+        QString token = expression.mid(position, tokenEnd - position);
+
+        auto replacement = replacements.constFind(token);
+        if (replacement == replacements.constEnd())
+        {
+            if (parameterFinder_->hasId(token))
+            {
+                replacement = replacements.insert(token, parameterFinder_->nameForId(token));
+            }
+            else
+            {
+                replacement = replacements.insert(token, token);
+            }
+        }
+
+        formatted.append(*replacement);
+        position = tokenEnd;
     }
 
-    return formattedExpression;
+    return formatted;
 }
@@ -14,7 +14,11 @@
 
 #include "ParameterFinder.h"
 
+#include <QHash>
 #include <QSharedPointer>
+#include <QString>
+
+#include <list>
 
 class ExpressionParser;
 
@@ -41,6 +45,10 @@ public:
     /*!
      *  Format an expression containing a reference to another parameter.
      *
+     *  The formatted expressions are cached if the parameter finder tracks the changes to its parameters. The
+     *  cache is dropped when the revision of the parameters changes, so renaming, adding or removing a parameter
+     *  formats the expressions again.
+     *
      *      @param [in] expression  The expression being worked on.
      *
      *      @return Formatted expression.
@@ -56,8 +64,39 @@ private:
 	//! No assignment
     ExpressionFormatter& operator=(const ExpressionFormatter& other);
 
+    //! A formatted expression in the cache.
+    struct FormattedExpression
+    {
+        //! The expression with the ids replaced by the parameter names.
+        QString formatted;
+
+        //! The position of the expression in the usage order.
+        std::list<QString>::iterator usage;
+    };
+
+    /*!
+     *  Replaces the parameter ids in an expression with the parameter names in a single pass.
+     *
+     *      @param [in] expression  The expression to format.
+     *
+     *      @return The formatted expression.
+     */
+    QString replaceIds(QString const& expression) const;
+
+    //! The maximum number of formatted expressions in the cache.
+    static const int MAX_CACHED_EXPRESSIONS = 4096;
+
     //! Used to search the components parameters.
     QSharedPointer<ParameterFinder> parameterFinder_;
+
+    //! The formatted expressions by the original expression.
+    mutable QHash<QString, FormattedExpression> formattedExpressions_;
+
+    //! The cached expressions, the most recently used first.
+    mutable std::list<QString> usageOrder_;
+
+    //! The revision of the parameters the cached expressions were formatted with.
+    mutable int cachedRevision_;
 };
 
 #endif // EXPRESSIONFORMATTER_H
@@ -20,7 +20,8 @@
 // Function: IPXactSystemVerilogParser::IPXactSystemVerilogParser()
 //-----------------------------------------------------------------------------
 IPXactSystemVerilogParser::IPXactSystemVerilogParser(QSharedPointer<ParameterFinder> finder):
-SystemVerilogExpressionParser(), finder_(finder), symbolStack_()
+SystemVerilogExpressionParser(), finder_(finder), symbolStack_(), valueCache_(), dependencies_(), dependents_(),
+evaluationDepth_(0), evaluationRound_(0), loopFound_(false), unresolvedFound_(false)
 {
 
 }
@@ -38,7 +39,15 @@ IPXactSystemVerilogParser::~IPXactSystemVerilogParser()
 //-----------------------------------------------------------------------------
 bool IPXactSystemVerilogParser::isSymbol(QString const& expression) const
 {
-    return finder_->hasId(expression);
+    bool symbolFound = finder_->hasId(expression);
+
+    // The missing symbol is not recorded as a dependency, so the value being evaluated must not be cached.
+    if (!symbolFound && !symbolStack_.isEmpty())
+    {
+        unresolvedFound_ = true;
+    }
+
+    return symbolFound;
 }
 
 //-----------------------------------------------------------------------------
@@ -46,16 +55,58 @@ bool IPXactSystemVerilogParser::isSymbol(QString const& expression) const
 //-----------------------------------------------------------------------------
 QString IPXactSystemVerilogParser::findSymbolValue(QString const& expression) const
 {
+    if (evaluationDepth_ == 0)
+    {
+        evaluationRound_++;
+        loopFound_ = false;
+        unresolvedFound_ = false;
+    }
+
+    // The symbol being evaluated depends on the referenced symbol.
+    if (!symbolStack_.isEmpty())
+    {
+        dependencies_[symbolStack_.last()].insert(expression);
+        dependents_[expression].insert(symbolStack_.last());
+    }
+
     // Check for ring references.
     if (symbolStack_.contains(expression))
     {
         symbolStack_.clear();
+        loopFound_ = true;
         return QStringLiteral("x");
     }
 
+    if (hasValidCachedValue(expression))
+    {
+        return valueCache_.value(expression).value;
+    }
+
+    clearDependencies(expression);
+
+    QString valueExpression = finder_->valueForId(expression);
+
+    // A missing reference in this value also leaves the values referencing this one uncached.
+    bool unresolvedBefore = unresolvedFound_;
+    unresolvedFound_ = false;
+
+    evaluationDepth_++;
     symbolStack_.append(expression);
-    QString value = parseExpression(finder_->valueForId(expression));
+    QString value = parseExpression(valueExpression);
     symbolStack_.removeOne(expression);
+    evaluationDepth_--;
+
+    bool unresolvedReference = unresolvedFound_;
+    unresolvedFound_ = unresolvedBefore || unresolvedReference;
+
+    if (!loopFound_ && !unresolvedReference)
+    {
+        CachedValue cachedValue;
+        cachedValue.expression = valueExpression;
+        cachedValue.value = value;
+        cachedValue.checkedRound = evaluationRound_;
+        valueCache_.insert(expression, cachedValue);
+    }
 
     return value;
 }
@@ -67,3 +118,97 @@ int IPXactSystemVerilogParser::getBaseForSymbol(QString const& symbol) const
 {
     return baseForExpression(finder_->valueForId(symbol));
 }
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::evaluateSymbols()
+//-----------------------------------------------------------------------------
+QStringList IPXactSystemVerilogParser::evaluateSymbols(QStringList const& symbols) const
+{
+    evaluationRound_++;
+    loopFound_ = false;
+
+    // Evaluating the symbols within the same round marks each checked value valid for the rest of the symbols.
+    evaluationDepth_++;
+
+    QStringList values;
+    values.reserve(symbols.size());
+    foreach (QString const& symbol, symbols)
+    {
+        values.append(findSymbolValue(symbol));
+    }
+
+    evaluationDepth_--;
+
+    return values;
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::hasValidCachedValue()
+//-----------------------------------------------------------------------------
+bool IPXactSystemVerilogParser::hasValidCachedValue(QString const& symbol) const
+{
+    auto cachedValue = valueCache_.find(symbol);
+    if (cachedValue == valueCache_.end())
+    {
+        return false;
+    }
+
+    if (cachedValue->checkedRound == evaluationRound_)
+    {
+        return true;
+    }
+
+    if (cachedValue->expression != finder_->valueForId(symbol))
+    {
+        invalidateCachedValue(symbol);
+        return false;
+    }
+
+    // Marked before checking the references, so a loop of references is checked only once.
+    cachedValue->checkedRound = evaluationRound_;
+
+    foreach (QString const& referencedSymbol, dependencies_.value(symbol))
+    {
+        if (!hasValidCachedValue(referencedSymbol))
+        {
+            invalidateCachedValue(symbol);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::invalidateCachedValue()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::invalidateCachedValue(QString const& symbol) const
+{
+    // Symbols depending on an uncached value are never cached, so the removal stops there.
+    if (valueCache_.remove(symbol) > 0)
+    {
+        foreach (QString const& dependentSymbol, dependents_.value(symbol))
+        {
+            invalidateCachedValue(dependentSymbol);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::clearDependencies()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::clearDependencies(QString const& symbol) const
+{
+    foreach (QString const& referencedSymbol, dependencies_.take(symbol))
+    {
+        auto dependents = dependents_.find(referencedSymbol);
+        if (dependents != dependents_.end())
+        {
+            dependents->remove(symbol);
+            if (dependents->isEmpty())
+            {
+                dependents_.erase(dependents);
+            }
+        }
+    }
+}
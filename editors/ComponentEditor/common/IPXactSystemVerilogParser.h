@@ -14,6 +14,8 @@
 
 #include "SystemVerilogExpressionParser.h"
 
+#include <QHash>
+#include <QSet>
 #include <QSharedPointer>
 #include <QString>
 #include <QStringList>
@@ -22,6 +24,15 @@ class ParameterFinder;
 
 //-----------------------------------------------------------------------------
 // Parser for SystemVerilog expressions with parameter references.
+//
+// The evaluated values of the referenced parameters are cached by parameter ID, together with the references
+// made by each value. A cached value is used as long as the value expression of the parameter and of every
+// parameter it depends on is unchanged. Once a change is found, the value and all the values depending on it
+// are removed from the cache. Values referencing a missing parameter are not cached, so they are evaluated
+// again once the parameter is available.
+//
+// The cache is updated also when evaluating through the const interface, so the parser is not thread-safe.
+// Each thread must use a parser of its own, e.g. the parallel component validation creates one per worker.
 //-----------------------------------------------------------------------------
 class IPXactSystemVerilogParser : public SystemVerilogExpressionParser
 {
@@ -64,12 +75,53 @@ public:
      */
     virtual int getBaseForSymbol(QString const& symbol) const override final;
 
+    /*!
+     *  Evaluates the values of the given symbols in a single evaluation round, so the cached values are checked
+     *  for changes only once. Each symbol should be given after the symbols it references.
+     *
+     *      @param [in] symbols     The symbols whose values to evaluate.
+     *
+     *      @return The values of the symbols in the given order.
+     */
+    QStringList evaluateSymbols(QStringList const& symbols) const;
+
 private:
 
     // Disable copying.
     IPXactSystemVerilogParser(IPXactSystemVerilogParser const& rhs);
     IPXactSystemVerilogParser& operator=(IPXactSystemVerilogParser const& rhs);
 
+    //! The evaluated value of a symbol.
+    struct CachedValue
+    {
+        QString expression;         //!< The value expression of the symbol at the time of evaluation.
+        QString value;              //!< The evaluated value.
+        quint64 checkedRound = 0;   //!< The last evaluation round in which the value was found valid.
+    };
+
+    /*!
+     *  Checks if the cached value of a symbol is still valid. Values found invalid are removed from the cache.
+     *
+     *      @param [in] symbol  The symbol whose value to check.
+     *
+     *      @return True, if the cached value can be used, otherwise false.
+     */
+    bool hasValidCachedValue(QString const& symbol) const;
+
+    /*!
+     *  Removes the cached value of a symbol and of all the symbols depending on it.
+     *
+     *      @param [in] symbol  The symbol whose value to remove.
+     */
+    void invalidateCachedValue(QString const& symbol) const;
+
+    /*!
+     *  Removes the recorded references of a symbol before it is evaluated again.
+     *
+     *      @param [in] symbol  The symbol whose references to remove.
+     */
+    void clearDependencies(QString const& symbol) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -79,6 +131,27 @@ private:
 
     //! Stack for tracking already evaluated symbols to check for loops in references.
     mutable QStringList symbolStack_;
+
+    //! The evaluated values of the symbols by symbol.
+    mutable QHash<QString, CachedValue> valueCache_;
+
+    //! The symbols referenced in the value of each symbol.
+    mutable QHash<QString, QSet<QString> > dependencies_;
+
+    //! The symbols referencing each symbol in their values.
+    mutable QHash<QString, QSet<QString> > dependents_;
+
+    //! The number of symbol evaluations in progress.
+    mutable int evaluationDepth_;
+
+    //! The current evaluation round. Each outermost symbol evaluation starts a new round.
+    mutable quint64 evaluationRound_;
+
+    //! Flag for a loop in references found during the current round. Values are not cached after a loop.
+    mutable bool loopFound_;
+
+    //! Flag for a reference to a missing symbol found in the value being evaluated.
+    mutable bool unresolvedFound_;
 };
 
 #endif // IPXACTSYSTEMVERILOGPARSER_H
@@ -11,12 +11,15 @@
 
 #include "ListParameterFinder.h"
 
+#include <QAbstractItemModel>
+
 //-----------------------------------------------------------------------------
 // Function: ListParameterFinder::ListParameterFinder()
 //-----------------------------------------------------------------------------
 ListParameterFinder::ListParameterFinder():
 ParameterFinder(),
-parameterList_(new QList<QSharedPointer<Parameter> > ())
+parameterList_(new QList<QSharedPointer<Parameter> > ()),
+parameterIndex_()
 {
 
 }
@@ -34,15 +37,10 @@ ListParameterFinder::~ListParameterFinder()
 //-----------------------------------------------------------------------------
 QSharedPointer<Parameter> ListParameterFinder::getParameterWithID(QString const& parameterId) const
 {
-    if (parameterList_)
+    QSharedPointer<Parameter> parameter = findParameter(parameterId);
+    if (parameter)
     {
-        foreach (QSharedPointer<Parameter> parameter, *parameterList_)
-        {
-            if (parameter->getValueId() == parameterId)
-            {
-                return parameter;
-            }
-        }
+        return parameter;
     }
 
     return QSharedPointer<Parameter> (new Parameter());
@@ -53,18 +51,7 @@ QSharedPointer<Parameter> ListParameterFinder::getParameterWithID(QString const&
 //-----------------------------------------------------------------------------
 bool ListParameterFinder::hasId(QString const& id) const
 {
-    if (parameterList_)
-    {
-        foreach (QSharedPointer<Parameter> parameter, *parameterList_)
-        {
-            if (parameter->getValueId() == id)
-            {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    return !findParameter(id).isNull();
 }
 
 //-----------------------------------------------------------------------------
@@ -132,12 +119,55 @@ int ListParameterFinder::getNumberOfParameters() const
 void ListParameterFinder::setParameterList(QSharedPointer<QList<QSharedPointer<Parameter> > > parameterList)
 {
     parameterList_ = parameterList;
+    rebuildIndex();
 }
 
 //-----------------------------------------------------------------------------
 // Function: ListParameterFinder::registerParameterModel()
 //-----------------------------------------------------------------------------
-void ListParameterFinder::registerParameterModel(QAbstractItemModel const* /*model*/)
+void ListParameterFinder::registerParameterModel(QAbstractItemModel const* model)
 {
-    // Nothing to do.
+    // The model is the context of the connections, as the models keep their finders alive.
+    QObject::connect(model, &QAbstractItemModel::modelReset, model, [this]() { rebuildIndex(); });
+    QObject::connect(model, &QAbstractItemModel::rowsInserted, model, [this]() { rebuildIndex(); });
+    QObject::connect(model, &QAbstractItemModel::rowsRemoved, model, [this]() { rebuildIndex(); });
+}
+
+//-----------------------------------------------------------------------------
+// Function: ListParameterFinder::rebuildIndex()
+//-----------------------------------------------------------------------------
+void ListParameterFinder::rebuildIndex()
+{
+    parameterIndex_.clear();
+
+    if (parameterList_)
+    {
+        parameterIndex_.reserve(parameterList_->size());
+
+        // The first parameter with an id is kept, as in a linear search.
+        foreach (QSharedPointer<Parameter> parameter, *parameterList_)
+        {
+            QString const& id = parameter->getValueId();
+            if (!parameterIndex_.contains(id))
+            {
+                parameterIndex_.insert(id, parameter);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ListParameterFinder::findParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> ListParameterFinder::findParameter(QString const& parameterId) const
+{
+    // An id missing from the index is not in the list, so misses are as cheap as hits. The id of an indexed
+    // parameter is checked in case it was changed after the index was built.
+    QSharedPointer<Parameter> parameter = parameterIndex_.value(parameterId);
+    if (parameter && parameter->getValueId() == parameterId)
+    {
+        return parameter;
+    }
+
+    return QSharedPointer<Parameter>();
 }
@@ -18,6 +18,7 @@
 
 #include <QSharedPointer>
 #include <QList>
+#include <QHash>
 
 //-----------------------------------------------------------------------------
 //! The implementation for finding parameters from a list with the correct ID.
@@ -99,6 +100,13 @@ public:
      */
     virtual void registerParameterModel(QAbstractItemModel const* model);
 
+    /*!
+     *  Rebuilds the index of the parameters by id. The index is rebuilt when the list is set and when the rows
+     *  of a registered parameter model change. Other changes to the list need a call to this before searching
+     *  for the changed ids.
+     */
+    void rebuildIndex();
+
 private:
 
 	//! No copying
@@ -106,12 +114,24 @@ private:
 	//! No assignment
     ListParameterFinder& operator=(const ListParameterFinder& other);
 
+    /*!
+     *  Finds the parameter with the given id from the index of the parameters.
+     *
+     *      @param [in] parameterId     The id of the parameter being searched for.
+     *
+     *      @return The found parameter, or a null pointer if the id was not found.
+     */
+    QSharedPointer<Parameter> findParameter(QString const& parameterId) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
 
     //! The parameters are searched from this list.
     QSharedPointer<QList<QSharedPointer<Parameter> > > parameterList_;
+
+    //! The first parameter with each id in the list. Key is the parameter id.
+    QHash<QString, QSharedPointer<Parameter> > parameterIndex_;
 };
 
 #endif // LISTPARAMETERFINDER_H
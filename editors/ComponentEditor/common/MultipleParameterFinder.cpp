@@ -59,12 +59,10 @@ void MultipleParameterFinder::removeAllFinders()
 //-----------------------------------------------------------------------------
 QSharedPointer<Parameter> MultipleParameterFinder::getParameterWithID(QString const& parameterId) const
 {
-    foreach(QSharedPointer<ParameterFinder> finder, finders_)
+    QSharedPointer<ParameterFinder> finder = finderForId(parameterId);
+    if (finder)
     {
-        if (finder->hasId(parameterId))
-        {
-            return finder->getParameterWithID(parameterId);
-        }
+        return finder->getParameterWithID(parameterId);
     }
 
     return QSharedPointer<Parameter>(new Parameter);
@@ -75,15 +73,7 @@ QSharedPointer<Parameter> MultipleParameterFinder::getParameterWithID(QString co
 //-----------------------------------------------------------------------------
 bool MultipleParameterFinder::hasId(QString const& id) const
 {
-    foreach(QSharedPointer<ParameterFinder> finder, finders_)
-    {
-        if (finder->hasId(id))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return !finderForId(id).isNull();
 }
 
 //-----------------------------------------------------------------------------
@@ -99,12 +89,10 @@ QString MultipleParameterFinder::nameForId(QString const& id) const
 //-----------------------------------------------------------------------------
 QString MultipleParameterFinder::valueForId(QString const& id) const
 {
-    foreach(QSharedPointer<ParameterFinder> finder, finders_)
+    QSharedPointer<ParameterFinder> finder = finderForId(id);
+    if (finder)
     {
-        if (finder->hasId(id))
-        {
-            return finder->valueForId(id);
-        }
+        return finder->valueForId(id);
     }
 
     return QString();
@@ -141,3 +129,20 @@ void MultipleParameterFinder::registerParameterModel(QAbstractItemModel const* /
 {
     // Nothing to do.
 }
+
+//-----------------------------------------------------------------------------
+// Function: MultipleParameterFinder::finderForId()
+//-----------------------------------------------------------------------------
+QSharedPointer<ParameterFinder> MultipleParameterFinder::finderForId(QString const& id) const
+{
+    // There are only a few finders, each with an index of its own, so nothing is cached here.
+    foreach(QSharedPointer<ParameterFinder> finder, finders_)
+    {
+        if (finder->hasId(id))
+        {
+            return finder;
+        }
+    }
+
+    return QSharedPointer<ParameterFinder>();
+}
@@ -117,6 +117,19 @@ private:
 	//! No assignment
     MultipleParameterFinder& operator=(const MultipleParameterFinder& other);
 
+    /*!
+     *  Finds the finder containing the parameter with the given id.
+     *
+     *      @param [in] id      The id to search for.
+     *
+     *      @return The first finder containing the id, or a null pointer if no finder contains the id.
+     */
+    QSharedPointer<ParameterFinder> finderForId(QString const& id) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
     //! The finders to use in searches.
     QList<QSharedPointer<ParameterFinder> > finders_;
 };
@@ -19,9 +19,9 @@
 // Function: ParameterCache::ParameterCache()
 //-----------------------------------------------------------------------------
 ParameterCache::ParameterCache(QSharedPointer<const Component> component) : QObject(0),
-ComponentParameterFinder(component), availableParameters_()
+ComponentParameterFinder(component), revision_(0)
 {
-    resetCache();
+
 }
 
 //-----------------------------------------------------------------------------
@@ -32,28 +32,12 @@ ParameterCache::~ParameterCache()
 
 }
 
-//-----------------------------------------------------------------------------
-// Function: ParameterCache::hasId()
-//-----------------------------------------------------------------------------
-bool ParameterCache::hasId(QString const& id) const
-{
-    return availableParameters_.contains(id);
-}
-
 //-----------------------------------------------------------------------------
 // Function: ParameterCache::getAllParameterIds()
 //-----------------------------------------------------------------------------
 QStringList ParameterCache::getAllParameterIds() const
 {
-    return availableParameters_.keys();
-}
-
-//-----------------------------------------------------------------------------
-// Function: ParameterCache::getParameterWithID()
-//-----------------------------------------------------------------------------
-QSharedPointer<Parameter> ParameterCache::getParameterWithID(QString const& parameterId) const
-{
-	return availableParameters_.value(parameterId);
+    return getParameterIndex().keys();
 }
 
 //-----------------------------------------------------------------------------
@@ -61,7 +45,7 @@ QSharedPointer<Parameter> ParameterCache::getParameterWithID(QString const& para
 //-----------------------------------------------------------------------------
 int ParameterCache::getNumberOfParameters() const
 {
-	return availableParameters_.count();
+	return getParameterIndex().count();
 }
 
 //-----------------------------------------------------------------------------
@@ -71,7 +55,7 @@ void ParameterCache::setComponent(QSharedPointer<Component const> component)
 {
 	ComponentParameterFinder::setComponent(component);
 	
-    resetCache();
+    onParametersChanged();
 }
 
 //-----------------------------------------------------------------------------
@@ -79,11 +63,19 @@ void ParameterCache::setComponent(QSharedPointer<Component const> component)
 //-----------------------------------------------------------------------------
 void ParameterCache::registerParameterModel(QAbstractItemModel const* model)
 {
-    ComponentParameterFinder::registerParameterModel(model);
-
     connect(model, SIGNAL(modelReset()), this, SLOT(resetCache()), Qt::UniqueConnection);
     connect(model, SIGNAL(rowsRemoved(QModelIndex const&, int, int)), this, SLOT(resetCache()), Qt::UniqueConnection);
     connect(model, SIGNAL(rowsInserted(QModelIndex const&, int, int)), this, SLOT(resetCache()), Qt::UniqueConnection);
+    connect(model, SIGNAL(dataChanged(QModelIndex const&, QModelIndex const&, QVector<int> const&)),
+        this, SLOT(onParametersChanged()), Qt::UniqueConnection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterCache::getParameterRevision()
+//-----------------------------------------------------------------------------
+int ParameterCache::getParameterRevision() const
+{
+    return revision_;
 }
 
 //-----------------------------------------------------------------------------
@@ -91,9 +83,15 @@ void ParameterCache::registerParameterModel(QAbstractItemModel const* model)
 //-----------------------------------------------------------------------------
 void ParameterCache::resetCache()
 {
-    availableParameters_.clear();
-    foreach(QString const& id, ComponentParameterFinder::getAllParameterIds())
-    {
-        availableParameters_.insert(id, ComponentParameterFinder::getParameterWithID(id));
-    }
+    onParametersChanged();
+
+    rebuildIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterCache::onParametersChanged()
+//-----------------------------------------------------------------------------
+void ParameterCache::onParametersChanged()
+{
+    ++revision_;
 }
@@ -15,8 +15,6 @@
 #include "ParameterFinder.h"
 #include "ComponentParameterFinder.h"
 
-#include <QHash>
-
 class Component;
 class Parameter;
 
@@ -40,22 +38,6 @@ public:
      */
     ~ParameterCache();
     
-    /*!
-     *  Get the parameter corresponding the id.
-     *
-     *      @param [in] parameterId     The id of the parameter being searched for.
-     */
-    virtual QSharedPointer<Parameter> getParameterWithID(QString const& parameterId) const;
-
-    /*!
-     *  Checks if a parameter with the given id exists.
-     *
-     *      @param [in] id      The id to search for.
-     *
-     *      @return True, if the parameter with the given id exists, otherwise false.
-     */
-    virtual bool hasId(QString const& id) const;
-
     /*!
      *  Gets all of the ids of components parameters.
      *
@@ -84,10 +66,23 @@ public:
      */
     virtual void registerParameterModel(QAbstractItemModel const* model);
 
+    /*!
+     *  Get the revision of the parameters. The revision changes whenever a parameter is added, removed or changed
+     *  through a registered parameter model.
+     *
+     *      @return The revision of the parameters.
+     */
+    virtual int getParameterRevision() const;
+
 private slots:
 
     void resetCache(); 
 
+    /*!
+     *  Marks the parameters changed.
+     */
+    void onParametersChanged();
+
 private:
 
 	//! No copying
@@ -99,8 +94,8 @@ private:
     // Data.
     //-----------------------------------------------------------------------------
 
-    //! Parameters available in the cache. Key is the parameterID.
-	QHash<QString, QSharedPointer<Parameter> > availableParameters_;
+    //! The revision of the parameters, increased on every change.
+    int revision_;
 
 };
 
@@ -0,0 +1,395 @@
+//-----------------------------------------------------------------------------
+// File: ParameterDependencyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Graph of the references between parameters.
+//-----------------------------------------------------------------------------
+
+#include "ParameterDependencyGraph.h"
+
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/common/ParameterFinder.h>
+
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::ParameterDependencyGraph()
+//-----------------------------------------------------------------------------
+ParameterDependencyGraph::ParameterDependencyGraph(QSharedPointer<ParameterFinder> finder):
+finder_(finder),
+    referenceParser_(new IPXactSystemVerilogParser(finder)),
+    parameterIds_(),
+    references_(),
+    referencingParameters_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::~ParameterDependencyGraph()
+//-----------------------------------------------------------------------------
+ParameterDependencyGraph::~ParameterDependencyGraph()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::rebuild()
+//-----------------------------------------------------------------------------
+void ParameterDependencyGraph::rebuild()
+{
+    parameterIds_.clear();
+    references_.clear();
+    referencingParameters_.clear();
+
+    for (QString const& parameterId : finder_->getAllParameterIds())
+    {
+        // Finders of multiple documents may list the same id more than once.
+        if (!references_.contains(parameterId))
+        {
+            parameterIds_.append(parameterId);
+            addReferences(parameterId);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::updateParameter()
+//-----------------------------------------------------------------------------
+void ParameterDependencyGraph::updateParameter(QString const& parameterId)
+{
+    bool inGraph = hasParameter(parameterId);
+    removeReferences(parameterId);
+
+    if (finder_->hasId(parameterId))
+    {
+        if (!inGraph)
+        {
+            parameterIds_.append(parameterId);
+        }
+
+        addReferences(parameterId);
+    }
+    else
+    {
+        parameterIds_.removeOne(parameterId);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::hasParameter()
+//-----------------------------------------------------------------------------
+bool ParameterDependencyGraph::hasParameter(QString const& parameterId) const
+{
+    return references_.contains(parameterId);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::getParameterIds()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::getParameterIds() const
+{
+    return parameterIds_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::getReferencedParameters()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::getReferencedParameters(QString const& parameterId) const
+{
+    return references_.value(parameterId);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::getReferencingParameters()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::getReferencingParameters(QString const& parameterId) const
+{
+    return referencingParameters_.value(parameterId);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::getAffectedParameters()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::getAffectedParameters(QString const& parameterId) const
+{
+    QStringList affected;
+    QSet<QString> found;
+
+    // The list grows while it is iterated, so each affected parameter is visited once in breadth-first order.
+    QStringList pending = getReferencingParameters(parameterId);
+    for (int i = 0; i < pending.size(); ++i)
+    {
+        QString affectedId = pending.at(i);
+        if (!found.contains(affectedId) && hasParameter(affectedId))
+        {
+            found.insert(affectedId);
+            affected.append(affectedId);
+            pending.append(getReferencingParameters(affectedId));
+        }
+    }
+
+    QStringList unordered;
+    QStringList ordered = orderForEvaluation(affected, unordered);
+    ordered.append(unordered);
+
+    return ordered;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::getEvaluationOrder()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::getEvaluationOrder() const
+{
+    QStringList unordered;
+    return orderForEvaluation(parameterIds_, unordered);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::findCycles()
+//-----------------------------------------------------------------------------
+QList<QStringList> ParameterDependencyGraph::findCycles() const
+{
+    // The groups of parameters referencing each other are the strongly connected components of the graph,
+    // found with Tarjan's algorithm. The search is iterative, so long reference chains do not exhaust the stack.
+    struct Visit
+    {
+        QString parameterId;    //!< The visited parameter.
+        int nextReference;      //!< The position of the next reference to follow.
+    };
+
+    QHash<QString, int> visitIndex;
+    QHash<QString, int> lowestReachable;
+    QSet<QString> onComponentStack;
+    QStringList componentStack;
+    QVector<Visit> visits;
+
+    QList<QStringList> cycles;
+
+    for (QString const& rootId : parameterIds_)
+    {
+        if (visitIndex.contains(rootId))
+        {
+            continue;
+        }
+
+        visits.append({rootId, 0});
+        visitIndex.insert(rootId, visitIndex.size());
+        lowestReachable.insert(rootId, visitIndex.value(rootId));
+        componentStack.append(rootId);
+        onComponentStack.insert(rootId);
+
+        while (!visits.isEmpty())
+        {
+            QString currentId = visits.last().parameterId;
+            QStringList const& currentReferences = *references_.constFind(currentId);
+
+            if (visits.last().nextReference < currentReferences.size())
+            {
+                QString const& referencedId = currentReferences.at(visits.last().nextReference);
+                visits.last().nextReference++;
+
+                if (!hasParameter(referencedId))
+                {
+                    continue;
+                }
+
+                if (!visitIndex.contains(referencedId))
+                {
+                    visits.append({referencedId, 0});
+                    visitIndex.insert(referencedId, visitIndex.size());
+                    lowestReachable.insert(referencedId, visitIndex.value(referencedId));
+                    componentStack.append(referencedId);
+                    onComponentStack.insert(referencedId);
+                }
+                else if (onComponentStack.contains(referencedId))
+                {
+                    lowestReachable[currentId] = qMin(lowestReachable.value(currentId),
+                        visitIndex.value(referencedId));
+                }
+
+                continue;
+            }
+
+            visits.removeLast();
+
+            if (lowestReachable.value(currentId) == visitIndex.value(currentId))
+            {
+                QSet<QString> group;
+                QString memberId;
+                do
+                {
+                    memberId = componentStack.takeLast();
+                    onComponentStack.remove(memberId);
+                    group.insert(memberId);
+                } while (memberId != currentId);
+
+                if (group.size() > 1 || references_.value(currentId).contains(currentId))
+                {
+                    cycles.append(findCyclePath(currentId, group));
+                }
+            }
+
+            if (!visits.isEmpty())
+            {
+                QString const& parentId = visits.last().parameterId;
+                lowestReachable[parentId] = qMin(lowestReachable.value(parentId), lowestReachable.value(currentId));
+            }
+        }
+    }
+
+    return cycles;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::evaluate()
+//-----------------------------------------------------------------------------
+QHash<QString, QString> ParameterDependencyGraph::evaluate(IPXactSystemVerilogParser const& parser) const
+{
+    QStringList unordered;
+    QStringList evaluationOrder = orderForEvaluation(parameterIds_, unordered);
+
+    // Parameters in cycles are evaluated last, as the parser stops caching values for the round after a loop.
+    evaluationOrder.append(unordered);
+
+    QStringList evaluatedValues = parser.evaluateSymbols(evaluationOrder);
+
+    QHash<QString, QString> values;
+    values.reserve(evaluationOrder.size());
+
+    for (int i = 0; i < evaluationOrder.size(); ++i)
+    {
+        values.insert(evaluationOrder.at(i), evaluatedValues.at(i));
+    }
+
+    return values;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::addReferences()
+//-----------------------------------------------------------------------------
+void ParameterDependencyGraph::addReferences(QString const& parameterId)
+{
+    QStringList referencedIds = referenceParser_->findSymbols(finder_->valueForId(parameterId));
+    references_.insert(parameterId, referencedIds);
+
+    for (QString const& referencedId : referencedIds)
+    {
+        referencingParameters_[referencedId].append(parameterId);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::removeReferences()
+//-----------------------------------------------------------------------------
+void ParameterDependencyGraph::removeReferences(QString const& parameterId)
+{
+    for (QString const& referencedId : references_.take(parameterId))
+    {
+        auto referencing = referencingParameters_.find(referencedId);
+        if (referencing != referencingParameters_.end())
+        {
+            referencing->removeOne(parameterId);
+            if (referencing->isEmpty())
+            {
+                referencingParameters_.erase(referencing);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::orderForEvaluation()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::orderForEvaluation(QStringList const& parameterIds,
+    QStringList& unordered) const
+{
+    // Number of references from each parameter to the unevaluated parameters in the group.
+    QHash<QString, int> pendingReferences;
+    pendingReferences.reserve(parameterIds.size());
+
+    for (QString const& parameterId : parameterIds)
+    {
+        pendingReferences.insert(parameterId, 0);
+    }
+
+    QStringList ordered;
+    for (QString const& parameterId : parameterIds)
+    {
+        int referenceCount = 0;
+        for (QString const& referencedId : references_.value(parameterId))
+        {
+            if (pendingReferences.contains(referencedId))
+            {
+                referenceCount++;
+            }
+        }
+
+        pendingReferences[parameterId] = referenceCount;
+        if (referenceCount == 0)
+        {
+            ordered.append(parameterId);
+        }
+    }
+
+    // The list grows while it is iterated, as parameters become ready for evaluation.
+    for (int i = 0; i < ordered.size(); ++i)
+    {
+        for (QString const& referencingId : referencingParameters_.value(ordered.at(i)))
+        {
+            auto pending = pendingReferences.find(referencingId);
+            if (pending != pendingReferences.end() && --(*pending) == 0)
+            {
+                ordered.append(referencingId);
+            }
+        }
+    }
+
+    for (QString const& parameterId : parameterIds)
+    {
+        if (pendingReferences.value(parameterId) > 0)
+        {
+            unordered.append(parameterId);
+        }
+    }
+
+    return ordered;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterDependencyGraph::findCyclePath()
+//-----------------------------------------------------------------------------
+QStringList ParameterDependencyGraph::findCyclePath(QString const& startId, QSet<QString> const& groupIds) const
+{
+    // Breadth-first search from the parameter back to itself, recording the parameter each one was reached from.
+    QHash<QString, QString> reachedFrom;
+    QStringList pending(startId);
+
+    for (int i = 0; i < pending.size() && !reachedFrom.contains(startId); ++i)
+    {
+        QString currentId = pending.at(i);
+        for (QString const& referencedId : references_.value(currentId))
+        {
+            if (groupIds.contains(referencedId) && !reachedFrom.contains(referencedId))
+            {
+                reachedFrom.insert(referencedId, currentId);
+                pending.append(referencedId);
+            }
+        }
+    }
+
+    QStringList path(startId);
+    QString previousId = reachedFrom.value(startId);
+    while (previousId != startId)
+    {
+        path.prepend(previousId);
+        previousId = reachedFrom.value(previousId);
+    }
+    path.prepend(startId);
+
+    return path;
+}
@@ -0,0 +1,193 @@
+//-----------------------------------------------------------------------------
+// File: ParameterDependencyGraph.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Graph of the references between parameters.
+//-----------------------------------------------------------------------------
+
+#ifndef PARAMETERDEPENDENCYGRAPH_H
+#define PARAMETERDEPENDENCYGRAPH_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+class IPXactSystemVerilogParser;
+class ParameterFinder;
+
+//-----------------------------------------------------------------------------
+//! Graph of the references between parameters.
+//
+// The graph contains the parameters available in a parameter finder, e.g. the parameters of a component or the
+// parameters and configurable element values of a design, with an edge from each parameter to the parameters
+// referenced in its value. The references are found from the tokens of the value expressions, so only whole
+// parameter ids are recognized as references. The graph is not updated automatically, so it must be rebuilt
+// or the changed parameters updated after editing.
+//-----------------------------------------------------------------------------
+class ParameterDependencyGraph
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] finder  The finder for the parameters in the graph.
+     */
+    explicit ParameterDependencyGraph(QSharedPointer<ParameterFinder> finder);
+
+    //! The destructor.
+    ~ParameterDependencyGraph();
+
+    //! Rebuilds the graph from all the parameters available in the finder.
+    void rebuild();
+
+    /*!
+     *  Updates the references of a single parameter e.g. after its value has been edited. Parameters no longer
+     *  available in the finder are removed from the graph.
+     *
+     *      @param [in] parameterId     The id of the parameter to update.
+     */
+    void updateParameter(QString const& parameterId);
+
+    /*!
+     *  Checks if the graph contains a parameter.
+     *
+     *      @param [in] parameterId     The id of the parameter to check.
+     *
+     *      @return True, if the parameter is in the graph, otherwise false.
+     */
+    bool hasParameter(QString const& parameterId) const;
+
+    /*!
+     *  Get the ids of all the parameters in the graph.
+     *
+     *      @return The ids in the order the parameters were added to the graph.
+     */
+    QStringList getParameterIds() const;
+
+    /*!
+     *  Get the parameters directly referenced in the value of a parameter.
+     *
+     *      @param [in] parameterId     The id of the referencing parameter.
+     *
+     *      @return The ids of the referenced parameters.
+     */
+    QStringList getReferencedParameters(QString const& parameterId) const;
+
+    /*!
+     *  Get the parameters directly referencing a parameter in their values.
+     *
+     *      @param [in] parameterId     The id of the referenced parameter.
+     *
+     *      @return The ids of the referencing parameters.
+     */
+    QStringList getReferencingParameters(QString const& parameterId) const;
+
+    /*!
+     *  Get the parameters whose values change, if the value of a parameter is edited.
+     *
+     *      @param [in] parameterId     The id of the edited parameter.
+     *
+     *      @return The ids of the parameters depending directly or indirectly on the edited parameter, in the
+     *              order of evaluation. The edited parameter is included only if it references itself.
+     */
+    QStringList getAffectedParameters(QString const& parameterId) const;
+
+    /*!
+     *  Get the order in which the parameters can be evaluated, each after the parameters it references.
+     *
+     *      @return The ids of the parameters in the order of evaluation. Parameters in a reference cycle, or
+     *              depending on one, are not included.
+     */
+    QStringList getEvaluationOrder() const;
+
+    /*!
+     *  Finds the reference cycles in the graph.
+     *
+     *      @return One cycle for each group of parameters referencing each other. Each cycle is a path of
+     *              parameter ids starting and ending with the same parameter, e.g. a, b, c, a when the value of
+     *              a references b, the value of b references c and the value of c references a.
+     */
+    QList<QStringList> findCycles() const;
+
+    /*!
+     *  Evaluates the values of all the parameters in the graph in the order of evaluation.
+     *
+     *  Each value is evaluated only after the values it references. The evaluated values are kept in the parser,
+     *  so the validators and generators sharing the parser use the values without evaluating them again.
+     *
+     *      @param [in] parser  The parser using the same finder as the graph.
+     *
+     *      @return The evaluated values by parameter id. Parameters in a reference cycle have the value x.
+     */
+    QHash<QString, QString> evaluate(IPXactSystemVerilogParser const& parser) const;
+
+private:
+
+    // Disable copying.
+    ParameterDependencyGraph(ParameterDependencyGraph const& rhs);
+    ParameterDependencyGraph& operator=(ParameterDependencyGraph const& rhs);
+
+    /*!
+     *  Adds the references of a parameter to the graph.
+     *
+     *      @param [in] parameterId     The id of the referencing parameter.
+     */
+    void addReferences(QString const& parameterId);
+
+    /*!
+     *  Removes the references of a parameter from the graph.
+     *
+     *      @param [in] parameterId     The id of the referencing parameter.
+     */
+    void removeReferences(QString const& parameterId);
+
+    /*!
+     *  Orders the given parameters so that each comes after the parameters it references within the group.
+     *
+     *      @param [in]  parameterIds   The ids of the parameters to order.
+     *      @param [out] unordered      The ids of the parameters that could not be ordered because of cycles.
+     *
+     *      @return The ordered parameter ids.
+     */
+    QStringList orderForEvaluation(QStringList const& parameterIds, QStringList& unordered) const;
+
+    /*!
+     *  Finds the shortest reference cycle through a parameter within a group of parameters referencing each
+     *  other.
+     *
+     *      @param [in] startId     The id of the parameter in the cycle.
+     *      @param [in] groupIds    The ids of the parameters in the group.
+     *
+     *      @return The cycle path starting and ending with the given parameter.
+     */
+    QStringList findCyclePath(QString const& startId, QSet<QString> const& groupIds) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The finder for the parameters in the graph.
+    QSharedPointer<ParameterFinder> finder_;
+
+    //! The parser used to find the references in the parameter values.
+    QSharedPointer<IPXactSystemVerilogParser> referenceParser_;
+
+    //! The ids of the parameters in the graph in the order they were added.
+    QStringList parameterIds_;
+
+    //! The parameters referenced in the value of each parameter.
+    QHash<QString, QStringList> references_;
+
+    //! The parameters referencing each parameter in their values.
+    QHash<QString, QStringList> referencingParameters_;
+};
+
+#endif // PARAMETERDEPENDENCYGRAPH_H
@@ -85,6 +85,17 @@ public:
      */
     virtual void registerParameterModel(QAbstractItemModel const* model) = 0;
 
+    /*!
+     *  Get the revision of the parameters. The revision changes whenever a parameter is added, removed or changed
+     *  through a registered parameter model.
+     *
+     *      @return The revision, or a negative value if the finder does not track the changes.
+     */
+    virtual int getParameterRevision() const
+    {
+        return -1;
+    }
+
 };
 
 #endif // PARAMETERFINDER_H
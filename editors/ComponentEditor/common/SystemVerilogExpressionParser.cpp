@@ -20,6 +20,7 @@
 #include <QDebug>
 
 #include <algorithm>
+#include <limits>
 
 namespace
 {
@@ -42,8 +43,24 @@ namespace
     const QString CLOSE_ARRAY_STRING("}");
 
     const QRegularExpression ANY_OPERATOR(BINARY_OPERATOR.pattern() + "|" + UNARY_OPERATOR.pattern());
+
+    //! The default number of compiled expressions kept for reuse.
+    const int DEFAULT_COMPILED_EXPRESSION_LIMIT = 10000;
+
+    //! Integer products and powers of smaller magnitude are calculated with 64-bit integers.
+    const qreal MAX_EXACT_INTEGER = 9.0e18;
+
+    //! The widest integer result of a shift or a power calculated exactly.
+    const int MAX_INTEGER_BITS = 65536;
 }
 
+QThreadStorage<SystemVerilogExpressionParser::CompiledExpressionCache*>
+    SystemVerilogExpressionParser::compiledExpressions_;
+
+QAtomicInt SystemVerilogExpressionParser::compiledExpressionLimit_(DEFAULT_COMPILED_EXPRESSION_LIMIT);
+
+QAtomicInt SystemVerilogExpressionParser::compiledExpressionGeneration_(0);
+
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::SystemVerilogExpressionParser()
 //-----------------------------------------------------------------------------
@@ -57,7 +74,7 @@ SystemVerilogExpressionParser::SystemVerilogExpressionParser()
 //-----------------------------------------------------------------------------
 QString SystemVerilogExpressionParser::parseExpression(QString const& expression, bool* validExpression) const
 {
-    return solveRPN(convertToRPN(expression), validExpression);
+    return solveRPN(compile(expression), validExpression);
 }
 
 //-----------------------------------------------------------------------------
@@ -83,21 +100,130 @@ int SystemVerilogExpressionParser::baseForExpression(QString const& expression)
 {
     int greatestBase = 0;
     
-    for (QString const& token : convertToRPN(expression))
+    for (CompiledToken const& token : compile(expression))
     {
-        if (isLiteral(token))
+        if (isLiteral(token.text))
         {
-            greatestBase = qMax(greatestBase, getBaseForNumber(token));
+            greatestBase = qMax(greatestBase, getBaseForNumber(token.text));
         }
-        else if (isSymbol(token))
+        else if (token.type == TokenType::OTHER && isSymbol(token.text))
         {
-            greatestBase = qMax(greatestBase, getBaseForSymbol(token));
+            greatestBase = qMax(greatestBase, getBaseForSymbol(token.text));
         }
     }
 
     return greatestBase;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::findSymbols()
+//-----------------------------------------------------------------------------
+QStringList SystemVerilogExpressionParser::findSymbols(QString const& expression) const
+{
+    QStringList symbols;
+
+    for (CompiledToken const& token : compile(expression))
+    {
+        if (token.type == TokenType::OTHER && !symbols.contains(token.text) && isSymbol(token.text))
+        {
+            symbols.append(token.text);
+        }
+    }
+
+    return symbols;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::setCompiledExpressionLimit()
+//-----------------------------------------------------------------------------
+void SystemVerilogExpressionParser::setCompiledExpressionLimit(int expressionCount)
+{
+    compiledExpressionLimit_.storeRelease(expressionCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::clearCompiledExpressions()
+//-----------------------------------------------------------------------------
+void SystemVerilogExpressionParser::clearCompiledExpressions()
+{
+    compiledExpressionGeneration_.fetchAndAddOrdered(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::compile()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::CompiledExpression SystemVerilogExpressionParser::compile(
+    QString const& expression) const
+{
+    // Each thread has its own expressions, so the parsers in parallel validation do not wait for each other.
+    if (compiledExpressions_.hasLocalData() == false)
+    {
+        compiledExpressions_.setLocalData(new CompiledExpressionCache());
+    }
+
+    CompiledExpressionCache* cache = compiledExpressions_.localData();
+
+    int generation = compiledExpressionGeneration_.loadAcquire();
+    if (cache->generation != generation)
+    {
+        cache->expressions.clear();
+        cache->generation = generation;
+    }
+
+    int limit = compiledExpressionLimit_.loadAcquire();
+    if (cache->expressions.maxCost() != limit)
+    {
+        cache->expressions.setMaxCost(limit);
+    }
+
+    CompiledExpression const* cached = cache->expressions.object(expression);
+    if (cached != nullptr)
+    {
+        return *cached;
+    }
+
+    // Symbols may change their meaning between evaluations, so they are recognized only when solving.
+    CompiledExpression compiled;
+    for (QString const& token : convertToRPN(expression))
+    {
+        CompiledToken compiledToken;
+        compiledToken.text = token;
+
+        if (PRIMARY_LITERAL.match(token, 0, QRegularExpression::NormalMatch,
+            QRegularExpression::AnchoredMatchOption).hasMatch())
+        {
+            compiledToken.type = TokenType::LITERAL;
+            compiledToken.value = toTerm(parseConstant(token));
+        }
+        else if (isBinaryOperator(token))
+        {
+            compiledToken.type = TokenType::BINARY_OPERATOR;
+        }
+        else if (isUnaryOperator(token))
+        {
+            compiledToken.type = TokenType::UNARY_OPERATOR;
+        }
+        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        {
+            compiledToken.type = TokenType::OPEN_ARRAY;
+        }
+        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        {
+            compiledToken.type = TokenType::CLOSE_ARRAY;
+        }
+        else
+        {
+            compiledToken.type = TokenType::OTHER;
+        }
+
+        compiled.append(compiledToken);
+    }
+
+    cache->expressions.insert(expression, new CompiledExpression(compiled));
+
+    return compiled;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::convertToRPN()
 //-----------------------------------------------------------------------------
@@ -228,21 +354,20 @@ QStringList SystemVerilogExpressionParser::convertToRPN(QString const& expressio
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveRPN()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveRPN(QStringList const& rpn, bool* validExpression) const
+QString SystemVerilogExpressionParser::solveRPN(CompiledExpression const& rpn, bool* validExpression) const
 {
-    QStringList resultStack;
+    QVector<Term> resultStack;
     bool isWellFormed = true;
 
-    for (QString const& token : rpn)
+    for (CompiledToken const& compiledToken : rpn)
     {
-        QRegularExpressionMatch match = PRIMARY_LITERAL.match(token, 0, QRegularExpression::NormalMatch,
-            QRegularExpression::AnchoredMatchOption);
+        QString const& token = compiledToken.text;
 
-        if (match.hasMatch())
+        if (compiledToken.type == TokenType::LITERAL)
         {
-            resultStack.append(parseConstant(token));
+            resultStack.append(compiledToken.value);
         }
-        else if (isBinaryOperator(token))
+        else if (compiledToken.type == TokenType::BINARY_OPERATOR)
         {
             if (resultStack.size() < 2)
             {
@@ -250,9 +375,11 @@ QString SystemVerilogExpressionParser::solveRPN(QStringList const& rpn, bool* va
                 break;
             }
 
-            resultStack.append(solveBinary(token, resultStack.takeLast(), resultStack.takeLast()));
+            Term rightTerm = resultStack.takeLast();
+            Term leftTerm = resultStack.takeLast();
+            resultStack.append(solveBinary(token, leftTerm, rightTerm));
         }
-        else if (isUnaryOperator(token))
+        else if (compiledToken.type == TokenType::UNARY_OPERATOR)
         {
             if (resultStack.isEmpty())
             {
@@ -262,16 +389,16 @@ QString SystemVerilogExpressionParser::solveRPN(QStringList const& rpn, bool* va
 
             resultStack.append(solveUnary(token, resultStack.takeLast()));
         }
-        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        else if (compiledToken.type == TokenType::OPEN_ARRAY)
         {
-            resultStack.append(token);
+            resultStack.append(toTerm(token));
         }
-        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        else if (compiledToken.type == TokenType::CLOSE_ARRAY)
         {
             QStringList items;
-            while (resultStack.size() > 0 && resultStack.last().compare(OPEN_ARRAY_STRING) != 0)
+            while (resultStack.size() > 0 && resultStack.last().text.compare(OPEN_ARRAY_STRING) != 0)
             {
-                items.prepend(resultStack.takeLast());
+                items.prepend(toText(resultStack.takeLast()));
             }
 
             if (resultStack.size() == 0)
@@ -280,12 +407,12 @@ QString SystemVerilogExpressionParser::solveRPN(QStringList const& rpn, bool* va
                 break;
             }
 
-            QString arrayItem(resultStack.takeLast() + items.join(QLatin1Char(',')) + token);
-            resultStack.append(arrayItem);
+            QString arrayItem(resultStack.takeLast().text + items.join(QLatin1Char(',')) + token);
+            resultStack.append(toTerm(arrayItem));
         }
         else if (isSymbol(token))
         {
-            resultStack.append(findSymbolValue(token));
+            resultStack.append(toTerm(findSymbolValue(token)));
         }
         else
         {
@@ -294,12 +421,142 @@ QString SystemVerilogExpressionParser::solveRPN(QStringList const& rpn, bool* va
         }
     }
 
+    // The terms are converted to text only for the result.
+    QString result;
+    bool hasUnknown = false;
+    for (Term const& term : resultStack)
+    {
+        QString text = toText(term);
+        hasUnknown = hasUnknown || text.compare(QLatin1String("x")) == 0;
+        result.append(text);
+    }
+
     if (validExpression != nullptr)
     {
-        *validExpression = isWellFormed && resultStack.contains(QStringLiteral("x")) == false;
+        *validExpression = isWellFormed && hasUnknown == false;
     }
 
-    return resultStack.join(QString());
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toTerm()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::toTerm(QString const& text) const
+{
+    Term term;
+    term.text = text;
+
+    bool fitsInteger = false;
+    term.integer = text.toLongLong(&fitsInteger);
+
+    if (isLiteral(text))
+    {
+        if (text.contains(QLatin1Char('.')))
+        {
+            term.type = TermType::REAL;
+            term.real = text.toDouble();
+            term.precision = getDecimalPrecision(text);
+        }
+        else
+        {
+            term.type = TermType::INTEGER;
+            term.real = term.integer;
+
+            if (fitsInteger == false)
+            {
+                bool isDecimal = false;
+                BigInteger wide = BigInteger::fromString(text.trimmed(), 10, &isDecimal);
+                if (isDecimal)
+                {
+                    term.wide = wide;
+                    term.isWide = true;
+                    term.integer = wide.toLongLong();
+                    term.real = wide.toDouble();
+                }
+            }
+        }
+    }
+    else if (isStringLiteral(text))
+    {
+        term.type = TermType::STRING;
+    }
+
+    return term;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::integerTerm()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::integerTerm(qint64 value)
+{
+    Term term;
+    term.type = TermType::INTEGER;
+    term.integer = value;
+    term.real = value;
+
+    return term;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::integerTerm()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::integerTerm(BigInteger const& value)
+{
+    if (value.fitsInLongLong())
+    {
+        return integerTerm(value.toLongLong());
+    }
+
+    Term term;
+    term.type = TermType::INTEGER;
+    term.integer = value.toLongLong();
+    term.wide = value;
+    term.isWide = true;
+    term.real = value.toDouble();
+
+    return term;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toBigInteger()
+//-----------------------------------------------------------------------------
+BigInteger SystemVerilogExpressionParser::toBigInteger(Term const& term)
+{
+    if (term.isWide)
+    {
+        return term.wide;
+    }
+
+    return BigInteger(term.integer);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::unknownTerm()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::unknownTerm()
+{
+    Term term;
+    term.text = QStringLiteral("x");
+    return term;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toText()
+//-----------------------------------------------------------------------------
+QString SystemVerilogExpressionParser::toText(Term const& term)
+{
+    if (term.type == TermType::INTEGER && term.text.isEmpty())
+    {
+        if (term.isWide)
+        {
+            return term.wide.toString();
+        }
+
+        return QString::number(term.integer);
+    }
+
+    return term.text;
 }
 
 //-----------------------------------------------------------------------------
@@ -344,223 +601,509 @@ bool SystemVerilogExpressionParser::isBinaryOperator(QString const& token) const
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveBinary()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveBinary(QString const& operation, QString const& leftTerm,
-    QString const& rightTerm) const
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveBinary(QString const& operation,
+    Term const& leftTerm, Term const& rightTerm) const
 {
-    if (isLiteral(leftTerm) && isLiteral(rightTerm))
+    bool leftIsNumber = leftTerm.type == TermType::INTEGER || leftTerm.type == TermType::REAL;
+    bool rightIsNumber = rightTerm.type == TermType::INTEGER || rightTerm.type == TermType::REAL;
+
+    if (leftIsNumber && rightIsNumber)
     {
-        qreal leftOperand = leftTerm.toDouble();
-        qreal rightOperand = rightTerm.toDouble();
+        if (leftTerm.type == TermType::INTEGER && rightTerm.type == TermType::INTEGER)
+        {
+            return solveIntegerBinary(operation, leftTerm, rightTerm);
+        }
 
-        qreal result = 0;
+        return solveRealBinary(operation, leftTerm, rightTerm);
+    }
 
-        if (operation.compare(QLatin1String("**")) == 0 || operation.compare(QLatin1String("$pow")) == 0)
+    else if (leftTerm.type == TermType::STRING && rightTerm.type == TermType::STRING)
+    {
+        if ((operation.compare(QLatin1String("==")) == 0 && leftTerm.text.compare(rightTerm.text) == 0) ||
+            (operation.compare(QLatin1String("!=")) == 0 && leftTerm.text.compare(rightTerm.text) != 0))
         {
-            if (leftOperand == 0 && rightOperand < 0)
-            {
-                return QStringLiteral("x");
-            }
+            return integerTerm(1);
+        }
+        else
+        {
+            return integerTerm(0);
+        }
+    }
 
-            result = qPow(leftOperand, rightOperand);
+    return unknownTerm();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveIntegerBinary()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveIntegerBinary(QString const& operation,
+    Term const& leftTerm, Term const& rightTerm) const
+{
+    if (operation.compare(QLatin1String("**")) == 0 || operation.compare(QLatin1String("$pow")) == 0)
+    {
+        if (leftTerm.isWide == false && leftTerm.integer == 0 && rightTerm.real < 0)
+        {
+            return unknownTerm();
+        }
+        else if (rightTerm.real < 0 && operation.compare(QLatin1String("**")) == 0)
+        {
+            return integerTerm(static_cast<qint64>(qPow(leftTerm.real, rightTerm.real)));
         }
+        else if (rightTerm.real < 0 || rightTerm.isWide)
+        {
+            return toTerm(QString::number(qPow(leftTerm.real, rightTerm.real), 'f', 0));
+        }
+
+        return solveIntegerPower(leftTerm, rightTerm.integer);
+    }
+
+    if (leftTerm.isWide == false && rightTerm.isWide == false)
+    {
+        qint64 left = leftTerm.integer;
+        qint64 right = rightTerm.integer;
 
-        else if (operation.compare(QLatin1String("*")) == 0)
+        // Operations that overflow 64 bits are solved again in full width below.
+        if (operation.compare(QLatin1String("*")) == 0)
         {
-            result = leftOperand*rightOperand;
+            if (qAbs(qreal(left) * qreal(right)) < MAX_EXACT_INTEGER)
+            {
+                return integerTerm(left * right);
+            }
         }
 
         else if (operation.compare(QLatin1String("/")) == 0)
         {
-            if (rightOperand == 0)
+            if (right == 0)
             {
-                return QStringLiteral("x");
+                return unknownTerm();
             }
 
-            result = leftOperand/rightOperand;
+            if (left != std::numeric_limits<qint64>::min() || right != -1)
+            {
+                return integerTerm(left / right);
+            }
         }
 
         else if (operation.compare(QLatin1String("%")) == 0)
         {
-            if (rightOperand == 0 || leftTerm.contains(".") || rightTerm.contains("."))
+            if (right == 0)
             {
-                return QStringLiteral("x");
+                return unknownTerm();
             }
 
-            result = leftTerm.toLongLong() % rightTerm.toLongLong();
+            return integerTerm(right == -1 ? 0 : left % right);
         }
 
         else if (operation.compare(QLatin1String("+")) == 0)
         {
-            result = leftOperand + rightOperand;
+            if ((right <= 0 || left <= std::numeric_limits<qint64>::max() - right) &&
+                (right >= 0 || left >= std::numeric_limits<qint64>::min() - right))
+            {
+                return integerTerm(left + right);
+            }
         }
 
         else if (operation.compare(QLatin1String("-")) == 0)
         {
-            result = leftOperand - rightOperand;
+            if ((right >= 0 || left <= std::numeric_limits<qint64>::max() + right) &&
+                (right <= 0 || left >= std::numeric_limits<qint64>::min() + right))
+            {
+                return integerTerm(left - right);
+            }
         }
 
         else if (operation.compare(QLatin1String("<<")) == 0)
         {
-          if (leftTerm.contains('.') || rightTerm.contains("."))
-          {
-            return QStringLiteral("x");
-          }
-
-          result = leftTerm.toLongLong() << rightTerm.toLongLong();
+            if (right >= 0 && right < 63)
+            {
+                qint64 shifted = static_cast<qint64>(static_cast<quint64>(left) << right);
+                if ((shifted >> right) == left)
+                {
+                    return integerTerm(shifted);
+                }
+            }
         }
 
         else if (operation.compare(QLatin1String(">>")) == 0)
         {
-            if (leftTerm.contains('.') || rightTerm.contains("."))
+            if (right >= 0)
             {
-                return QStringLiteral("x");
+                return integerTerm(right < 64 ? left >> right : (left < 0 ? -1 : 0));
             }
-
-          result = leftTerm.toLongLong() >> rightTerm.toLongLong();
         }
 
-        else if ((operation.compare(QLatin1String(">")) == 0 && leftOperand > rightOperand) ||
-            (operation.compare(QLatin1String("<")) == 0 && leftOperand < rightOperand) ||
-            (operation.compare(QLatin1String("==")) == 0 && leftOperand == rightOperand) ||
-            (operation.compare(QLatin1String(">=")) == 0 && leftOperand >= rightOperand) ||
-            (operation.compare(QLatin1String("<=")) == 0 && leftOperand <= rightOperand) ||
-            (operation.compare(QLatin1String("!=")) == 0 && leftOperand != rightOperand))
+        else if ((operation.compare(QLatin1String(">")) == 0 && left > right) ||
+            (operation.compare(QLatin1String("<")) == 0 && left < right) ||
+            (operation.compare(QLatin1String("==")) == 0 && left == right) ||
+            (operation.compare(QLatin1String(">=")) == 0 && left >= right) ||
+            (operation.compare(QLatin1String("<=")) == 0 && left <= right) ||
+            (operation.compare(QLatin1String("!=")) == 0 && left != right))
         {
-            return QStringLiteral("1");
+            return integerTerm(1);
         }
 
         else if (operation.compare(QLatin1String("||")) == 0)
         {
-            result = leftTerm.toLongLong() || rightTerm.toLongLong();
+            return integerTerm(left || right);
         }
 
         else if (operation.compare(QLatin1String("&&")) == 0)
         {
-            result = leftTerm.toLongLong() && rightTerm.toLongLong();
+            return integerTerm(left && right);
         }
 
         else if (operation.compare(QLatin1String("|")) == 0)
         {
-          if (leftTerm.contains('.') || rightTerm.contains("."))
-          {
-                return QStringLiteral("x");
-          }
-
-          result = leftTerm.toLongLong() | rightTerm.toLongLong();
+            return integerTerm(left | right);
         }
 
         else if (operation.compare(QLatin1String("^")) == 0)
         {
-          if (leftTerm.contains('.') || rightTerm.contains("."))
-          {
-                return QStringLiteral("x");
-          }
-          
-          result = leftTerm.toLongLong() ^ rightTerm.toLongLong();
+            return integerTerm(left ^ right);
         }
 
-        else if (operation.compare(QLatin1String("&"))==0)
+        else if (operation.compare(QLatin1String("&")) == 0)
         {
-          if (leftTerm.contains('.') || rightTerm.contains("."))
-          {
-                return QStringLiteral("x");
-          }
-          
-          result = leftTerm.toLongLong() & rightTerm.toLongLong();
+            return integerTerm(left & right);
         }
 
-        if (!leftTerm.contains('.') &&  (operation.compare(QLatin1String("/")) == 0 ||
-           (operation.compare(QLatin1String("**")) == 0 && rightOperand < 0)))
+        else
         {
-            int integerResult = result;
-            return QString::number(integerResult);
+            return integerTerm(0);
         }
-        else
+    }
+
+    return solveWideBinary(operation, toBigInteger(leftTerm), toBigInteger(rightTerm));
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveWideBinary()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveWideBinary(QString const& operation,
+    BigInteger const& left, BigInteger const& right) const
+{
+    if (operation.compare(QLatin1String("*")) == 0)
+    {
+        return integerTerm(left * right);
+    }
+
+    else if (operation.compare(QLatin1String("/")) == 0)
+    {
+        if (right.isZero())
         {
-            return QString::number(result, 'f',
-                qMax(getDecimalPrecision(leftTerm), getDecimalPrecision(rightTerm)));
+            return unknownTerm();
         }
+
+        return integerTerm(left / right);
     }
 
-    else if (isStringLiteral(leftTerm) && isStringLiteral(rightTerm))
+    else if (operation.compare(QLatin1String("%")) == 0)
     {
-        if ((operation.compare(QLatin1String("==")) == 0 && leftTerm.compare(rightTerm) == 0) ||
-            (operation.compare(QLatin1String("!=")) == 0 && leftTerm.compare(rightTerm) != 0))
+        if (right.isZero())
         {
-            return QStringLiteral("1");
+            return unknownTerm();
         }
-        else
+
+        return integerTerm(left % right);
+    }
+
+    else if (operation.compare(QLatin1String("+")) == 0)
+    {
+        return integerTerm(left + right);
+    }
+
+    else if (operation.compare(QLatin1String("-")) == 0)
+    {
+        return integerTerm(left - right);
+    }
+
+    else if (operation.compare(QLatin1String("<<")) == 0)
+    {
+        if (right.isNegative() || right > BigInteger(MAX_INTEGER_BITS))
+        {
+            return unknownTerm();
+        }
+
+        return integerTerm(left << static_cast<int>(right.toLongLong()));
+    }
+
+    else if (operation.compare(QLatin1String(">>")) == 0)
+    {
+        if (right.isNegative())
+        {
+            return unknownTerm();
+        }
+        else if (right > BigInteger(left.bitLength()))
+        {
+            return integerTerm(left.isNegative() ? -1 : 0);
+        }
+
+        return integerTerm(left >> static_cast<int>(right.toLongLong()));
+    }
+
+    else if ((operation.compare(QLatin1String(">")) == 0 && left > right) ||
+        (operation.compare(QLatin1String("<")) == 0 && left < right) ||
+        (operation.compare(QLatin1String("==")) == 0 && left == right) ||
+        (operation.compare(QLatin1String(">=")) == 0 && left >= right) ||
+        (operation.compare(QLatin1String("<=")) == 0 && left <= right) ||
+        (operation.compare(QLatin1String("!=")) == 0 && left != right))
+    {
+        return integerTerm(1);
+    }
+
+    else if (operation.compare(QLatin1String("||")) == 0)
+    {
+        return integerTerm(left.isZero() == false || right.isZero() == false);
+    }
+
+    else if (operation.compare(QLatin1String("&&")) == 0)
+    {
+        return integerTerm(left.isZero() == false && right.isZero() == false);
+    }
+
+    else if (operation.compare(QLatin1String("|")) == 0)
+    {
+        return integerTerm(left | right);
+    }
+
+    else if (operation.compare(QLatin1String("^")) == 0)
+    {
+        return integerTerm(left ^ right);
+    }
+
+    else if (operation.compare(QLatin1String("&")) == 0)
+    {
+        return integerTerm(left & right);
+    }
+
+    return integerTerm(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveRealBinary()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveRealBinary(QString const& operation,
+    Term const& leftTerm, Term const& rightTerm) const
+{
+    qreal leftOperand = leftTerm.real;
+    qreal rightOperand = rightTerm.real;
+
+    qreal result = 0;
+
+    if (operation.compare(QLatin1String("**")) == 0 || operation.compare(QLatin1String("$pow")) == 0)
+    {
+        if (leftOperand == 0 && rightOperand < 0)
+        {
+            return unknownTerm();
+        }
+
+        result = qPow(leftOperand, rightOperand);
+    }
+
+    else if (operation.compare(QLatin1String("*")) == 0)
+    {
+        result = leftOperand*rightOperand;
+    }
+
+    else if (operation.compare(QLatin1String("/")) == 0)
+    {
+        if (rightOperand == 0)
+        {
+            return unknownTerm();
+        }
+
+        result = leftOperand/rightOperand;
+    }
+
+    else if (operation.compare(QLatin1String("+")) == 0)
+    {
+        result = leftOperand + rightOperand;
+    }
+
+    else if (operation.compare(QLatin1String("-")) == 0)
+    {
+        result = leftOperand - rightOperand;
+    }
+
+    // Modulo, shifts and bitwise operations are defined only for integers.
+    else if (operation.compare(QLatin1String("%")) == 0 ||
+        operation.compare(QLatin1String("<<")) == 0 ||
+        operation.compare(QLatin1String(">>")) == 0 ||
+        operation.compare(QLatin1String("|")) == 0 ||
+        operation.compare(QLatin1String("^")) == 0 ||
+        operation.compare(QLatin1String("&")) == 0)
+    {
+        return unknownTerm();
+    }
+
+    else if ((operation.compare(QLatin1String(">")) == 0 && leftOperand > rightOperand) ||
+        (operation.compare(QLatin1String("<")) == 0 && leftOperand < rightOperand) ||
+        (operation.compare(QLatin1String("==")) == 0 && leftOperand == rightOperand) ||
+        (operation.compare(QLatin1String(">=")) == 0 && leftOperand >= rightOperand) ||
+        (operation.compare(QLatin1String("<=")) == 0 && leftOperand <= rightOperand) ||
+        (operation.compare(QLatin1String("!=")) == 0 && leftOperand != rightOperand))
+    {
+        return integerTerm(1);
+    }
+
+    // Real numbers are not integers, so they are false in logical operations.
+    else if (operation.compare(QLatin1String("||")) == 0)
+    {
+        result = (leftTerm.isWide || leftTerm.integer != 0) || (rightTerm.isWide || rightTerm.integer != 0);
+    }
+
+    else if (operation.compare(QLatin1String("&&")) == 0)
+    {
+        result = (leftTerm.isWide || leftTerm.integer != 0) && (rightTerm.isWide || rightTerm.integer != 0);
+    }
+
+    if (leftTerm.type == TermType::INTEGER && (operation.compare(QLatin1String("/")) == 0 ||
+       (operation.compare(QLatin1String("**")) == 0 && rightOperand < 0)))
+    {
+        if (qIsFinite(result) == false || qAbs(result) >= MAX_EXACT_INTEGER)
         {
-            return QStringLiteral("0");
+            return unknownTerm();
         }
+
+        return integerTerm(static_cast<qint64>(result));
     }
 
-    return QStringLiteral("x");
+    // The result is rounded to the precision of the terms, as the following operations use the rounded value.
+    return toTerm(QString::number(result, 'f', qMax(leftTerm.precision, rightTerm.precision)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveIntegerPower()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveIntegerPower(Term const& baseTerm,
+    qint64 exponent) const
+{
+    qreal estimate = qPow(baseTerm.real, exponent);
+    if (baseTerm.isWide == false && qAbs(estimate) < MAX_EXACT_INTEGER)
+    {
+        // The base is squared only while exponent bits remain, so no intermediate value exceeds the result.
+        qint64 base = baseTerm.integer;
+        qint64 result = 1;
+        while (exponent > 0)
+        {
+            if (exponent & 1)
+            {
+                result *= base;
+            }
+
+            exponent >>= 1;
+            if (exponent > 0)
+            {
+                base *= base;
+            }
+        }
+
+        return integerTerm(result);
+    }
+
+    BigInteger base = toBigInteger(baseTerm);
+    if (qreal(base.bitLength()) * exponent > MAX_INTEGER_BITS)
+    {
+        return toTerm(QString::number(estimate, 'f', 0));
+    }
+
+    BigInteger result(1);
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = result * base;
+        }
+
+        exponent >>= 1;
+        if (exponent > 0)
+        {
+            base = base * base;
+        }
+    }
+
+    return integerTerm(result);
 }
 
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveUnary()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveUnary(QString const& operation, QString const& term) const
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveUnary(QString const& operation,
+    Term const& term) const
 {
+    // Wide integers are used through their nearest floating point value.
+    qreal value = term.isWide ? term.real : term.integer;
+
     if (operation.compare(QLatin1String("$clog2")) == 0)
     {
         return solveClog2(term);
     }
     else if (operation.compare(QLatin1String("$exp")) == 0)
     {
-        return QString::number(qExp(term.toLongLong()));
+        return toTerm(QString::number(qExp(value)));
     }
     else if (operation.compare(QLatin1String("$sqrt")) == 0)
     {
-        return solveSqrt(term);
+        return solveSqrt(value);
     }
     else if (operation.compare(QLatin1String("~")) == 0)
     {
-        return QString::number(~term.toLongLong());
+        if (term.isWide)
+        {
+            return integerTerm(~term.wide);
+        }
+
+        return integerTerm(~term.integer);
     }
 
-    return QStringLiteral("x");
+    return unknownTerm();
 }
 
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveClog2()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveClog2(QString const& value) const
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveClog2(Term const& term) const
 {
-    qreal quotient = value.toLongLong();
+    if (term.isWide)
+    {
+        if (term.wide.isNegative())
+        {
+            return unknownTerm();
+        }
+
+        return integerTerm((term.wide - BigInteger(1)).bitLength());
+    }
 
-    if (quotient < 0)
+    qint64 value = term.integer;
+    if (value < 0)
     {
-        return QStringLiteral("x");
+        return unknownTerm();
     }
-    else if (quotient == 1)
+    else if (value == 1)
     {
-        return QStringLiteral("1");
+        return integerTerm(1);
     }
 
     int answer = 0;
-    while (quotient > 1)
+    while ((Q_UINT64_C(1) << answer) < static_cast<quint64>(value))
     {
-        quotient /= 2;
         answer++;
     }
 
-    return QString::number(answer);
+    return integerTerm(answer);
 }
 
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveSqrt()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveSqrt(QString const& value) const
+SystemVerilogExpressionParser::Term SystemVerilogExpressionParser::solveSqrt(qreal value) const
 {
-    qreal radicand = value.toLongLong();
-    if (radicand < 0)
+    if (value < 0)
     {
-        return QStringLiteral("x");
+        return unknownTerm();
     }
 
-    return QString::number(qSqrt(radicand));
+    return toTerm(QString::number(qSqrt(value)));
 }
 
 //-----------------------------------------------------------------------------
@@ -585,7 +1128,19 @@ QString SystemVerilogExpressionParser::parseConstant(QString token) const
     token.remove(prefix);
     token.remove('_');
 
-    return QString::number(token.toLongLong(nullptr, base));
+    bool fitsInteger = false;
+    qint64 value = token.toLongLong(&fitsInteger, base);
+    if (fitsInteger == false)
+    {
+        bool isNumber = false;
+        BigInteger wide = BigInteger::fromString(token, base, &isNumber);
+        if (isNumber)
+        {
+            return wide.toString();
+        }
+    }
+
+    return QString::number(value);
 }
 
 //-----------------------------------------------------------------------------
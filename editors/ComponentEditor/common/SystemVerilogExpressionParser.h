@@ -12,10 +12,15 @@
 #ifndef SYSTEMVERILOGEXPRESSIONPARSER_H
 #define SYSTEMVERILOGEXPRESSIONPARSER_H
 
+#include "BigInteger.h"
 #include "ExpressionParser.h"
 
-#include <QString>
+#include <QAtomicInt>
+#include <QCache>
 #include <QMap>
+#include <QString>
+#include <QThreadStorage>
+#include <QVector>
 
 //-----------------------------------------------------------------------------
 //! Parser for SystemVerilog expressions.
@@ -67,6 +72,25 @@ public:
      */
     virtual int baseForExpression(QString const& expression) const override;
 
+    /*!
+     *  Finds the symbols referenced in the expression.
+     *
+     *      @param [in] expression   The expression to search in.
+     *
+     *      @return The distinct symbols in the order of their first appearance in the expression.
+     */
+    QStringList findSymbols(QString const& expression) const;
+
+    /*!
+     *  Sets the maximum number of compiled expressions kept for reuse in each thread.
+     *
+     *      @param [in] expressionCount     The maximum number of compiled expressions.
+     */
+    static void setCompiledExpressionLimit(int expressionCount);
+
+    //! Removes all compiled expressions kept for reuse. The threads remove their expressions on their next use.
+    static void clearCompiledExpressions();
+
 protected:
      
     /*!
@@ -120,6 +144,66 @@ private:
 	SystemVerilogExpressionParser(SystemVerilogExpressionParser const& rhs);
 	SystemVerilogExpressionParser& operator=(SystemVerilogExpressionParser const& rhs);
 
+    //! The kinds of tokens in a compiled expression.
+    enum class TokenType
+    {
+        LITERAL,
+        BINARY_OPERATOR,
+        UNARY_OPERATOR,
+        OPEN_ARRAY,
+        CLOSE_ARRAY,
+        OTHER
+    };
+
+    //! The kinds of values in an evaluation.
+    enum class TermType
+    {
+        INTEGER,
+        REAL,
+        STRING,
+        OTHER
+    };
+
+    //! A value in an evaluation, kept in its own type until the result is converted to text.
+    struct Term
+    {
+        TermType type = TermType::OTHER;    //!< The kind of the value.
+        qint64 integer = 0;                 //!< The integer value, or the integer conversion of the text.
+        BigInteger wide;                    //!< The value of an integer that does not fit in 64 bits.
+        bool isWide = false;                //!< True, if the integer value is in wide.
+        qreal real = 0;                     //!< The value of a real number, or the nearest value of an integer.
+        int precision = 0;                  //!< The number of decimals in a real number.
+        QString text;                       //!< The value as text. Empty for calculated integers.
+    };
+
+    //! A single token of a compiled expression.
+    struct CompiledToken
+    {
+        TokenType type;     //!< The kind of the token.
+        QString text;       //!< The token as written in the expression.
+        Term value;         //!< The parsed value of a literal token.
+    };
+
+    //! An expression compiled to Reverse Polish Notation with the tokens already classified.
+    typedef QVector<CompiledToken> CompiledExpression;
+
+    //! The compiled expressions kept for reuse in a thread.
+    struct CompiledExpressionCache
+    {
+        QCache<QString, CompiledExpression> expressions;    //!< The compiled expressions by expression text.
+        int generation = -1;                                //!< The clearing generation of the expressions.
+    };
+
+    /*!
+     *  Get the compiled form of the given expression. Compiled expressions are shared by all parsers used in the
+     *  same thread, so each distinct expression is tokenized only once per thread without locking.
+     *
+     *      @param [in] expression   The expression to compile.
+     *
+     *      @return The compiled expression.
+     */
+    CompiledExpression compile(QString const& expression) const;
+
     /*!
      *  Converts the given expression to Reverse Polish Notation (RPN) format.
      *  RPN is used to ensure the operations are calculated in the correct precedence order.
@@ -131,14 +215,66 @@ private:
     QStringList convertToRPN(QString const& expression) const;
 
     /*!
-     *  Solves the given RPN expression.
+     *  Solves the given compiled expression.
      *
      *      @param [in]     rpn                The expression to solve.
      *      @param [out]    validExpression    Set to true, if the parsing was successful, otherwise false.
      *
      *      @return The solved result.
      */
-    QString solveRPN(QStringList const& rpn, bool* validExpression) const;
+    QString solveRPN(CompiledExpression const& rpn, bool* validExpression) const;
+
+    /*!
+     *  Creates a term from the given text, e.g. a symbol value.
+     *
+     *      @param [in] text    The text to convert.
+     *
+     *      @return The term with the type recognized from the text.
+     */
+    Term toTerm(QString const& text) const;
+
+    /*!
+     *  Creates a term for a calculated integer.
+     *
+     *      @param [in] value   The calculated integer.
+     *
+     *      @return The term for the integer.
+     */
+    static Term integerTerm(qint64 value);
+
+    /*!
+     *  Creates a term for a calculated integer of any width.
+     *
+     *      @param [in] value   The calculated integer.
+     *
+     *      @return The term for the integer.
+     */
+    static Term integerTerm(BigInteger const& value);
+
+    /*!
+     *  Get the integer value of the given integer term in any width.
+     *
+     *      @param [in] term    The integer term.
+     *
+     *      @return The integer value of the term.
+     */
+    static BigInteger toBigInteger(Term const& term);
+
+    /*!
+     *  Creates a term for an unknown value.
+     *
+     *      @return The unknown term.
+     */
+    static Term unknownTerm();
+
+    /*!
+     *  Get the text of the given term.
+     *
+     *      @param [in] term    The term whose text to get.
+     *
+     *      @return The term as text.
+     */
+    static QString toText(Term const& term);
 
     /*!
      *  Checks if the given expression is a string.
@@ -185,26 +321,70 @@ private:
      *
      *      @return The result of the operation.
      */
-    QString solveBinary(QString const& operation, QString const& leftTerm, QString const& rightTerm) const;
+    Term solveBinary(QString const& operation, Term const& leftTerm, Term const& rightTerm) const;
 
     /*!
-     *  Solves a binary operation.
+     *  Solves a binary operation on two integers. The operation is calculated with 64-bit integers, unless
+     *  the operands or the result need more bits.
+     *
+     *      @param [in] operation   The operation to solve.
+     *      @param [in] leftTerm    The first term of the operation.
+     *      @param [in] rightTerm   The second term of the operation.
+     *
+     *      @return The result of the operation.
+     */
+    Term solveIntegerBinary(QString const& operation, Term const& leftTerm, Term const& rightTerm) const;
+
+    /*!
+     *  Solves a binary operation on two integers of any width.
+     *
+     *      @param [in] operation   The operation to solve.
+     *      @param [in] left        The first operand.
+     *      @param [in] right       The second operand.
+     *
+     *      @return The result of the operation.
+     */
+    Term solveWideBinary(QString const& operation, BigInteger const& left, BigInteger const& right) const;
+
+    /*!
+     *  Solves a binary operation on numbers of which at least one is real.
+     *
+     *      @param [in] operation   The operation to solve.
+     *      @param [in] leftTerm    The first term of the operation.
+     *      @param [in] rightTerm   The second term of the operation.
+     *
+     *      @return The result of the operation.
+     */
+    Term solveRealBinary(QString const& operation, Term const& leftTerm, Term const& rightTerm) const;
+
+    /*!
+     *  Solves an integer power exactly, unless the result is too wide.
+     *
+     *      @param [in] baseTerm    The integer base of the power.
+     *      @param [in] exponent    The non-negative exponent of the power.
+     *
+     *      @return The result of the power.
+     */
+    Term solveIntegerPower(Term const& baseTerm, qint64 exponent) const;
+
+    /*!
+     *  Solves a unary operation.
      *
      *      @param [in] operation    The operation to solve.
      *      @param [in] term         The term for the operation.
      *
      *      @return The result of the operation.
      */
-    QString solveUnary(QString const& operation, QString const& term) const;
+    Term solveUnary(QString const& operation, Term const& term) const;
 
     /*!
      *  Solves the SystemVerilog $clog2 function.
      *
-     *      @param [in] value   The value for which the function is called.
+     *      @param [in] term    The term for which the function is called.
      *
      *      @return The solved value.
      */
-    QString solveClog2(QString const& value) const;
+    Term solveClog2(Term const& term) const;
 
     /*!
      *  Solves the SystemVerilog $sqrt function.
@@ -213,7 +393,7 @@ private:
      *
      *      @return The solved value.
      */
-    QString solveSqrt(QString const& value) const;
+    Term solveSqrt(qreal value) const;
 
     /*!
      *  Get the precision used from the terms.
@@ -233,6 +413,19 @@ private:
      *      @return The base for the selected number. Either 2, 8, 10 or 16.
      */
     int getBaseForNumber(QString const& constantNumber) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The compiled expressions of each thread, shared by all parsers used in the thread.
+    static QThreadStorage<CompiledExpressionCache*> compiledExpressions_;
+
+    //! The maximum number of compiled expressions kept in each thread.
+    static QAtomicInt compiledExpressionLimit_;
+
+    //! Increased when the compiled expressions are cleared.
+    static QAtomicInt compiledExpressionGeneration_;
 };
 
 #endif // SYSTEMVERILOGEXPRESSIONPARSER_H
@@ -18,10 +18,10 @@ namespace SystemVerilogSyntax
 
     const QString BOOLEAN_VALUE = "(?i)true|(?i)false";
     const QString REAL_NUMBER("[-+]?[0-9_]+[.][0-9_]+");
-    const QString DECIMAL_NUMBER = "(?:" + SIZE + "'" + SIGNED + "[dD]?)?[0-9_]{1,18}";
-    const QString HEXADECIMAL_NUMBER = SIZE + "'" + SIGNED + "[hH][0-9a-fA-F_]{1,15}";
-    const QString OCTAL_NUMBER = SIZE + "'" + SIGNED + "[oO][0-7_]{1,20}";
-    const QString BINARY_NUMBER = SIZE + "'" + SIGNED + "[bB][01_]{1,62}";
+    const QString DECIMAL_NUMBER = "(?:" + SIZE + "'" + SIGNED + "[dD]?)?[0-9_]+";
+    const QString HEXADECIMAL_NUMBER = SIZE + "'" + SIGNED + "[hH][0-9a-fA-F_]+";
+    const QString OCTAL_NUMBER = SIZE + "'" + SIGNED + "[oO][0-7_]+";
+    const QString BINARY_NUMBER = SIZE + "'" + SIGNED + "[bB][01_]+";
 
     const QString INTEGRAL_NUMBER("[+-]?(?:" + HEXADECIMAL_NUMBER + "|" +
         OCTAL_NUMBER + "|" + BINARY_NUMBER + "|" + DECIMAL_NUMBER + ")");
@@ -49,6 +49,8 @@
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
 #include <common/dialogs/comboSelector/comboselector.h>
 
+#include <library/DocumentValidator.h>
+
 #include <editors/ComponentEditor/itemeditor.h>
 #include <editors/ComponentEditor/itemvisualizer.h>
 
@@ -120,6 +122,7 @@ parameterReferenceWindow_(new ParameterReferenceTreeWindow(parameterReferenceTre
     setupLayout();
 
 	// set the component to be displayed in the navigation model
+    navigationModel_.setParameterReferences(parameterFinder_, referenceCounter_);
     navigationModel_.setRootItem(createNavigationRootForComponent(component_));
 
 	QSettings settings;
@@ -285,9 +288,12 @@ QStringList ComponentEditor::getSwItemNames()
 //-----------------------------------------------------------------------------
 bool ComponentEditor::validate(QVector<QString>& errorList)
 {
-    if (!validator_.validate(component_))
+    QVector<ValidationDiagnostic> diagnostics;
+    validator_.findDiagnosticsIn(diagnostics, component_);
+
+    if (DocumentValidator::hasErrors(diagnostics))
     {
-        validator_.findErrorsIn(errorList, component_);
+        errorList += DocumentValidator::getMessages(diagnostics);
         return false;
     }
 
@@ -536,6 +542,17 @@ void ComponentEditor::setRowVisibility(QSettings& settings)
     proxy_.setRowVisibility( hiddenRows );
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditor::onLibraryDocumentChanged()
+//-----------------------------------------------------------------------------
+void ComponentEditor::onLibraryDocumentChanged(VLNV const& vlnv)
+{
+    if (component_->getDependentVLNVs().contains(vlnv))
+    {
+        navigationModel_.onLibraryChanged();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditor::createNavigationRootForComponent()
 //-----------------------------------------------------------------------------
@@ -551,32 +568,41 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
 
     connect(genEditor, SIGNAL(hierarchyChanged(QSettings&)), this, SLOT(setRowVisibility(QSettings&)));
 
-    root->addChildItem(QSharedPointer<ComponentEditorFileSetsItem>( new ComponentEditorFileSetsItem(
+    QSharedPointer<ComponentEditorFileSetsItem> fileSetsItem(new ComponentEditorFileSetsItem(
         &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_,
-        expressionParser_, expressionFormatter_, root)));
+        expressionParser_, expressionFormatter_, root));
+    root->addChildItem(fileSetsItem);
+
+    QSharedPointer<ComponentEditorChoicesItem> choicesItem;
+    QSharedPointer<ComponentEditorMemMapsItem> memoryMapsItem;
+    QSharedPointer<ComponentEditorAddrSpacesItem> addressSpacesItem;
 
     if (component->getImplementation() == KactusAttribute::HW)
     {
-        root->addChildItem(QSharedPointer<ComponentEditorChoicesItem>(
-            new ComponentEditorChoicesItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        choicesItem = QSharedPointer<ComponentEditorChoicesItem>(
+            new ComponentEditorChoicesItem(&navigationModel_, libHandler_, component, expressionParser_, root));
+        root->addChildItem(choicesItem);
 
         QSharedPointer<ComponentEditorParametersItem> parametersItem(new ComponentEditorParametersItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionParser_, 
             expressionFormatter_, root));
 
         root->addChildItem(parametersItem);
+        choicesItem->addDependentItem(parametersItem.data());
 
         connect(parametersItem.data(), SIGNAL(openReferenceTree(QString const&, QString const&)),
             parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const)),
             Qt::UniqueConnection);
 
-        root->addChildItem(QSharedPointer<ComponentEditorMemMapsItem>(new ComponentEditorMemMapsItem(
+        memoryMapsItem = QSharedPointer<ComponentEditorMemMapsItem>(new ComponentEditorMemMapsItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionFormatter_,
-            expressionParser_, root)));
+            expressionParser_, root));
+        root->addChildItem(memoryMapsItem);
 
-        root->addChildItem(QSharedPointer<ComponentEditorAddrSpacesItem>(new ComponentEditorAddrSpacesItem(
+        addressSpacesItem = QSharedPointer<ComponentEditorAddrSpacesItem>(new ComponentEditorAddrSpacesItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionFormatter_,
-            expressionParser_, root)));
+            expressionParser_, root));
+        root->addChildItem(addressSpacesItem);
     }
 
     QSharedPointer<InstantiationsItem> instantiationsItem (
@@ -584,6 +610,11 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
         expressionFormatter_, expressionParser_, root));
 
     root->addChildItem(instantiationsItem);
+    fileSetsItem->addDependentItem(instantiationsItem.data());
+    if (choicesItem)
+    {
+        choicesItem->addDependentItem(instantiationsItem.data());
+    }
 
     connect(instantiationsItem.data(), SIGNAL(openReferenceTree(QString const&, QString const&)),
         parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const&)), Qt::UniqueConnection);
@@ -592,14 +623,18 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
         component, referenceCounter_, parameterFinder_, expressionFormatter_, expressionParser_, root));
 
     root->addChildItem(viewsItem);
+    instantiationsItem->addDependentItem(viewsItem.data());
 
     connect(viewsItem.data(), SIGNAL(openReferenceTree(QString const&, QString const&)),
         parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const&)), Qt::UniqueConnection);
 
     if (component->getImplementation() != KactusAttribute::SW)
     {
-        root->addChildItem(QSharedPointer<ComponentEditorSystemViewsItem>(
-            new ComponentEditorSystemViewsItem(&navigationModel_, libHandler_, component, root)));
+        QSharedPointer<ComponentEditorSystemViewsItem> systemViewsItem(
+            new ComponentEditorSystemViewsItem(&navigationModel_, libHandler_, component, root));
+        root->addChildItem(systemViewsItem);
+        fileSetsItem->addDependentItem(systemViewsItem.data());
+        viewsItem->addDependentItem(systemViewsItem.data());
     }
 
     if (component->getImplementation() == KactusAttribute::HW)
@@ -634,21 +669,39 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
             parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const&)),
             Qt::UniqueConnection);
 
-        root->addChildItem(QSharedPointer<ComponentEditorChannelsItem>(
-            new ComponentEditorChannelsItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        QSharedPointer<ComponentEditorChannelsItem> channelsItem(
+            new ComponentEditorChannelsItem(&navigationModel_, libHandler_, component, expressionParser_, root));
+        root->addChildItem(channelsItem);
 
-        root->addChildItem(QSharedPointer<RemapStatesItem>(
+        QSharedPointer<RemapStatesItem> remapStatesItem(
             new RemapStatesItem(&navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_,
-            expressionFormatter_, expressionParser_, root)));
+            expressionFormatter_, expressionParser_, root));
+        root->addChildItem(remapStatesItem);
 
-        root->addChildItem(QSharedPointer<ComponentEditorCpusItem>(
-            new ComponentEditorCpusItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        QSharedPointer<ComponentEditorCpusItem> cpusItem(
+            new ComponentEditorCpusItem(&navigationModel_, libHandler_, component, expressionParser_, root));
+        root->addChildItem(cpusItem);
 
         root->addChildItem(QSharedPointer<ComponentEditorOtherClocksItem>(
             new ComponentEditorOtherClocksItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
 
-        root->addChildItem(QSharedPointer<ResetTypesItem>(
-            new ResetTypesItem(&navigationModel_, libHandler_, component, validator_, root)));
+        QSharedPointer<ResetTypesItem> resetTypesItem(
+            new ResetTypesItem(&navigationModel_, libHandler_, component, validator_, root));
+        root->addChildItem(resetTypesItem);
+
+        // Items referencing the elements of other items by name are validated again when those are edited.
+        viewsItem->addDependentItem(portsItem.data());
+        viewsItem->addDependentItem(busInterfaceItem.data());
+        portsItem->addDependentItem(busInterfaceItem.data());
+        portsItem->addDependentItem(remapStatesItem.data());
+        memoryMapsItem->addDependentItem(busInterfaceItem.data());
+        memoryMapsItem->addDependentItem(indirectInterfacesItem.data());
+        addressSpacesItem->addDependentItem(busInterfaceItem.data());
+        addressSpacesItem->addDependentItem(cpusItem.data());
+        busInterfaceItem->addDependentItem(channelsItem.data());
+        busInterfaceItem->addDependentItem(indirectInterfacesItem.data());
+        remapStatesItem->addDependentItem(memoryMapsItem.data());
+        resetTypesItem->addDependentItem(memoryMapsItem.data());
     }
     else if (component->getImplementation() == KactusAttribute::SW)
     {
@@ -138,6 +138,13 @@ public slots:
 	 */
 	void setRowVisibility(QSettings& settings);
 
+    /*!
+     *  Validates again the items referencing a changed library document.
+     *
+     *      @param [in] vlnv    The VLNV of the document added, changed or removed in the library.
+     */
+    void onLibraryDocumentChanged(VLNV const& vlnv);
+
 private slots:
 
 	/*! This slot is called when an item is selected in the navigation tree.
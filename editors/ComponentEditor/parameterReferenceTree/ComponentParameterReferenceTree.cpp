@@ -76,6 +76,8 @@ void ComponentParameterReferenceTree::setupTree()
 {
     if (!component_.isNull())
     {
+        referenceCounter_->updateReferenceIndex();
+
         if (referenceCounter_->countReferencesInFileSets(getTargetID()) > 0)
         {
             createReferencesForFileSets();
@@ -87,6 +87,9 @@ delegate_()
 
     proxy_.setSortCaseSensitivity(Qt::CaseInsensitive);
 
+    // The edited ports are reported before the content change, so that only they are validated again.
+    connect(model_, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
+        this, SLOT(onPortDataChanged(const QModelIndex&, const QModelIndex&)), Qt::UniqueConnection);
 	connect(model_, SIGNAL(contentChanged()), this, SIGNAL(contentChanged()), Qt::UniqueConnection);
 	connect(model_, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
 		this, SIGNAL(contentChanged()), Qt::UniqueConnection);
@@ -338,3 +341,14 @@ void PortsEditor::changeExtensionsEditorItem(QModelIndex const& itemIndex)
 
     emit changeVendorExtensions(extensionID, extensionItem);
 }
+
+//-----------------------------------------------------------------------------
+// Function: portseditor::onPortDataChanged()
+//-----------------------------------------------------------------------------
+void PortsEditor::onPortDataChanged(QModelIndex const& topLeft, QModelIndex const& bottomRight)
+{
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+    {
+        emit portChanged(model_->getPortAtIndex(topLeft.sibling(row, 0)));
+    }
+}
@@ -91,6 +91,13 @@ signals:
      */
     void createInterface();
 
+    /*!
+     *  Emitted when the data of a port has been edited.
+     *
+     *      @param [in] port    The edited port.
+     */
+    void portChanged(QSharedPointer<Port> port);
+
 protected:
 
     //! Called when the editor is shown.
@@ -119,6 +126,14 @@ private slots:
      */
     void changeExtensionsEditorItem(QModelIndex const& itemIndex);
 
+    /*!
+     *  Handler for edits in the ports model.
+     *
+     *      @param [in] topLeft         The first edited index.
+     *      @param [in] bottomRight     The last edited index.
+     */
+    void onPortDataChanged(QModelIndex const& topLeft, QModelIndex const& bottomRight);
+
 private:
 
 	//! No copying
@@ -40,7 +40,7 @@ ComponentParameterReferenceCounter::ComponentParameterReferenceCounter(
 ParameterReferenceCounter(parameterFinder),
 component_(component)
 {
-
+    updateReferenceIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -49,6 +49,8 @@ component_(component)
 void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component> newComponent)
 {
     component_ = newComponent;
+
+    updateReferenceIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -57,21 +59,11 @@ void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component>
 void ComponentParameterReferenceCounter::recalculateReferencesToParameters(
     QVector<QSharedPointer<Parameter> > parameterList)
 {
+    updateReferenceIndex();
+
     foreach (QSharedPointer<Parameter> parameter, parameterList)
     {
-        int referenceCount = 0;
-        QString parameterID = parameter->getValueId();
-
-        referenceCount += countReferencesInFileSets(parameterID);
-        referenceCount += countReferencesInParameters(parameterID, component_->getParameters());
-        referenceCount += countReferencesInMemoryMaps(parameterID);
-        referenceCount += countReferencesInAddressSpaces(parameterID);
-        referenceCount += countReferencesInInstantiations(parameterID);
-        referenceCount += countReferencesInPorts(parameterID);
-        referenceCount += countReferencesInBusInterfaces(parameterID);
-        referenceCount += countReferencesInRemapStates(parameterID);
-
-        parameter->setUsageCount(referenceCount);
+        parameter->setUsageCount(getReferenceIndex().countReferences(parameter->getValueId()));
     }
 }
 
@@ -80,14 +72,7 @@ void ComponentParameterReferenceCounter::recalculateReferencesToParameters(
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInFileSets(QString const& parameterID) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<FileSet> fileSet, *component_->getFileSets())
-    {
-        referenceCount += countReferencesInSingleFileSet(parameterID, fileSet);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, component_->getFileSets().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -96,12 +81,7 @@ int ComponentParameterReferenceCounter::countReferencesInFileSets(QString const&
 int ComponentParameterReferenceCounter::countReferencesInSingleFileSet(QString const& parameterID,
     QSharedPointer<FileSet> fileSet) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInFileBuilders(parameterID, fileSet->getDefaultFileBuilders());
-    referenceCount += countReferencesInFiles(parameterID, fileSet->getFiles());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, fileSet.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -110,14 +90,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleFileSet(QString c
 int ComponentParameterReferenceCounter::countReferencesInFileBuilders(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<FileBuilder> fileBuilder, *builders)
-    {
-        referenceCount += countReferencesInSingleFileBuilder(parameterID, fileBuilder);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, builders.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -126,7 +99,7 @@ int ComponentParameterReferenceCounter::countReferencesInFileBuilders(QString co
 int ComponentParameterReferenceCounter::countReferencesInSingleFileBuilder(QString const& parameterID,
     QSharedPointer<FileBuilder> builder) const
 {
-    return countReferencesInExpression(parameterID, builder->getReplaceDefaultFlags());
+    return getReferenceIndex().countReferences(parameterID, builder.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -135,14 +108,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleFileBuilder(QStri
 int ComponentParameterReferenceCounter::countReferencesInFiles(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<File> > > files) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<File> singleFile, *files)
-    {
-        referenceCount += countReferencesInSingleFile(parameterID, singleFile);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, files.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -151,14 +117,7 @@ int ComponentParameterReferenceCounter::countReferencesInFiles(QString const& pa
 int ComponentParameterReferenceCounter::countReferencesInSingleFile(QString const& parameterID,
     QSharedPointer<File> file) const
 {
-    if (file->getBuildCommand())
-    {
-        return countReferencesInBuildCommand(parameterID, file->getBuildCommand());
-    }
-    else
-    {
-        return 0;
-    }
+    return getReferenceIndex().countReferences(parameterID, file.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -167,7 +126,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleFile(QString cons
 int ComponentParameterReferenceCounter::countReferencesInBuildCommand(QString const& parameterID,
     QSharedPointer<BuildCommand> buildCommand) const
 {
-    return countReferencesInExpression(parameterID, buildCommand->getReplaceDefaultFlags());
+    return getReferenceIndex().countReferences(parameterID, buildCommand.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -175,14 +134,7 @@ int ComponentParameterReferenceCounter::countReferencesInBuildCommand(QString co
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInMemoryMaps(QString const& parameterID) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<MemoryMap> memoryMap, *component_->getMemoryMaps())
-    {
-        referenceCount += countReferencesInSingleMemoryMap(parameterID, memoryMap);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, component_->getMemoryMaps().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -191,16 +143,7 @@ int ComponentParameterReferenceCounter::countReferencesInMemoryMaps(QString cons
 int ComponentParameterReferenceCounter::countReferencesInSingleMemoryMap(QString const& parameterID,
     QSharedPointer<MemoryMap> memoryMap) const
 {
-    int referenceCount = 0;
-    
-    referenceCount += countReferencesInBaseMemoryMap(parameterID, memoryMap);
-
-    foreach (QSharedPointer<MemoryRemap> remap, *memoryMap->getMemoryRemaps())
-    {
-        referenceCount += countReferencesInBaseMemoryMap(parameterID, remap);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, memoryMap.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -209,18 +152,13 @@ int ComponentParameterReferenceCounter::countReferencesInSingleMemoryMap(QString
 int ComponentParameterReferenceCounter::countReferencesInBaseMemoryMap(QString const& parameterID,
     QSharedPointer<MemoryMapBase> memoryMap) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<MemoryBlockBase> memoryBlock, *memoryMap->getMemoryBlocks())
+    if (memoryMap.isNull())
     {
-        QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
-        if (addressBlock)
-        {
-            referenceCount += countReferenceInAddressBlock(parameterID, addressBlock);
-        }
+        return 0;
     }
 
-    return referenceCount;
+    // The memory blocks are indexed separately from the memory map to exclude the remaps of the memory map.
+    return getReferenceIndex().countReferences(parameterID, memoryMap->getMemoryBlocks().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -229,12 +167,7 @@ int ComponentParameterReferenceCounter::countReferencesInBaseMemoryMap(QString c
 int ComponentParameterReferenceCounter::countReferenceInAddressBlock(QString const& parameterID,
     QSharedPointer<AddressBlock> addressBlock) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInAddressBlockValues(parameterID, addressBlock);
-    referenceCount += countReferencesInRegisters(parameterID, addressBlock->getRegisterData());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, addressBlock.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -243,14 +176,7 @@ int ComponentParameterReferenceCounter::countReferenceInAddressBlock(QString con
 int ComponentParameterReferenceCounter::countReferencesInAddressBlockValues(QString const& parameterID,
     QSharedPointer<AddressBlock> addressBlock) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInExpression(parameterID, addressBlock->getBaseAddress());
-    referenceCount += countReferencesInExpression(parameterID, addressBlock->getRange());
-    referenceCount += countReferencesInExpression(parameterID, addressBlock->getWidth());
-    referenceCount += countReferencesInExpression(parameterID, addressBlock->getIsPresent());
-
-    return referenceCount;
+    return getReferenceIndex().countOwnReferences(parameterID, addressBlock.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -259,18 +185,7 @@ int ComponentParameterReferenceCounter::countReferencesInAddressBlockValues(QStr
 int ComponentParameterReferenceCounter::countReferencesInRegisters(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<RegisterBase> > > registers) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<RegisterBase> registerItem, *registers)
-    {
-        QSharedPointer<Register> targetRegister = registerItem.dynamicCast<Register>();
-        if (targetRegister)
-        {
-            referenceCounter += countReferencesInSingleRegister(parameterID, targetRegister);
-        }
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, registers.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -279,15 +194,7 @@ int ComponentParameterReferenceCounter::countReferencesInRegisters(QString const
 int ComponentParameterReferenceCounter::countReferencesInSingleRegister(QString const& parameterID,
     QSharedPointer<Register> targetRegister) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInExpression(parameterID, targetRegister->getAddressOffset());
-    referenceCount += countReferencesInExpression(parameterID, targetRegister->getDimension());
-    referenceCount += countReferencesInExpression(parameterID, targetRegister->getSize());
-    referenceCount += countReferencesInExpression(parameterID, targetRegister->getIsPresent());
-    referenceCount += countReferencesInFields(parameterID, targetRegister->getFields());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, targetRegister.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -296,14 +203,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleRegister(QString
 int ComponentParameterReferenceCounter::countReferencesInFields(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<Field> > > fields) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<Field> registerField, *fields)
-    {
-        referenceCount += countReferencesInSingleField(parameterID, registerField);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, fields.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -312,15 +212,7 @@ int ComponentParameterReferenceCounter::countReferencesInFields(QString const& p
 int ComponentParameterReferenceCounter::countReferencesInSingleField(QString const& parameterID,
     QSharedPointer<Field> registerField) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInExpression(parameterID, registerField->getBitOffset());
-    referenceCount += countReferencesInExpression(parameterID, registerField->getBitWidth());
-    referenceCount += countReferencesInExpression(parameterID, registerField->getIsPresent());
-    referenceCount += countReferencesInFieldResets(parameterID, registerField->getResets());
-    referenceCount += countReferencesInWriteConstraint(parameterID, registerField->getWriteConstraint());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, registerField.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -329,14 +221,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleField(QString con
 int ComponentParameterReferenceCounter::countReferencesInFieldResets(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<FieldReset> > > resets) const
 {
-    int referenceCount = 0;
-
-    for (auto fieldReset : *resets)
-    {
-        referenceCount += countReferencesInSingleFieldReset(parameterID, fieldReset);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, resets.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -345,12 +230,7 @@ int ComponentParameterReferenceCounter::countReferencesInFieldResets(QString con
 int ComponentParameterReferenceCounter::countReferencesInSingleFieldReset(QString const& parameterID,
     QSharedPointer<FieldReset> fieldReset) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInExpression(parameterID, fieldReset->getResetValue());
-    referenceCount += countReferencesInExpression(parameterID, fieldReset->getResetMask());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, fieldReset.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -359,15 +239,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleFieldReset(QStrin
 int ComponentParameterReferenceCounter::countReferencesInWriteConstraint(QString const& parameterID,
     QSharedPointer<WriteValueConstraint> writeConstraint) const
 {
-    int referenceCount = 0;
-
-    if (writeConstraint)
-    {
-        referenceCount += countReferencesInExpression(parameterID, writeConstraint->getMinimum());
-        referenceCount += countReferencesInExpression(parameterID, writeConstraint->getMaximum());
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, writeConstraint.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -375,14 +247,7 @@ int ComponentParameterReferenceCounter::countReferencesInWriteConstraint(QString
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInAddressSpaces(QString const& parameterID) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<AddressSpace> space, *component_->getAddressSpaces())
-    {
-        referenceCount += countReferencesInSingleAddressSpace(parameterID, space);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, component_->getAddressSpaces().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -391,17 +256,7 @@ int ComponentParameterReferenceCounter::countReferencesInAddressSpaces(QString c
 int ComponentParameterReferenceCounter::countReferencesInSingleAddressSpace(QString const& parameterID,
     QSharedPointer<AddressSpace> space) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInSingleAddressSpaceItems(parameterID, space);
-    if (space->getLocalMemoryMap())
-    {
-        referenceCount += countReferencesInBaseMemoryMap(parameterID, space->getLocalMemoryMap());
-    }
-
-    referenceCount += countReferencesInSegments(parameterID, space->getSegments());
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, space.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -410,12 +265,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleAddressSpace(QStr
 int ComponentParameterReferenceCounter::countReferencesInSingleAddressSpaceItems(QString const& parameterID,
     QSharedPointer<AddressSpace> space) const
 {
-    int referenceCount = 0;
-
-    referenceCount += countReferencesInExpression(parameterID, space->getWidth());
-    referenceCount += countReferencesInExpression(parameterID, space->getRange());
-
-    return referenceCount;
+    return getReferenceIndex().countOwnReferences(parameterID, space.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -424,14 +274,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleAddressSpaceItems
 int ComponentParameterReferenceCounter::countReferencesInSegments(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<Segment> > > segments) const
 {
-    int referenceCount = 0;
-
-    foreach (QSharedPointer<Segment> segment, *segments)
-    {
-        referenceCount += countReferencesInSingleSegment(parameterID, segment);
-    }
-
-    return referenceCount;
+    return getReferenceIndex().countReferences(parameterID, segments.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -440,12 +283,7 @@ int ComponentParameterReferenceCounter::countReferencesInSegments(QString const&
 int ComponentParameterReferenceCounter::countReferencesInSingleSegment(QString const& parameterID,
     QSharedPointer<Segment> segment) const
 {
-    int referenceCounter = 0;
-
-    referenceCounter += countReferencesInExpression(parameterID, segment->getAddressOffset());
-    referenceCounter += countReferencesInExpression(parameterID, segment->getRange());
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, segment.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -470,14 +308,7 @@ int ComponentParameterReferenceCounter::countReferencesInInstantiations(QString
 int ComponentParameterReferenceCounter::countReferencesInComponentInstantiations(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<ComponentInstantiation> > > instantiations) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<ComponentInstantiation> singleInstantiation, *instantiations)
-    {
-        referenceCounter += countReferencesInSingleComponentInstantiation(parameterID, singleInstantiation);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, instantiations.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -486,13 +317,7 @@ int ComponentParameterReferenceCounter::countReferencesInComponentInstantiations
 int ComponentParameterReferenceCounter::countReferencesInSingleComponentInstantiation(QString const& parameterID,
     QSharedPointer<ComponentInstantiation> instantiation) const
 {
-    int referenceCounter = 0;
-
-    referenceCounter += countReferencesInModuleParameters(parameterID, instantiation->getModuleParameters());
-    referenceCounter += countReferencesInParameters(parameterID, instantiation->getParameters());
-    referenceCounter += countReferencesInFileBuilders(parameterID, instantiation->getDefaultFileBuilders());
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, instantiation.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -501,14 +326,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleComponentInstanti
 int ComponentParameterReferenceCounter::countReferencesInModuleParameters(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<ModuleParameter> > > moduleParameters) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<ModuleParameter> parameter, *moduleParameters)
-    {
-        referenceCounter += countReferencesInSingleParameter(parameterID, parameter);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, moduleParameters.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -518,15 +336,7 @@ int ComponentParameterReferenceCounter::countReferencesInDesignConfigurationInst
     QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<DesignConfigurationInstantiation> > > instantiations) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<DesignConfigurationInstantiation> configurationInstantiation, *instantiations)
-    {
-        referenceCounter +=
-            countReferencesInSingleDesignConfigurationInstantiation(parameterID, configurationInstantiation);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, instantiations.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -535,19 +345,7 @@ int ComponentParameterReferenceCounter::countReferencesInDesignConfigurationInst
 int ComponentParameterReferenceCounter::countReferencesInSingleDesignConfigurationInstantiation(
     QString const& parameterID, QSharedPointer<DesignConfigurationInstantiation> instantiation) const
 {
-    int refererenceCounter = 0;
-
-    refererenceCounter += countReferencesInParameters(parameterID, instantiation->getParameters());
-    
-    QSharedPointer<ConfigurableVLNVReference> configurationReference =
-        instantiation->getDesignConfigurationReference();
-    if (configurationReference && configurationReference->isValid())
-    {
-        refererenceCounter += countReferencesInConfigurableElementValues(
-            parameterID, configurationReference->getConfigurableElementValues());
-    }
-
-    return refererenceCounter;
+    return getReferenceIndex().countReferences(parameterID, instantiation.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -555,14 +353,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleDesignConfigurati
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInDesignInstantiations(QString const& parameterID) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<DesignInstantiation> instantiation, *component_->getDesignInstantiations())
-    {
-        referenceCounter += countReferencesInSingleDesigninstantiation(parameterID, instantiation);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, component_->getDesignInstantiations().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -571,16 +362,7 @@ int ComponentParameterReferenceCounter::countReferencesInDesignInstantiations(QS
 int ComponentParameterReferenceCounter::countReferencesInSingleDesigninstantiation(QString const& parameterID,
     QSharedPointer<DesignInstantiation> instantiation) const
 {
-    int referenceCounter = 0;
-
-    QSharedPointer<ConfigurableVLNVReference> designReference = instantiation->getDesignReference();
-    if (designReference && designReference->isValid())
-    {
-        referenceCounter += countReferencesInConfigurableElementValues(
-            parameterID, designReference->getConfigurableElementValues());
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, instantiation.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -588,14 +370,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleDesigninstantiati
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInPorts(QString const& parameterID) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<Port> port, *component_->getPorts())
-    {
-        referenceCounter += countReferencesInSinglePort(parameterID, port);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, component_->getPorts().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -604,15 +379,7 @@ int ComponentParameterReferenceCounter::countReferencesInPorts(QString const& pa
 int ComponentParameterReferenceCounter::countReferencesInSinglePort(QString const& parameterID,
     QSharedPointer<Port> port) const
 {
-    int referenceCounter = 0;
-
-    referenceCounter += countReferencesInExpression(parameterID, port->getLeftBound());
-    referenceCounter += countReferencesInExpression(parameterID, port->getRightBound());
-    referenceCounter += countReferencesInExpression(parameterID, port->getArrayLeft());
-    referenceCounter += countReferencesInExpression(parameterID, port->getArrayRight());
-    referenceCounter += countReferencesInExpression(parameterID, port->getDefaultValue());
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, port.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -620,112 +387,393 @@ int ComponentParameterReferenceCounter::countReferencesInSinglePort(QString cons
 //-----------------------------------------------------------------------------
 int ComponentParameterReferenceCounter::countReferencesInBusInterfaces(QString const& parameterID) const
 {
-    int referenceCounter = 0;
+    return getReferenceIndex().countReferences(parameterID, component_->getBusInterfaces().data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInSingleBusInterface()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInSingleBusInterface(QString const& parameterID,
+    QSharedPointer<BusInterface> busInterface) const
+{
+    return getReferenceIndex().countReferences(parameterID, busInterface.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInMirroredSlaveInterface()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInMirroredSlaveInterface(QString const& parameterID,
+    QSharedPointer<MirroredSlaveInterface> mirroredSlave) const
+{
+    return getReferenceIndex().countReferences(parameterID, mirroredSlave.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInRemapAddress()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInRemapAddress(QString const& parameterID,
+    QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress) const
+{
+    return getReferenceIndex().countReferences(parameterID, remapAddress.data());
+}
 
-    foreach (QSharedPointer<BusInterface> busInterface, *component_->getBusInterfaces())
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInMasterInterface()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInMasterInterface(QString const& parameterID,
+    QSharedPointer<MasterInterface> master) const
+{
+    return getReferenceIndex().countReferences(parameterID, master.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInRemapStates()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInRemapStates(QString const& parameterID) const
+{
+    return getReferenceIndex().countReferences(parameterID, component_->getRemapStates().data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInSingleRemapState()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInSingleRemapState(QString const& parameterID,
+    QSharedPointer<RemapState> remapState) const
+{
+    return getReferenceIndex().countReferences(parameterID, remapState.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInSingleRemapPort()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInSingleRemapPort(QString const& parameterID,
+    QSharedPointer<RemapPort> port) const
+{
+    return getReferenceIndex().countReferences(parameterID, port.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexDocument()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexDocument()
+{
+    if (component_.isNull())
     {
-        referenceCounter += countReferencesInSingleBusInterface(parameterID, busInterface);
+        return;
     }
 
-    return referenceCounter;
+    indexElement(component_.data(), nullptr);
+
+    indexFileSets();
+    indexParameters(component_->getParameters(), component_.data());
+    indexMemoryMaps();
+    indexAddressSpaces();
+    indexInstantiations();
+    indexPorts();
+    indexBusInterfaces();
+    indexRemapStates();
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInSingleBusInterface()
+// Function: ComponentParameterReferenceCounter::indexFileSets()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInSingleBusInterface(QString const& parameterID,
-    QSharedPointer<BusInterface> busInterface) const
+void ComponentParameterReferenceCounter::indexFileSets()
 {
-    int referenceCounter = 0;
+    QSharedPointer<QList<QSharedPointer<FileSet> > > fileSets = component_->getFileSets();
+    indexElement(fileSets.data(), component_.data());
 
-    referenceCounter += countReferencesInParameters(parameterID, busInterface->getParameters());
+    for (QSharedPointer<FileSet> fileSet : *fileSets)
+    {
+        indexElement(fileSet.data(), fileSets.data());
+        indexFileBuilders(fileSet->getDefaultFileBuilders(), fileSet.data());
 
-    if (busInterface->getMirroredSlave())
+        QSharedPointer<QList<QSharedPointer<File> > > files = fileSet->getFiles();
+        indexElement(files.data(), fileSet.data());
+
+        for (QSharedPointer<File> singleFile : *files)
+        {
+            indexElement(singleFile.data(), files.data());
+
+            QSharedPointer<BuildCommand> buildCommand = singleFile->getBuildCommand();
+            if (buildCommand)
+            {
+                indexElement(buildCommand.data(), singleFile.data(),
+                    QStringList(buildCommand->getReplaceDefaultFlags()));
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexFileBuilders()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexFileBuilders(
+    QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders, void const* parent)
+{
+    indexElement(builders.data(), parent);
+
+    for (QSharedPointer<FileBuilder> builder : *builders)
     {
-        referenceCounter +=
-            countReferencesInMirroredSlaveInterface(parameterID, busInterface->getMirroredSlave());
+        indexElement(builder.data(), builders.data(), QStringList(builder->getReplaceDefaultFlags()));
     }
-    if (busInterface->getMaster())
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexMemoryMaps()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexMemoryMaps()
+{
+    QSharedPointer<QList<QSharedPointer<MemoryMap> > > memoryMaps = component_->getMemoryMaps();
+    indexElement(memoryMaps.data(), component_.data());
+
+    for (QSharedPointer<MemoryMap> memoryMap : *memoryMaps)
     {
-        referenceCounter += countReferencesInMasterInterface(parameterID, busInterface->getMaster());
+        indexElement(memoryMap.data(), memoryMaps.data());
+        indexBaseMemoryMap(memoryMap);
+
+        for (QSharedPointer<MemoryRemap> remap : *memoryMap->getMemoryRemaps())
+        {
+            indexElement(remap.data(), memoryMap.data());
+            indexBaseMemoryMap(remap);
+        }
     }
+}
 
-    return referenceCounter;
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexBaseMemoryMap()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexBaseMemoryMap(QSharedPointer<MemoryMapBase> memoryMap)
+{
+    QSharedPointer<QList<QSharedPointer<MemoryBlockBase> > > memoryBlocks = memoryMap->getMemoryBlocks();
+    indexElement(memoryBlocks.data(), memoryMap.data());
+
+    for (QSharedPointer<MemoryBlockBase> memoryBlock : *memoryBlocks)
+    {
+        QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
+        if (addressBlock)
+        {
+            indexAddressBlock(addressBlock, memoryBlocks.data());
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInMirroredSlaveInterface()
+// Function: ComponentParameterReferenceCounter::indexAddressBlock()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInMirroredSlaveInterface(QString const& parameterID,
-    QSharedPointer<MirroredSlaveInterface> mirroredSlave) const
+void ComponentParameterReferenceCounter::indexAddressBlock(QSharedPointer<AddressBlock> addressBlock,
+    void const* parent)
 {
-    int referenceCounter = 0;
+    indexElement(addressBlock.data(), parent, QStringList({ addressBlock->getBaseAddress(),
+        addressBlock->getRange(), addressBlock->getWidth(), addressBlock->getIsPresent() }));
 
-    referenceCounter += countReferencesInExpression(parameterID, mirroredSlave->getRange());
-    
-    foreach (QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress,
-        *mirroredSlave->getRemapAddresses())
+    QSharedPointer<QList<QSharedPointer<RegisterBase> > > registers = addressBlock->getRegisterData();
+    indexElement(registers.data(), addressBlock.data());
+
+    for (QSharedPointer<RegisterBase> registerItem : *registers)
     {
-        referenceCounter += countReferencesInRemapAddress(parameterID, remapAddress);
+        QSharedPointer<Register> targetRegister = registerItem.dynamicCast<Register>();
+        if (targetRegister)
+        {
+            indexRegister(targetRegister, registers.data());
+        }
     }
+}
 
-    return referenceCounter;
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexRegister()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexRegister(QSharedPointer<Register> targetRegister, void const* parent)
+{
+    indexElement(targetRegister.data(), parent, QStringList({ targetRegister->getAddressOffset(),
+        targetRegister->getDimension(), targetRegister->getSize(), targetRegister->getIsPresent() }));
+
+    QSharedPointer<QList<QSharedPointer<Field> > > fields = targetRegister->getFields();
+    indexElement(fields.data(), targetRegister.data());
+
+    for (QSharedPointer<Field> registerField : *fields)
+    {
+        indexField(registerField, fields.data());
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInRemapAddress()
+// Function: ComponentParameterReferenceCounter::indexField()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInRemapAddress(QString const& parameterID,
-    QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress) const
+void ComponentParameterReferenceCounter::indexField(QSharedPointer<Field> field, void const* parent)
 {
-    return countReferencesInExpression(parameterID, remapAddress->remapAddress_);
+    indexElement(field.data(), parent,
+        QStringList({ field->getBitOffset(), field->getBitWidth(), field->getIsPresent() }));
+
+    QSharedPointer<QList<QSharedPointer<FieldReset> > > resets = field->getResets();
+    indexElement(resets.data(), field.data());
+
+    for (QSharedPointer<FieldReset> fieldReset : *resets)
+    {
+        indexElement(fieldReset.data(), resets.data(),
+            QStringList({ fieldReset->getResetValue(), fieldReset->getResetMask() }));
+    }
+
+    QSharedPointer<WriteValueConstraint> writeConstraint = field->getWriteConstraint();
+    if (writeConstraint)
+    {
+        indexElement(writeConstraint.data(), field.data(),
+            QStringList({ writeConstraint->getMinimum(), writeConstraint->getMaximum() }));
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInMasterInterface()
+// Function: ComponentParameterReferenceCounter::indexAddressSpaces()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInMasterInterface(QString const& parameterID,
-    QSharedPointer<MasterInterface> master) const
+void ComponentParameterReferenceCounter::indexAddressSpaces()
 {
-    return countReferencesInExpression(parameterID, master->getBaseAddress());
+    QSharedPointer<QList<QSharedPointer<AddressSpace> > > spaces = component_->getAddressSpaces();
+    indexElement(spaces.data(), component_.data());
+
+    for (QSharedPointer<AddressSpace> space : *spaces)
+    {
+        indexElement(space.data(), spaces.data(), QStringList({ space->getWidth(), space->getRange() }));
+
+        QSharedPointer<MemoryMapBase> localMemoryMap = space->getLocalMemoryMap();
+        if (localMemoryMap)
+        {
+            indexElement(localMemoryMap.data(), space.data());
+            indexBaseMemoryMap(localMemoryMap);
+        }
+
+        QSharedPointer<QList<QSharedPointer<Segment> > > segments = space->getSegments();
+        indexElement(segments.data(), space.data());
+
+        for (QSharedPointer<Segment> segment : *segments)
+        {
+            indexElement(segment.data(), segments.data(),
+                QStringList({ segment->getAddressOffset(), segment->getRange() }));
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInRemapStates()
+// Function: ComponentParameterReferenceCounter::indexInstantiations()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInRemapStates(QString const& parameterID) const
+void ComponentParameterReferenceCounter::indexInstantiations()
 {
-    int referenceCount = 0;
+    QSharedPointer<QList<QSharedPointer<ComponentInstantiation> > > componentInstantiations =
+        component_->getComponentInstantiations();
+    indexElement(componentInstantiations.data(), component_.data());
 
-    foreach (QSharedPointer<RemapState> remap, *component_->getRemapStates())
+    for (QSharedPointer<ComponentInstantiation> instantiation : *componentInstantiations)
     {
-        referenceCount += countReferencesInSingleRemapState(parameterID, remap);
+        indexElement(instantiation.data(), componentInstantiations.data());
+
+        QSharedPointer<QList<QSharedPointer<ModuleParameter> > > moduleParameters =
+            instantiation->getModuleParameters();
+        indexElement(moduleParameters.data(), instantiation.data());
+
+        for (QSharedPointer<ModuleParameter> moduleParameter : *moduleParameters)
+        {
+            indexSingleParameter(moduleParameter, moduleParameters.data());
+        }
+
+        indexParameters(instantiation->getParameters(), instantiation.data());
+        indexFileBuilders(instantiation->getDefaultFileBuilders(), instantiation.data());
     }
 
-    return referenceCount;
+    QSharedPointer<QList<QSharedPointer<DesignConfigurationInstantiation> > > configurationInstantiations =
+        component_->getDesignConfigurationInstantiations();
+    indexElement(configurationInstantiations.data(), component_.data());
+
+    for (QSharedPointer<DesignConfigurationInstantiation> instantiation : *configurationInstantiations)
+    {
+        indexElement(instantiation.data(), configurationInstantiations.data());
+        indexParameters(instantiation->getParameters(), instantiation.data());
+
+        QSharedPointer<ConfigurableVLNVReference> configurationReference =
+            instantiation->getDesignConfigurationReference();
+        if (configurationReference && configurationReference->isValid())
+        {
+            indexConfigurableElementValues(configurationReference->getConfigurableElementValues(),
+                instantiation.data());
+        }
+    }
+
+    QSharedPointer<QList<QSharedPointer<DesignInstantiation> > > designInstantiations =
+        component_->getDesignInstantiations();
+    indexElement(designInstantiations.data(), component_.data());
+
+    for (QSharedPointer<DesignInstantiation> instantiation : *designInstantiations)
+    {
+        indexElement(instantiation.data(), designInstantiations.data());
+
+        QSharedPointer<ConfigurableVLNVReference> designReference = instantiation->getDesignReference();
+        if (designReference && designReference->isValid())
+        {
+            indexConfigurableElementValues(designReference->getConfigurableElementValues(), instantiation.data());
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInSingleRemapState()
+// Function: ComponentParameterReferenceCounter::indexPorts()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInSingleRemapState(QString const& parameterID,
-    QSharedPointer<RemapState> remapState) const
+void ComponentParameterReferenceCounter::indexPorts()
 {
-    int referenceCounter = 0;
+    QSharedPointer<QList<QSharedPointer<Port> > > ports = component_->getPorts();
+    indexElement(ports.data(), component_.data());
 
-    foreach (QSharedPointer<RemapPort> port, *remapState->getRemapPorts())
+    for (QSharedPointer<Port> port : *ports)
     {
-        referenceCounter += countReferencesInSingleRemapPort(parameterID, port);
+        indexElement(port.data(), ports.data(), QStringList({ port->getLeftBound(), port->getRightBound(),
+            port->getArrayLeft(), port->getArrayRight(), port->getDefaultValue() }));
     }
+}
 
-    return referenceCounter;
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::indexBusInterfaces()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::indexBusInterfaces()
+{
+    QSharedPointer<QList<QSharedPointer<BusInterface> > > busInterfaces = component_->getBusInterfaces();
+    indexElement(busInterfaces.data(), component_.data());
+
+    for (QSharedPointer<BusInterface> busInterface : *busInterfaces)
+    {
+        indexElement(busInterface.data(), busInterfaces.data());
+        indexParameters(busInterface->getParameters(), busInterface.data());
+
+        QSharedPointer<MirroredSlaveInterface> mirroredSlave = busInterface->getMirroredSlave();
+        if (mirroredSlave)
+        {
+            indexElement(mirroredSlave.data(), busInterface.data(), QStringList(mirroredSlave->getRange()));
+
+            for (QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress :
+                *mirroredSlave->getRemapAddresses())
+            {
+                indexElement(remapAddress.data(), mirroredSlave.data(), QStringList(remapAddress->remapAddress_));
+            }
+        }
+
+        QSharedPointer<MasterInterface> master = busInterface->getMaster();
+        if (master)
+        {
+            indexElement(master.data(), busInterface.data(), QStringList(master->getBaseAddress()));
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterReferenceCounter::countReferencesInSingleRemapPort()
+// Function: ComponentParameterReferenceCounter::indexRemapStates()
 //-----------------------------------------------------------------------------
-int ComponentParameterReferenceCounter::countReferencesInSingleRemapPort(QString const& parameterID,
-    QSharedPointer<RemapPort> port) const
+void ComponentParameterReferenceCounter::indexRemapStates()
 {
-    return countReferencesInExpression(parameterID, port->getValue());
+    QSharedPointer<QList<QSharedPointer<RemapState> > > remapStates = component_->getRemapStates();
+    indexElement(remapStates.data(), component_.data());
+
+    for (QSharedPointer<RemapState> remapState : *remapStates)
+    {
+        indexElement(remapState.data(), remapStates.data());
+
+        for (QSharedPointer<RemapPort> port : *remapState->getRemapPorts())
+        {
+            indexElement(port.data(), remapState.data(), QStringList(port->getValue()));
+        }
+    }
 }
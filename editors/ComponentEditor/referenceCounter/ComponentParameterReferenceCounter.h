@@ -507,8 +507,89 @@ public slots:
      */
     virtual void recalculateReferencesToParameters(QVector<QSharedPointer<Parameter> > parameterList);
 
+protected:
+
+    /*!
+     *  Indexes the elements of the component.
+     */
+    virtual void indexDocument() override;
+
 private:
 
+    /*!
+     *  Indexes the file sets of the component.
+     */
+    void indexFileSets();
+
+    /*!
+     *  Indexes the selected file builders.
+     *
+     *      @param [in] builders    The selected file builders.
+     *      @param [in] parent      The element containing the file builders.
+     */
+    void indexFileBuilders(QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders, void const* parent);
+
+    /*!
+     *  Indexes the memory maps of the component.
+     */
+    void indexMemoryMaps();
+
+    /*!
+     *  Indexes the memory blocks of the selected memory map or remap.
+     *
+     *      @param [in] memoryMap   The selected memory map or remap.
+     */
+    void indexBaseMemoryMap(QSharedPointer<MemoryMapBase> memoryMap);
+
+    /*!
+     *  Indexes the selected address block.
+     *
+     *      @param [in] addressBlock    The selected address block.
+     *      @param [in] parent          The element containing the address block.
+     */
+    void indexAddressBlock(QSharedPointer<AddressBlock> addressBlock, void const* parent);
+
+    /*!
+     *  Indexes the selected register.
+     *
+     *      @param [in] targetRegister  The selected register.
+     *      @param [in] parent          The element containing the register.
+     */
+    void indexRegister(QSharedPointer<Register> targetRegister, void const* parent);
+
+    /*!
+     *  Indexes the selected field.
+     *
+     *      @param [in] field   The selected field.
+     *      @param [in] parent  The element containing the field.
+     */
+    void indexField(QSharedPointer<Field> field, void const* parent);
+
+    /*!
+     *  Indexes the address spaces of the component.
+     */
+    void indexAddressSpaces();
+
+    /*!
+     *  Indexes the component, design configuration and design instantiations of the component.
+     */
+    void indexInstantiations();
+
+    /*!
+     *  Indexes the ports of the component.
+     */
+    void indexPorts();
+
+    /*!
+     *  Indexes the bus interfaces of the component.
+     */
+    void indexBusInterfaces();
+
+    /*!
+     *  Indexes the remap states of the component.
+     */
+    void indexRemapStates();
+
     /*!
      *  Count the references made to the selected parameter in the selected write constraint.
      *
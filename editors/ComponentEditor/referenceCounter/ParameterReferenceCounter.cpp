@@ -14,11 +14,15 @@
 #include <IPXACTmodels/common/Parameter.h>
 #include <IPXACTmodels/common/ConfigurableElementValue.h>
 
+#include <QTimer>
+
 //-----------------------------------------------------------------------------
 // Function: ParameterReferenceCounter::ParameterReferenceCounter()
 //-----------------------------------------------------------------------------
 ParameterReferenceCounter::ParameterReferenceCounter(QSharedPointer<ParameterFinder> parameterFinder):
-parameterFinder_(parameterFinder)
+parameterFinder_(parameterFinder),
+referenceIndex_(),
+indexUpdateScheduled_(false)
 {
 
 }
@@ -34,6 +38,8 @@ void ParameterReferenceCounter::increaseReferenceCount(QString const& id)
     {
         targetParameter->increaseUsageCount();
     }
+
+    scheduleIndexUpdate();
 }
 
 //-----------------------------------------------------------------------------
@@ -47,6 +53,8 @@ void ParameterReferenceCounter::decreaseReferenceCount(QString const& id)
     {
         targetParameter->decreaseUsageCount();
     }
+
+    scheduleIndexUpdate();
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +63,11 @@ void ParameterReferenceCounter::decreaseReferenceCount(QString const& id)
 int ParameterReferenceCounter::countReferencesInParameters(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<Parameter> > > parameters) const
 {
+    if (referenceIndex_.contains(parameters.data()))
+    {
+        return referenceIndex_.countReferences(parameterID, parameters.data());
+    }
+
     int referenceCount = 0;
 
     foreach (QSharedPointer<Parameter> singleParameter, *parameters)
@@ -71,6 +84,11 @@ int ParameterReferenceCounter::countReferencesInParameters(QString const& parame
 int ParameterReferenceCounter::countReferencesInSingleParameter(QString const& parameterID,
     QSharedPointer<Parameter> parameter) const
 {
+    if (referenceIndex_.contains(parameter.data()))
+    {
+        return referenceIndex_.countReferences(parameterID, parameter.data());
+    }
+
     int referenceCount = 0;
 
     referenceCount += countReferencesInExpression(parameterID, parameter->getValue());
@@ -90,6 +108,11 @@ int ParameterReferenceCounter::countReferencesInSingleParameter(QString const& p
 int ParameterReferenceCounter::countReferencesInConfigurableElementValues(QString const& parameterId,
     QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > configurableElements) const
 {
+    if (referenceIndex_.contains(configurableElements.data()))
+    {
+        return referenceIndex_.countReferences(parameterId, configurableElements.data());
+    }
+
     int referenceCount = 0;
 
     foreach (QSharedPointer<ConfigurableElementValue> element, *configurableElements)
@@ -106,6 +129,11 @@ int ParameterReferenceCounter::countReferencesInConfigurableElementValues(QStrin
 int ParameterReferenceCounter::countReferencesInSingleConfigurableElementValue(QString const& parameterID,
     QSharedPointer<ConfigurableElementValue> element) const
 {
+    if (referenceIndex_.contains(element.data()))
+    {
+        return referenceIndex_.countReferences(parameterID, element.data());
+    }
+
     return countReferencesInExpression(parameterID, element->getConfigurableValue());
 }
 
@@ -115,5 +143,103 @@ int ParameterReferenceCounter::countReferencesInSingleConfigurableElementValue(Q
 int ParameterReferenceCounter::countReferencesInExpression(QString const& parameterID,
     QString const& expression) const
 {
-    return expression.count(parameterID);
+    return ParameterReferenceIndex::countReferencesInExpression(parameterID, expression);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::updateReferenceIndex()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::updateReferenceIndex()
+{
+    indexUpdateScheduled_ = false;
+
+    referenceIndex_.beginUpdate();
+    indexDocument();
+    referenceIndex_.endUpdate();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::getReferenceIndex()
+//-----------------------------------------------------------------------------
+ParameterReferenceIndex const& ParameterReferenceCounter::getReferenceIndex() const
+{
+    return referenceIndex_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::takeChangedParameterIds()
+//-----------------------------------------------------------------------------
+QStringList ParameterReferenceCounter::takeChangedParameterIds()
+{
+    updateReferenceIndex();
+    return referenceIndex_.takeChangedIds();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::indexDocument()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::indexDocument()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::indexElement()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::indexElement(void const* element, void const* parent,
+    QStringList const& expressions)
+{
+    referenceIndex_.indexElement(element, parent, expressions);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::indexSingleParameter()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::indexSingleParameter(QSharedPointer<Parameter> parameter, void const* parent)
+{
+    referenceIndex_.indexElement(parameter.data(), parent, QStringList({ parameter->getValue(),
+        parameter->getVectorLeft(), parameter->getVectorRight(),
+        parameter->getAttribute(QLatin1String("kactus2:arrayLeft")),
+        parameter->getAttribute(QLatin1String("kactus2:arrayRight")) }), parameter->getValueId());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::indexParameters()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::indexParameters(QSharedPointer<QList<QSharedPointer<Parameter> > > parameters,
+    void const* parent)
+{
+    indexElement(parameters.data(), parent);
+
+    for (QSharedPointer<Parameter> parameter : *parameters)
+    {
+        indexSingleParameter(parameter, parameters.data());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::indexConfigurableElementValues()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::indexConfigurableElementValues(
+    QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > elements, void const* parent)
+{
+    indexElement(elements.data(), parent);
+
+    for (QSharedPointer<ConfigurableElementValue> element : *elements)
+    {
+        indexElement(element.data(), elements.data(), QStringList(element->getConfigurableValue()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::scheduleIndexUpdate()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::scheduleIndexUpdate()
+{
+    // The editors report each changed reference separately, so the index is updated once after the edit.
+    if (!indexUpdateScheduled_)
+    {
+        indexUpdateScheduled_ = true;
+        QTimer::singleShot(0, this, &ParameterReferenceCounter::updateReferenceIndex);
+    }
 }
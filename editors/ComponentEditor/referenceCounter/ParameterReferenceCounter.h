@@ -13,6 +13,7 @@
 #define PARAMETERREFERENCECOUNTER_H
 
 #include "ReferenceCounter.h"
+#include "ParameterReferenceIndex.h"
 
 #include <editors/ComponentEditor/common/ComponentParameterFinder.h>
 #include <editors/ComponentEditor/common/ParameterFinder.h>
@@ -21,6 +22,10 @@ class ConfigurableElementValue;
 
 //-----------------------------------------------------------------------------
 //! ParameterReferenceCounter class. 
+//
+// The counters of a document keep an index of the references made in the elements of the document and answer
+// the counts from it. The index is updated when the editors report changed references, and it can be updated
+// explicitly before reading the counts after other changes.
 //-----------------------------------------------------------------------------
 class ParameterReferenceCounter : public ReferenceCounter
 {
@@ -92,7 +97,8 @@ public:
         QSharedPointer<ConfigurableElementValue> element) const;
     
     /*!
-     *  Count the references made to the selected parameter in the selected expression.
+     *  Count the references made to the selected parameter in the selected expression. Only whole IDs are
+     *  counted, so IDs containing the selected ID are not references to it.
      *
      *      @param [in] parameterID     ID of the selected parameter.
      *      @param [in] expression      The selected expression.
@@ -101,6 +107,26 @@ public:
      */
     int countReferencesInExpression(QString const& parameterID, QString const& expression) const;
 
+    /*!
+     *  Updates the index of the references made in the document. Only the changed elements are re-scanned.
+     */
+    void updateReferenceIndex();
+
+    /*!
+     *  Gets the index of the references made in the document.
+     *
+     *      @return The reference index.
+     */
+    ParameterReferenceIndex const& getReferenceIndex() const;
+
+    /*!
+     *  Gets the parameters edited since the previous call, i.e. the parameters whose expressions have changed
+     *  or which have been added or removed. The reference index is updated first.
+     *
+     *      @return The ids of the edited parameters.
+     */
+    QStringList takeChangedParameterIds();
+
 public slots:
 
     /*!
@@ -117,14 +143,64 @@ public slots:
      */
     virtual void decreaseReferenceCount(QString const& id) override;
 
+protected:
+
+    /*!
+     *  Indexes the elements of the document. Called during the update of the reference index.
+     */
+    virtual void indexDocument();
+
+    /*!
+     *  Sets the expressions of an element in the reference index.
+     *
+     *      @param [in] element         The element.
+     *      @param [in] parent          The element containing the element.
+     *      @param [in] expressions     The expressions of the element itself.
+     */
+    void indexElement(void const* element, void const* parent, QStringList const& expressions = QStringList());
+
+    /*!
+     *  Sets the expressions of a parameter in the reference index.
+     *
+     *      @param [in] parameter   The parameter.
+     *      @param [in] parent      The element containing the parameter.
+     */
+    void indexSingleParameter(QSharedPointer<Parameter> parameter, void const* parent);
+
+    /*!
+     *  Sets the parameters in the reference index.
+     *
+     *      @param [in] parameters  The parameters.
+     *      @param [in] parent      The element containing the parameters.
+     */
+    void indexParameters(QSharedPointer<QList<QSharedPointer<Parameter> > > parameters, void const* parent);
+
+    /*!
+     *  Sets the configurable element values in the reference index.
+     *
+     *      @param [in] elements    The configurable element values.
+     *      @param [in] parent      The element containing the configurable element values.
+     */
+    void indexConfigurableElementValues(
+        QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > elements, void const* parent);
+
 private:
 
+    //! Schedules an update of the reference index after the current event.
+    void scheduleIndexUpdate();
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
 
     //! Object for finding parameters with the correct id.
     QSharedPointer<ParameterFinder> parameterFinder_;
+
+    //! The index of the references made in the document.
+    ParameterReferenceIndex referenceIndex_;
+
+    //! Flag for an already scheduled update of the reference index.
+    bool indexUpdateScheduled_;
 };
 
 #endif // PARAMETERREFERENCECOUNTER_H
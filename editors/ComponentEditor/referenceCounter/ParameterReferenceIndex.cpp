@@ -0,0 +1,344 @@
+//-----------------------------------------------------------------------------
+// File: ParameterReferenceIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Index of the parameter references made in the elements of a document.
+//-----------------------------------------------------------------------------
+
+#include "ParameterReferenceIndex.h"
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: isIdCharacter()
+    //-----------------------------------------------------------------------------
+    bool isIdCharacter(QChar character)
+    {
+        ushort const code = character.unicode();
+        return (code >= 'a' && code <= 'z') || (code >= 'A' && code <= 'Z') || (code >= '0' && code <= '9') ||
+            code == ':' || code == '_' || code == '.';
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferences()
+    //-----------------------------------------------------------------------------
+    void collectReferences(QString const& expression, QHash<QString, int>& references)
+    {
+        int const length = expression.size();
+        int start = -1;
+
+        for (int i = 0; i <= length; ++i)
+        {
+            bool const inId = i < length && isIdCharacter(expression.at(i));
+            if (inId && start == -1)
+            {
+                start = i;
+            }
+            else if (!inId && start != -1)
+            {
+                references[expression.mid(start, i - start)]++;
+                start = -1;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::ParameterReferenceIndex()
+//-----------------------------------------------------------------------------
+ParameterReferenceIndex::ParameterReferenceIndex():
+elements_(),
+referencingElements_(),
+update_(0),
+changedIds_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::beginUpdate()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::beginUpdate()
+{
+    update_++;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::indexElement()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::indexElement(void const* element, void const* parent, QStringList const& expressions,
+    QString const& definedId)
+{
+    if (element == nullptr)
+    {
+        return;
+    }
+
+    auto found = elements_.find(element);
+    bool const added = found == elements_.end();
+    if (added)
+    {
+        found = elements_.insert(element, IndexedElement());
+    }
+
+    IndexedElement& indexed = *found;
+    indexed.parent = parent;
+    indexed.update = update_;
+
+    if (indexed.definedId != definedId)
+    {
+        if (!indexed.definedId.isEmpty())
+        {
+            changedIds_.insert(indexed.definedId);
+        }
+
+        indexed.definedId = definedId;
+    }
+    else if (!added && indexed.expressions == expressions)
+    {
+        return;
+    }
+
+    if (!definedId.isEmpty())
+    {
+        changedIds_.insert(definedId);
+    }
+
+    if (indexed.expressions == expressions)
+    {
+        return;
+    }
+
+    removeReferences(element, indexed.references);
+
+    indexed.expressions = expressions;
+    indexed.references.clear();
+    for (QString const& expression : expressions)
+    {
+        collectReferences(expression, indexed.references);
+    }
+
+    addReferences(element, indexed.references);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::endUpdate()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::endUpdate()
+{
+    auto i = elements_.begin();
+    while (i != elements_.end())
+    {
+        if (i->update != update_)
+        {
+            if (!i->definedId.isEmpty())
+            {
+                changedIds_.insert(i->definedId);
+            }
+
+            removeReferences(i.key(), i->references);
+            i = elements_.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::clear()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::clear()
+{
+    for (IndexedElement const& indexed : elements_)
+    {
+        if (!indexed.definedId.isEmpty())
+        {
+            changedIds_.insert(indexed.definedId);
+        }
+    }
+
+    elements_.clear();
+    referencingElements_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::takeChangedIds()
+//-----------------------------------------------------------------------------
+QStringList ParameterReferenceIndex::takeChangedIds()
+{
+    QStringList changedIds = changedIds_.values();
+    changedIds_.clear();
+
+    return changedIds;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::contains()
+//-----------------------------------------------------------------------------
+bool ParameterReferenceIndex::contains(void const* element) const
+{
+    return elements_.contains(element);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::countReferences()
+//-----------------------------------------------------------------------------
+int ParameterReferenceIndex::countReferences(QString const& id) const
+{
+    int referenceCount = 0;
+
+    auto referencing = referencingElements_.constFind(id);
+    if (referencing != referencingElements_.constEnd())
+    {
+        for (int count : *referencing)
+        {
+            referenceCount += count;
+        }
+    }
+
+    return referenceCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::countReferences()
+//-----------------------------------------------------------------------------
+int ParameterReferenceIndex::countReferences(QString const& id, void const* element) const
+{
+    int referenceCount = 0;
+
+    auto referencing = referencingElements_.constFind(id);
+    if (element != nullptr && referencing != referencingElements_.constEnd())
+    {
+        for (auto i = referencing->constBegin(); i != referencing->constEnd(); ++i)
+        {
+            if (isContainedIn(i.key(), element))
+            {
+                referenceCount += i.value();
+            }
+        }
+    }
+
+    return referenceCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::countOwnReferences()
+//-----------------------------------------------------------------------------
+int ParameterReferenceIndex::countOwnReferences(QString const& id, void const* element) const
+{
+    auto indexed = elements_.constFind(element);
+    if (indexed == elements_.constEnd())
+    {
+        return 0;
+    }
+
+    return indexed->references.value(id);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::getReferencingElements()
+//-----------------------------------------------------------------------------
+QList<void const*> ParameterReferenceIndex::getReferencingElements(QString const& id) const
+{
+    return referencingElements_.value(id).keys();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::isContainedIn()
+//-----------------------------------------------------------------------------
+bool ParameterReferenceIndex::isContainedIn(void const* element, void const* container) const
+{
+    while (element != nullptr)
+    {
+        if (element == container)
+        {
+            return true;
+        }
+
+        auto indexed = elements_.constFind(element);
+        if (indexed == elements_.constEnd())
+        {
+            return false;
+        }
+
+        element = indexed->parent;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::countReferencesInExpression()
+//-----------------------------------------------------------------------------
+int ParameterReferenceIndex::countReferencesInExpression(QString const& id, QString const& expression)
+{
+    if (id.isEmpty())
+    {
+        return 0;
+    }
+
+    for (QChar const& character : id)
+    {
+        if (!isIdCharacter(character))
+        {
+            return expression.count(id);
+        }
+    }
+
+    int referenceCount = 0;
+    int const length = expression.size();
+
+    int position = expression.indexOf(id);
+    while (position != -1)
+    {
+        int const end = position + id.size();
+        if ((position == 0 || !isIdCharacter(expression.at(position - 1))) &&
+            (end == length || !isIdCharacter(expression.at(end))))
+        {
+            referenceCount++;
+            position = expression.indexOf(id, end);
+        }
+        else
+        {
+            position = expression.indexOf(id, position + 1);
+        }
+    }
+
+    return referenceCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::addReferences()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::addReferences(void const* element, QHash<QString, int> const& references)
+{
+    for (auto i = references.constBegin(); i != references.constEnd(); ++i)
+    {
+        referencingElements_[i.key()].insert(element, i.value());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceIndex::removeReferences()
+//-----------------------------------------------------------------------------
+void ParameterReferenceIndex::removeReferences(void const* element, QHash<QString, int> const& references)
+{
+    for (auto i = references.constBegin(); i != references.constEnd(); ++i)
+    {
+        auto referencing = referencingElements_.find(i.key());
+        if (referencing != referencingElements_.end())
+        {
+            referencing->remove(element);
+            if (referencing->isEmpty())
+            {
+                referencingElements_.erase(referencing);
+            }
+        }
+    }
+}
@@ -0,0 +1,193 @@
+//-----------------------------------------------------------------------------
+// File: ParameterReferenceIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Index of the parameter references made in the elements of a document.
+//-----------------------------------------------------------------------------
+
+#ifndef PARAMETERREFERENCEINDEX_H
+#define PARAMETERREFERENCEINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+//-----------------------------------------------------------------------------
+//! Index of the parameter references made in the elements of a document.
+//
+// The elements, e.g. ports, registers and the lists containing them, are identified by their addresses and form
+// a tree through their parent elements. For each element the index keeps the ids referenced in its own
+// expressions, and for each id the elements referencing it, so the references to an id within any part of the
+// document are found without scanning the expressions. The index is updated by indexing the current elements of
+// the document between beginUpdate() and endUpdate(). Only the elements with changed expressions are re-scanned
+// and the elements no longer in the document are removed.
+//-----------------------------------------------------------------------------
+class ParameterReferenceIndex
+{
+public:
+
+    //! The constructor.
+    ParameterReferenceIndex();
+
+    //! The destructor.
+    ~ParameterReferenceIndex() = default;
+
+    //! Starts an update of the index.
+    void beginUpdate();
+
+    /*!
+     *  Sets the expressions of an element in the document. The references of the element are re-scanned only if
+     *  its expressions have changed since the previous update.
+     *
+     *      @param [in] element         The element.
+     *      @param [in] parent          The element containing the element, or null for the document.
+     *      @param [in] expressions     The expressions of the element itself.
+     *      @param [in] definedId       The id of the parameter defined by the element, if any.
+     */
+    void indexElement(void const* element, void const* parent, QStringList const& expressions = QStringList(),
+        QString const& definedId = QString());
+
+    //! Ends the update of the index by removing the elements that were not indexed during the update.
+    void endUpdate();
+
+    //! Removes all the elements from the index.
+    void clear();
+
+    /*!
+     *  Gets the parameters whose expressions have changed, or which have been added or removed, in the updates
+     *  since the previous call.
+     *
+     *      @return The ids of the changed parameters.
+     */
+    QStringList takeChangedIds();
+
+    /*!
+     *  Checks if an element is in the index.
+     *
+     *      @param [in] element     The element to check.
+     *
+     *      @return True, if the element is in the index, otherwise false.
+     */
+    bool contains(void const* element) const;
+
+    /*!
+     *  Count the references made to an id in the whole document.
+     *
+     *      @param [in] id  The referenced id.
+     *
+     *      @return The number of references made to the id.
+     */
+    int countReferences(QString const& id) const;
+
+    /*!
+     *  Count the references made to an id in an element and the elements contained in it.
+     *
+     *      @param [in] id          The referenced id.
+     *      @param [in] element     The element to search.
+     *
+     *      @return The number of references made to the id in the element.
+     */
+    int countReferences(QString const& id, void const* element) const;
+
+    /*!
+     *  Count the references made to an id in the expressions of an element, excluding the elements contained in
+     *  it.
+     *
+     *      @param [in] id          The referenced id.
+     *      @param [in] element     The element to search.
+     *
+     *      @return The number of references made to the id in the element.
+     */
+    int countOwnReferences(QString const& id, void const* element) const;
+
+    /*!
+     *  Gets the elements whose own expressions reference an id.
+     *
+     *      @param [in] id  The referenced id.
+     *
+     *      @return The referencing elements.
+     */
+    QList<void const*> getReferencingElements(QString const& id) const;
+
+    /*!
+     *  Checks if an element is contained in another element.
+     *
+     *      @param [in] element     The element to check.
+     *      @param [in] container   The possibly containing element.
+     *
+     *      @return True, if the element is the container or contained in it, otherwise false.
+     */
+    bool isContainedIn(void const* element, void const* container) const;
+
+    /*!
+     *  Count the references made to an id in an expression. Only whole ids are counted, so ids containing the
+     *  selected id are not references to it.
+     *
+     *      @param [in] id          The referenced id.
+     *      @param [in] expression  The expression to search.
+     *
+     *      @return The number of references made to the id in the expression.
+     */
+    static int countReferencesInExpression(QString const& id, QString const& expression);
+
+private:
+
+    //! The references of a single element.
+    struct IndexedElement
+    {
+        //! The element containing the element.
+        void const* parent = nullptr;
+
+        //! The expressions of the element.
+        QStringList expressions;
+
+        //! The number of references to each id in the expressions.
+        QHash<QString, int> references;
+
+        //! The update in which the element was last indexed.
+        unsigned int update = 0;
+
+        //! The id of the parameter defined by the element, if any.
+        QString definedId;
+    };
+
+    /*!
+     *  Adds the references of an element to the referencing elements of the ids.
+     *
+     *      @param [in] element     The element.
+     *      @param [in] references  The number of references to each id in the element.
+     */
+    void addReferences(void const* element, QHash<QString, int> const& references);
+
+    /*!
+     *  Removes the references of an element from the referencing elements of the ids.
+     *
+     *      @param [in] element     The element.
+     *      @param [in] references  The number of references to each id in the element.
+     */
+    void removeReferences(void const* element, QHash<QString, int> const& references);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The indexed elements.
+    QHash<void const*, IndexedElement> elements_;
+
+    //! The elements referencing each id, with the number of references in each element.
+    QHash<QString, QHash<void const*, int> > referencingElements_;
+
+    //! The number of the current update.
+    unsigned int update_;
+
+    //! The ids of the parameters changed since they were last taken.
+    QSet<QString> changedIds_;
+};
+
+#endif // PARAMETERREFERENCEINDEX_H
@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// File: ElementValidityCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Caches the validity of the elements of a component editor item.
+//-----------------------------------------------------------------------------
+
+#ifndef ELEMENTVALIDITYCACHE_H
+#define ELEMENTVALIDITYCACHE_H
+
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+
+//-----------------------------------------------------------------------------
+//! Caches the validity of the elements of a component editor item, e.g. the ports of the component.
+//
+// An element is validated again only after it has been marked as changed. The results for the elements removed
+// from the item are dropped on the next check. The results are keyed by the element addresses, so the elements
+// can be marked as changed by their addresses, e.g. those found from the parameter reference index.
+//-----------------------------------------------------------------------------
+template <class Element>
+class ElementValidityCache
+{
+public:
+
+    //! The constructor.
+    ElementValidityCache(): validities_()
+    {
+
+    }
+
+    //! The destructor.
+    ~ElementValidityCache() = default;
+
+    /*!
+     *  Check the validity of the given elements. Only the elements not validated since their latest change are
+     *  validated.
+     *
+     *      @param [in] elements    The current elements of the item.
+     *      @param [in] validator   The validator providing validate() for a single element.
+     *
+     *      @return True, if all the elements are valid, otherwise false.
+     */
+    template <class Validator>
+    bool validate(QList<QSharedPointer<Element> > const& elements, Validator const& validator)
+    {
+        QHash<Element const*, CachedValidity> currentValidities;
+        currentValidities.reserve(elements.size());
+
+        bool allValid = true;
+        for (QSharedPointer<Element> const& element : elements)
+        {
+            typename QHash<Element const*, CachedValidity>::const_iterator cached =
+                validities_.constFind(element.data());
+
+            bool elementValid =
+                cached != validities_.constEnd() ? cached->valid : validator->validate(element);
+            currentValidities.insert(element.data(), CachedValidity(element, elementValid));
+
+            allValid = allValid && elementValid;
+        }
+
+        validities_.swap(currentValidities);
+        return allValid;
+    }
+
+    /*!
+     *  Marks an element to be validated again in the next check.
+     *
+     *      @param [in] element     The changed element.
+     */
+    void invalidate(QSharedPointer<Element> const& element)
+    {
+        invalidate(element.data());
+    }
+
+    /*!
+     *  Marks an element to be validated again in the next check.
+     *
+     *      @param [in] element     The address of the changed element.
+     */
+    void invalidate(Element const* element)
+    {
+        validities_.remove(element);
+    }
+
+    //! Marks all the elements to be validated again in the next check.
+    void clear()
+    {
+        validities_.clear();
+    }
+
+    /*!
+     *  Checks if the validity of an element is known without validating it.
+     *
+     *      @param [in] element     The element to check.
+     *
+     *      @return True, if the element has been validated after its latest change, otherwise false.
+     */
+    bool isCached(QSharedPointer<Element> const& element) const
+    {
+        return validities_.contains(element.data());
+    }
+
+private:
+
+    //! The validity of a single element.
+    struct CachedValidity
+    {
+        //! Keeps the element alive, so its address is not reused while the result is cached.
+        QSharedPointer<Element> element;
+
+        //! The validity of the element.
+        bool valid;
+
+        //! The constructor.
+        CachedValidity(QSharedPointer<Element> const& validatedElement = QSharedPointer<Element>(),
+            bool isValid = false): element(validatedElement), valid(isValid) {}
+    };
+
+    //! The validity of the elements validated after their latest change, keyed by the element addresses.
+    QHash<Element const*, CachedValidity> validities_;
+};
+
+#endif // ELEMENTVALIDITYCACHE_H
@@ -95,6 +95,14 @@ QString InstantiationsItem::text() const
 	return tr("Instantiations");
 }
 
+//-----------------------------------------------------------------------------
+// Function: InstantiationsItem::dependsOnLibrary()
+//-----------------------------------------------------------------------------
+bool InstantiationsItem::dependsOnLibrary() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: InstantiationsItem::editor()
 //-----------------------------------------------------------------------------
@@ -75,6 +75,13 @@ public:
 	 */
 	virtual QString text() const;
 
+	/*!
+     *  Checks if the validity of the item depends on the documents in the library.
+	 *
+	 *      @return True, as the instantiations reference designs and design configurations.
+	 */
+	virtual bool dependsOnLibrary() const;
+
 	/*!
      *  Get The editor of this item.
 	 *
@@ -105,8 +105,9 @@ QString MemoryRemapItem::text() const
 //-----------------------------------------------------------------------------
 bool MemoryRemapItem::isValid() const
 {
+    // The address blocks are validated by their own items, which keep the result until the block is changed.
     bool baseIsValid = memoryMapValidator_->MemoryMapBaseValidator::validate(
-        memoryRemap_, parentMemoryMap_->getAddressUnitBits());
+        memoryRemap_, parentMemoryMap_->getAddressUnitBits(), false) && ComponentEditorItem::isValid();
 
     QSharedPointer<MemoryRemap> transformedMemoryRemap = memoryRemap_.dynamicCast<MemoryRemap>();
 
@@ -120,6 +121,14 @@ bool MemoryRemapItem::isValid() const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryRemapItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* MemoryRemapItem::getIndexedElement() const
+{
+    return memoryRemap_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryRemapItem::editor()
 //-----------------------------------------------------------------------------
@@ -87,6 +87,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The memory remap of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
 	 *  Get the The editor of this item.
 	 *
@@ -70,6 +70,14 @@ bool SingleComponentInstantiationItem::isValid() const
     return validator_->validateComponentInstantiation(instantiation_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: SingleComponentInstantiationItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* SingleComponentInstantiationItem::getIndexedElement() const
+{
+    return instantiation_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentInstantiationsItem::editor()
 //-----------------------------------------------------------------------------
@@ -73,6 +73,13 @@ public:
     //! Checks if the item represented by the item is valid.
     virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The component instantiation of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
      *  Get The editor of this item.
 	 *
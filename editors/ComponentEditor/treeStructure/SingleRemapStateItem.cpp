@@ -67,6 +67,14 @@ bool SingleRemapStateItem::isValid() const
     return validator_->validate(remapState_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: SingleRemapStateItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* SingleRemapStateItem::getIndexedElement() const
+{
+    return remapState_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: SingleRemapStateItem::editor()
 //-----------------------------------------------------------------------------
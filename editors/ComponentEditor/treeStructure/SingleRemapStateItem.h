@@ -74,6 +74,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The remap state of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
 	 *  Get the pointer to the editor of this item.
 	 *
@@ -107,7 +107,29 @@ QString ComponentEditorAddrBlockItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorAddrBlockItem::isValid() const 
 {
-    return addressBlockValidator_->validate(addrBlock_, QString::number(addressUnitBits_));
+    if (!addressBlockValidator_->validate(addrBlock_, QString::number(addressUnitBits_), false))
+    {
+        return false;
+    }
+
+    // The registers are validated by their own items, which keep the result until the register is changed.
+    foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_)
+    {
+        if (childItem.dynamicCast<ComponentEditorRegisterItem>() && !childItem->getValidity())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorAddrBlockItem::getIndexedElement() const
+{
+    return addrBlock_.data();
 }
 
 //-----------------------------------------------------------------------------
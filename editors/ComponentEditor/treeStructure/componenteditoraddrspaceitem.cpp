@@ -113,6 +113,14 @@ bool ComponentEditorAddrSpaceItem::isValid() const
     return spaceValidator_->validate(addrSpace_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrSpaceItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorAddrSpaceItem::getIndexedElement() const
+{
+    return addrSpace_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrSpaceItem::editor()
 //-----------------------------------------------------------------------------
@@ -74,6 +74,14 @@ bool ComponentEditorBusInterfaceItem::isValid() const
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorBusInterfaceItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorBusInterfaceItem::getIndexedElement() const
+{
+    return busif_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorBusInterfaceItem::editor()
 //-----------------------------------------------------------------------------
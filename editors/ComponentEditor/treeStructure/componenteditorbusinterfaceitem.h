@@ -77,6 +77,13 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The bus interface of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*! Get The editor of this item.
 	 *
 	 *      @return The editor to use for this item.
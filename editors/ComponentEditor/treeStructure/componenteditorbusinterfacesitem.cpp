@@ -95,6 +95,14 @@ QString ComponentEditorBusInterfacesItem::text() const
 	return tr("Bus interfaces");
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorbusinterfacesitem::dependsOnLibrary()
+//-----------------------------------------------------------------------------
+bool ComponentEditorBusInterfacesItem::dependsOnLibrary() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorbusinterfacesitem::editor()
 //-----------------------------------------------------------------------------
@@ -73,6 +73,12 @@ public:
 	*/
 	virtual QString text() const;
 
+	/*! Checks if the validity of the item depends on the documents in the library.
+	 *
+	 *      @return True, as the bus interfaces reference bus and abstraction definitions.
+	*/
+	virtual bool dependsOnLibrary() const;
+
 	/*! Get The editor of this item.
 	 *
 	 *      @return The editor to use for this item.
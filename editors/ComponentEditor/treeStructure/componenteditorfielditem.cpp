@@ -81,6 +81,14 @@ bool ComponentEditorFieldItem::isValid() const
     return fieldValidator_->validate(field_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFieldItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorFieldItem::getIndexedElement() const
+{
+    return field_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorfielditem::editor()
 //-----------------------------------------------------------------------------
@@ -80,6 +80,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The field of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
      *  Get the editor of this item.
 	 *
@@ -93,6 +93,14 @@ bool ComponentEditorFileItem::isValid() const
     return isValidPath(filePath) || isValidURI(filePath);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFileItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorFileItem::getIndexedElement() const
+{
+    return file_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorFileItem::editor()
 //-----------------------------------------------------------------------------
@@ -92,6 +92,14 @@ bool ComponentEditorFileSetItem::isValid() const
 	return ComponentEditorItem::isValid();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFileSetItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorFileSetItem::getIndexedElement() const
+{
+    return fileSet_.data();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorFileSetItem::editor()
 //-----------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 
 #include <editors/ComponentEditor/itemeditor.h>
 #include <editors/ComponentEditor/itemvisualizer.h>
+#include <editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h>
 
 #include <library/LibraryInterface.h>
 
@@ -37,6 +38,9 @@ childItems_(),
 editor_(NULL),
 locked_(true),
 highlight_(false),
+validityChecked_(false),
+valid_(true),
+dependentItems_(),
 referenceCounter_(0),
 parameterFinder_(0),
 expressionFormatter_(0),
@@ -88,6 +92,9 @@ childItems_(),
 editor_(NULL),
 locked_(true),
 highlight_(false),
+validityChecked_(false),
+valid_(true),
+dependentItems_(),
 parent_(NULL)
 {
 	connect(this, SIGNAL(contentChanged(ComponentEditorItem*)),
@@ -187,7 +194,7 @@ bool ComponentEditorItem::isValid() const
 	// if at least one child is not valid then this is not valid
 	foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_)
     {
-		if (!childItem->isValid())
+		if (!childItem->getValidity())
         {
 			return false;
 		}
@@ -197,6 +204,113 @@ bool ComponentEditorItem::isValid() const
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::getValidity()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::getValidity() const
+{
+    if (!validityChecked_)
+    {
+        valid_ = isValid();
+        validityChecked_ = true;
+    }
+
+    return valid_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateValidity()
+{
+    foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_)
+    {
+        childItem->invalidateValidity();
+    }
+
+    invalidateOwnValidity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateEditedValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateEditedValidity()
+{
+    invalidateValidity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateParameterReferences()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateParameterReferences(QStringList const& /*parameterIds*/)
+{
+    invalidateOwnValidity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::dependsOnParameters()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::dependsOnParameters(QStringList const& parameterIds) const
+{
+    void const* element = getIndexedElement();
+    if (element == 0)
+    {
+        // Items without an element of their own reference the parameters only through their sub items, unless
+        // they have none.
+        return childItems_.isEmpty();
+    }
+
+    QSharedPointer<ParameterReferenceCounter> parameterCounter =
+        referenceCounter_.dynamicCast<ParameterReferenceCounter>();
+    if (parameterCounter.isNull() || !parameterCounter->getReferenceIndex().contains(element))
+    {
+        return true;
+    }
+
+    ParameterReferenceIndex const& referenceIndex = parameterCounter->getReferenceIndex();
+    foreach (QString const& parameterId, parameterIds)
+    {
+        if (referenceIndex.countReferences(parameterId, element) > 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorItem::getIndexedElement() const
+{
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::dependsOnLibrary()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::dependsOnLibrary() const
+{
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::addDependentItem()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::addDependentItem(ComponentEditorItem* dependentItem)
+{
+    dependentItems_.append(dependentItem);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::getDependentItems()
+//-----------------------------------------------------------------------------
+QList<ComponentEditorItem*> ComponentEditorItem::getDependentItems() const
+{
+    return dependentItems_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorItem::setHighlight()
 //-----------------------------------------------------------------------------
@@ -226,6 +340,8 @@ ItemVisualizer* ComponentEditorItem::visualizer()
 //-----------------------------------------------------------------------------
 void ComponentEditorItem::onEditorChanged()
 {
+    model_->onItemEdited(this);
+
 	// if there is a valid parent then update it also
 	if (parent_)
     {
@@ -470,3 +586,14 @@ void ComponentEditorItem::connectItemEditorToVendorExtensionsEditor()
     connect(editor_, SIGNAL(changeVendorExtensions(QString const&, QSharedPointer<Extendable>)),
         this, SIGNAL(changeVendorExtensions(QString const&, QSharedPointer<Extendable>)), Qt::UniqueConnection);
 }
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::invalidateOwnValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateOwnValidity()
+{
+    for (ComponentEditorItem* item = this; item != 0; item = item->parent_)
+    {
+        item->validityChecked_ = false;
+    }
+}
@@ -22,6 +22,7 @@
 #include <QFont>
 #include <QList>
 #include <QGraphicsItem>
+#include <QStringList>
 
 class LibraryInterface;
 class ComponentEditorTreeModel;
@@ -171,6 +172,83 @@ public:
 	 */
 	virtual bool isValid() const;
 
+    /*!
+     *  Get the validity of this item and sub items. The item is validated again only if it has been marked as
+     *  changed since the previous check.
+     *
+     *      @return True if item is in valid state.
+     */
+    bool getValidity() const;
+
+    /*!
+     *  Marks the validity of this item and its sub items to be checked again. The parent items are marked too,
+     *  as their validity depends on the validity of this item.
+     *
+     *  Items caching the validity of their elements forget all of them.
+     */
+    virtual void invalidateValidity();
+
+    /*!
+     *  Marks the validity of this item to be checked again after it has been edited in its editor.
+     *
+     *  The default implementation marks the sub items too. Reimplement this for items whose editors report the
+     *  edited elements, so that only those are validated again.
+     */
+    virtual void invalidateEditedValidity();
+
+    /*!
+     *  Marks the validity of the elements referencing the given parameters to be checked again. Called for the
+     *  items depending on the parameters. The sub items depending on the parameters are marked separately.
+     *
+     *  The default implementation marks the item itself. Reimplement this for items caching the validity of
+     *  their elements, so that only the referencing elements are validated again.
+     *
+     *      @param [in] parameterIds    The ids of the changed parameters.
+     */
+    virtual void invalidateParameterReferences(QStringList const& parameterIds);
+
+    /*!
+     *  Checks if the validity of the item may depend on the values of the given parameters.
+     *
+     *  The references are looked up from the parameter reference index for the element of the item. Items
+     *  without an indexed element are assumed to depend on the parameters if they have no sub items.
+     *
+     *      @param [in] parameterIds    The ids of the changed parameters.
+     *
+     *      @return True, if the item may reference the parameters, otherwise false.
+     */
+    virtual bool dependsOnParameters(QStringList const& parameterIds) const;
+
+    /*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+     *
+     *      @return The element of the item, or null if the item has no element of its own in the index.
+     */
+    virtual void const* getIndexedElement() const;
+
+    /*!
+     *  Checks if the validity of the item depends on the documents in the library, e.g. on the referenced bus
+     *  definitions. These items are validated again when the library changes.
+     *
+     *      @return True, if the item references library documents, otherwise false.
+     */
+    virtual bool dependsOnLibrary() const;
+
+    /*!
+     *  Adds an item whose validity depends on the elements of this item, e.g. an item referencing the elements
+     *  by name. The dependent item is validated again whenever this item or its sub items are edited.
+     *
+     *      @param [in] dependentItem   The dependent item.
+     */
+    void addDependentItem(ComponentEditorItem* dependentItem);
+
+    /*!
+     *  Get the items whose validity depends on the elements of this item.
+     *
+     *      @return The dependent items.
+     */
+    QList<ComponentEditorItem*> getDependentItems() const;
+
     /*!
      *  Set the highlight.
      *
@@ -389,6 +467,12 @@ protected:
      */
     virtual void connectItemEditorToVendorExtensionsEditor();
 
+    /*!
+     *  Marks the validity of this item and its parent items to be checked again. The sub items and the cached
+     *  elements keep their validity.
+     */
+    void invalidateOwnValidity();
+
     //! Pointer to the instance that manages the library.
 	LibraryInterface* libHandler_;
 
@@ -410,6 +494,15 @@ protected:
     //! Flag for indicating highlight of the item.
     bool highlight_;
 
+    //! Flag for indicating that the validity of the item has been checked after the latest change.
+    mutable bool validityChecked_;
+
+    //! The validity of the item in the latest check.
+    mutable bool valid_;
+
+    //! The items whose validity depends on the elements of this item.
+    QList<ComponentEditorItem*> dependentItems_;
+
     //! Allows increasing and decreasing of parameter usage counts.
     QSharedPointer<ReferenceCounter> referenceCounter_;
 
@@ -90,7 +90,17 @@ QString ComponentEditorMemMapItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorMemMapItem::isValid() const
 {
-    return memoryMapValidator_->validate(memoryMap_);
+    // The address blocks are validated by the items of the remaps, which keep the result until the block is
+    // changed.
+    return memoryMapValidator_->validate(memoryMap_, false) && ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorMemMapItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorMemMapItem::getIndexedElement() const
+{
+    return memoryMap_.data();
 }
 
 //-----------------------------------------------------------------------------
@@ -81,6 +81,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The memory map of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
      *  Get pointer to the editor of this item.
 	 *
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "componenteditorparametersitem.h"
+#include "componenteditortreemodel.h"
 
 #include <editors/ComponentEditor/parameters/parameterseditor.h>
 
@@ -85,7 +86,15 @@ bool ComponentEditorParametersItem::isValid() const
         }
     }
 
-    return true;
+    return findParameterCycles().isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorParametersItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorParametersItem::getIndexedElement() const
+{
+    return component_->getParameters().data();
 }
 
 //-----------------------------------------------------------------------------
@@ -113,5 +122,44 @@ ItemEditor* ComponentEditorParametersItem::editor()
 //-----------------------------------------------------------------------------
 QString ComponentEditorParametersItem::getTooltip() const
 {
-	return tr("Contains the configurable elements of the component");
+    QString tooltip = tr("Contains the configurable elements of the component");
+
+    foreach (QString const& cycle, findParameterCycles())
+    {
+        tooltip.append(QLatin1Char('\n') + tr("Parameters %1 reference each other.").arg(cycle));
+    }
+
+    return tooltip;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorParametersItem::findParameterCycles()
+//-----------------------------------------------------------------------------
+QStringList ComponentEditorParametersItem::findParameterCycles() const
+{
+    QStringList parameterIds;
+    foreach (QSharedPointer<Parameter> parameter, *component_->getParameters())
+    {
+        parameterIds.append(parameter->getValueId());
+    }
+
+    // Cycles only between e.g. module parameters are left to the library validation, which reports all of them.
+    QStringList cycleNames;
+    foreach (QStringList const& cycle, model_->findParameterCycles())
+    {
+        bool containsParameter = false;
+        QStringList names;
+        foreach (QString const& parameterId, cycle)
+        {
+            containsParameter = containsParameter || parameterIds.contains(parameterId);
+            names.append(parameterFinder_->nameForId(parameterId));
+        }
+
+        if (containsParameter)
+        {
+            cycleNames.append(names.join(QLatin1String(" -> ")));
+        }
+    }
+
+    return cycleNames;
 }
@@ -81,6 +81,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The parameters of the component.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*!
      *  Get The editor of this item.
 	 *
@@ -94,6 +101,13 @@ private:
 	ComponentEditorParametersItem(const ComponentEditorParametersItem& other);
 	ComponentEditorParametersItem& operator=(const ComponentEditorParametersItem& other);
 
+    /*!
+     *  Finds the reference cycles containing the parameters of the component.
+     *
+     *      @return The names of the parameters in each cycle, joined as a path.
+     */
+    QStringList findParameterCycles() const;
+
     //! Expression parser for parameter values.
     QSharedPointer<ExpressionParser> expressionParser_;
 
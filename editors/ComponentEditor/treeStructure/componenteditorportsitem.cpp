@@ -13,11 +13,14 @@
 
 #include <editors/ComponentEditor/ports/portseditor.h>
 #include <editors/ComponentEditor/common/ExpressionParser.h>
+#include <editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h>
 
 #include <IPXACTmodels/Component/Component.h>
 
 #include <IPXACTmodels/Component/validators/PortValidator.h>
 
+#include <QSet>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorPortsItem::ComponentEditorPortsItem()
 //-----------------------------------------------------------------------------
@@ -26,7 +29,8 @@ ComponentEditorPortsItem::ComponentEditorPortsItem(ComponentEditorTreeModel* mod
     QSharedPointer<ParameterFinder> parameterFinder, QSharedPointer<ExpressionFormatter> expressionFormatter,
     QSharedPointer<ExpressionParser> expressionParser, ComponentEditorItem* parent):
 ComponentEditorItem(model, libHandler, component, parent),
-portValidator_(new PortValidator(expressionParser, component->getViews()))
+portValidator_(new PortValidator(expressionParser, component->getViews())),
+portValidities_()
 {
     setReferenceCounter(refCounter);
     setParameterFinder(parameterFinder);
@@ -63,20 +67,82 @@ QString ComponentEditorPortsItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorPortsItem::isValid() const
 {
-    QStringList portNames;
+    // Only the ports changed since the previous check are validated. The names are checked each time, as
+    // renaming a port may affect the other ports.
+    if (!portValidities_.validate(*component_->getPorts(), portValidator_))
+    {
+        return false;
+    }
+
+    QSet<QString> portNames;
 	foreach (QSharedPointer<Port> port, *component_->getPorts()) 
     {
-        if (portNames.contains(port->name()) || !portValidator_->validate(port))
+        if (portNames.contains(port->name()))
         {
 			return false;
 		}
 
-        portNames.append(port->name());
+        portNames.insert(port->name());
 	}
 
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorPortsItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorPortsItem::getIndexedElement() const
+{
+    return component_->getPorts().data();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorPortsItem::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorPortsItem::invalidateValidity()
+{
+    portValidities_.clear();
+    ComponentEditorItem::invalidateValidity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorPortsItem::invalidateEditedValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorPortsItem::invalidateEditedValidity()
+{
+    invalidateOwnValidity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorPortsItem::invalidateParameterReferences()
+//-----------------------------------------------------------------------------
+void ComponentEditorPortsItem::invalidateParameterReferences(QStringList const& parameterIds)
+{
+    QSharedPointer<ParameterReferenceCounter> parameterCounter =
+        referenceCounter_.dynamicCast<ParameterReferenceCounter>();
+    if (parameterCounter.isNull())
+    {
+        invalidateValidity();
+        return;
+    }
+
+    // The ports referencing the parameters are found from the index, so the other ports are not visited.
+    ParameterReferenceIndex const& referenceIndex = parameterCounter->getReferenceIndex();
+    void const* ports = component_->getPorts().data();
+    foreach (QString const& parameterId, parameterIds)
+    {
+        foreach (void const* element, referenceIndex.getReferencingElements(parameterId))
+        {
+            if (element != ports && referenceIndex.isContainedIn(element, ports))
+            {
+                portValidities_.invalidate(static_cast<Port const*>(element));
+            }
+        }
+    }
+
+    invalidateOwnValidity();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorPortsItem::editor()
 //-----------------------------------------------------------------------------
@@ -87,6 +153,8 @@ ItemEditor* ComponentEditorPortsItem::editor()
 		editor_ = new PortsEditor(component_, libHandler_, parameterFinder_, expressionFormatter_, portValidator_);
 		editor_->setProtection(locked_);
 
+        connect(editor_, SIGNAL(portChanged(QSharedPointer<Port>)),
+            this, SLOT(onPortChanged(QSharedPointer<Port>)), Qt::UniqueConnection);
 		connect(editor_, SIGNAL(contentChanged()), this, SLOT(onEditorChanged()), Qt::UniqueConnection);
 		connect(editor_, SIGNAL(helpUrlRequested(QString const&)),
 			this, SIGNAL(helpUrlRequested(QString const&)), Qt::UniqueConnection);
@@ -106,3 +174,11 @@ QString ComponentEditorPortsItem::getTooltip() const
 {
 	return tr("Contains the external ports of the component");
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorPortsItem::onPortChanged()
+//-----------------------------------------------------------------------------
+void ComponentEditorPortsItem::onPortChanged(QSharedPointer<Port> port)
+{
+    portValidities_.invalidate(port);
+}
@@ -13,6 +13,7 @@
 #define COMPONENTEDITORPORTSITEM_H
 
 #include "componenteditoritem.h"
+#include "ElementValidityCache.h"
 
 #include <QList>
 
@@ -83,6 +84,31 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The ports of the component.
+	 */
+	virtual void const* getIndexedElement() const;
+
+	/*!
+     *  Marks the validity of all the ports to be checked again.
+	 */
+	virtual void invalidateValidity();
+
+	/*!
+     *  Marks the validity of the item to be checked again after an edit. The edited ports have been reported
+     *  by the editor, and the other ports keep their validity.
+	 */
+	virtual void invalidateEditedValidity();
+
+	/*!
+     *  Marks the validity of the ports referencing the given parameters to be checked again.
+	 *
+	 *      @param [in] parameterIds    The ids of the changed parameters.
+	 */
+	virtual void invalidateParameterReferences(QStringList const& parameterIds);
+
 	/*!
      *  Get pointer to the editor of this item.
 	 *
@@ -95,6 +121,15 @@ signals:
     //! Emitted when a new interface should be created in the component editor tree.
     void createInterface();
 
+private slots:
+
+	/*!
+     *  Marks the validity of an edited port to be checked again.
+	 *
+	 *      @param [in] port    The edited port.
+	 */
+	void onPortChanged(QSharedPointer<Port> port);
+
 private:
 	//! No copying
 	ComponentEditorPortsItem(const ComponentEditorPortsItem& other);
@@ -104,6 +139,9 @@ private:
 
     //! The used port validator.
     QSharedPointer<PortValidator> portValidator_;
+
+    //! The validity of each port after its latest change.
+    mutable ElementValidityCache<Port> portValidities_;
 };
 
 #endif // COMPONENTEDITORPORTSITEM_H
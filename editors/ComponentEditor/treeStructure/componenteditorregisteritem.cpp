@@ -83,7 +83,16 @@ QString ComponentEditorRegisterItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorRegisterItem::isValid() const
 {
-    return registerValidator_->validate(reg_);
+    // The fields are validated by their own items, which keep the result until the field is changed.
+    return registerValidator_->validate(reg_, false) && ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::getIndexedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorRegisterItem::getIndexedElement() const
+{
+    return reg_.data();
 }
 
 //-----------------------------------------------------------------------------
@@ -88,6 +88,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+	/*!
+     *  Get the element edited in the item, as identified in the parameter reference index.
+	 *
+	 *      @return The register of the item.
+	 */
+	virtual void const* getIndexedElement() const;
+
 	/*! Get pointer to the editor of this item.
 	 *
 	 *      @return Pointer to the editor to use for this item.
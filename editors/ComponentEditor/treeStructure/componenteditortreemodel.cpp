@@ -11,6 +11,10 @@
 
 #include "componenteditortreemodel.h"
 
+#include <editors/ComponentEditor/common/ParameterDependencyGraph.h>
+#include <editors/ComponentEditor/common/ParameterFinder.h>
+#include <editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h>
+
 #include <IPXACTmodels/Component/Component.h>
 
 #include <common/KactusColors.h>
@@ -22,7 +26,9 @@
 //-----------------------------------------------------------------------------
 ComponentEditorTreeModel::ComponentEditorTreeModel(QObject* parent) :
 QAbstractItemModel(parent),
-rootItem_()
+rootItem_(),
+referenceCounter_(),
+dependencyGraph_()
 {
 	setObjectName(tr("ComponentEditorTreeModel"));
 }
@@ -45,6 +51,33 @@ void ComponentEditorTreeModel::setRootItem(QSharedPointer<ComponentEditorRootIte
 	endResetModel();
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::setParameterReferences()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::setParameterReferences(QSharedPointer<ParameterFinder> parameterFinder,
+    QSharedPointer<ParameterReferenceCounter> referenceCounter)
+{
+    referenceCounter_ = referenceCounter;
+    dependencyGraph_ = QSharedPointer<ParameterDependencyGraph>(new ParameterDependencyGraph(parameterFinder));
+
+    // The graph is built once. After this only the edited parameters are updated in it.
+    dependencyGraph_->rebuild();
+    referenceCounter_->takeChangedParameterIds();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::findParameterCycles()
+//-----------------------------------------------------------------------------
+QList<QStringList> ComponentEditorTreeModel::findParameterCycles() const
+{
+    if (!dependencyGraph_)
+    {
+        return QList<QStringList>();
+    }
+
+    return dependencyGraph_->findCycles();
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::rowCount()
 //-----------------------------------------------------------------------------
@@ -132,7 +165,7 @@ QVariant ComponentEditorTreeModel::data( const QModelIndex& index, int role /*=
 	}
 	else if (role == Qt::ForegroundRole)
     {
-        if (!item->isValid())
+        if (!item->getValidity())
         {
             return KactusColors::ERROR;
         }         
@@ -182,6 +215,69 @@ void ComponentEditorTreeModel::onContentChanged(ComponentEditorItem* item )
 	emit dataChanged(index, index);
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::onItemEdited()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::onItemEdited(ComponentEditorItem* item)
+{
+    item->invalidateEditedValidity();
+
+    bool dependentsChanged = false;
+
+    // The elements of the edited item may be referenced by name in other items.
+    for (ComponentEditorItem* editedItem = item; editedItem != 0; editedItem = editedItem->parent())
+    {
+        foreach (ComponentEditorItem* dependentItem, editedItem->getDependentItems())
+        {
+            dependentItem->invalidateValidity();
+            dependentsChanged = true;
+        }
+    }
+
+    QStringList changedParameters;
+    if (referenceCounter_)
+    {
+        changedParameters = referenceCounter_->takeChangedParameterIds();
+    }
+
+    if (!changedParameters.isEmpty() && rootItem_)
+    {
+        foreach (QString const& parameterId, changedParameters)
+        {
+            dependencyGraph_->updateParameter(parameterId);
+        }
+
+        // The values of the parameters referencing the changed parameters change as well.
+        QStringList affectedParameters = changedParameters;
+        foreach (QString const& parameterId, changedParameters)
+        {
+            affectedParameters.append(dependencyGraph_->getAffectedParameters(parameterId));
+        }
+        affectedParameters.removeDuplicates();
+
+        invalidateParameterDependents(rootItem_.data(), affectedParameters);
+        dependentsChanged = true;
+    }
+
+    // The dependent items may be anywhere in the tree, so the whole view is updated.
+    if (dependentsChanged && rowCount() > 0)
+    {
+        emit dataChanged(index(0, 0), index(rowCount() - 1, 0));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::onLibraryChanged()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::onLibraryChanged()
+{
+    if (rootItem_ && rowCount() > 0)
+    {
+        invalidateLibraryDependents(rootItem_.data());
+        emit dataChanged(index(0, 0), index(rowCount() - 1, 0));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::index()
 //-----------------------------------------------------------------------------
@@ -296,6 +392,8 @@ void ComponentEditorTreeModel::addItem( ComponentEditorItem* parentItem, int chi
 	parentItem->createChild(childIndex);
 	endInsertRows();
 
+    parentItem->invalidateValidity();
+
 	emit expandItem(parentIndex);
 }
 
@@ -313,6 +411,8 @@ void ComponentEditorTreeModel::removeItem( ComponentEditorItem* parentItem, int
 	beginRemoveRows(parentIndex, childIndex, childIndex);
 	parentItem->removeChild(childIndex);
 	endRemoveRows();
+
+    parentItem->invalidateValidity();
 }
 
 //-----------------------------------------------------------------------------
@@ -413,3 +513,46 @@ QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& i
 
     return parentIndex;
 }
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::invalidateParameterDependents()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateParameterDependents(ComponentEditorItem* item,
+    QStringList const& parameterIds)
+{
+    for (int i = 0; i < item->rowCount(); ++i)
+    {
+        QSharedPointer<ComponentEditorItem> childItem = item->child(i);
+
+        // The sub items of an item not referencing the parameters do not reference them either, unless the
+        // item has no element of its own in the reference index.
+        if (childItem->dependsOnParameters(parameterIds))
+        {
+            childItem->invalidateParameterReferences(parameterIds);
+            invalidateParameterDependents(childItem.data(), parameterIds);
+        }
+        else if (childItem->getIndexedElement() == 0)
+        {
+            invalidateParameterDependents(childItem.data(), parameterIds);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::invalidateLibraryDependents()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateLibraryDependents(ComponentEditorItem* item)
+{
+    for (int i = 0; i < item->rowCount(); ++i)
+    {
+        QSharedPointer<ComponentEditorItem> childItem = item->child(i);
+        if (childItem->dependsOnLibrary())
+        {
+            childItem->invalidateValidity();
+        }
+        else
+        {
+            invalidateLibraryDependents(childItem.data());
+        }
+    }
+}
@@ -17,8 +17,12 @@
 #include <QAbstractItemModel>
 #include <QWidget>
 #include <QSharedPointer>
+#include <QStringList>
 
 class LibraryInterface;
+class ParameterDependencyGraph;
+class ParameterFinder;
+class ParameterReferenceCounter;
 class PluginManager;
 class Component;
 class VLNV;
@@ -50,6 +54,23 @@ public:
 	 */
     void setRootItem(QSharedPointer<ComponentEditorRootItem> root);
 
+	/*!
+     *  Set the parameters of the component and the references to them. The items referencing the parameters
+     *  are validated again when the parameter values are edited.
+	 *
+     *      @param [in] parameterFinder     The finder for the component parameters.
+     *      @param [in] referenceCounter    The counter for the references made in the component.
+	 */
+    void setParameterReferences(QSharedPointer<ParameterFinder> parameterFinder,
+        QSharedPointer<ParameterReferenceCounter> referenceCounter);
+
+	/*!
+     *  Finds the reference cycles between the parameters of the component.
+	 *
+     *      @return The paths of parameter ids in each cycle, starting and ending with the same parameter.
+	 */
+    QList<QStringList> findParameterCycles() const;
+
 	/*!
      *  Get the number of rows an item contains.
 	 *
@@ -143,6 +164,22 @@ public slots:
 	 */
 	void onContentChanged(ComponentEditorItem* item);
 
+	/*!
+     *  Marks the validity of an edited item and the items depending on it to be checked again.
+     *
+     *  The dependent items are the items referencing the elements of the edited item and the items
+     *  referencing the parameters whose values changed in the edit. Other items keep their validity.
+	 *
+	 *      @param [in] item    Pointer to the edited item.
+	 */
+	void onItemEdited(ComponentEditorItem* item);
+
+	/*!
+     *  Marks the validity of the items referencing library documents to be checked again. Called when the
+     *  documents referenced by the component are added, changed or removed in the library.
+	 */
+	void onLibraryChanged();
+
 	/*!
      *  Add a new item to the tree under parent item.
 	 *
@@ -248,12 +285,33 @@ private:
     QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex())
         const;
 
+    /*!
+     *  Marks the validity of the sub items referencing the given parameters to be checked again.
+     *
+     *      @param [in] item            The item whose sub items to check.
+     *      @param [in] parameterIds    The ids of the changed parameters.
+     */
+    void invalidateParameterDependents(ComponentEditorItem* item, QStringList const& parameterIds);
+
+    /*!
+     *  Marks the validity of the sub items referencing library documents to be checked again.
+     *
+     *      @param [in] item    The item whose sub items to check.
+     */
+    void invalidateLibraryDependents(ComponentEditorItem* item);
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
 
 	//! Pointer to the root item of the tree.
 	QSharedPointer<ComponentEditorRootItem> rootItem_;
+
+    //! The counter for the references made in the component.
+    QSharedPointer<ParameterReferenceCounter> referenceCounter_;
+
+    //! The references between the parameters of the component.
+    QSharedPointer<ParameterDependencyGraph> dependencyGraph_;
 };
 
 #endif // COMPONENTEDITORTREEMODEL_H
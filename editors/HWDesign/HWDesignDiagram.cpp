@@ -156,6 +156,18 @@ void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
     // Clear undo/redo stack to prevent undoing the column adds.
     getEditProvider()->clear();
 
+    // Read the instantiated components and their definitions in parallel into the library cache, so the items
+    // below do not read them one by one.
+    getLibraryInterface()->prefetchDependencies(design->getVlnv()).waitForFinished();
+
+    createDesignItems(design);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createDesignItems()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::createDesignItems(QSharedPointer<Design> design)
+{
     // Create diagram interfaces for the top-level bus interfaces.
     foreach (QSharedPointer<BusInterface> busIf, *getEditedComponent()->getBusInterfaces())
     {
@@ -2016,11 +2028,11 @@ bool HWDesignDiagram::referenceFinderContainsComponent(QSharedPointer<Component>
     {
         if (instance->getComponentRef())
         {
-            QSharedPointer<Document> componentDocument =
-                getLibraryInterface()->getModel(*instance->getComponentRef().data());
+            QSharedPointer<Document const> componentDocument =
+                getLibraryInterface()->getModelReadOnly(*instance->getComponentRef().data());
             if (componentDocument)
             {
-                QSharedPointer<Component> instancedComponent = componentDocument.dynamicCast<Component>();
+                QSharedPointer<Component const> instancedComponent = componentDocument.dynamicCast<Component const>();
                 if (instancedComponent && instancedComponent->getVlnv() == component->getVlnv())
                 {
                     return true;
@@ -429,6 +429,13 @@ private:
     QSharedPointer<InterfaceGraphicsData> findOrCreateInterfaceExtensionGroup(QSharedPointer<Design> design,
         QString const& busInterfaceName);
 
+    /*!
+     *  Creates the interface, component, connection and ad-hoc items of a design.
+     *
+     *      @param [in] design  The design to create the items for.
+     */
+    void createDesignItems(QSharedPointer<Design> design);
+
     /*!
      *  Called when an item has been selected in the diagram.
      *
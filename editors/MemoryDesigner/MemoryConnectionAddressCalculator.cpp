@@ -27,17 +27,17 @@ MemoryConnectionAddressCalculator::ConnectionPathVariables MemoryConnectionAddre
     newPathVariables.hasRemapRange_ = false;
     newPathVariables.isChainedSpaceConnection_ = false;
     newPathVariables.baseAddressNumber_ = getStartingBaseAddress(startInterface, endInterface);
-    newPathVariables.mirroredSlaveAddressChange_ = 0;
+    newPathVariables.mirroredSlaveAddressChange_ = BigInteger(0);
 
     QSharedPointer<MemoryItem> mapItem = MemoryDesignerConstants::getMapItem(startInterface, endInterface);
 
-    QPair<quint64, quint64> mapAddressRanges = getMemoryMapAddressRanges(mapItem);
-    newPathVariables.spaceChainBaseAddress_ = 0;
+    QPair<BigInteger, BigInteger> mapAddressRanges = getMemoryMapAddressRanges(mapItem);
+    newPathVariables.spaceChainBaseAddress_ = BigInteger(0);
     newPathVariables.memoryMapEndAddress_ = mapAddressRanges.second;
 
     QSharedPointer<MemoryItem> startSpace = startInterface->getConnectedMemory();
     MemoryConnectionAddressCalculator::ChainedSpace newChainedSpace;
-    newChainedSpace.spaceConnectionBaseAddress_ = 0;
+    newChainedSpace.spaceConnectionBaseAddress_ = BigInteger(0);
     newChainedSpace.spaceInterface_ = startInterface;
 
     newPathVariables.spaceChain_.append(newChainedSpace);
@@ -49,21 +49,24 @@ MemoryConnectionAddressCalculator::ConnectionPathVariables MemoryConnectionAddre
             if (pathInterface->getMode().compare(QStringLiteral("mirroredSlave"), Qt::CaseInsensitive) == 0 &&
                 !pathInterface->getRemapAddress().isEmpty() && !pathInterface->getRemapRange().isEmpty())
             {
-                newPathVariables.mirroredSlaveAddressChange_ += pathInterface->getRemapAddress().toULongLong();
+                newPathVariables.mirroredSlaveAddressChange_ = newPathVariables.mirroredSlaveAddressChange_ +
+                    BigInteger::fromString(pathInterface->getRemapAddress());
 
-                newPathVariables.memoryMapEndAddress_ = pathInterface->getRemapRange().toULongLong() - 1;
+                newPathVariables.memoryMapEndAddress_ =
+                    BigInteger::fromString(pathInterface->getRemapRange()) - BigInteger(1);
                 newPathVariables.hasRemapRange_ = true;
             }
             else if (pathInterface->getMode().compare(QStringLiteral("master"), Qt::CaseInsensitive) == 0)
             {
                 if (pathInterface->isConnectedToMemory())
                 {
-                    newPathVariables.spaceChainBaseAddress_ += newPathVariables.baseAddressNumber_;
+                    newPathVariables.spaceChainBaseAddress_ =
+                        newPathVariables.spaceChainBaseAddress_ + newPathVariables.baseAddressNumber_;
 
                     QSharedPointer<MemoryItem> middleSpace = pathInterface->getConnectedMemory();
                     if (middleSpace)
                     {
-                        quint64 chainOffset = newPathVariables.spaceChainBaseAddress_;
+                        BigInteger chainOffset = newPathVariables.spaceChainBaseAddress_;
 
                         MemoryConnectionAddressCalculator::ChainedSpace middleChainedSpace;
                         middleChainedSpace.spaceInterface_ = pathInterface;
@@ -72,7 +75,7 @@ MemoryConnectionAddressCalculator::ConnectionPathVariables MemoryConnectionAddre
                         newPathVariables.spaceChain_.append(middleChainedSpace);
                     }
 
-                    newPathVariables.baseAddressNumber_ = pathInterface->getBaseAddress().toULongLong();
+                    newPathVariables.baseAddressNumber_ = BigInteger::fromString(pathInterface->getBaseAddress());
                 }
             }
         }
@@ -94,17 +97,17 @@ MemoryConnectionAddressCalculator::ConnectionPathVariables MemoryConnectionAddre
 //-----------------------------------------------------------------------------
 // Function: MemoryConnectionAddressCalculator::getStartingBaseAddress()
 //-----------------------------------------------------------------------------
-quint64 MemoryConnectionAddressCalculator::getStartingBaseAddress(
+BigInteger MemoryConnectionAddressCalculator::getStartingBaseAddress(
     QSharedPointer<ConnectivityInterface const> startInterface,
     QSharedPointer<ConnectivityInterface const> endInterface)
 {
-    quint64 baseAddressNumber = 0;
+    BigInteger baseAddressNumber;
     if (startInterface != endInterface)
     {
         QString startInterfaceBaseAddress = startInterface->getBaseAddress();
         if (startInterfaceBaseAddress.compare(QStringLiteral("x"), Qt::CaseInsensitive) != 0)
         {
-            baseAddressNumber = startInterfaceBaseAddress.toULongLong();
+            baseAddressNumber = BigInteger::fromString(startInterfaceBaseAddress);
         }
     }
 
@@ -114,11 +117,11 @@ quint64 MemoryConnectionAddressCalculator::getStartingBaseAddress(
 //-----------------------------------------------------------------------------
 // Function: MemoryConnectionAddressCalculator::getMemoryMapAddressRanges()
 //-----------------------------------------------------------------------------
-QPair<quint64, quint64> MemoryConnectionAddressCalculator::getMemoryMapAddressRanges(
+QPair<BigInteger, BigInteger> MemoryConnectionAddressCalculator::getMemoryMapAddressRanges(
     QSharedPointer<MemoryItem> mapItem)
 {
-    quint64 baseAddress = 0;
-    quint64 lastAddress = 0;
+    BigInteger baseAddress;
+    BigInteger lastAddress;
     if (mapItem && mapItem->getChildItems().size() > 0)
     {
         bool firstBlock = true;
@@ -127,9 +130,9 @@ QPair<quint64, quint64> MemoryConnectionAddressCalculator::getMemoryMapAddressRa
         {
             if (blockItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
             {
-                quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
-                quint64 blockRange = blockItem->getRange().toULongLong();
-                quint64 blockEndPoint = blockBaseAddress + blockRange - 1;
+                BigInteger blockBaseAddress = BigInteger::fromString(blockItem->getAddress());
+                BigInteger blockRange = BigInteger::fromString(blockItem->getRange());
+                BigInteger blockEndPoint = blockBaseAddress + blockRange - BigInteger(1);
 
                 if (firstBlock)
                 {
@@ -152,23 +155,23 @@ QPair<quint64, quint64> MemoryConnectionAddressCalculator::getMemoryMapAddressRa
         }
     }
 
-    QPair<quint64, quint64> memoryRanges(baseAddress, lastAddress);
+    QPair<BigInteger, BigInteger> memoryRanges(baseAddress, lastAddress);
     return memoryRanges;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryConnectionAddressCalculator::getRemappedBaseAddress()
 //-----------------------------------------------------------------------------
-quint64 MemoryConnectionAddressCalculator::getRemappedBaseAddress(quint64 memoryMapBaseAddress,
-    quint64 baseAddressNumber, quint64 spaceChainConnectionBaseAddress, quint64 mirroredSlaveAddressChange,
-    bool hasRemapRange)
+BigInteger MemoryConnectionAddressCalculator::getRemappedBaseAddress(BigInteger const& memoryMapBaseAddress,
+    BigInteger const& baseAddressNumber, BigInteger const& spaceChainConnectionBaseAddress,
+    BigInteger const& mirroredSlaveAddressChange, bool hasRemapRange)
 {
-    quint64 remappedAddress =
+    BigInteger remappedAddress =
         baseAddressNumber + spaceChainConnectionBaseAddress + mirroredSlaveAddressChange;
 
     if (!hasRemapRange)
     {
-        remappedAddress += memoryMapBaseAddress;
+        remappedAddress = remappedAddress + memoryMapBaseAddress;
     }
 
     return remappedAddress;
@@ -15,11 +15,15 @@
 class ConnectivityInterface;
 class MemoryItem;
 
+#include <editors/ComponentEditor/common/BigInteger.h>
+
 #include <QVector>
 #include <QSharedPointer>
 
 //-----------------------------------------------------------------------------
 //! Calculates address ranges for connected memory items.
+//
+// The addresses are calculated in full width, so address spaces wider than 64 bits are not truncated.
 //-----------------------------------------------------------------------------
 namespace MemoryConnectionAddressCalculator
 {
@@ -30,23 +34,23 @@ namespace MemoryConnectionAddressCalculator
         QSharedPointer<const ConnectivityInterface> spaceInterface_;
 
         //! Base address of the address space connection.
-        quint64 spaceConnectionBaseAddress_;
+        BigInteger spaceConnectionBaseAddress_;
     };
 
     //! Path variables determined during connection path examination.
     struct ConnectionPathVariables
     {
         //! The base address number of the path interfaces.
-        quint64 baseAddressNumber_;
+        BigInteger baseAddressNumber_;
 
         //! Address change caused by mirrored slave bus interfaces.
-        quint64 mirroredSlaveAddressChange_;
+        BigInteger mirroredSlaveAddressChange_;
 
         //! End address of the memory map modified by mirrored slave interfaces.
-        quint64 memoryMapEndAddress_;
+        BigInteger memoryMapEndAddress_;
 
         //! Base address modified by the interface bridges.
-        quint64 spaceChainBaseAddress_;
+        BigInteger spaceChainBaseAddress_;
 
         //! Flag for paths that have gone through a mirrored slave with a remapped address range.
         bool hasRemapRange_;
@@ -58,16 +62,16 @@ namespace MemoryConnectionAddressCalculator
         QVector<ChainedSpace> spaceChain_;
 
         //! Base address of the connected memory map interface.
-        quint64 memoryMapBaseAddress_;
+        BigInteger memoryMapBaseAddress_;
 
         //! Last address of the connected memory map interface.
-        quint64 endAddressNumber_;
+        BigInteger endAddressNumber_;
 
         //! The remapped base address.
-        quint64 remappedAddress_;
+        BigInteger remappedAddress_;
 
         //! The remapped end address.
-        quint64 remappedEndAddress_;
+        BigInteger remappedEndAddress_;
     };
 
     /*!
@@ -91,7 +95,7 @@ namespace MemoryConnectionAddressCalculator
      *
      *      @return Starting base address of the memory connection.
      */
-    quint64 getStartingBaseAddress(QSharedPointer<ConnectivityInterface const> startInterface,
+    BigInteger getStartingBaseAddress(QSharedPointer<ConnectivityInterface const> startInterface,
         QSharedPointer<ConnectivityInterface const> endInterface);
 
     /*!
@@ -101,7 +105,7 @@ namespace MemoryConnectionAddressCalculator
      *
      *		@return	QPair containing the base address and the last address of the selected memory map.
      */
-    QPair<quint64, quint64> getMemoryMapAddressRanges(QSharedPointer<MemoryItem> mapItem);
+    QPair<BigInteger, BigInteger> getMemoryMapAddressRanges(QSharedPointer<MemoryItem> mapItem);
 
     /*!
      *  Calculate the remapped base address for the memory connection.
@@ -114,8 +118,9 @@ namespace MemoryConnectionAddressCalculator
      *
      *      @return The remapped base address of the memory connection.
      */
-    quint64 getRemappedBaseAddress(quint64 memoryMapBaseAddress, quint64 baseAddressNumber,
-        quint64 spaceChainConnectionBaseAddress, quint64 mirroredSlaveAddressChange, bool hasRemapRange);
+    BigInteger getRemappedBaseAddress(BigInteger const& memoryMapBaseAddress, BigInteger const& baseAddressNumber,
+        BigInteger const& spaceChainConnectionBaseAddress, BigInteger const& mirroredSlaveAddressChange,
+        bool hasRemapRange);
 };
 
 //-----------------------------------------------------------------------------
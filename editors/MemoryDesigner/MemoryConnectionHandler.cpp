@@ -203,29 +203,35 @@ void MemoryConnectionHandler::createConnection(
         spaceItemPlaced = true;
     }
 
-    qreal yTransfer = getConnectionInitialTransferY(pathVariables.baseAddressNumber_,
-        pathVariables.mirroredSlaveAddressChange_, pathVariables.hasRemapRange_,
-        pathVariables.memoryMapBaseAddress_, pathVariables.spaceChainBaseAddress_);
+    // The graphics items are positioned with 64-bit addresses.
+    quint64 baseAddressNumber = pathVariables.baseAddressNumber_.toULongLong();
+    quint64 memoryMapBaseAddress = pathVariables.memoryMapBaseAddress_.toULongLong();
+    quint64 remappedAddress = pathVariables.remappedAddress_.toULongLong();
+    quint64 remappedEndAddress = pathVariables.remappedEndAddress_.toULongLong();
+
+    qreal yTransfer = getConnectionInitialTransferY(baseAddressNumber,
+        pathVariables.mirroredSlaveAddressChange_.toULongLong(), pathVariables.hasRemapRange_,
+        memoryMapBaseAddress, pathVariables.spaceChainBaseAddress_.toULongLong());
 
     if (!placedMapItems->contains(connectionEndItem))
     {
-        placeMemoryMapItem(pathVariables.remappedAddress_, pathVariables.remappedEndAddress_, connectionEndItem,
-            connectionStartItem, yTransfer, pathVariables.hasRemapRange_, pathVariables.memoryMapBaseAddress_,
-            spaceItemPlaced, pathVariables.isChainedSpaceConnection_, placedMapItems, placedSpaceItems,
-            memoryMapColumn, spaceColumn, spaceYPlacement);
+        placeMemoryMapItem(remappedAddress, remappedEndAddress, connectionEndItem, connectionStartItem, yTransfer,
+            pathVariables.hasRemapRange_, memoryMapBaseAddress, spaceItemPlaced,
+            pathVariables.isChainedSpaceConnection_, placedMapItems, placedSpaceItems, memoryMapColumn, spaceColumn,
+            spaceYPlacement);
     }
     else
     {
         placeSpaceItemToOtherColumn(
-            connectionStartItem, spaceChain, spaceColumn, connectionEndItem, pathVariables.remappedAddress_);
+            connectionStartItem, spaceChain, spaceColumn, connectionEndItem, remappedAddress);
 
         spaceYPlacement = spaceYPlacement - (connectionStartItem->getHeightWithSubItems() +
             MemoryDesignerConstants::SPACEITEMINTERVAL);
     }
 
     createMemoryConnectionItem(connectionPath, connectionStartItem, connectionEndItem,
-        pathVariables.remappedAddress_, pathVariables.remappedEndAddress_, pathVariables.memoryMapBaseAddress_,
-        pathVariables.hasRemapRange_, yTransfer, spaceYPlacement);
+        remappedAddress, remappedEndAddress, memoryMapBaseAddress, pathVariables.hasRemapRange_, yTransfer,
+        spaceYPlacement);
 }
 
 //-----------------------------------------------------------------------------
@@ -454,14 +460,15 @@ QVector<MainMemoryGraphicsItem*> MemoryConnectionHandler::createSpaceChain(
 
         if (connectionMiddleItem != spaceChainStartItem)
         {
-            connectionMiddleItem->changeAddressRange(chainedSpace.spaceConnectionBaseAddress_);
+            quint64 spaceConnectionBaseAddress = chainedSpace.spaceConnectionBaseAddress_.toULongLong();
+            connectionMiddleItem->changeAddressRange(spaceConnectionBaseAddress);
 
             QPointF middlePosition = connectionMiddleItem->scenePos();
 
             spaceItemChain.append(connectionMiddleItem);
 
             createSpaceConnection(connectionPath, spaceChainStartItem,
-                chainedSpace.spaceConnectionBaseAddress_, connectionMiddleItem, spaceColumn, placedSpaceItems,
+                spaceConnectionBaseAddress, connectionMiddleItem, spaceColumn, placedSpaceItems,
                 spaceItemChain, spaceYPlacement);
         }
 
@@ -46,11 +46,11 @@ filterFields_(filterFields),
 subItemWidth_(0),
 filteredBlocks_()
 {
-    QPair<quint64, quint64> memoryRanges =
+    QPair<BigInteger, BigInteger> memoryRanges =
         MemoryConnectionAddressCalculator::getMemoryMapAddressRanges(memoryItem);
 
-    quint64 baseAddress = memoryRanges.first;
-    quint64 lastAddress = memoryRanges.second;
+    quint64 baseAddress = memoryRanges.first.toULongLong();
+    quint64 lastAddress = memoryRanges.second.toULongLong();
 
     QBrush memoryMapBrush(KactusColors::MEM_MAP_COLOR);
     setBrush(memoryMapBrush);
@@ -38,6 +38,8 @@ DesignParameterReferenceCounter::~DesignParameterReferenceCounter()
 void DesignParameterReferenceCounter::setDesign(QSharedPointer<Design> newDesign)
 {
     design_ = newDesign;
+
+    updateReferenceIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -46,16 +48,11 @@ void DesignParameterReferenceCounter::setDesign(QSharedPointer<Design> newDesign
 void DesignParameterReferenceCounter::recalculateReferencesToParameters(
     QVector<QSharedPointer<Parameter> > parameterList)
 {
+    updateReferenceIndex();
+
     foreach (QSharedPointer<Parameter> parameter, parameterList)
     {
-        int referenceCount = 0;
-        QString parameterID = parameter->getValueId();
-
-        referenceCount += countReferencesInParameters(parameterID, design_->getParameters());
-        referenceCount += countReferencesInComponentInstances(parameterID);
-        referenceCount += countReferencesInAdHocConnections(parameterID, design_->getAdHocConnections());
-
-        parameter->setUsageCount(referenceCount);
+        parameter->setUsageCount(getReferenceIndex().countReferences(parameter->getValueId()));
     }
 }
 
@@ -64,14 +61,7 @@ void DesignParameterReferenceCounter::recalculateReferencesToParameters(
 //-----------------------------------------------------------------------------
 int DesignParameterReferenceCounter::countReferencesInComponentInstances(QString const& parameterID) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<ComponentInstance> instance, *design_->getComponentInstances())
-    {
-        referenceCounter += countReferencesInSingleComponentInstance(parameterID, instance);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, design_->getComponentInstances().data());
 }
 
 //-----------------------------------------------------------------------------
@@ -80,7 +70,7 @@ int DesignParameterReferenceCounter::countReferencesInComponentInstances(QString
 int DesignParameterReferenceCounter::countReferencesInSingleComponentInstance(QString const& parameterID,
     QSharedPointer<ComponentInstance> instance) const
 {
-    return countReferencesInConfigurableElementValues(parameterID, instance->getConfigurableElementValues());
+    return getReferenceIndex().countReferences(parameterID, instance.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -89,14 +79,7 @@ int DesignParameterReferenceCounter::countReferencesInSingleComponentInstance(QS
 int DesignParameterReferenceCounter::countReferencesInAdHocConnections(QString const& parameterID,
     QSharedPointer<QList<QSharedPointer<AdHocConnection> > > connections) const
 {
-    int referenceCounter = 0;
-
-    foreach (QSharedPointer<AdHocConnection> connection, *connections)
-    {
-        referenceCounter += countReferencesInSingleAdHocConnection(parameterID, connection);
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, connections.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -105,29 +88,7 @@ int DesignParameterReferenceCounter::countReferencesInAdHocConnections(QString c
 int DesignParameterReferenceCounter::countReferencesInSingleAdHocConnection(QString const& parameterID,
     QSharedPointer<AdHocConnection> connection) const
 {
-    int referenceCounter = 0;
-
-    if (!connection->getInternalPortReferences()->isEmpty() || !connection->getExternalPortReferences()->isEmpty())
-    {
-        referenceCounter += countReferencesInExpression(parameterID, connection->getTiedValue());
-
-        foreach (QSharedPointer<PortReference> port, *connection->getInternalPortReferences())
-        {
-            if (port->getPartSelect())
-            {
-                referenceCounter += countReferencesInPartSelect(parameterID, port->getPartSelect());
-            }
-        }
-        foreach (QSharedPointer<PortReference> port, *connection->getExternalPortReferences())
-        {
-            if (port->getPartSelect())
-            {
-                referenceCounter += countReferencesInPartSelect(parameterID, port->getPartSelect());
-            }
-        }
-    }
-
-    return referenceCounter;
+    return getReferenceIndex().countReferences(parameterID, connection.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -136,13 +97,57 @@ int DesignParameterReferenceCounter::countReferencesInSingleAdHocConnection(QStr
 int DesignParameterReferenceCounter::countReferencesInPartSelect(QString const& parameterID,
     QSharedPointer<PartSelect> partSelect) const
 {
-    int referenceCount = 0;
+    return getReferenceIndex().countReferences(parameterID, partSelect.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignParameterReferenceCounter::indexDocument()
+//-----------------------------------------------------------------------------
+void DesignParameterReferenceCounter::indexDocument()
+{
+    if (design_.isNull())
+    {
+        return;
+    }
 
-    if (partSelect)
+    indexElement(design_.data(), nullptr);
+    indexParameters(design_->getParameters(), design_.data());
+
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances = design_->getComponentInstances();
+    indexElement(instances.data(), design_.data());
+
+    for (QSharedPointer<ComponentInstance> instance : *instances)
     {
-        referenceCount += countReferencesInExpression(parameterID, partSelect->getLeftRange());
-        referenceCount += countReferencesInExpression(parameterID, partSelect->getRightRange());
+        indexElement(instance.data(), instances.data());
+        indexConfigurableElementValues(instance->getConfigurableElementValues(), instance.data());
     }
 
-    return referenceCount;
+    QSharedPointer<QList<QSharedPointer<AdHocConnection> > > connections = design_->getAdHocConnections();
+    indexElement(connections.data(), design_.data());
+
+    for (QSharedPointer<AdHocConnection> connection : *connections)
+    {
+        // Only the connections with port references are referencing the parameters.
+        if (connection->getInternalPortReferences()->isEmpty() &&
+            connection->getExternalPortReferences()->isEmpty())
+        {
+            indexElement(connection.data(), connections.data());
+            continue;
+        }
+
+        indexElement(connection.data(), connections.data(), QStringList(connection->getTiedValue()));
+
+        QList<QSharedPointer<PortReference> > portReferences = *connection->getInternalPortReferences();
+        portReferences.append(*connection->getExternalPortReferences());
+
+        for (QSharedPointer<PortReference> port : portReferences)
+        {
+            QSharedPointer<PartSelect> partSelect = port->getPartSelect();
+            if (partSelect)
+            {
+                indexElement(partSelect.data(), connection.data(),
+                    QStringList({ partSelect->getLeftRange(), partSelect->getRightRange() }));
+            }
+        }
+    }
 }
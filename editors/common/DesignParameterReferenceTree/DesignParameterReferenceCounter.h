@@ -111,6 +111,13 @@ public slots:
      */
     virtual void recalculateReferencesToParameters(QVector<QSharedPointer<Parameter> > parameterList);
 
+protected:
+
+    /*!
+     *  Indexes the elements of the design.
+     */
+    virtual void indexDocument() override;
+
 private:
 
 	//! No copying. No assignment.
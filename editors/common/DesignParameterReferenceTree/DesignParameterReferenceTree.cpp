@@ -51,6 +51,8 @@ void DesignParameterReferenceTree::setupTree()
 {
     if (design_)
     {
+        referenceCounter_->updateReferenceIndex();
+
         QString targetID = getTargetID();
 
         if (referenceCounter_->countReferencesInParameters(targetID, design_->getParameters()) > 0)
@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// File: DependencyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Forward and reverse VLNV references between the documents in the library.
+//-----------------------------------------------------------------------------
+
+#include "DependencyGraph.h"
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::setDependencies()
+//-----------------------------------------------------------------------------
+void DependencyGraph::setDependencies(VLNV const& document, QVector<VLNV> const& dependencies)
+{
+    removeDocument(document);
+
+    QVector<VLNV>& documentDependencies = dependencies_[document];
+    for (VLNV const& dependency : dependencies)
+    {
+        // A document may reference the same VLNV several times, e.g. from multiple instances.
+        if (documentDependencies.contains(dependency) == false)
+        {
+            documentDependencies.append(dependency);
+            dependents_[dependency].append(document);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::removeDocument()
+//-----------------------------------------------------------------------------
+void DependencyGraph::removeDocument(VLNV const& document)
+{
+    auto previous = dependencies_.find(document);
+    if (previous == dependencies_.end())
+    {
+        return;
+    }
+
+    for (VLNV const& dependency : *previous)
+    {
+        auto users = dependents_.find(dependency);
+        if (users != dependents_.end())
+        {
+            users->removeAll(document);
+            if (users->isEmpty())
+            {
+                dependents_.erase(users);
+            }
+        }
+    }
+
+    dependencies_.erase(previous);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::clear()
+//-----------------------------------------------------------------------------
+void DependencyGraph::clear()
+{
+    dependencies_.clear();
+    dependents_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::contains()
+//-----------------------------------------------------------------------------
+bool DependencyGraph::contains(VLNV const& document) const
+{
+    return dependencies_.contains(document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::getDependencies()
+//-----------------------------------------------------------------------------
+QVector<VLNV> DependencyGraph::getDependencies(VLNV const& document) const
+{
+    return dependencies_.value(document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::getDependents()
+//-----------------------------------------------------------------------------
+QVector<VLNV> DependencyGraph::getDependents(VLNV const& vlnv) const
+{
+    return dependents_.value(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::getAllDependents()
+//-----------------------------------------------------------------------------
+QVector<VLNV> DependencyGraph::getAllDependents(VLNV const& vlnv) const
+{
+    return findReachable(dependents_, vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::getAllDependencies()
+//-----------------------------------------------------------------------------
+QVector<VLNV> DependencyGraph::getAllDependencies(VLNV const& document) const
+{
+    return findReachable(dependencies_, document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DependencyGraph::findReachable()
+//-----------------------------------------------------------------------------
+QVector<VLNV> DependencyGraph::findReachable(QMap<VLNV, QVector<VLNV> > const& edges, VLNV const& start)
+{
+    QVector<VLNV> found;
+    QMap<VLNV, bool> visited;
+    visited.insert(start, true);
+
+    // Breadth-first, so the direct references come before the indirect ones.
+    found.append(start);
+    for (int i = 0; i < found.count(); ++i)
+    {
+        for (VLNV const& next : edges.value(found.at(i)))
+        {
+            if (visited.contains(next) == false)
+            {
+                visited.insert(next, true);
+                found.append(next);
+            }
+        }
+    }
+
+    found.removeFirst();
+    return found;
+}
@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// File: DependencyGraph.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Forward and reverse VLNV references between the documents in the library.
+//-----------------------------------------------------------------------------
+
+#ifndef DEPENDENCYGRAPH_H
+#define DEPENDENCYGRAPH_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QMap>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Forward and reverse VLNV references between the documents in the library.
+//
+// The references of each document are stored in both directions, so both the documents needed by a document
+// and the documents using a document are found without reading any documents. References to VLNVs not in the
+// library are kept, so the documents using a missing VLNV are found when the VLNV is added.
+//-----------------------------------------------------------------------------
+class DependencyGraph
+{
+public:
+
+    //! The constructor.
+    DependencyGraph() = default;
+
+    //! The destructor.
+    ~DependencyGraph() = default;
+
+    /*! Sets the references of a document, replacing any previous references.
+     *
+     *      @param [in] document        The VLNV of the document.
+     *      @param [in] dependencies    The VLNVs referenced by the document.
+     */
+    void setDependencies(VLNV const& document, QVector<VLNV> const& dependencies);
+
+    /*! Removes the references of a document. References to the document from other documents are kept.
+     *
+     *      @param [in] document    The VLNV of the document.
+     */
+    void removeDocument(VLNV const& document);
+
+    //! Removes all references.
+    void clear();
+
+    /*! Checks if the references of a document are known.
+     *
+     *      @param [in] document    The VLNV of the document.
+     *
+     *      @return True, if the references have been set, otherwise false.
+     */
+    bool contains(VLNV const& document) const;
+
+    /*! Get the VLNVs referenced by a document.
+     *
+     *      @param [in] document    The VLNV of the document.
+     *
+     *      @return The referenced VLNVs.
+     */
+    QVector<VLNV> getDependencies(VLNV const& document) const;
+
+    /*! Get the documents referencing a VLNV.
+     *
+     *      @param [in] vlnv    The referenced VLNV.
+     *
+     *      @return The documents directly referencing the VLNV.
+     */
+    QVector<VLNV> getDependents(VLNV const& vlnv) const;
+
+    /*! Get the documents referencing a VLNV directly or through other documents.
+     *
+     *      @param [in] vlnv    The referenced VLNV.
+     *
+     *      @return The documents referencing the VLNV, nearest first. The VLNV itself is not included.
+     */
+    QVector<VLNV> getAllDependents(VLNV const& vlnv) const;
+
+    /*! Get the VLNVs referenced by a document directly or through other documents.
+     *
+     *      @param [in] document    The VLNV of the document.
+     *
+     *      @return The referenced VLNVs, nearest first. The document itself is not included.
+     */
+    QVector<VLNV> getAllDependencies(VLNV const& document) const;
+
+private:
+
+    /*! Finds the VLNVs reachable from a VLNV along the given edges.
+     *
+     *      @param [in] edges   The edges to follow.
+     *      @param [in] start   The VLNV to start from.
+     *
+     *      @return The reachable VLNVs in breadth-first order, excluding the starting VLNV.
+     */
+    static QVector<VLNV> findReachable(QMap<VLNV, QVector<VLNV> > const& edges, VLNV const& start);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The VLNVs referenced by each document.
+    QMap<VLNV, QVector<VLNV> > dependencies_;
+
+    //! The documents referencing each VLNV.
+    QMap<VLNV, QVector<VLNV> > dependents_;
+};
+
+#endif // DEPENDENCYGRAPH_H
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// File: DocumentCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Memory-budgeted cache of the parsed IP-XACT documents in the library.
+//-----------------------------------------------------------------------------
+
+#include "DocumentCache.h"
+
+#include <IPXACTmodels/common/Document.h>
+
+namespace
+{
+    //! Ratio of the parsed document size to the file size. Strings are stored as UTF-16 and every element
+    //! becomes an object of its own, so the model takes several times the space of the XML text.
+    const qint64 FOOTPRINT_PER_FILE_BYTE = 4;
+
+    //! The minimum estimated size of a parsed document.
+    const qint64 MINIMUM_FOOTPRINT = 4096;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::DocumentCache()
+//-----------------------------------------------------------------------------
+DocumentCache::DocumentCache(qint64 budgetBytes):
+entries_(),
+    usageOrder_(),
+    budgetBytes_(qMax(budgetBytes, qint64(0))),
+    usedBytes_(0),
+    hits_(0),
+    misses_(0),
+    evictions_(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::estimateFootprint()
+//-----------------------------------------------------------------------------
+qint64 DocumentCache::estimateFootprint(qint64 fileSize)
+{
+    return qMax(fileSize * FOOTPRINT_PER_FILE_BYTE, MINIMUM_FOOTPRINT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::setBudget()
+//-----------------------------------------------------------------------------
+void DocumentCache::setBudget(qint64 budgetBytes)
+{
+    budgetBytes_ = qMax(budgetBytes, qint64(0));
+    evictToBudget();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::budget()
+//-----------------------------------------------------------------------------
+qint64 DocumentCache::budget() const
+{
+    return budgetBytes_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::find()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> DocumentCache::find(VLNV const& vlnv)
+{
+    auto entry = entries_.find(vlnv);
+    if (entry == entries_.end())
+    {
+        ++misses_;
+        return QSharedPointer<Document>();
+    }
+
+    ++hits_;
+    usageOrder_.splice(usageOrder_.begin(), usageOrder_, entry->usage);
+    return entry->document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::contains()
+//-----------------------------------------------------------------------------
+bool DocumentCache::contains(VLNV const& vlnv) const
+{
+    return entries_.contains(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::insert()
+//-----------------------------------------------------------------------------
+void DocumentCache::insert(VLNV const& vlnv, QSharedPointer<Document> document, qint64 cost)
+{
+    if (document.isNull())
+    {
+        remove(vlnv);
+        return;
+    }
+
+    auto entry = entries_.find(vlnv);
+    if (entry == entries_.end())
+    {
+        usageOrder_.push_front(vlnv);
+
+        Entry newEntry;
+        newEntry.usage = usageOrder_.begin();
+        entry = entries_.insert(vlnv, newEntry);
+    }
+    else
+    {
+        usedBytes_ -= entry->cost;
+        usageOrder_.splice(usageOrder_.begin(), usageOrder_, entry->usage);
+    }
+
+    entry->document = document;
+    entry->cost = cost;
+    usedBytes_ += cost;
+
+    evictToBudget();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::remove()
+//-----------------------------------------------------------------------------
+void DocumentCache::remove(VLNV const& vlnv)
+{
+    auto entry = entries_.find(vlnv);
+    if (entry != entries_.end())
+    {
+        usedBytes_ -= entry->cost;
+        usageOrder_.erase(entry->usage);
+        entries_.erase(entry);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::clear()
+//-----------------------------------------------------------------------------
+void DocumentCache::clear()
+{
+    entries_.clear();
+    usageOrder_.clear();
+    usedBytes_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::statistics()
+//-----------------------------------------------------------------------------
+DocumentCache::Statistics DocumentCache::statistics() const
+{
+    Statistics current;
+    current.hits = hits_;
+    current.misses = misses_;
+    current.evictions = evictions_;
+    current.documentCount = entries_.count();
+    current.usedBytes = usedBytes_;
+    current.budgetBytes = budgetBytes_;
+
+    return current;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::resetStatistics()
+//-----------------------------------------------------------------------------
+void DocumentCache::resetStatistics()
+{
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::evictToBudget()
+//-----------------------------------------------------------------------------
+void DocumentCache::evictToBudget()
+{
+    if (budgetBytes_ == 0)
+    {
+        return;
+    }
+
+    // The most recently used document is always kept, even if it alone exceeds the budget.
+    while (usedBytes_ > budgetBytes_ && usageOrder_.size() > 1)
+    {
+        auto entry = entries_.find(usageOrder_.back());
+        usedBytes_ -= entry->cost;
+        entries_.erase(entry);
+        usageOrder_.pop_back();
+
+        ++evictions_;
+    }
+}
@@ -0,0 +1,160 @@
+//-----------------------------------------------------------------------------
+// File: DocumentCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Memory-budgeted cache of the parsed IP-XACT documents in the library.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTCACHE_H
+#define DOCUMENTCACHE_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QMap>
+#include <QSharedPointer>
+
+#include <list>
+
+class Document;
+
+//-----------------------------------------------------------------------------
+//! Memory-budgeted cache of the parsed IP-XACT documents in the library.
+//
+// Documents are kept in least recently used order. When the estimated size of the cached documents exceeds
+// the budget, the least recently used documents are evicted until the cache fits the budget again.
+//-----------------------------------------------------------------------------
+class DocumentCache
+{
+public:
+
+    //! The default memory budget in megabytes.
+    static const int DEFAULT_BUDGET_MB = 1024;
+
+    //! The cache usage counters.
+    struct Statistics
+    {
+        quint64 hits = 0;           //!< The number of documents found in the cache.
+        quint64 misses = 0;         //!< The number of documents not found in the cache.
+        quint64 evictions = 0;      //!< The number of documents evicted to fit the budget.
+        int documentCount = 0;      //!< The number of documents currently in the cache.
+        qint64 usedBytes = 0;       //!< The estimated size of the documents currently in the cache.
+        qint64 budgetBytes = 0;     //!< The memory budget, or zero for no limit.
+    };
+
+    /*! The constructor.
+     *
+     *      @param [in] budgetBytes     The memory budget in bytes. Zero means no limit.
+     */
+    explicit DocumentCache(qint64 budgetBytes = 0);
+
+    //! The destructor.
+    ~DocumentCache() = default;
+
+    /*! Estimates the memory used by a parsed document.
+     *
+     * The estimate is based on the size of the document file, since the parsed model grows with it.
+     *
+     *      @param [in] fileSize    The size of the document file in bytes.
+     *
+     *      @return The estimated size of the parsed document in bytes.
+     */
+    static qint64 estimateFootprint(qint64 fileSize);
+
+    /*! Sets the memory budget and evicts documents to fit it, if needed.
+     *
+     *      @param [in] budgetBytes     The memory budget in bytes. Zero means no limit.
+     */
+    void setBudget(qint64 budgetBytes);
+
+    /*! Get the memory budget.
+     *
+     *      @return The memory budget in bytes, or zero for no limit.
+     */
+    qint64 budget() const;
+
+    /*! Finds a document in the cache and marks it as the most recently used.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return The cached document, or null if the document is not in the cache.
+     */
+    QSharedPointer<Document> find(VLNV const& vlnv);
+
+    /*! Checks if a document is in the cache. Does not affect the usage order or the counters.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return True, if the document is in the cache, otherwise false.
+     */
+    bool contains(VLNV const& vlnv) const;
+
+    /*! Adds a document to the cache or replaces the cached document with the same VLNV.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] document    The parsed document.
+     *      @param [in] cost        The estimated size of the document in bytes.
+     */
+    void insert(VLNV const& vlnv, QSharedPointer<Document> document, qint64 cost);
+
+    /*! Removes a document from the cache.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     */
+    void remove(VLNV const& vlnv);
+
+    //! Removes all documents from the cache.
+    void clear();
+
+    /*! Get the cache usage counters.
+     *
+     *      @return The current counters.
+     */
+    Statistics statistics() const;
+
+    //! Resets the hit, miss and eviction counters.
+    void resetStatistics();
+
+private:
+
+    //! A single cached document.
+    struct Entry
+    {
+        QSharedPointer<Document> document;      //!< The parsed document.
+        qint64 cost = 0;                        //!< The estimated size of the document.
+        std::list<VLNV>::iterator usage;        //!< The position of the document in the usage order.
+    };
+
+    //! Evicts the least recently used documents until the cache fits the budget.
+    void evictToBudget();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The cached documents.
+    QMap<VLNV, Entry> entries_;
+
+    //! The cached documents from the most recently used to the least recently used.
+    std::list<VLNV> usageOrder_;
+
+    //! The memory budget, or zero for no limit.
+    qint64 budgetBytes_;
+
+    //! The estimated size of the cached documents.
+    qint64 usedBytes_;
+
+    //! The number of documents found in the cache.
+    quint64 hits_;
+
+    //! The number of documents not found in the cache.
+    quint64 misses_;
+
+    //! The number of documents evicted to fit the budget.
+    quint64 evictions_;
+};
+
+#endif // DOCUMENTCACHE_H
@@ -25,8 +25,13 @@
 #include <IPXACTmodels/BusDefinition/BusDefinitionReader.h>
 #include <IPXACTmodels/Catalog/CatalogReader.h>
 #include <IPXACTmodels/Component/ComponentReader.h>
+#include <IPXACTmodels/Component/ComponentStreamReader.h>
 #include <IPXACTmodels/Design/DesignReader.h>
+#include <IPXACTmodels/Design/DesignStreamReader.h>
 #include <IPXACTmodels/designConfiguration/DesignConfigurationReader.h>
+#include <IPXACTmodels/designConfiguration/DesignConfigurationStreamReader.h>
+
+#include <IPXACTmodels/common/DocumentStreamParser.h>
 
 #include <IPXACTmodels/kactusExtensions/ComDefinitionReader.h>
 #include <IPXACTmodels/kactusExtensions/ApiDefinitionReader.h>
@@ -49,7 +54,8 @@
 // Function: DocumentFileAccess::DocumentFileAccess()
 //-----------------------------------------------------------------------------
 DocumentFileAccess::DocumentFileAccess(MessageMediator* messageChannel) :
-    messageChannel_(messageChannel)
+    messageChannel_(messageChannel),
+    useStreamingReaders_(false)
 {
 
 }
@@ -61,6 +67,18 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 {
     // Create file handle and use it to read the IP-XACT document into memory.
     QFile file(path);
+    if (useStreamingReaders_)
+    {
+        QSharedPointer<Document> streamedDocument = readDocumentStream(file);
+        if (streamedDocument.isNull() == false)
+        {
+            return streamedDocument;
+        }
+    }
+
+    // A failed streaming read may have left the file open at an arbitrary position.
+    file.close();
+
     QDomDocument doc;
     if (!doc.setContent(&file))
     {
@@ -116,7 +134,11 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
     }
     else
     {
-        messageChannel_->showMessage(QObject::tr("File '%1' was not supported type").arg(path));
+        if (messageChannel_ != nullptr)
+        {
+            messageChannel_->showMessage(QObject::tr("File '%1' was not supported type").arg(path));
+        }
+
         return QSharedPointer<Document>();
     }
 }
@@ -209,3 +231,47 @@ VLNV::IPXactType DocumentFileAccess::getDocumentVLNV(QDomDocument const& doc)
 {
     return VLNV::string2Type(doc.documentElement().nodeName());
 }
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::setStreamingReadersEnabled()
+//-----------------------------------------------------------------------------
+void DocumentFileAccess::setStreamingReadersEnabled(bool enabled)
+{
+    useStreamingReaders_ = enabled;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::streamingReadersEnabled()
+//-----------------------------------------------------------------------------
+bool DocumentFileAccess::streamingReadersEnabled() const
+{
+    return useStreamingReaders_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::readDocumentStream()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> DocumentFileAccess::readDocumentStream(QFile& file)
+{
+    VLNV::IPXactType documentType = VLNV::string2Type(DocumentStreamParser::readDocumentElementName(&file));
+    file.close();
+
+    // Other document types are small and read with the DOM readers.
+    if (documentType == VLNV::COMPONENT)
+    {
+        ComponentStreamReader reader;
+        return reader.createComponentFrom(&file);
+    }
+    else if (documentType == VLNV::DESIGN)
+    {
+        DesignStreamReader reader;
+        return reader.createDesignFrom(&file);
+    }
+    else if (documentType == VLNV::DESIGNCONFIGURATION)
+    {
+        DesignConfigurationStreamReader reader;
+        return reader.createDesignConfigurationFrom(&file);
+    }
+
+    return QSharedPointer<Document>();
+}
@@ -16,6 +16,7 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QFile>
 #include <QSharedPointer>
 #include <QString>
 #include <QDomDocument>
@@ -29,7 +30,7 @@ class DocumentFileAccess
 {
 public:
 
-	//! The constructor.
+	//! The constructor. Without a message channel, unsupported documents are skipped silently when reading.
 	explicit DocumentFileAccess(MessageMediator* messageChannel);
 
 	//! The destructor.
@@ -44,14 +45,40 @@ public:
     //! Gets the VLVN type of the document in the given path.
     VLNV::IPXactType getDocumentVLNV(QDomDocument const& doc);
 
+    /*!
+     *  Sets the streaming readers to be used for components, designs and design configurations.
+     *
+     *      @param [in] enabled     If true, the streaming readers are used, otherwise the DOM readers.
+     */
+    void setStreamingReadersEnabled(bool enabled);
+
+    /*!
+     *  Checks if the streaming readers are used for components, designs and design configurations.
+     *
+     *      @return True, if the streaming readers are used, otherwise false.
+     */
+    bool streamingReadersEnabled() const;
+
 private:
 
+    /*!
+     *  Reads a component, design or design configuration from the given file using the streaming readers.
+     *
+     *      @param [in] file    The file to read.
+     *
+     *      @return The read document or null, if the document could not be read.
+     */
+    QSharedPointer<Document> readDocumentStream(QFile& file);
+
 	//! Disable copying.
 	DocumentFileAccess(DocumentFileAccess const& rhs);
 	DocumentFileAccess& operator=(DocumentFileAccess const& rhs);
 
     //! Channel for messages concerning file access.
     MessageMediator* messageChannel_;
+
+    //! Flag for reading components, designs and design configurations with the streaming readers.
+    bool useStreamingReaders_;
 };
 
 #endif // DOCUMENTFILEACCESS_H
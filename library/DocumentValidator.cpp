@@ -15,6 +15,7 @@
 #include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
 #include <editors/ComponentEditor/common/ListParameterFinder.h>
 #include <editors/ComponentEditor/common/ParameterCache.h>
+#include <editors/ComponentEditor/common/ParameterDependencyGraph.h>
 #include <editors/ComponentEditor/common/SystemVerilogExpressionParser.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
@@ -34,8 +35,8 @@
 //-----------------------------------------------------------------------------
 DocumentValidator::DocumentValidator(LibraryInterface* library) : library_(library),
     componentValidatorFinder_(new ParameterCache(QSharedPointer<Component>())),
-    componentValidator_(QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(componentValidatorFinder_)),
-    library_),
+    componentValidatorParser_(new IPXactSystemVerilogParser(componentValidatorFinder_)),
+    componentValidator_(componentValidatorParser_, library_),
     designValidatorFinder_(new ListParameterFinder()),
     designValidator_(QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(designValidatorFinder_)), library_),
     designConfigurationValidator_(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()), library_),
@@ -79,6 +80,18 @@ bool DocumentValidator::validate(QSharedPointer<Document> document)
         QSharedPointer<Component> currentComponent = document.dynamicCast<Component>();
         changeComponentValidatorParameterFinder(currentComponent);
 
+        ParameterDependencyGraph dependencyGraph(componentValidatorFinder_);
+        evaluateComponentParameters(dependencyGraph);
+
+        // The parallel tasks check all the sections at once, so the problems are found instead of stopping at the
+        // first invalid section.
+        if (componentValidator_.isParallelValidationEnabled())
+        {
+            QVector<ValidationDiagnostic> diagnostics;
+            componentValidator_.findDiagnosticsIn(diagnostics, currentComponent);
+            return hasErrors(diagnostics) == false;
+        }
+
         return componentValidator_.validate(currentComponent);
     }
     else if (documentType == VLNV::DESIGN)
@@ -124,6 +137,11 @@ void DocumentValidator::findErrorsIn(QSharedPointer<Document> document, QVector<
     {
         findErrorsInAbstractionDefinition(document.dynamicCast<AbstractionDefinition>(), errorList);
     }
+    else if (documentType == VLNV::CATALOG)
+    {
+        CatalogValidator validator;
+        validator.findErrorsIn(errorList, document.dynamicCast<Catalog>());
+    }
     else if (documentType == VLNV::COMPONENT)
     {
         findErrorsInComponent(document.dynamicCast<Component>(), errorList);
@@ -138,6 +156,117 @@ void DocumentValidator::findErrorsIn(QSharedPointer<Document> document, QVector<
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::findDiagnostics()
+//-----------------------------------------------------------------------------
+QVector<ValidationDiagnostic> DocumentValidator::findDiagnostics(QSharedPointer<Document> document)
+{
+    QVector<ValidationDiagnostic> diagnostics;
+
+    VLNV documentVLNV = document->getVlnv();
+    VLNV::IPXactType documentType = documentVLNV.getType();
+
+    // The same document types are rejected as in validate().
+    if (documentType == VLNV::GENERATORCHAIN || documentType == VLNV::ABSTRACTOR || documentType == VLNV::INVALID)
+    {
+        diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_ERROR, documentVLNV.toString(),
+            QObject::tr("Documents of type %1 are not supported.").arg(VLNV::IPXactType2String(documentType))));
+        return diagnostics;
+    }
+
+    if (documentType == VLNV::COMPONENT)
+    {
+        QSharedPointer<Component> component = document.dynamicCast<Component>();
+        changeComponentValidatorParameterFinder(component);
+
+        ParameterDependencyGraph dependencyGraph(componentValidatorFinder_);
+        evaluateComponentParameters(dependencyGraph);
+
+        componentValidator_.findDiagnosticsIn(diagnostics, component);
+        findParameterCyclesIn(diagnostics, component, dependencyGraph);
+    }
+    else if (documentType == VLNV::DESIGN)
+    {
+        QSharedPointer<Design> design = document.dynamicCast<Design>();
+        designValidatorFinder_->setParameterList(design->getParameters());
+        designValidator_.findDiagnosticsIn(diagnostics, design);
+    }
+    else if (documentType == VLNV::DESIGNCONFIGURATION)
+    {
+        QSharedPointer<DesignConfiguration> configuration = document.dynamicCast<DesignConfiguration>();
+        if (configuration->getImplementation() == KactusAttribute::SYSTEM)
+        {
+            systemDesignConfigurationValidator_.findDiagnosticsIn(diagnostics, configuration);
+        }
+        else
+        {
+            designConfigurationValidator_.findDiagnosticsIn(diagnostics, configuration);
+        }
+    }
+    else
+    {
+        // The definitions and catalogs are small, so their problems are reported for the whole document.
+        QVector<QString> errorList;
+        findErrorsIn(document, errorList);
+        ValidationDiagnostic::appendMessages(diagnostics, errorList, documentVLNV.toString(),
+            ValidationDiagnostic::SEVERITY_ERROR);
+    }
+
+    return diagnostics;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::hasErrors()
+//-----------------------------------------------------------------------------
+bool DocumentValidator::hasErrors(QVector<ValidationDiagnostic> const& diagnostics)
+{
+    for (ValidationDiagnostic const& diagnostic : diagnostics)
+    {
+        if (diagnostic.severity == ValidationDiagnostic::SEVERITY_ERROR)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::getMessages()
+//-----------------------------------------------------------------------------
+QVector<QString> DocumentValidator::getMessages(QVector<ValidationDiagnostic> const& diagnostics)
+{
+    QVector<QString> messages;
+    messages.reserve(diagnostics.size());
+
+    for (ValidationDiagnostic const& diagnostic : diagnostics)
+    {
+        messages.append(diagnostic.message);
+    }
+
+    return messages;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::setParallelComponentValidation()
+//-----------------------------------------------------------------------------
+void DocumentValidator::setParallelComponentValidation(bool enabled)
+{
+    if (enabled)
+    {
+        // The finder is changed to each validated component, so the parsers of the parallel tasks share it.
+        QSharedPointer<ComponentParameterFinder> finder = componentValidatorFinder_;
+        componentValidator_.setParallelValidation([finder]()
+        {
+            return QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(finder));
+        });
+    }
+    else
+    {
+        componentValidator_.setParallelValidation(ComponentValidator::ParserFactory());
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: DocumentValidator::changeComponentValidatorParameterFinder()
 //-----------------------------------------------------------------------------
@@ -146,6 +275,39 @@ void DocumentValidator::changeComponentValidatorParameterFinder(QSharedPointer<C
     componentValidatorFinder_->setComponent(targetComponent);
 }
 
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::evaluateComponentParameters()
+//-----------------------------------------------------------------------------
+void DocumentValidator::evaluateComponentParameters(ParameterDependencyGraph& dependencyGraph) const
+{
+    dependencyGraph.rebuild();
+
+    // The values are kept in the parser, so the section validators use them without evaluating them again.
+    dependencyGraph.evaluate(*componentValidatorParser_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentValidator::findParameterCyclesIn()
+//-----------------------------------------------------------------------------
+void DocumentValidator::findParameterCyclesIn(QVector<ValidationDiagnostic>& diagnostics,
+    QSharedPointer<Component> component, ParameterDependencyGraph const& dependencyGraph) const
+{
+    // The parameters in a cycle evaluate to x, which is accepted in untyped values, so a cycle is only a warning.
+    QString parametersPath = component->getVlnv().toString() + QLatin1String("/parameters");
+    for (QStringList const& cycle : dependencyGraph.findCycles())
+    {
+        QStringList cycleNames;
+        for (QString const& parameterId : cycle)
+        {
+            cycleNames.append(componentValidatorFinder_->nameForId(parameterId));
+        }
+
+        diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_WARNING, parametersPath,
+            QObject::tr("Parameters %1 reference each other within component %2.").arg(
+            cycleNames.join(QLatin1String(" -> ")), component->getVlnv().toString())));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: DocumentValidator::findErrorsInBusDefinition()
 //-----------------------------------------------------------------------------
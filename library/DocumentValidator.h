@@ -20,6 +20,7 @@
 #include <IPXACTmodels/Design/validator/DesignValidator.h>
 #include <IPXACTmodels/designConfiguration/validators/DesignConfigurationValidator.h>
 #include <IPXACTmodels/kactusExtensions/validators/SystemDesignConfigurationValidator.h>
+#include <IPXACTmodels/common/validators/ValidationDiagnostic.h>
 
 class Document;
 class AbstractionDefinition;
@@ -29,8 +30,10 @@ class Component;
 class ComponentParameterFinder;
 class Design;
 class DesignConfiguration;
+class IPXactSystemVerilogParser;
 class LibraryInterface;
 class ListParameterFinder;
+class ParameterDependencyGraph;
 
 class DocumentValidator 
 {
@@ -42,10 +45,53 @@ public:
     //! The destructor.
     ~DocumentValidator();
 
+    /*!
+     *  Checks if the given document is valid. The check stops at the first error found, so it should be used
+     *  when only the validity is needed.
+     *
+     *      @param [in] document    The document to check.
+     *
+     *      @return True, if the document is valid, otherwise false.
+     */
     bool validate(QSharedPointer<Document> document);
 
     void findErrorsIn(QSharedPointer<Document> document, QVector<QString>& errorList);
 
+    /*!
+     *  Finds all the problems in the given document in a single pass. The validity of the document is derived
+     *  from the found problems, so the document need not be validated separately.
+     *
+     *      @param [in] document    The document to check.
+     *
+     *      @return The problems found in the document.
+     */
+    QVector<ValidationDiagnostic> findDiagnostics(QSharedPointer<Document> document);
+
+    /*!
+     *  Checks if the given problems make a document invalid.
+     *
+     *      @param [in] diagnostics     The problems found in the document.
+     *
+     *      @return True, if any of the problems is an error, otherwise false.
+     */
+    static bool hasErrors(QVector<ValidationDiagnostic> const& diagnostics);
+
+    /*!
+     *  Get the descriptions of the given problems.
+     *
+     *      @param [in] diagnostics     The problems to describe.
+     *
+     *      @return The descriptions of the problems.
+     */
+    static QVector<QString> getMessages(QVector<ValidationDiagnostic> const& diagnostics);
+
+    /*!
+     *  Sets the sections of the components to be validated in parallel when finding errors.
+     *
+     *      @param [in] enabled     True for parallel validation, false for validation in sequence.
+     */
+    void setParallelComponentValidation(bool enabled);
+
    
 private:
 
@@ -60,6 +106,24 @@ private:
      */
     void changeComponentValidatorParameterFinder(QSharedPointer<Component> targetComponent);
 
+    /*!
+     *  Builds the dependency graph of the component parameters and evaluates the parameters in the order of
+     *  their references for the component validator.
+     *
+     *      @param [in] dependencyGraph     The graph using the component validator parameter finder.
+     */
+    void evaluateComponentParameters(ParameterDependencyGraph& dependencyGraph) const;
+
+    /*!
+     *  Finds the reference cycles between the parameters of a component and reports each with its full path.
+     *
+     *      @param [out] diagnostics        The list to add the found cycles to.
+     *      @param [in]  component          The component whose parameters are checked.
+     *      @param [in]  dependencyGraph    The dependency graph of the component parameters.
+     */
+    void findParameterCyclesIn(QVector<ValidationDiagnostic>& diagnostics, QSharedPointer<Component> component,
+        ParameterDependencyGraph const& dependencyGraph) const;
+
 
   /*!
      *  Finds any errors within a given bus definition document.
@@ -111,6 +175,9 @@ private:
      //! The parameter finder used in the component validator.
      QSharedPointer<ComponentParameterFinder> componentValidatorFinder_;
 
+     //! The parser used in the component validator.
+     QSharedPointer<IPXactSystemVerilogParser> componentValidatorParser_;
+
      //! The used component validator.
      ComponentValidator componentValidator_;
 
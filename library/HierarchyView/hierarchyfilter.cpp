@@ -100,7 +100,13 @@ bool HierarchyFilter::filterAcceptsRow(int sourceRow, QModelIndex const& sourceP
         }
     }
 
-    QSharedPointer<Component const> component = item->component();
+    // The component is read only if its attributes are filtered, so unexpanded items stay unread.
+    QSharedPointer<Component const> component;
+    if (itemType == HierarchyItem::COMPONENT && hasComponentFilters())
+    {
+        component = item->component();
+    }
+
     if (component)
     {
         // check the filters
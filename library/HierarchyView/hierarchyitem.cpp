@@ -28,20 +28,20 @@ HierarchyItem::HierarchyItem(LibraryInterface* handler, HierarchyItem* parent,
     VLNV const& vlnv, KactusAttribute::Implementation implementation, QString const& viewName):
 QObject(parent),
     component_(),
-    busDef_(),
-    absDef_(),
-    comDef_(),
-    apiDef_(),
     design_(),
     catalog_(),
     library_(handler),
     childItems_(),
     parentItem_(parent),
+    vlnv_(vlnv),
     isValid_(true),
     isDuplicate_(false),
+    childrenFetched_(false),
+    childrenPublished_(false),
+    expectedChildren_(-1),
     type_(HierarchyItem::ROOT),
     instanceCount_(),
-    viewName_()
+    viewName_(viewName)
 {
     Q_ASSERT_X(handler, "HierarchyItem constructor", "Null LibraryInterface pointer given as parameter");
     Q_ASSERT_X(parent, "HierarchyItem constructor", "Null parent pointer given as parameter");
@@ -53,34 +53,46 @@ QObject(parent),
 
     Q_ASSERT(handler->contains(vlnv));
 
+    // Only the type and validity are resolved here, the document is read when its details are needed.
     VLNV::IPXactType documentType = library_->getDocumentType(vlnv);
+    vlnv_.setType(documentType);
+    isValid_ = library_->isValid(vlnv);
+
     if (documentType == VLNV::COMPONENT)
     {
-        parseComponent(vlnv);
+        type_ = HierarchyItem::COMPONENT;
     }
     else if (documentType == VLNV::CATALOG)
     {
-        parseCatalog(vlnv);
+        type_ = HierarchyItem::CATALOG;
     }
     else if (documentType == VLNV::BUSDEFINITION)
     {
-        parseBusDefinition(vlnv);
+        type_ = HierarchyItem::BUSDEFINITION;
     }
     else if (documentType == VLNV::ABSTRACTIONDEFINITION)
     {
-        parseAbsDefinition(vlnv);
+        type_ = HierarchyItem::ABSDEFINITION;
     }
     else if (documentType == VLNV::COMDEFINITION)
     {
-        parseComDefinition(vlnv);
+        type_ = HierarchyItem::COMDEFINITION;
     }
     else if (documentType == VLNV::APIDEFINITION)
     {
-        parseApiDefinition(vlnv);
+        type_ = HierarchyItem::APIDEFINITION;
+    }
+    else if (documentType == VLNV::DESIGN && implementation == KactusAttribute::HW)
+    {
+        type_ = HierarchyItem::HW_DESIGN;
+    }
+    else if (documentType == VLNV::DESIGN && implementation == KactusAttribute::SW)
+    {
+        type_ = HierarchyItem::SW_DESIGN;
     }
-    else if (documentType == VLNV::DESIGN)
+    else if (documentType == VLNV::DESIGN && implementation == KactusAttribute::SYSTEM)
     {
-        parseDesign(vlnv, implementation, viewName);
+        type_ = HierarchyItem::SYS_DESIGN;
     }
     else
     {
@@ -95,17 +107,17 @@ QObject(parent),
 HierarchyItem::HierarchyItem(LibraryInterface* handler, QObject* parent ):
 QObject(parent),
     component_(),
-    busDef_(),
-    absDef_(),
-    comDef_(),
-    apiDef_(),
     design_(),
     catalog_(),
     library_(handler),
     childItems_(),
     parentItem_(NULL),
+    vlnv_(),
     isValid_(true),
     isDuplicate_(false),
+    childrenFetched_(true),
+    childrenPublished_(true),
+    expectedChildren_(-1),
     type_(HierarchyItem::ROOT),
     instanceCount_(),
     viewName_()
@@ -124,7 +136,8 @@ HierarchyItem::~HierarchyItem()
 //-----------------------------------------------------------------------------
 void HierarchyItem::createChild(VLNV const& vlnv)
 {
-	if (hasChild(vlnv) || !library_->contains(vlnv))
+    // The children of the root are unique library VLNVs, so the linear duplicate search is skipped for them.
+	if ((parentItem_ && hasChild(vlnv)) || !library_->contains(vlnv))
     {
 		return;
 	}
@@ -133,49 +146,67 @@ void HierarchyItem::createChild(VLNV const& vlnv)
 }
 
 //-----------------------------------------------------------------------------
-// Function: HierarchyItem::parent()
+// Function: HierarchyItem::canFetchChildren()
 //-----------------------------------------------------------------------------
-HierarchyItem* HierarchyItem::parent() const
+bool HierarchyItem::canFetchChildren() const
 {
-    return parentItem_;
+    return !childrenFetched_;
 }
 
 //-----------------------------------------------------------------------------
-// Function: HierarchyItem::getVLNV()
+// Function: HierarchyItem::fetchChildren()
 //-----------------------------------------------------------------------------
-VLNV HierarchyItem::getVLNV() const
+int HierarchyItem::fetchChildren()
 {
-	if (type_ == HierarchyItem::COMPONENT && component_)
+    if (childrenFetched_)
     {
-		return component_->getVlnv();
-	}
-    if (type_ == HierarchyItem::CATALOG && catalog_)
-    {
-        return catalog_->getVlnv();
+        return 0;
     }
-	else if (type_ == HierarchyItem::BUSDEFINITION && busDef_)
-    {
-		return busDef_->getVlnv();
-	}
-	else if (type_ == HierarchyItem::ABSDEFINITION && absDef_)
+
+    childrenFetched_ = true;
+
+    if (type_ == HierarchyItem::COMPONENT)
     {
-		return absDef_->getVlnv();
-	}
-	else if (type_ == HierarchyItem::COMDEFINITION && comDef_)
+        parseComponent();
+    }
+    else if (type_ == HierarchyItem::CATALOG)
     {
-        return comDef_->getVlnv();
-	}
-	else if (type_ == HierarchyItem::APIDEFINITION && apiDef_)
+        parseCatalog();
+    }
+    else if (type_ == HierarchyItem::BUSDEFINITION)
     {
-        return apiDef_->getVlnv();
-	}
-	else if ((type_ == HierarchyItem::HW_DESIGN || type_ == HierarchyItem::SW_DESIGN ||
-		type_ == HierarchyItem::SYS_DESIGN) && design_)
+        parseBusDefinition();
+    }
+    else if (isDesign())
     {
-		return design_->getVlnv();
-	}
+        parseDesign();
+    }
+
+    return childItems_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::publishChildren()
+//-----------------------------------------------------------------------------
+void HierarchyItem::publishChildren()
+{
+    childrenPublished_ = childrenFetched_;
+}
 
-	return VLNV();
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::parent()
+//-----------------------------------------------------------------------------
+HierarchyItem* HierarchyItem::parent() const
+{
+    return parentItem_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::getVLNV()
+//-----------------------------------------------------------------------------
+VLNV HierarchyItem::getVLNV() const
+{
+	return vlnv_;
 }
 
 //-----------------------------------------------------------------------------
@@ -183,7 +214,7 @@ VLNV HierarchyItem::getVLNV() const
 //-----------------------------------------------------------------------------
 HierarchyItem* HierarchyItem::child(int index) const
 {
-	if (0 <= index && index < childItems_.size())
+	if (childrenPublished_ && 0 <= index && index < childItems_.size())
     {
 		return childItems_[index];
     }
@@ -209,6 +240,11 @@ int HierarchyItem::row()
 //-----------------------------------------------------------------------------
 int HierarchyItem::getNumberOfChildren() const
 {
+    if (!childrenPublished_)
+    {
+        return 0;
+    }
+
 	return childItems_.size();
 }
 
@@ -225,7 +261,20 @@ int HierarchyItem::getIndexOf(HierarchyItem* item)
 //-----------------------------------------------------------------------------
 bool HierarchyItem::hasChildren() const
 {
-	return !childItems_.isEmpty();
+    if (childrenFetched_)
+    {
+	    return !childItems_.isEmpty();
+    }
+
+    if (expectedChildren_ == -1)
+    {
+        // Catalogs list all kinds of documents, so they are assumed to have children until fetched.
+        expectedChildren_ = (type_ == HierarchyItem::CATALOG ||
+            ((type_ == HierarchyItem::COMPONENT || type_ == HierarchyItem::BUSDEFINITION || isDesign()) &&
+            library_->hasChildren(vlnv_))) ? 1 : 0;
+    }
+
+    return expectedChildren_ == 1;
 }
 
 //-----------------------------------------------------------------------------
@@ -245,133 +294,18 @@ void HierarchyItem::setValidity(bool valid)
 }
 
 //-----------------------------------------------------------------------------
-// Function: HierarchyItem::contains()
+// Function: HierarchyItem::component()
 //-----------------------------------------------------------------------------
-bool HierarchyItem::contains(VLNV const& vlnv) const
+QSharedPointer<Component const> HierarchyItem::component() const
 {
-	if (component_ && component_->getVlnv() == vlnv)
-    {
-		return true;
-    }
-
-    else if (catalog_ && catalog_->getVlnv() == vlnv)
-    {
-        return true;
-    }
-
-	else if (busDef_ && busDef_->getVlnv() == vlnv)
-    {
-		return true;
-    }
-	
-	else if (absDef_ && absDef_->getVlnv() == vlnv)
-    {
-		return true;
-    }
-    
-    else if (comDef_ && comDef_->getVlnv() == vlnv)
-    {
-        return true;
-    }
-
-    else if (apiDef_ && apiDef_->getVlnv() == vlnv)
+    if (type_ == HierarchyItem::COMPONENT && !component_)
     {
-        return true;
+        component_ = library_->getModelReadOnly<Component>(vlnv_);
     }
 
-	foreach (HierarchyItem* item, childItems_)
-    {
-		if (item->contains(vlnv))
-        {
-			return true;
-        }
-	}
-	return false;
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::cleanUp()
-//-----------------------------------------------------------------------------
-void HierarchyItem::cleanUp()
-{
-	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::cleanUp", "Function was called for non-root item");
-
-	foreach (HierarchyItem* item, childItems_)
-    {
-		VLNV vlnv = item->getVLNV();
-
-		foreach (HierarchyItem* item2, childItems_)
-        {			
-			// if item is not the same but contains the other one and the other is not yet on the list to be removed
-			if (item != item2 && item2->contains(vlnv))
-            {				
-				item->setDuplicate(true);
-				break;
-			}
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::component()
-//-----------------------------------------------------------------------------
-QSharedPointer<Component const> HierarchyItem::component() const
-{
 	return component_;
 }
 
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::referenceCount()
-//-----------------------------------------------------------------------------
-int HierarchyItem::referenceCount(VLNV const& vlnv) const
-{
-	int count = 0;
-
-	// add the reference count of all child items.
-	foreach (HierarchyItem* item, childItems_)
-    {		
-		// if item itself matches the vlnv and this item is not the root.
-		// root must be excluded because it has all items as it's children so 
-		// the real count does not include direct children of root
-		if (parentItem_ && item->getVLNV() == vlnv)
-        {
-			count++;
-        }
-		else
-        {
-			count += item->referenceCount(vlnv);
-        }
-	}
-
-	return count;
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::getOwners()
-//-----------------------------------------------------------------------------
-int HierarchyItem::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
-{
-	foreach (HierarchyItem* item, childItems_)
-    {	
-		// if item itself matches the vlnv and this item is not the root.
-		// root must be excluded because it has all items as it's children so 
-		// the real count does not include direct children of root
-		// also make sure the vlnvs are appended only once
-		if (parentItem_ && item->getVLNV() == vlnvToSearch && !list.contains(getVLNV()))
-        {
-			list.append(getVLNV());
-        }
-		// tell item to search it's children
-		else
-        {
-			item->getOwners(list, vlnvToSearch);
-        }
-	}
-
-	return list.size();
-}
-
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::removeItems()
 //-----------------------------------------------------------------------------
@@ -541,15 +475,16 @@ void HierarchyItem::clear()
 //-----------------------------------------------------------------------------
 bool HierarchyItem::isHierarchical() const
 {
-	Q_ASSERT(component_);
+    QSharedPointer<Component const> itemComponent = component();
+	Q_ASSERT(itemComponent);
 
-    if (component_->getImplementation() == KactusAttribute::SW)
+    if (itemComponent->getImplementation() == KactusAttribute::SW)
     {
-        return component_->hasViews();
+        return itemComponent->hasViews();
     }
     else
     {
-	    return component_->isHierarchical();
+	    return itemComponent->isHierarchical();
     }
 }
 
@@ -558,8 +493,9 @@ bool HierarchyItem::isHierarchical() const
 //-----------------------------------------------------------------------------
 KactusAttribute::Implementation HierarchyItem::getImplementation() const
 {
-    Q_ASSERT(component_);
-    return component_->getImplementation();
+    QSharedPointer<Component const> itemComponent = component();
+    Q_ASSERT(itemComponent);
+    return itemComponent->getImplementation();
 }
 
 //-----------------------------------------------------------------------------
@@ -570,46 +506,6 @@ HierarchyItem::ObjectType HierarchyItem::type() const
 	return type_;
 }
 
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::getChildren()
-//-----------------------------------------------------------------------------
-void HierarchyItem::getChildren(QList<VLNV>& childList, VLNV const& owner)
-{
-	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::getChildren", "Function was called for non-root item");
-
-	// search each child item
-	foreach (HierarchyItem* item, childItems_)
-    {
-		// if child matches the owner
-		if (item->getVLNV() == owner)
-        {
-			// ask child to append it's children
-			item->getChildItems(childList);
-			break;
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::getChildItems()
-//-----------------------------------------------------------------------------
-void HierarchyItem::getChildItems(QList<VLNV>& itemList)
-{
-	// go through each child item
-	foreach (HierarchyItem* item, childItems_)
-    {
-		// if child's vlnv is not yet on the list
-		if (!itemList.contains(item->getVLNV()))
-        {
-			itemList.append(item->getVLNV());
-        }
-
-		// ask child to add its' children
-		item->getChildItems(itemList);
-	}
-}
-
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::instanceCount()
 //-----------------------------------------------------------------------------
@@ -660,14 +556,11 @@ bool HierarchyItem::hasChild(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parseComponent()
 //-----------------------------------------------------------------------------
-void HierarchyItem::parseComponent(VLNV const& vlnv)
+void HierarchyItem::parseComponent()
 {
-    type_ = HierarchyItem::COMPONENT;
-    component_ = library_->getModelReadOnly<Component>(vlnv);
+    component();
     Q_ASSERT(component_);
 
-    isValid_ = library_->isValid(vlnv);
-
     foreach (QSharedPointer<View> view, *component_->getViews())
     {
         if (view->isHierarchical())
@@ -681,14 +574,11 @@ void HierarchyItem::parseComponent(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parseCatalog()
 //-----------------------------------------------------------------------------
-void HierarchyItem::parseCatalog(VLNV const& vlnv)
+void HierarchyItem::parseCatalog()
 {
-    type_ = HierarchyItem::CATALOG;
-    catalog_ = library_->getModelReadOnly<Catalog>(vlnv);
+    catalog_ = library_->getModelReadOnly<Catalog>(vlnv_);
     Q_ASSERT(catalog_);
 
-    isValid_ = library_->isValid(vlnv);
-
     foreach (QSharedPointer<IpxactFile> catalogFile, *catalog_->getCatalogs())
     {
         if (!hasParent(catalogFile->getVlnv())) //<! Avoid cyclic instantiations.
@@ -799,75 +689,27 @@ void HierarchyItem::createChildItemForDesign(VLNV const& designVLNV, QString con
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parseBusDefinition()
 //-----------------------------------------------------------------------------
-void HierarchyItem::parseBusDefinition(VLNV const& vlnv)
-{
-    type_ = HierarchyItem::BUSDEFINITION;
-    busDef_ = library_->getModelReadOnly<BusDefinition>(vlnv);
-
-    isValid_ = library_->isValid(vlnv);
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::parseAbsDefinition()
-//-----------------------------------------------------------------------------
-void HierarchyItem::parseAbsDefinition(VLNV const& vlnv)
-{
-    type_ = HierarchyItem::ABSDEFINITION;
-    absDef_ = library_->getModelReadOnly<AbstractionDefinition>(vlnv);
-
-    isValid_ = library_->isValid(vlnv);
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::parseComDefinition()
-//-----------------------------------------------------------------------------
-void HierarchyItem::parseComDefinition(VLNV const& vlnv)
+void HierarchyItem::parseBusDefinition()
 {
-    type_ = HierarchyItem::COMDEFINITION;
-    comDef_ = library_->getModelReadOnly<ComDefinition>(vlnv);
+    // The abstraction definitions referencing the bus are found without reading them.
+    QList<VLNV> abstractionVLNVs;
+    library_->getChildren(abstractionVLNVs, vlnv_);
 
-    isValid_ = library_->isValid(vlnv);
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyItem::parseApiDefinition()
-//-----------------------------------------------------------------------------
-void HierarchyItem::parseApiDefinition(VLNV const& vlnv)
-{
-    type_ = HierarchyItem::APIDEFINITION;
-    apiDef_ = library_->getModelReadOnly<ApiDefinition>(vlnv);
-
-    isValid_ = library_->isValid(vlnv);
+    foreach (VLNV const& abstractionVLNV, abstractionVLNVs)
+    {
+        createChild(abstractionVLNV);
+    }
 }
 
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parseDesign()
 //-----------------------------------------------------------------------------
-void HierarchyItem::parseDesign(VLNV const& vlnv, KactusAttribute::Implementation implementation,
-    QString const& viewName)
+void HierarchyItem::parseDesign()
 {
     instanceCount_.clear();
 
-    viewName_ = viewName;
-    design_ = library_->getModelReadOnly<Design>(vlnv);
-    isValid_ = library_->isValid(vlnv);
-
-    if (implementation == KactusAttribute::HW)
-    {
-        type_ = HierarchyItem::HW_DESIGN;
-    }
-    else if (implementation == KactusAttribute::SW)
-    {
-        type_ = HierarchyItem::SW_DESIGN;
-    }
-    else if (implementation == KactusAttribute::SYSTEM)
-    {
-        type_ = HierarchyItem::SYS_DESIGN;
-    }
-    else
-    {
-        Q_ASSERT(false);
-    }
+    design_ = library_->getModelReadOnly<Design>(vlnv_);
+    Q_ASSERT(design_);
 
     // Take all valid components referenced by the design.
     QVector<VLNV> componentReferences = getValidComponentsInDesign();
@@ -918,6 +760,15 @@ QVector<VLNV> HierarchyItem::getValidComponentsInDesign()
     return componentReferences;
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::isDesign()
+//-----------------------------------------------------------------------------
+bool HierarchyItem::isDesign() const
+{
+    return type_ == HierarchyItem::HW_DESIGN || type_ == HierarchyItem::SW_DESIGN ||
+        type_ == HierarchyItem::SYS_DESIGN;
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::isValidComponentInstanceVLNV()
 //-----------------------------------------------------------------------------
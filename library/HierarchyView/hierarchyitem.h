@@ -55,6 +55,8 @@ public:
 	};
 
 	/*! The constructor
+	 *
+	 * The document of the item is not read until its details or children are needed.
 	 *
 	 *      @param [in] handler         The instance that manages the library.
 	 *      @param [in] parent          The owner of this object.
@@ -86,6 +88,24 @@ public:
 	 */
 	void createChild(const VLNV& vlnv);
 
+	/*! Check if the child items have not been created yet.
+	 *
+	 *      @return True if the children can be fetched.
+	*/
+	bool canFetchChildren() const;
+
+	/*! Create the child items by reading the document of this item.
+	 * 
+	 * The created children are not reported by getNumberOfChildren() and child() until publishChildren()
+	 * is called, so the model can announce them before they become visible.
+	 *
+	 *      @return The number of created children.
+	*/
+	int fetchChildren();
+
+	//! Makes the children created by fetchChildren() visible.
+	void publishChildren();
+
 
 	/*! Get the parent of this item.
 	 *
@@ -131,7 +151,9 @@ public:
 
 	/*! Check if this item has children or not.
 	 *
-	 *      @return True if at least one child item exists.
+	 * Before the children are fetched, the answer is based on the references known by the library.
+	 *
+	 *      @return True if at least one child item exists or can be fetched.
 	*/
 	bool hasChildren() const;
 
@@ -148,51 +170,12 @@ public:
 	*/
 	void setValidity(bool valid);
 
-	/*! Checks if the component or one of it's sub-components contains the vlnv.
-	 *
-	 *      @param [in] vlnv The vlnv that is searched in hierarchy.
-	 *
-	 *      @return bool True if the vlnv is found.
-	*/
-	bool contains(const VLNV& vlnv) const;
-
-	/*! Removes the child items that are contained in one or several other components.
-	 * 
-	 * Note: This function should be called only for the root item.
-	 *
-	 *      @return void
-	*/
-	void cleanUp();
-	
-	/*! Get pointer to the component that this item represents
+	/*! Get pointer to the component that this item represents. The component is read on the first call.
 	 *
 	 *      @return QSharedPointer<Component> The component model.
 	*/
 	QSharedPointer<Component const> component() const;
 
-	/*! Count how many instances of given vlnv is found under this item.
-	 *
-	 * This function does not check if the same owner is counted multiple times
-	 * if same sub-component is instantiated in several components. If count that 
-	 * contains only unique owners then you should use getOwners().
-	 * 
-	 *      @param [in] vlnv Identifies the component that's instances are searched.
-	 *
-	 *      @return Number of found instances.
-	*/
-	int referenceCount(const VLNV& vlnv) const;
-
-	/*! Get list of objects that have instantiated the given vlnv.
-	 *
-	 * This function makes sure each owner is appended to the list only once.
-	 *
-	 *      @param [out] list QList where owner vlnvs is appended.
-	 *      @param [in] vlnvToSearch The vlnv to that's parents are wanted.
-	 * 
-	 *      @return Number of unique owners found.
-	*/
-	int getOwners(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
-
 	/*! Remove the child items with given vlnv.
 	 *
 	 *      @param [in] vlnv Identifies the items to remove.
@@ -284,23 +267,6 @@ public:
 	*/
 	ObjectType type() const;
 
-	/*! Get the child items of given object.
-	 * 
-	 * This function must only be called to the root item.
-	 * 
-	 *      @param [in] childList The list where the vlnvs of the children are appended.
-	 *      @param [in] owner Identifies the object that's children are searched.
-	 *
-	*/
-	void getChildren(QList<VLNV>& childList, const VLNV& owner);
-
-	/*! Get the vlnvs of the items that are this item's children.
-	 *
-	 *      @param [in] itemList The list where the vlnvs are appended to.
-	 *
-	*/
-	void getChildItems(QList<VLNV>& itemList);
-
 	/*! Count how many times this component has been instantiated in a containing design.
 	 * 
 	 * For items that are not components this function returns -1
@@ -350,14 +316,11 @@ private:
 	*/
 	bool hasChild(const VLNV& vlnv);
 
-	/*! Parse this hierarchy item to match a component
-	 *
-	 *      @param [in] vlnv The vlnv of the component.
-	 *
-	*/
-	void parseComponent(const VLNV& vlnv);
+	//! Creates the design children of a component item.
+	void parseComponent();
 
-    void parseCatalog(VLNV const& vlnv);
+    //! Creates the children of a catalog item.
+    void parseCatalog();
 
     /*!
      *  Finds the referenced design in a component view.
@@ -378,39 +341,17 @@ private:
     void createChildItemForDesign(VLNV const& designVLNV,
         QString const& viewName);
 
-	/*! Parse this hierarchy item to match a bus definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the bus definition.
-	 *
-	*/
-	void parseBusDefinition(const VLNV& vlnv);
-
-	/*! Parse this hierarchy item to match an abstraction definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the abstraction definition.
-	 *
-	*/
-	void parseAbsDefinition(const VLNV& vlnv);
-
-    /*! Parse this hierarchy item to match a COM definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the COM definition.
-	 *
-	*/
-	void parseComDefinition(const VLNV& vlnv);
+	//! Creates the abstraction definition children of a bus definition item.
+	void parseBusDefinition();
 
-    /*! Parse this hierarchy item to match an API definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the API definition.
-	 *
-	*/
-	void parseApiDefinition(const VLNV& vlnv);
+	//! Creates the component children of a design item.
+	void parseDesign();
 
-	/*! Parse this hierarchy item to match a design.
+	/*! Check if this item is a design.
 	 *
-	 *      @param [in] vlnv The vlnv of the design.
+	 *      @return True if the item is a HW, SW or system design.
 	*/
-	void parseDesign(const VLNV& vlnv, KactusAttribute::Implementation implementation, QString const& viewName);
+	bool isDesign() const;
 
     /*!
      *  Finds the valid component references in a design item.
@@ -432,20 +373,8 @@ private:
     // Data.
     //-----------------------------------------------------------------------------
 
-	//! The component that this hierarhcyItem represents.
-	QSharedPointer<Component const> component_;
-
-	//! The bus definition that this hierarchyItem represents.
-	QSharedPointer<BusDefinition const> busDef_;
-
-	//! The abstraction definition that this hierarchyItem represents.
-	QSharedPointer<AbstractionDefinition const> absDef_;
-
-    //! The COM definition that this hierarchyItem represents.
-    QSharedPointer<ComDefinition const> comDef_;
-
-    //! The API definition that this hierarchyItem represents.
-    QSharedPointer<ApiDefinition const> apiDef_;
+	//! The component that this hierarhcyItem represents, once read.
+	mutable QSharedPointer<Component const> component_;
 
 	//! The design that this hierarchyItem represents.
 	QSharedPointer<Design const> design_;
@@ -462,12 +391,24 @@ private:
 	//! The parent of this item.
 	HierarchyItem* parentItem_;
 
+	//! The VLNV of the document this item represents.
+	VLNV vlnv_;
+
 	//! Specifies the validity of this item.
 	bool isValid_;
 
 	//! Contains info that tell is this item is contained in some item as child.
 	bool isDuplicate_;
 
+	//! True, once the child items have been created.
+	bool childrenFetched_;
+
+	//! True, once the created child items are visible to the model.
+	bool childrenPublished_;
+
+	//! Cached result of hasChildren() before the children are fetched: -1 unknown, 0 no, 1 yes.
+	mutable int expectedChildren_;
+
 	//! Defines the type of this hierarchy item.
 	ObjectType type_;
 
@@ -44,15 +44,19 @@ void HierarchyModel::onResetModel()
 
     rootItem_->clear();
 
-    QVector<VLNV> absDefs;
-
-    // add all items to this model
+    // Items are created without reading their documents. The children are created when an item is expanded.
+    QMap<VLNV, bool> abstractionsUnderBus;
     foreach (VLNV const& itemVlnv, handler_->getAllVLNVs())
     {
         VLNV::IPXactType documentType = handler_->getDocumentType(itemVlnv);
-        if (documentType == VLNV::ABSTRACTIONDEFINITION)
+        if (documentType == VLNV::BUSDEFINITION)
         {
-            absDefs.append(itemVlnv);
+            QList<VLNV> abstractionVLNVs;
+            handler_->getChildren(abstractionVLNVs, itemVlnv);
+            for (VLNV const& abstractionVLNV : abstractionVLNVs)
+            {
+                abstractionsUnderBus.insert(abstractionVLNV, true);
+            }
         }
 
         //! Add supported item types only. Designs and configurations will be created by their top-components.
@@ -64,21 +68,17 @@ void HierarchyModel::onResetModel()
         }
     }
 
-    // create the abstraction definitions
-    for (VLNV const& absDefVlnv : absDefs) 
+    // Mark the duplicates, i.e. the items also shown under another item.
+    for (int i = 0; i < rootItem_->getNumberOfChildren(); ++i)
     {
-    	QSharedPointer<AbstractionDefinition const> absDef = 
-            handler_->getModelReadOnly(absDefVlnv).staticCast<AbstractionDefinition const>();
-
-        foreach (HierarchyItem* busDefItem, rootItem_->findItems(absDef->getBusType()))
+        HierarchyItem* item = rootItem_->child(i);
+        VLNV itemVLNV = item->getVLNV();
+        if (abstractionsUnderBus.contains(itemVLNV) || isContainedInHierarchy(itemVLNV))
         {
-    		busDefItem->createChild(absDefVlnv);
+            item->setDuplicate(true);
         }
     }
 
-    // Remove the duplicates.
-    rootItem_->cleanUp();
-
     endResetModel();
 }
 
@@ -387,6 +387,49 @@ bool HierarchyModel::hasChildren(QModelIndex const& parent) const
     return parentItem->hasChildren();
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::canFetchMore()
+//-----------------------------------------------------------------------------
+bool HierarchyModel::canFetchMore(QModelIndex const& parent) const
+{
+    if (!parent.isValid() || parent.column() > 0)
+    {
+        return false;
+    }
+
+    HierarchyItem* parentItem = static_cast<HierarchyItem*>(parent.internalPointer());
+    return parentItem->canFetchChildren();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::fetchMore()
+//-----------------------------------------------------------------------------
+void HierarchyModel::fetchMore(QModelIndex const& parent)
+{
+    if (!canFetchMore(parent))
+    {
+        return;
+    }
+
+    HierarchyItem* parentItem = static_cast<HierarchyItem*>(parent.internalPointer());
+
+    // The children are created first to know their count, but become visible only after being announced.
+    int childCount = parentItem->fetchChildren();
+    if (childCount > 0)
+    {
+        beginInsertRows(parent, 0, childCount - 1);
+        parentItem->publishChildren();
+        endInsertRows();
+    }
+    else
+    {
+        parentItem->publishChildren();
+    }
+
+    // Reading the document may have revealed invalid references.
+    emit dataChanged(parent, parent.sibling(parent.row(), HierarchyModel::COLUMN_COUNT - 1));
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyModel::flags()
 //-----------------------------------------------------------------------------
@@ -697,14 +740,6 @@ void HierarchyModel::onRemoveVLNV(VLNV const& vlnv)
     endResetModel();
 }
 
-//-----------------------------------------------------------------------------
-// Function: HierarchyModel::referenceCount()
-//-----------------------------------------------------------------------------
-int HierarchyModel::referenceCount(VLNV const& vlnv) const
-{
-    return rootItem_->referenceCount(vlnv);
-}
-
 //-----------------------------------------------------------------------------
 // Function: HierarchyModel::onDocumentUpdated()
 //-----------------------------------------------------------------------------
@@ -717,23 +752,6 @@ void HierarchyModel::onDocumentUpdated(VLNV const& vlnv)
     }
 }
 
-//-----------------------------------------------------------------------------
-// Function: HierarchyModel::getOwners()
-//-----------------------------------------------------------------------------
-int HierarchyModel::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
-{
-    rootItem_->getOwners(list, vlnvToSearch);
-    return list.size();
-}
-
-//-----------------------------------------------------------------------------
-// Function: HierarchyModel::getChildren()
-//-----------------------------------------------------------------------------
-void HierarchyModel::getChildren(QList<VLNV>& childList, VLNV const& owner)
-{
-    rootItem_->getChildren(childList, owner);
-}
-
 //-----------------------------------------------------------------------------
 // Function: HierarchyModel::onShowErrors()
 //-----------------------------------------------------------------------------
@@ -749,3 +767,13 @@ void HierarchyModel::onShowErrors(QModelIndex const& index)
 
     emit showErrors(vlnv);
 }
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::isContainedInHierarchy()
+//-----------------------------------------------------------------------------
+bool HierarchyModel::isContainedInHierarchy(VLNV const& vlnv) const
+{
+    // The owners are the catalogs listing the item and the components instantiating it in their designs.
+    QList<VLNV> owners;
+    return handler_->getOwners(owners, vlnv) > 0;
+}
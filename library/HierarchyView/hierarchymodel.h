@@ -109,6 +109,20 @@ public:
     */
     virtual bool hasChildren(QModelIndex const& parent = QModelIndex()) const;
 
+    /*! Checks if the children of the specified item have not been created yet.
+     *
+     *      @param [in] parent Model index identifying the object that's children are asked.
+     *
+     *      @return True if the children can be fetched.
+    */
+    virtual bool canFetchMore(QModelIndex const& parent) const;
+
+    /*! Creates the children of the specified item by reading its document.
+     *
+     *      @param [in] parent Model index identifying the object that's children are fetched.
+    */
+    virtual void fetchMore(QModelIndex const& parent);
+
     /*! Get the flags that identify possible methods for given object.
      *
      *      @param [in] index Model index identifying the object that's flags are requested.
@@ -125,30 +139,6 @@ public:
     */
     QModelIndex index(HierarchyItem* item) const;
 
-    /*! Count how many times the given component is instantiated in the library.
-     * 
-     * This function does not check if the same owner is counted multiple times
-     * if same sub-component is instantiated in several components. If count that 
-     * contains only unique owners then you should use getOwners().
-     * 
-     *      @param [in] vlnv Identifies the component that's instances are searched.
-     *
-     *      @return Number of found instances.
-     */
-    int referenceCount(VLNV const& vlnv) const;
-
-    /*! Get the components that have instantiated the given vlnv in their design.
-     * 
-     * This function makes sure each owner is appended to the list only once.
-     *
-     *      @param [out] list           QList where the search results are appended.
-     *      @param [in] vlnvToSearch    Identifies the component to search for.
-     * 
-     *      @return Number of owners found.
-     *
-    */
-    virtual int getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const;
-
     /*! Find model indexes of items that represent given vlnv.
      *
      *      @param [in] vlnv Identifies the objects to search for.
@@ -157,14 +147,6 @@ public:
     */
     QModelIndexList findIndexes(VLNV const& vlnv);
 
-    /*! Get the child items of given object.
-     *
-     *      @param [out] childList  The list where the vlnvs of the children are appended.
-     *      @param [in] owner       Identifies the object that's children are searched.
-     *
-    */
-    void getChildren(QList<VLNV>& childList, VLNV const& owner);
-
 public slots:
 
     //! Reset the model
@@ -292,6 +274,14 @@ private:
     //! No assignment
     HierarchyModel& operator=(const HierarchyModel& other);
 
+    /*! Checks if an item is shown under a component design or a catalog in the hierarchy.
+     *
+     *      @param [in] vlnv    Identifies the item.
+     *
+     *      @return True, if the item is instantiated in a design used by a component or listed in a catalog.
+    */
+    bool isContainedInHierarchy(VLNV const& vlnv) const;
+
     //! The root item of the model
     HierarchyItem* rootItem_;
 
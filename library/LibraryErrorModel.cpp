@@ -43,6 +43,45 @@ void LibraryErrorModel::addErrors(QVector<QString> const& errorList, QString con
     endResetModel();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryErrorModel::setErrors()
+//-----------------------------------------------------------------------------
+void LibraryErrorModel::setErrors(QVector<QString> const& errorList, QString const& vlnv)
+{
+    // Rows are removed one run at a time, so the views keep their state for the other items.
+    int last = errorSources_.lastIndexOf(vlnv);
+    while (last != -1)
+    {
+        int first = last;
+        while (first > 0 && errorSources_.at(first - 1) == vlnv)
+        {
+            first--;
+        }
+
+        beginRemoveRows(QModelIndex(), first, last);
+        errors_.remove(first, last - first + 1);
+        for (int i = last; i >= first; i--)
+        {
+            errorSources_.removeAt(i);
+        }
+        endRemoveRows();
+
+        last = first > 0 ? errorSources_.lastIndexOf(vlnv, first - 1) : -1;
+    }
+
+    if (errorList.isEmpty() == false)
+    {
+        int firstRow = errors_.count();
+        beginInsertRows(QModelIndex(), firstRow, firstRow + errorList.count() - 1);
+        errors_ += errorList;
+        for (int i = 0; i < errorList.count(); i++)
+        {
+            errorSources_.append(vlnv);
+        }
+        endInsertRows();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryErrorModel::rowCount()
 //-----------------------------------------------------------------------------
@@ -45,6 +45,14 @@ public:
      */
     void addErrors(QVector<QString> const& errorList, QString const& vlnv);
 
+    /*!
+     *  Replaces the errors of a single item in the model.
+     *
+     *      @param [in] errorList   The current errors of the item. If empty, the item is removed from the model.
+     *      @param [in] vlnv        The item whose errors to replace.
+     */
+    void setErrors(QVector<QString> const& errorList, QString const& vlnv);
+
     /*!
      *  Returns the number of rows to be displayed.
      *
@@ -0,0 +1,269 @@
+//-----------------------------------------------------------------------------
+// File: LibraryFileWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Watches the directories of the library files and reports the changed files in batches.
+//-----------------------------------------------------------------------------
+
+#include "LibraryFileWatcher.h"
+
+#include <QDir>
+#include <QFileInfo>
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::LibraryFileWatcher()
+//-----------------------------------------------------------------------------
+LibraryFileWatcher::LibraryFileWatcher(QObject* parent):
+QObject(parent),
+    watcher_(this),
+    delayTimer_(this),
+    directories_(),
+    pendingDirectories_()
+{
+    delayTimer_.setSingleShot(true);
+    delayTimer_.setInterval(DEFAULT_DELAY_MS);
+
+    connect(&watcher_, SIGNAL(directoryChanged(QString const&)),
+        this, SLOT(onDirectoryChanged(QString const&)), Qt::UniqueConnection);
+    connect(&watcher_, SIGNAL(fileChanged(QString const&)),
+        this, SLOT(onFileChanged(QString const&)), Qt::UniqueConnection);
+    connect(&delayTimer_, &QTimer::timeout, this, &LibraryFileWatcher::reportPendingChanges);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::setDelay()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::setDelay(int milliseconds)
+{
+    delayTimer_.setInterval(milliseconds);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::addFile()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::addFile(QString const& path)
+{
+    QFileInfo fileInfo(path);
+    QString directoryPath = fileInfo.absolutePath();
+
+    QStringList foundFiles;
+    watchDirectory(directoryPath, foundFiles);
+
+    if (fileInfo.exists())
+    {
+        FileState state;
+        state.lastModified = fileInfo.lastModified();
+        state.size = fileInfo.size();
+        directories_[directoryPath].files.insert(fileInfo.fileName(), state);
+
+        // A file replaced by renaming is a new file for the system, so it is watched again.
+        QString filePath = fileInfo.absoluteFilePath();
+        libraryFiles_.insert(filePath);
+        watcher_.addPath(filePath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::clear()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::clear()
+{
+    if (watcher_.directories().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.directories());
+    }
+    if (watcher_.files().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.files());
+    }
+
+    directories_.clear();
+    libraryFiles_.clear();
+    pendingDirectories_.clear();
+    delayTimer_.stop();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::directories()
+//-----------------------------------------------------------------------------
+QStringList LibraryFileWatcher::directories() const
+{
+    return directories_.keys();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onDirectoryChanged()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onDirectoryChanged(QString const& path)
+{
+    QString directoryPath = QFileInfo(path).absoluteFilePath();
+    if (directories_.contains(directoryPath))
+    {
+        pendingDirectories_.insert(directoryPath);
+        delayTimer_.start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onFileChanged()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onFileChanged(QString const& path)
+{
+    onDirectoryChanged(QFileInfo(path).absolutePath());
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::reportPendingChanges()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::reportPendingChanges()
+{
+    delayTimer_.stop();
+
+    QStringList changedFiles;
+    QStringList addedFiles;
+    QStringList removedFiles;
+    QStringList addedDirectories;
+
+    for (QString const& directoryPath : pendingDirectories_)
+    {
+        compareDirectory(directoryPath, changedFiles, addedFiles, removedFiles, addedDirectories);
+    }
+
+    pendingDirectories_.clear();
+
+    // The files of the new subdirectories are not in any recorded state, so they are all added.
+    for (QString const& directoryPath : addedDirectories)
+    {
+        watchDirectory(directoryPath, addedFiles);
+    }
+
+    // A library file rewritten by renaming a new file over it is no longer watched by the system.
+    for (QString const& filePath : changedFiles)
+    {
+        if (libraryFiles_.contains(filePath))
+        {
+            watcher_.addPath(filePath);
+        }
+    }
+
+    if (changedFiles.isEmpty() == false || addedFiles.isEmpty() == false || removedFiles.isEmpty() == false)
+    {
+        emit filesChanged(changedFiles, addedFiles, removedFiles);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::readDirectory()
+//-----------------------------------------------------------------------------
+LibraryFileWatcher::DirectoryState LibraryFileWatcher::readDirectory(QString const& path)
+{
+    QDir directory(path);
+
+    DirectoryState state;
+    for (QFileInfo const& fileInfo : directory.entryInfoList(QStringList(QLatin1String("*.xml")),
+        QDir::Files | QDir::Readable))
+    {
+        FileState fileState;
+        fileState.lastModified = fileInfo.lastModified();
+        fileState.size = fileInfo.size();
+        state.files.insert(fileInfo.fileName(), fileState);
+    }
+
+    for (QString const& subdirectory : directory.entryList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Readable))
+    {
+        state.subdirectories.insert(subdirectory);
+    }
+
+    return state;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::watchDirectory()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::watchDirectory(QString const& path, QStringList& foundFiles)
+{
+    QStringList unwatchedPaths(path);
+    while (unwatchedPaths.isEmpty() == false)
+    {
+        QString directoryPath = unwatchedPaths.takeLast();
+        if (directories_.contains(directoryPath) || QFileInfo(directoryPath).isDir() == false)
+        {
+            continue;
+        }
+
+        DirectoryState state = readDirectory(directoryPath);
+        directories_.insert(directoryPath, state);
+        watcher_.addPath(directoryPath);
+
+        QString pathPrefix = directoryPath + QLatin1Char('/');
+        for (auto file = state.files.constBegin(); file != state.files.constEnd(); ++file)
+        {
+            foundFiles.append(pathPrefix + file.key());
+        }
+
+        for (QString const& subdirectory : state.subdirectories)
+        {
+            unwatchedPaths.append(pathPrefix + subdirectory);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::compareDirectory()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::compareDirectory(QString const& path, QStringList& changedFiles,
+    QStringList& addedFiles, QStringList& removedFiles, QStringList& addedDirectories)
+{
+    auto directory = directories_.find(path);
+    if (directory == directories_.end())
+    {
+        return;
+    }
+
+    DirectoryState current = readDirectory(path);
+    QString pathPrefix = path + QLatin1Char('/');
+
+    for (auto file = current.files.constBegin(); file != current.files.constEnd(); ++file)
+    {
+        auto recorded = directory->files.constFind(file.key());
+        if (recorded == directory->files.constEnd())
+        {
+            addedFiles.append(pathPrefix + file.key());
+        }
+        else if (!(*recorded == *file))
+        {
+            changedFiles.append(pathPrefix + file.key());
+        }
+    }
+
+    for (auto recorded = directory->files.constBegin(); recorded != directory->files.constEnd(); ++recorded)
+    {
+        if (current.files.contains(recorded.key()) == false)
+        {
+            removedFiles.append(pathPrefix + recorded.key());
+            libraryFiles_.remove(pathPrefix + recorded.key());
+        }
+    }
+
+    for (QString const& subdirectory : current.subdirectories)
+    {
+        if (directory->subdirectories.contains(subdirectory) == false)
+        {
+            addedDirectories.append(pathPrefix + subdirectory);
+        }
+    }
+
+    // A removed directory is no longer watched by the system, so it is forgotten here as well.
+    if (QFileInfo::exists(path) == false)
+    {
+        directories_.erase(directory);
+    }
+    else
+    {
+        *directory = current;
+    }
+}
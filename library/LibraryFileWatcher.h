@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------
+// File: LibraryFileWatcher.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Watches the directories of the library files and reports the changed files in batches.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYFILEWATCHER_H
+#define LIBRARYFILEWATCHER_H
+
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+//-----------------------------------------------------------------------------
+//! Watches the directories of the library files and reports the changed files in batches.
+//
+// The directories containing library files and their subdirectories are watched for added and removed files.
+// The library files are watched as well, since editing a file in place does not change its directory. A
+// directory stays watched after its last library file is removed, so the files added there later are reported.
+// The XML files in each watched directory are recorded with their modification time and size. When a directory
+// or a file in it changes, the directory is compared to the recorded state after a short delay, so a burst of
+// changes, e.g. from a version control checkout, is reported as a single batch.
+//-----------------------------------------------------------------------------
+class LibraryFileWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    //! The default delay from the last change to reporting the changes in milliseconds.
+    static const int DEFAULT_DELAY_MS = 500;
+
+    /*! The constructor.
+     *
+     *      @param [in] parent  The parent object.
+     */
+    explicit LibraryFileWatcher(QObject* parent = nullptr);
+
+    //! The destructor.
+    virtual ~LibraryFileWatcher() = default;
+
+    /*! Sets the delay from the last change to reporting the changes.
+     *
+     *      @param [in] milliseconds    The delay in milliseconds.
+     */
+    void setDelay(int milliseconds);
+
+    /*! Starts watching a library file, or records its current state if it is already watched.
+     *
+     * Recording the state after writing a file prevents reporting the write as a change.
+     *
+     *      @param [in] path    The path of the file.
+     */
+    void addFile(QString const& path);
+
+    //! Stops watching all files.
+    void clear();
+
+    /*! Get the watched directories.
+     *
+     *      @return The absolute paths of the watched directories.
+     */
+    QStringList directories() const;
+
+    //! Reports the pending changes without waiting for the delay.
+    void reportPendingChanges();
+
+signals:
+
+    /*! Emitted when watched directories have changed.
+     *
+     *      @param [in] changedFiles    The XML files whose modification time or size has changed.
+     *      @param [in] addedFiles      The XML files added to the watched directories.
+     *      @param [in] removedFiles    The XML files removed from the watched directories.
+     */
+    void filesChanged(QStringList const& changedFiles, QStringList const& addedFiles,
+        QStringList const& removedFiles);
+
+public slots:
+
+    /*! Marks a directory for checking when the delay has passed.
+     *
+     *      @param [in] path    The path of the changed directory.
+     */
+    void onDirectoryChanged(QString const& path);
+
+    /*! Marks the directory of a changed file for checking when the delay has passed.
+     *
+     *      @param [in] path    The path of the changed file.
+     */
+    void onFileChanged(QString const& path);
+
+private:
+
+    //! Disable copying.
+    LibraryFileWatcher(LibraryFileWatcher const& rhs);
+    LibraryFileWatcher& operator=(LibraryFileWatcher const& rhs);
+
+    //! The recorded state of a single file.
+    struct FileState
+    {
+        QDateTime lastModified;     //!< The modification time of the file.
+        qint64 size = 0;            //!< The size of the file.
+
+        bool operator==(FileState const& other) const
+        {
+            return lastModified == other.lastModified && size == other.size;
+        }
+    };
+
+    //! The recorded state of a watched directory.
+    struct DirectoryState
+    {
+        QHash<QString, FileState> files;    //!< The XML files in the directory by file name.
+        QSet<QString> subdirectories;       //!< The names of the subdirectories.
+    };
+
+    /*! Reads the current state of a directory.
+     *
+     *      @param [in] path    The path of the directory.
+     *
+     *      @return The XML files and the subdirectories in the directory.
+     */
+    static DirectoryState readDirectory(QString const& path);
+
+    /*! Starts watching a directory and its subdirectories, unless they are already watched.
+     *
+     *      @param [in]  path           The absolute path of the directory.
+     *      @param [out] foundFiles     The XML files in the newly watched directories.
+     */
+    void watchDirectory(QString const& path, QStringList& foundFiles);
+
+    /*! Compares a pending directory to its recorded state.
+     *
+     *      @param [in]  path               The absolute path of the directory.
+     *      @param [out] changedFiles       The XML files whose modification time or size has changed.
+     *      @param [out] addedFiles         The XML files added to the directory.
+     *      @param [out] removedFiles       The XML files removed from the directory.
+     *      @param [out] addedDirectories   The subdirectories added to the directory.
+     */
+    void compareDirectory(QString const& path, QStringList& changedFiles, QStringList& addedFiles,
+        QStringList& removedFiles, QStringList& addedDirectories);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The watcher for the directories.
+    QFileSystemWatcher watcher_;
+
+    //! Delays the reporting until the changes have settled.
+    QTimer delayTimer_;
+
+    //! The recorded states of the watched directories by absolute path.
+    QHash<QString, DirectoryState> directories_;
+
+    //! The absolute paths of the watched library files.
+    QSet<QString> libraryFiles_;
+
+    //! The directories changed since the last report.
+    QSet<QString> pendingDirectories_;
+};
+
+#endif // LIBRARYFILEWATCHER_H
@@ -189,6 +189,19 @@ bool LibraryFilter::hasEmptyVLNVfilter() const
         versionFilter_.isEmpty();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryFilter::hasComponentFilters()
+//-----------------------------------------------------------------------------
+bool LibraryFilter::hasComponentFilters() const
+{
+    bool allFirmness = firmness_.templates_ && firmness_.mutable_ && firmness_.fixed_;
+    bool allImplementations = implementation_.hw_ && implementation_.sw_ && implementation_.system_;
+    bool allHierarchies = hierarchy_.flat_ && hierarchy_.product_ && hierarchy_.board_ && hierarchy_.chip_ &&
+        hierarchy_.soc_ && hierarchy_.ip_;
+
+    return !(allFirmness && allImplementations && allHierarchies);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::checkFirmness()
 //-----------------------------------------------------------------------------
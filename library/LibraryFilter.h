@@ -112,6 +112,13 @@ protected:
      */
     bool hasEmptyVLNVfilter() const;
 
+    /*!
+     *  Checks if any of the firmness, implementation or hierarchy options is disabled.
+     *
+     *      @return True, if components must be read to check their attributes, otherwise false.
+     */
+    bool hasComponentFilters() const;
+
     //! Check the firmness matching.
 	bool checkFirmness(QSharedPointer<Component const> component) const;
 
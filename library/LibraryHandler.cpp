@@ -38,14 +38,48 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QCoreApplication>
+#include <QEventLoop>
 #include <QFile>
 #include <QFileInfo>
 #include <QSharedPointer>
 #include <QList>
 #include <QMap>
 #include <QMessageBox>
+#include <QMutexLocker>
+#include <QProgressDialog>
+#include <QReadLocker>
+#include <QSet>
+#include <QSettings>
 #include <QString>
 #include <QStringList>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
+#include <QWriteLocker>
+
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <functional>
+
+namespace
+{
+    //! The interval for updating the progress of the integrity check in milliseconds.
+    const int INTEGRITY_PROGRESS_INTERVAL = 50;
+
+    //! The version of the validation rules. Increase when the rules change, so the stored results are discarded.
+    const int VALIDATION_RULES_VERSION = 1;
+
+    //-----------------------------------------------------------------------------
+    // Function: validatorVersion()
+    //-----------------------------------------------------------------------------
+    QString validatorVersion()
+    {
+        return QCoreApplication::applicationVersion() + QLatin1Char('/') +
+            QString::number(VALIDATION_RULES_VERSION);
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::LibraryHandler()
@@ -56,20 +90,51 @@ QObject(parent),
     messageChannel_(messageChannel),
     fileAccess_(messageChannel),
     loader_(messageChannel, this),
+    index_(),
     documentCache_(),
+    parsedDocuments_(),
     urlTester_(Utils::URL_VALIDITY_REG_EXP, this),
     validator_(this),
+    parallelValidationRequested_(false),
+    parallelValidation_(false),
     treeModel_(new LibraryTreeModel(this, this)),
     hierarchyModel_(new HierarchyModel(this, this)),
     integrityWidget_(0),
+    integrityModel_(0),
+    dependencyGraph_(),
+    unresolvedDependencies_(),
     saveInProgress_(false),
     fileWatch_(this),
-    checkResults_()
+    documentPaths_(),
+    deferRevalidation_(false),
+    deferredRevalidation_(),
+    checkResults_(),
+    cacheMutex_(),
+    documentGenerations_(),
+    cacheClears_(0),
+    integrityCheckCanceled_(0),
+    integrityCheckRunning_(false),
+    heldChangedFiles_(),
+    heldAddedFiles_(),
+    heldRemovedFiles_(),
+    loadPool_()
 {
     // create the connections between models and library handler
     syncronizeModels();
-    connect(&fileWatch_, SIGNAL(fileChanged(QString const&)),
-            this, SLOT(onFileChanged(QString const&)), Qt::UniqueConnection);
+    connect(&fileWatch_, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)),
+        this, SLOT(onLibraryFilesChanged(QStringList const&, QStringList const&, QStringList const&)),
+        Qt::UniqueConnection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::~LibraryHandler()
+//-----------------------------------------------------------------------------
+LibraryHandler::~LibraryHandler()
+{
+    // Requests not yet started are dropped, the running ones are finished by the pool destructor.
+    loadPool_.clear();
+
+    index_.save();
 }
 
 //-----------------------------------------------------------------------------
@@ -78,15 +143,16 @@ QObject(parent),
 QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 {
     // if object has already been previously parsed
-    if (documentCache_.contains(vlnv))
+    QString path;
+    if (findDocumentPath(vlnv, path))
     {
-        auto info = documentCache_.find(vlnv);
-        if (info->document.isNull())
+        QSharedPointer<Document> document = findOrReadDocument(vlnv, path);
+        if (document.isNull())
         {
-            info->document = fileAccess_.readDocument(info->path);
+            return QSharedPointer<Document>();
         }
 
-        QSharedPointer<Document> copy = info->document->clone();
+        QSharedPointer<Document> copy = document->clone();
         return copy;
     }
 
@@ -99,25 +165,85 @@ QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv)
 {
-    if (documentCache_.contains(vlnv))
+    QString path;
+    if (findDocumentPath(vlnv, path))
     {
-        auto info = documentCache_.find(vlnv);
-        if (info->document.isNull())
-        {
-            info->document = fileAccess_.readDocument(info->path);
-        }
-
-        return info->document;
+        return findOrReadDocument(vlnv, path);
     }
     
     return QSharedPointer<Document const>();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getModelAsync()
+//-----------------------------------------------------------------------------
+QFuture<QSharedPointer<Document> > LibraryHandler::getModelAsync(VLNV const& vlnv)
+{
+    // The path is resolved here, so the task does not depend on later changes to the library.
+    QString path;
+    if (findDocumentPath(vlnv, path) == false)
+    {
+        showNotFoundError(vlnv);
+        return QtConcurrent::run(&loadPool_, []() { return QSharedPointer<Document>(); });
+    }
+
+    return QtConcurrent::run(&loadPool_, [this, vlnv, path]()
+    {
+        QSharedPointer<Document> document = findOrReadDocument(vlnv, path);
+        if (document.isNull())
+        {
+            return QSharedPointer<Document>();
+        }
+
+        return document->clone();
+    });
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::prefetchDependencies()
+//-----------------------------------------------------------------------------
+QFuture<void> LibraryHandler::prefetchDependencies(VLNV const& vlnv)
+{
+    // The documents of one level are read with a single map on the global pool. The walk itself is the only
+    // task in the load pool, so no load pool thread waits for another load pool task.
+    return QtConcurrent::run(&loadPool_, [this, vlnv]()
+    {
+        std::function<QVector<VLNV>(VLNV const&)> readLevel = [this](VLNV const& neededVLNV)
+        {
+            return readDependencies(neededVLNV);
+        };
+
+        QSet<VLNV> visitedVLNVs;
+        visitedVLNVs.insert(vlnv);
+
+        QVector<VLNV> level(1, vlnv);
+        while (level.isEmpty() == false)
+        {
+            QList<QVector<VLNV> > levelDependencies =
+                QtConcurrent::blockingMapped<QList<QVector<VLNV> > >(level, readLevel);
+
+            level.clear();
+            for (QVector<VLNV> const& dependencies : levelDependencies)
+            {
+                for (VLNV const& dependency : dependencies)
+                {
+                    if (visitedVLNVs.contains(dependency) == false)
+                    {
+                        visitedVLNVs.insert(dependency);
+                        level.append(dependency);
+                    }
+                }
+            }
+        }
+    });
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getAllVLNVs()
 //-----------------------------------------------------------------------------
 QList<VLNV> LibraryHandler::getAllVLNVs() const
 {
+    QReadLocker locker(&documentLock_);
     return documentCache_.keys();
 }
 
@@ -126,6 +252,7 @@ QList<VLNV> LibraryHandler::getAllVLNVs() const
 //-----------------------------------------------------------------------------
 bool LibraryHandler::contains(const VLNV& vlnv) const
 {
+    QReadLocker locker(&documentLock_);
     return documentCache_.contains(vlnv);
 }
 
@@ -134,6 +261,7 @@ bool LibraryHandler::contains(const VLNV& vlnv) const
 //-----------------------------------------------------------------------------
 const QString LibraryHandler::getPath(VLNV const& vlnv) const
 {
+    QReadLocker locker(&documentLock_);
     return documentCache_.value(vlnv).path;
 }
 
@@ -191,9 +319,21 @@ void LibraryHandler::searchForIPXactFiles()
 
     loadAvailableVLNVs();
 
-    onCheckLibraryIntegrity();
+    checkChangedDocuments();
+
+    findUnresolvedDependencies();
     
     resetModels();
+
+    index_.save();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::requestParallelValidation()
+//-----------------------------------------------------------------------------
+void LibraryHandler::requestParallelValidation(bool requested)
+{
+    parallelValidationRequested_ = requested;
 }
 
 //-----------------------------------------------------------------------------
@@ -260,6 +400,7 @@ LibraryItem const* LibraryHandler::getTreeRoot() const
 //-----------------------------------------------------------------------------
 VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
 {
+    QReadLocker locker(&documentLock_);
     QMap<VLNV, DocumentInfo>::const_iterator it = documentCache_.constFind(vlnv);
     if (it == documentCache_.constEnd())
     {
@@ -275,7 +416,7 @@ VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
 int LibraryHandler::referenceCount(VLNV const& vlnv) const
 {
     QList<VLNV> list;
-    return hierarchyModel_->getOwners(list, vlnv);
+    return getOwners(list, vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -283,7 +424,54 @@ int LibraryHandler::referenceCount(VLNV const& vlnv) const
 //-----------------------------------------------------------------------------
 int LibraryHandler::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 {
-    return hierarchyModel_->getOwners(list, vlnvToSearch);
+    auto searched = documentCache_.constFind(vlnvToSearch);
+    if (searched == documentCache_.constEnd())
+    {
+        return list.size();
+    }
+
+    // Only catalogs and the documents in the hierarchy can own a document, so only their references are needed.
+    resolveDependencies(QVector<VLNV>(1, searched.key()));
+    resolveDependencies(VLNV::CATALOG);
+    if (searched.key().getType() != VLNV::ABSTRACTIONDEFINITION)
+    {
+        resolveDependencies(VLNV::COMPONENT);
+        resolveDependencies(VLNV::DESIGNCONFIGURATION);
+        resolveDependencies(VLNV::DESIGN);
+    }
+
+    QVector<VLNV> dependents = dependencyGraph_.getDependents(vlnvToSearch);
+
+    // Catalogs own the documents they list.
+    QVector<VLNV> owners = filterByType(dependents, VLNV::CATALOG);
+
+    VLNV::IPXactType searchedType = searched.key().getType();
+    if (searchedType == VLNV::COMPONENT)
+    {
+        // A component is owned by the components whose designs instantiate it.
+        for (VLNV const& design : filterByType(dependents, VLNV::DESIGN))
+        {
+            owners += findHierarchyOwners(design);
+        }
+    }
+    else if (searchedType == VLNV::DESIGN || searchedType == VLNV::DESIGNCONFIGURATION)
+    {
+        owners += findHierarchyOwners(vlnvToSearch);
+    }
+    else if (searchedType == VLNV::ABSTRACTIONDEFINITION)
+    {
+        owners += filterByType(dependencyGraph_.getDependencies(vlnvToSearch), VLNV::BUSDEFINITION);
+    }
+
+    for (VLNV const& owner : owners)
+    {
+        if (list.contains(owner) == false)
+        {
+            list.append(owner);
+        }
+    }
+
+    return list.size();
 }
 
 //-----------------------------------------------------------------------------
@@ -291,15 +479,56 @@ int LibraryHandler::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 //-----------------------------------------------------------------------------
 int LibraryHandler::getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 {
-    if (vlnvToSearch.isValid() == false)
+    auto searched = documentCache_.constFind(vlnvToSearch);
+    if (vlnvToSearch.isValid() == false || searched == documentCache_.constEnd())
     {
         return 0;
     }
 
-    hierarchyModel_->getChildren(list, vlnvToSearch);
+    // The hierarchy is walked breadth-first, so the direct children come first.
+    QVector<VLNV> found(1, searched.key());
+    QSet<VLNV> foundVLNVs;
+    foundVLNVs.insert(searched.key());
+    for (int i = 0; i < found.count(); ++i)
+    {
+        for (VLNV const& child : findHierarchyChildren(found.at(i)))
+        {
+            if (foundVLNVs.contains(child) == false)
+            {
+                foundVLNVs.insert(child);
+                found.append(child);
+            }
+        }
+    }
+
+    QSet<VLNV> listedVLNVs = list.toSet();
+    for (int i = 1; i < found.count(); ++i)
+    {
+        if (listedVLNVs.contains(found.at(i)) == false)
+        {
+            listedVLNVs.insert(found.at(i));
+            list.append(found.at(i));
+        }
+    }
+
     return list.size();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::hasChildren()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::hasChildren(VLNV const& vlnvToSearch) const
+{
+    auto searched = documentCache_.constFind(vlnvToSearch);
+    if (vlnvToSearch.isValid() == false || searched == documentCache_.constEnd())
+    {
+        return false;
+    }
+
+    // The deeper children are found only through the direct ones, so the rest of the hierarchy is not walked.
+    return findHierarchyChildren(searched.key()).isEmpty() == false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getDesignVLNV()
 //-----------------------------------------------------------------------------
@@ -360,6 +589,7 @@ QSharedPointer<Design> LibraryHandler::getDesign(VLNV const& hierarchyRef)
 //-----------------------------------------------------------------------------
 bool LibraryHandler::isValid(VLNV const& vlnv)
 {    
+    QReadLocker locker(&documentLock_);
     return documentCache_.value(vlnv).isValid;
 }
 
@@ -379,34 +609,350 @@ LibraryTreeModel* LibraryHandler::getTreeModel()
     return treeModel_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheStatistics()
+//-----------------------------------------------------------------------------
+DocumentCache::Statistics LibraryHandler::getCacheStatistics() const
+{
+    QMutexLocker locker(&cacheMutex_);
+    return parsedDocuments_.statistics();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::onCheckLibraryIntegrity()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onCheckLibraryIntegrity()
 {
-    messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
+    checkResults_.documentCount = 0;
+    checkResults_.fileCount = 0;
 
+    QVector<LibraryLoader::LoadTarget> targets;
+    targets.reserve(documentCache_.count());
+    for (auto it = documentCache_.constBegin(); it != documentCache_.constEnd(); ++it)
+    {
+        targets.append(LibraryLoader::LoadTarget(it.key(), it->path));
+    }
+
+    checkIntegrity(targets);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::checkChangedDocuments()
+//-----------------------------------------------------------------------------
+void LibraryHandler::checkChangedDocuments()
+{
     checkResults_.documentCount = 0;
     checkResults_.fileCount = 0;
 
+    QString currentValidatorVersion = validatorVersion();
+
+    QVector<VLNV> changedVLNVs;
+    QMap<VLNV, bool> uncheckedVLNVs;
+    for (auto it = documentCache_.constBegin(); it != documentCache_.constEnd(); ++it)
+    {
+        LibraryIndex::Entry const* entry = index_.findCurrent(QFileInfo(it->path));
+        if (entry == nullptr || entry->vlnv != it.key() || entry->validityKnown == false ||
+            entry->dependenciesKnown == false || entry->validatorVersion != currentValidatorVersion)
+        {
+            changedVLNVs.append(it.key());
+            uncheckedVLNVs.insert(it.key(), true);
+            continue;
+        }
+
+        // Invalid documents and documents with missing references may have been fixed by other documents.
+        bool missingDependency = false;
+        for (VLNV const& dependency : entry->dependencies)
+        {
+            if (documentCache_.contains(dependency) == false)
+            {
+                missingDependency = true;
+                break;
+            }
+        }
+
+        bool missingPath = false;
+        for (QString const& referencedPath : entry->referencedPaths)
+        {
+            if (QFileInfo::exists(referencedPath) == false)
+            {
+                missingPath = true;
+                break;
+            }
+        }
+
+        if (entry->isValid == false || missingDependency || missingPath)
+        {
+            uncheckedVLNVs.insert(it.key(), true);
+        }
+    }
+
+    // The validity of a document depends on the documents it references, so their dependents are checked as well.
+    for (VLNV const& dependent : findAllDependents(changedVLNVs))
+    {
+        uncheckedVLNVs.insert(dependent, true);
+    }
+
+    QVector<LibraryLoader::LoadTarget> targets;
+    QWriteLocker locker(&documentLock_);
     for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
     {
-        QSharedPointer<Document> model = fileAccess_.readDocument(it->path);
+        if (uncheckedVLNVs.contains(it.key()))
+        {
+            targets.append(LibraryLoader::LoadTarget(it.key(), it->path));
+        }
+        else
+        {
+            // Unchanged documents keep the result of the previous check.
+            LibraryIndex::Entry const* entry = index_.findCurrent(QFileInfo(it->path));
+            it->isValid = true;
+            checkResults_.fileCount += entry->fileCount;
+        }
+    }
+    locker.unlock();
+
+    checkIntegrity(targets);
+}
 
-        // TODO: Add model to cache only, if it is already previously cached.
-        // Current hierarchy model forces all models to be loaded, but this should be changed.
-        it->document = model;
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findUnresolvedDependencies()
+//-----------------------------------------------------------------------------
+void LibraryHandler::findUnresolvedDependencies()
+{
+    // The references are normally known from the index or the integrity check, but a canceled check or
+    // an unreadable document leaves them unknown.
+    unresolvedDependencies_.clear();
+    for (auto it = documentCache_.constBegin(); it != documentCache_.constEnd(); ++it)
+    {
+        if (dependencyGraph_.contains(it.key()) == false)
+        {
+            unresolvedDependencies_.insert(it.key());
+        }
+    }
+}
 
-        it->isValid = validateDocument(model, it->path);
-        if (it->isValid == false)
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::resolveDependencies()
+//-----------------------------------------------------------------------------
+void LibraryHandler::resolveDependencies(VLNV::IPXactType type) const
+{
+    QVector<VLNV> unresolvedVLNVs;
+    for (VLNV const& vlnv : unresolvedDependencies_)
+    {
+        if (type == VLNV::INVALID || vlnv.getType() == type)
+        {
+            unresolvedVLNVs.append(vlnv);
+        }
+    }
+
+    resolveDependencies(unresolvedVLNVs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::resolveDependencies()
+//-----------------------------------------------------------------------------
+void LibraryHandler::resolveDependencies(QVector<VLNV> const& vlnvs) const
+{
+    QVector<VLNV> unknownVLNVs;
+    for (VLNV const& vlnv : vlnvs)
+    {
+        if (unresolvedDependencies_.remove(vlnv) && dependencyGraph_.contains(vlnv) == false)
+        {
+            unknownVLNVs.append(vlnv);
+        }
+    }
+
+    if (unknownVLNVs.isEmpty())
+    {
+        return;
+    }
+
+    // Reading the references only fills the caches, so the library is unchanged for the callers.
+    LibraryHandler* handler = const_cast<LibraryHandler*>(this);
+    std::function<QVector<VLNV>(VLNV const&)> readReferences = [handler](VLNV const& vlnv)
+    {
+        return handler->readDependencies(vlnv);
+    };
+
+    QList<QVector<VLNV> > references =
+        QtConcurrent::blockingMapped<QList<QVector<VLNV> > >(unknownVLNVs, readReferences);
+
+    for (int i = 0; i < unknownVLNVs.count(); ++i)
+    {
+        dependencyGraph_.setDependencies(unknownVLNVs.at(i), references.at(i));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::filterByType()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::filterByType(QVector<VLNV> const& vlnvs, VLNV::IPXactType type) const
+{
+    QVector<VLNV> found;
+    for (VLNV const& vlnv : vlnvs)
+    {
+        auto info = documentCache_.constFind(vlnv);
+        if (info != documentCache_.constEnd() && info.key().getType() == type && found.contains(info.key()) == false)
+        {
+            found.append(info.key());
+        }
+    }
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findHierarchyOwners()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::findHierarchyOwners(VLNV const& vlnv) const
+{
+    QVector<VLNV> dependents = dependencyGraph_.getDependents(vlnv);
+    QVector<VLNV> owners = filterByType(dependents, VLNV::COMPONENT);
+
+    // A design referenced through a configuration is owned by the components referencing the configuration.
+    for (VLNV const& configuration : filterByType(dependents, VLNV::DESIGNCONFIGURATION))
+    {
+        owners += filterByType(dependencyGraph_.getDependents(configuration), VLNV::COMPONENT);
+    }
+
+    return owners;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findHierarchyChildren()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::findHierarchyChildren(VLNV const& vlnv) const
+{
+    VLNV::IPXactType type = documentCache_.constFind(vlnv).key().getType();
+    if (type == VLNV::BUSDEFINITION)
+    {
+        resolveDependencies(VLNV::ABSTRACTIONDEFINITION);
+    }
+    else
+    {
+        resolveDependencies(QVector<VLNV>(1, vlnv));
+    }
+
+    QVector<VLNV> dependencies = dependencyGraph_.getDependencies(vlnv);
+
+    if (type == VLNV::BUSDEFINITION)
+    {
+        // The abstraction definitions are the children of a bus definition, even though they reference the bus.
+        return filterByType(dependencyGraph_.getDependents(vlnv), VLNV::ABSTRACTIONDEFINITION);
+    }
+    else if (type == VLNV::COMPONENT)
+    {
+        return filterByType(dependencies, VLNV::DESIGNCONFIGURATION) + filterByType(dependencies, VLNV::DESIGN);
+    }
+    else if (type == VLNV::DESIGNCONFIGURATION)
+    {
+        return filterByType(dependencies, VLNV::DESIGN);
+    }
+    else if (type == VLNV::DESIGN)
+    {
+        return filterByType(dependencies, VLNV::COMPONENT);
+    }
+    else if (type == VLNV::CATALOG)
+    {
+        return filterByType(dependencies, VLNV::CATALOG) + filterByType(dependencies, VLNV::BUSDEFINITION) +
+            filterByType(dependencies, VLNV::ABSTRACTIONDEFINITION) + filterByType(dependencies, VLNV::COMPONENT);
+    }
+
+    return QVector<VLNV>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::checkIntegrity()
+//-----------------------------------------------------------------------------
+void LibraryHandler::checkIntegrity(QVector<LibraryLoader::LoadTarget> const& targets)
+{
+    messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
+
+    QVector<IntegrityResult> results = checkDocuments(targets);
+
+    // Results are applied in the library order, so the outcome does not depend on the thread count.
+    QWriteLocker locker(&documentLock_);
+    bool canceled = false;
+    for (int i = 0; i < targets.count(); ++i)
+    {
+        IntegrityResult const& result = results.at(i);
+        auto info = documentCache_.find(targets.at(i).vlnv);
+        if (result.checked == false || info == documentCache_.end())
+        {
+            canceled = true;
+            continue;
+        }
+
+        if (result.dependenciesRead)
+        {
+            index_.setDependencies(info->path, result.dependencies);
+            dependencyGraph_.setDependencies(info.key(), result.dependencies);
+        }
+
+        info->isValid = result.isValid;
+        index_.setValidity(info->path, result.isValid, result.fileCount, result.referencedPaths,
+            validatorVersion());
+
+        checkResults_.fileCount += result.fileCount;
+        if (info->isValid == false)
         {
             checkResults_.documentCount++;
         }
     }
+    locker.unlock();
+
+    if (canceled)
+    {
+        messageChannel_->showMessage(tr("Library integrity check was canceled. "
+            "The results cover only the items checked before canceling."));
+    }
 
     showIntegrityResults();
 
     messageChannel_->showStatusMessage(tr("Ready."));
+
+    applyHeldLibraryChanges();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::applyHeldLibraryChanges()
+//-----------------------------------------------------------------------------
+void LibraryHandler::applyHeldLibraryChanges()
+{
+    if (heldChangedFiles_.isEmpty() && heldAddedFiles_.isEmpty() && heldRemovedFiles_.isEmpty())
+    {
+        return;
+    }
+
+    QStringList changedFiles;
+    QStringList addedFiles;
+    QStringList removedFiles;
+    changedFiles.swap(heldChangedFiles_);
+    addedFiles.swap(heldAddedFiles_);
+    removedFiles.swap(heldRemovedFiles_);
+
+    changedFiles.removeDuplicates();
+    addedFiles.removeDuplicates();
+    removedFiles.removeDuplicates();
+
+    onLibraryFilesChanged(changedFiles, addedFiles, removedFiles);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onCancelIntegrityCheck()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onCancelIntegrityCheck()
+{
+    integrityCheckCanceled_.storeRelease(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onRebuildLibraryIndex()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onRebuildLibraryIndex()
+{
+    index_.clear();
+
+    searchForIPXactFiles();
 }
 
 //-----------------------------------------------------------------------------
@@ -443,7 +989,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
     else if (documentType == VLNV::BUSDEFINITION)
     {
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, vlnv);
+        getChildren(absDefVLNVs, vlnv);
 
         if (absDefVLNVs.size() == 1)
         {
@@ -474,7 +1020,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
         }
 
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+        getChildren(absDefVLNVs, busDefVLNV);
 
         // If there is exactly one abstraction definition per bus definition, open it.
         if (absDefVLNVs.size() == 1 && absDefVLNVs.first() == vlnv)
@@ -578,11 +1124,13 @@ void LibraryHandler::onGenerateIntegrityReport()
         {
             if (it->isValid == false)
             {
-                model->addErrors(findErrorsInDocument(it->document, it->path), it.key().toString());
+                model->addErrors(findErrorsInDocument(findOrReadDocument(it.key(), it->path), it->path),
+                    it.key().toString());
             }
         }             
 
         integrityWidget_->setModel(model);
+        integrityModel_ = model;
 
         integrityWidget_->show();       
 
@@ -692,14 +1240,78 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
         return;
     }
 
+    removeDocument(vlnv);
+
+    // The documents using the removed one are no longer valid.
+    revalidateDependents(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::removeDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::removeDocument(VLNV const& vlnv)
+{
+    QString path = documentCache_.find(vlnv)->path;
+    removeFromLibrary(vlnv);
+    removeFile(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::removeFromLibrary()
+//-----------------------------------------------------------------------------
+void LibraryHandler::removeFromLibrary(VLNV const& vlnv)
+{
     QString path = documentCache_.find(vlnv)->path;
-    fileWatch_.removePath(path);
+
+    // The directory of the file stays watched, so the files added there later are found.
+    documentPaths_.remove(QFileInfo(path).absoluteFilePath());
+
+    QWriteLocker documentLocker(&documentLock_);
     documentCache_.remove(vlnv);
+    documentLocker.unlock();
+
+    evictDocument(vlnv, path);
+
+    index_.removeEntry(path);
+
+    dependencyGraph_.removeDocument(vlnv);
+    unresolvedDependencies_.remove(vlnv);
+    updateIntegrityReport(vlnv, QVector<QString>());
 
     treeModel_->onRemoveVLNV(vlnv);
     hierarchyModel_->onRemoveVLNV(vlnv);
 
-    removeFile(path);
+    emit documentChanged(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::addFromFile()
+//-----------------------------------------------------------------------------
+void LibraryHandler::addFromFile(VLNV const& vlnv, QString const& path)
+{
+    QFileInfo fileInfo(path);
+
+    QWriteLocker locker(&documentLock_);
+    documentCache_.insert(vlnv, DocumentInfo(path));
+    locker.unlock();
+
+    documentPaths_.insert(fileInfo.absoluteFilePath(), vlnv);
+    fileWatch_.addFile(path);
+    index_.setEntry(fileInfo, vlnv);
+
+    // The validation reads the document information, so the lock is not held while validating.
+    QSharedPointer<Document> document = findOrReadDocument(vlnv, path);
+    bool isValid = validateAndReport(vlnv, document, path);
+
+    locker.relock();
+    documentCache_[vlnv].isValid = isValid;
+    locker.unlock();
+
+    updateDependencies(vlnv, path, document);
+
+    treeModel_->onAddVLNV(vlnv);
+
+    emit documentChanged(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -818,7 +1430,7 @@ void LibraryHandler::onCreateAbsDef(VLNV const& busDefVLNV)
     QString directory = busDefInfo.absolutePath();
 
     QList<VLNV> absDefVLNVs;
-    hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+    getChildren(absDefVLNVs, busDefVLNV);
 
     // if theres no previous abstraction definition for given bus def
     if (absDefVLNVs.isEmpty())
@@ -865,10 +1477,30 @@ void LibraryHandler::onItemSaved(VLNV const& vlnv)
 
     // Replace overwritten item with new and check validity.
     QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
-    
+    QString path = getPath(vlnv);
+    bool isValid = validateAndReport(vlnv, model, path);
+
+    QWriteLocker locker(&documentLock_);
+    documentCache_.insert(vlnv, DocumentInfo(path, isValid));
+    locker.unlock();
+    cacheDocument(vlnv, path, model);
+
+    updateDependencies(vlnv, path, model);
+
+    // During a batched update, the users of all the changed documents are validated once at the end.
+    if (deferRevalidation_)
+    {
+        deferredRevalidation_.append(vlnv);
+    }
+    else
+    {
+        revalidateDependents(vlnv);
+    }
+
     treeModel_->onDocumentUpdated(vlnv);
     hierarchyModel_->onDocumentUpdated(vlnv);
+
+    emit documentChanged(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -878,24 +1510,98 @@ void LibraryHandler::onCloseIntegrityReport()
 {
     integrityWidget_->deleteLater();
     integrityWidget_ = 0;
+    integrityModel_ = 0;
 }
 
 //-----------------------------------------------------------------------------
-// Function: LibraryHandler::onFileChanged()
+// Function: LibraryHandler::onLibraryFilesChanged()
 //-----------------------------------------------------------------------------
-void LibraryHandler::onFileChanged(QString const& path)
+void LibraryHandler::onLibraryFilesChanged(QStringList const& changedFiles, QStringList const& addedFiles,
+    QStringList const& removedFiles)
 {
-    auto changedDocument = std::find_if(documentCache_.begin(), documentCache_.end(),
-        [path] (const DocumentInfo& s) { return s.path.compare(path) == 0; } );
+    // The integrity check reads the library entries, so the changes are applied after it has finished.
+    if (integrityCheckRunning_)
+    {
+        heldChangedFiles_ += changedFiles;
+        heldAddedFiles_ += addedFiles;
+        heldRemovedFiles_ += removedFiles;
+        return;
+    }
+
+    QVector<VLNV> affectedVLNVs;
+    QStringList newFiles = addedFiles;
+
+    for (QString const& path : removedFiles)
+    {
+        VLNV removedVLNV = documentPaths_.value(path);
+        if (removedVLNV.isValid() && contains(removedVLNV))
+        {
+            removeFromLibrary(removedVLNV);
+            affectedVLNVs.append(removedVLNV);
+        }
+    }
+
+    QVector<VLNV> updatedVLNVs;
+    for (QString const& path : changedFiles)
+    {
+        VLNV knownVLNV = documentPaths_.value(path);
+        if (knownVLNV.isValid() == false)
+        {
+            // The file may have become an IP-XACT document.
+            newFiles.append(path);
+            continue;
+        }
+
+        // The parsed document no longer matches the file, so it is read again when needed.
+        evictDocument(knownVLNV, path);
+
+        VLNV fileVLNV = LibraryLoader::findDocumentVLNV(path);
+        if (fileVLNV == knownVLNV && fileVLNV.getType() == knownVLNV.getType())
+        {
+            QFileInfo fileInfo(path);
+            index_.setEntry(fileInfo, knownVLNV);
+            updatedVLNVs.append(knownVLNV);
+        }
+        else
+        {
+            removeFromLibrary(knownVLNV);
+            affectedVLNVs.append(knownVLNV);
+            newFiles.append(path);
+        }
+    }
+
+    bool hierarchyChanged = affectedVLNVs.isEmpty() == false;
+    for (QString const& path : newFiles)
+    {
+        VLNV fileVLNV = LibraryLoader::findDocumentVLNV(path);
+        if (fileVLNV.isValid() && contains(fileVLNV) == false)
+        {
+            addFromFile(fileVLNV, path);
+            affectedVLNVs.append(fileVLNV);
+            hierarchyChanged = true;
+        }
+    }
 
-    if (changedDocument != documentCache_.end() && changedDocument.key().isValid())
+    // The open editors and the views are updated for each changed document, but the users of the changed
+    // documents are validated only once for the whole batch.
+    deferRevalidation_ = true;
+    for (VLNV const& vlnv : updatedVLNVs)
     {
-        emit updatedVLNV(changedDocument.key());
+        emit updatedVLNV(vlnv);
     }
-    else
+    deferRevalidation_ = false;
+
+    affectedVLNVs += deferredRevalidation_;
+    deferredRevalidation_.clear();
+
+    revalidateDocuments(findAllDependents(affectedVLNVs));
+
+    if (hierarchyChanged)
     {
-        // TODO: File removed.
+        hierarchyModel_->onResetModel();
     }
+
+    index_.save();
 }
 
 //-----------------------------------------------------------------------------
@@ -1018,6 +1724,12 @@ void LibraryHandler::syncronizeModels()
 //-----------------------------------------------------------------------------
 void LibraryHandler::showNotFoundError(VLNV const& vlnv) const
 {
+    // Missing references found by the integrity check threads are reported by the check itself.
+    if (QThread::currentThread() != thread())
+    {
+        return;
+    }
+
     messageChannel_->showError(tr("VLNV: %1 was not found in library.").arg(vlnv.toString()));
 }
 
@@ -1034,12 +1746,27 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
         targetPath = pathInfo.symLinkTarget();
     }
 
-    fileWatch_.removePath(targetPath);
     fileAccess_.writeDocument(model, targetPath);
-    fileWatch_.addPath(targetPath);
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model, validateDocument(model, targetPath)));
+    // The written state is recorded, so the write is not reported as an external change.
+    fileWatch_.addFile(targetPath);
+
+    QFileInfo targetInfo(targetPath);
+    index_.setEntry(targetInfo, model->getVlnv());
+    index_.setDependencies(targetInfo.absoluteFilePath(), model->getDependentVLNVs().toVector());
+
+    bool isValid = validateAndReport(model->getVlnv(), model, targetPath);
+
+    QWriteLocker locker(&documentLock_);
+    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, isValid));
+    locker.unlock();
+    documentPaths_.insert(targetInfo.absoluteFilePath(), model->getVlnv());
+    cacheDocument(model->getVlnv(), targetPath, model);
 
+    updateDependencies(model->getVlnv(), targetPath, model);
+    revalidateDependents(model->getVlnv());
+
+    emit documentChanged(model->getVlnv());
     return true;
 }
 
@@ -1050,8 +1777,20 @@ void LibraryHandler::clearCache()
 {
     if (!documentCache_.isEmpty())
     {
-        fileWatch_.removePaths(fileWatch_.files());
+        fileWatch_.clear();
+        documentPaths_.clear();
+
+        QWriteLocker locker(&documentLock_);
         documentCache_.clear();
+        locker.unlock();
+
+        QMutexLocker cacheLocker(&cacheMutex_);
+        parsedDocuments_.clear();
+        cacheClears_++;
+        cacheLocker.unlock();
+
+        dependencyGraph_.clear();
+        unresolvedDependencies_.clear();
     }
 }
 
@@ -1062,9 +1801,25 @@ void LibraryHandler::loadAvailableVLNVs()
 {
     messageChannel_->showStatusMessage(tr("Scanning library. Please wait..."));
 
+    QSettings settings;
+    fileAccess_.setStreamingReadersEnabled(
+        settings.value(QStringLiteral("Library/StreamingReaders"), false).toBool());
+    qint64 cacheBudgetMB =
+        settings.value(QStringLiteral("Library/CacheBudget"), DocumentCache::DEFAULT_BUDGET_MB).toLongLong();
+    parsedDocuments_.setBudget(cacheBudgetMB * 1024 * 1024);
+
+    parallelValidation_ = parallelValidationRequested_ ||
+        settings.value(QStringLiteral("Library/ParallelValidation"), false).toBool();
+    validator_.setParallelComponentValidation(parallelValidation_);
+
     // Read all items before validation.
     // Validation will check for VLNVs in the library, so they must be available before validation.
-    QVector<LibraryLoader::LoadTarget> vlnvPaths = loader_.parseLibrary();
+    if (index_.entries().isEmpty())
+    {
+        index_.load();
+    }
+
+    QVector<LibraryLoader::LoadTarget> vlnvPaths = loader_.parseLibrary(index_);
     for (auto const& target: vlnvPaths)
     {
         if (contains(target.vlnv))
@@ -1074,8 +1829,21 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
+            QWriteLocker locker(&documentLock_);
             documentCache_.insert(target.vlnv, DocumentInfo(target.path));
-            fileWatch_.addPath(target.path);
+            locker.unlock();
+
+            documentPaths_.insert(QFileInfo(target.path).absoluteFilePath(), target.vlnv);
+            fileWatch_.addFile(target.path);
+        }
+    }
+
+    // References known from earlier runs are available before any document is parsed.
+    for (LibraryIndex::Entry const& entry : index_.entries())
+    {
+        if (entry.dependenciesKnown && documentCache_.value(entry.vlnv).path == entry.path)
+        {
+            dependencyGraph_.setDependencies(entry.vlnv, entry.dependencies);
         }
     }
     messageChannel_->showStatusMessage(tr("Ready."));
@@ -1101,6 +1869,13 @@ void LibraryHandler::showIntegrityResults() const
     messageChannel_->showMessage(tr("Total library object count: %1").arg(documentCache_.size()));
     messageChannel_->showMessage(tr("Total file count in the library: %1").arg(checkResults_.fileCount));
 
+    DocumentCache::Statistics cacheStatistics = parsedDocuments_.statistics();
+    messageChannel_->showMessage(
+        tr("Document cache: %1 hits, %2 misses, %3 evictions, %4 documents using %5 MB").arg(
+        QString::number(cacheStatistics.hits), QString::number(cacheStatistics.misses),
+        QString::number(cacheStatistics.evictions), QString::number(cacheStatistics.documentCount),
+        QString::number(cacheStatistics.usedBytes / (1024 * 1024))));
+
     // if errors were found then print the summary of error types
     if (checkResults_.documentCount > 0)
     {
@@ -1108,6 +1883,377 @@ void LibraryHandler::showIntegrityResults() const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::updateDependencies()
+//-----------------------------------------------------------------------------
+void LibraryHandler::updateDependencies(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document)
+{
+    if (document.isNull())
+    {
+        return;
+    }
+
+    QVector<VLNV> dependencies = document->getDependentVLNVs().toVector();
+    dependencyGraph_.setDependencies(vlnv, dependencies);
+    index_.setDependencies(QFileInfo(path).absoluteFilePath(), dependencies);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::revalidateDependents()
+//-----------------------------------------------------------------------------
+void LibraryHandler::revalidateDependents(VLNV const& vlnv)
+{
+    resolveDependencies(VLNV::INVALID);
+    revalidateDocuments(dependencyGraph_.getAllDependents(vlnv));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::revalidateDocuments()
+//-----------------------------------------------------------------------------
+void LibraryHandler::revalidateDocuments(QVector<VLNV> const& vlnvs)
+{
+    for (VLNV const& vlnv : vlnvs)
+    {
+        auto info = documentCache_.find(vlnv);
+        if (info == documentCache_.end())
+        {
+            continue;
+        }
+
+        // The validation reads the document information, so the lock is not held while validating.
+        bool wasValid = info->isValid;
+        bool isValid = validateAndReport(info.key(), findOrReadDocument(info.key(), info->path), info->path);
+
+        QWriteLocker locker(&documentLock_);
+        info->isValid = isValid;
+        locker.unlock();
+
+        if (isValid != wasValid)
+        {
+            treeModel_->onDocumentUpdated(info.key());
+            hierarchyModel_->onDocumentUpdated(info.key());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findAllDependents()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::findAllDependents(QVector<VLNV> const& vlnvs) const
+{
+    resolveDependencies(VLNV::INVALID);
+
+    QVector<VLNV> dependents;
+    QMap<VLNV, bool> found;
+    for (VLNV const& vlnv : vlnvs)
+    {
+        for (VLNV const& dependent : dependencyGraph_.getAllDependents(vlnv))
+        {
+            if (found.contains(dependent) == false)
+            {
+                found.insert(dependent, true);
+                dependents.append(dependent);
+            }
+        }
+    }
+
+    return dependents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::validateAndReport()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::validateAndReport(VLNV const& vlnv, QSharedPointer<Document> document, QString const& path)
+{
+    if (integrityModel_ == 0)
+    {
+        return validateDocument(document, path);
+    }
+
+    // The errors are needed for the report, so the validity is derived from them instead of a second check.
+    QVector<ValidationDiagnostic> diagnostics = findDiagnosticsInDocument(document, path);
+    updateIntegrityReport(vlnv, DocumentValidator::getMessages(diagnostics));
+
+    return document.isNull() == false && DocumentValidator::hasErrors(diagnostics) == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::updateIntegrityReport()
+//-----------------------------------------------------------------------------
+void LibraryHandler::updateIntegrityReport(VLNV const& vlnv, QVector<QString> const& errors)
+{
+    if (integrityModel_ != 0)
+    {
+        integrityModel_->setErrors(errors, vlnv.toString());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::checkDocuments()
+//-----------------------------------------------------------------------------
+QVector<LibraryHandler::IntegrityResult> LibraryHandler::checkDocuments(
+    QVector<LibraryLoader::LoadTarget> const& targets)
+{
+    QVector<IntegrityResult> results(targets.count());
+    if (targets.isEmpty())
+    {
+        return results;
+    }
+
+    int threadCount = QSettings().value(QStringLiteral("Library/ScanThreadCount"),
+        QThread::idealThreadCount()).toInt();
+
+    integrityCheckCanceled_.storeRelease(0);
+
+    // Workers pick the next unchecked document until all are checked or the check is canceled.
+    // Each result is written to its own slot, so no locking is needed for the result vector.
+    QAtomicInt nextIndex(0);
+    QAtomicInt checkedCount(0);
+    int workerCount = qBound(1, threadCount, targets.count());
+
+    // The documents are validated in parallel at one level only. The sections of the components are validated
+    // in parallel tasks only when a single worker checks the documents, so the thread pools are not oversubscribed.
+    bool parallelSections = parallelValidation_ && workerCount == 1;
+
+    auto worker = [this, &targets, &results, &nextIndex, &checkedCount, parallelSections]()
+    {
+        // The validators keep state of the document being validated, so each worker has its own for all the
+        // documents it checks.
+        DocumentValidator validator(this);
+        validator.setParallelComponentValidation(parallelSections);
+
+        for (int i = nextIndex.fetchAndAddRelaxed(1); i < targets.count(); i = nextIndex.fetchAndAddRelaxed(1))
+        {
+            if (integrityCheckCanceled_.loadAcquire() != 0)
+            {
+                return;
+            }
+
+            results[i] = checkDocument(targets.at(i), validator);
+            checkedCount.fetchAndAddRelaxed(1);
+        }
+    };
+
+    // Library changes found by the file watcher are held until the results have been applied.
+    integrityCheckRunning_ = true;
+
+    QThreadPool checkPool;
+    checkPool.setMaxThreadCount(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        QtConcurrent::run(&checkPool, worker);
+    }
+
+    QScopedPointer<QProgressDialog> progress;
+    if (parentWidget_)
+    {
+        progress.reset(new QProgressDialog(tr("Checking library integrity..."), tr("Cancel"), 0,
+            targets.count(), parentWidget_));
+        progress->setWindowModality(Qt::WindowModal);
+        progress->setMinimumDuration(500);
+    }
+
+    // The GUI thread only reports the progress, so the application stays responsive during the check.
+    // Without the progress dialog there is nothing for the user to interact with during the check.
+    QEventLoop waitLoop;
+    QTimer progressTimer;
+    connect(&progressTimer, &QTimer::timeout, &waitLoop,
+        [this, &checkPool, &checkedCount, &progress, &waitLoop]()
+    {
+        if (progress)
+        {
+            progress->setValue(checkedCount.loadAcquire());
+            if (progress->wasCanceled())
+            {
+                onCancelIntegrityCheck();
+            }
+        }
+
+        if (checkPool.waitForDone(0))
+        {
+            waitLoop.quit();
+        }
+    });
+    progressTimer.start(INTEGRITY_PROGRESS_INTERVAL);
+
+    if (checkPool.waitForDone(0) == false)
+    {
+        waitLoop.exec(progress ? QEventLoop::AllEvents : QEventLoop::ExcludeUserInputEvents);
+    }
+
+    progressTimer.stop();
+    checkPool.waitForDone();
+
+    integrityCheckRunning_ = false;
+
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::checkDocument()
+//-----------------------------------------------------------------------------
+LibraryHandler::IntegrityResult LibraryHandler::checkDocument(LibraryLoader::LoadTarget const& target,
+    DocumentValidator& validator)
+{
+    IntegrityResult result;
+    result.checked = true;
+
+    unsigned int generation = documentGeneration(target.path);
+    QSharedPointer<Document> model = readDocumentFile(target.path);
+
+    // The cache budget keeps the whole library from being held in memory during the check.
+    cacheReadDocument(target.vlnv, target.path, model, generation);
+
+    if (model.isNull() == false)
+    {
+        result.dependencies = model->getDependentVLNVs().toVector();
+        result.dependenciesRead = true;
+        result.referencedPaths = findReferencedPaths(model, target.path);
+    }
+
+    result.isValid = validateDocument(model, target.path, validator, result.fileCount);
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::readDocumentFile()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::readDocumentFile(QString const& path)
+{
+    if (QThread::currentThread() == thread())
+    {
+        return fileAccess_.readDocument(path);
+    }
+
+    // The message channel may only be used from the GUI thread.
+    DocumentFileAccess workerAccess(nullptr);
+    workerAccess.setStreamingReadersEnabled(fileAccess_.streamingReadersEnabled());
+    return workerAccess.readDocument(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findOrReadDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::findOrReadDocument(VLNV const& vlnv, QString const& path)
+{
+    QMutexLocker locker(&cacheMutex_);
+    QSharedPointer<Document> document = parsedDocuments_.find(vlnv);
+    locker.unlock();
+
+    // The file is read without holding the lock, so other threads can use the cache meanwhile.
+    if (document.isNull())
+    {
+        unsigned int generation = documentGeneration(path);
+        document = readDocumentFile(path);
+        cacheReadDocument(vlnv, path, document, generation);
+    }
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findDocumentPath()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::findDocumentPath(VLNV const& vlnv, QString& path) const
+{
+    QReadLocker locker(&documentLock_);
+    auto info = documentCache_.constFind(vlnv);
+    if (info == documentCache_.constEnd())
+    {
+        return false;
+    }
+
+    path = info->path;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::readDependencies()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::readDependencies(VLNV const& vlnv)
+{
+    QString path;
+    if (findDocumentPath(vlnv, path) == false)
+    {
+        return QVector<VLNV>();
+    }
+
+    QSharedPointer<Document> document = findOrReadDocument(vlnv, path);
+    if (document.isNull())
+    {
+        return QVector<VLNV>();
+    }
+
+    return document->getDependentVLNVs().toVector();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cacheDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cacheDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document)
+{
+    QFileInfo fileInfo(path);
+    qint64 cost = DocumentCache::estimateFootprint(fileInfo.size());
+
+    QMutexLocker locker(&cacheMutex_);
+    documentGenerations_[fileInfo.absoluteFilePath()]++;
+
+    if (document.isNull())
+    {
+        parsedDocuments_.remove(vlnv);
+    }
+    else
+    {
+        parsedDocuments_.insert(vlnv, document, cost);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cacheReadDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cacheReadDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document,
+    unsigned int generation)
+{
+    // Failed reads are not cached, so the file is read again once it has been fixed.
+    if (document.isNull())
+    {
+        return;
+    }
+
+    QFileInfo fileInfo(path);
+    qint64 cost = DocumentCache::estimateFootprint(fileInfo.size());
+
+    // A newer version of the document may have been cached or the file changed while it was read.
+    QMutexLocker locker(&cacheMutex_);
+    if (cacheClears_ + documentGenerations_.value(fileInfo.absoluteFilePath()) == generation)
+    {
+        parsedDocuments_.insert(vlnv, document, cost);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::evictDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::evictDocument(VLNV const& vlnv, QString const& path)
+{
+    QMutexLocker locker(&cacheMutex_);
+    documentGenerations_[QFileInfo(path).absoluteFilePath()]++;
+    parsedDocuments_.remove(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::documentGeneration()
+//-----------------------------------------------------------------------------
+unsigned int LibraryHandler::documentGeneration(QString const& path) const
+{
+    QString filePath = QFileInfo(path).absoluteFilePath();
+
+    // Both counters only grow, so their sum changes whenever either of them changes.
+    QMutexLocker locker(&cacheMutex_);
+    return cacheClears_ + documentGenerations_.value(filePath);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::removeSelectedObjects()
 //-----------------------------------------------------------------------------
@@ -1117,12 +2263,15 @@ LibraryHandler::DocumentStatistics LibraryHandler::removeSelectedObjects(
     DocumentStatistics removeStatistics;
 
     QStringList changedDirectories;
+    QVector<VLNV> removedVLNVs;
     for (ObjectSelectionListItem* removedItem : removedItems)
     {
-        if (removedItem->getType() == ObjectSelectionListItem::VLNVOJBECT)
+        VLNV removedVLNV = removedItem->getVLNV();
+        if (removedItem->getType() == ObjectSelectionListItem::VLNVOJBECT && contains(removedVLNV))
         {
-            changedDirectories.append(QFileInfo(getPath(removedItem->getVLNV())).absolutePath());
-            removeObject(removedItem->getVLNV());
+            changedDirectories.append(QFileInfo(getPath(removedVLNV)).absolutePath());
+            removeDocument(removedVLNV);
+            removedVLNVs.append(removedVLNV);
             removeStatistics.documentCount++;
         }
         else if (removedItem->getType() == ObjectSelectionListItem::FILE)
@@ -1139,6 +2288,9 @@ LibraryHandler::DocumentStatistics LibraryHandler::removeSelectedObjects(
         }
     }
 
+    // The users of all the removed documents are validated once, after everything has been removed.
+    revalidateDocuments(findAllDependents(removedVLNVs));
+
     loader_.clean(changedDirectories);
 
     return removeStatistics;
@@ -1372,16 +2524,25 @@ bool LibraryHandler::validateDocument(QSharedPointer<Document> document, QString
 
     Q_ASSERT(!documentPath.isEmpty());
 
-    if (QFileInfo(documentPath).exists() == false)
+    return validateDocument(document, documentPath, validator_, checkResults_.fileCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::validateDocument()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::validateDocument(QSharedPointer<Document> document, QString const& documentPath,
+    DocumentValidator& validator, int& fileCount) const
+{
+    if (document.isNull() || QFileInfo(documentPath).exists() == false)
     {
         return false;
     }
 
-    bool documentValid = validator_.validate(document);
+    bool documentValid = validator.validate(document);
 
     return documentValid && validateDependentVLNVReferencences(document) &&
         validateDependentDirectories(document, documentPath) &&
-        validateDependentFiles(document, documentPath);
+        validateDependentFiles(document, documentPath, fileCount);
 }
 
 //-----------------------------------------------------------------------------
@@ -1389,32 +2550,52 @@ bool LibraryHandler::validateDocument(QSharedPointer<Document> document, QString
 //-----------------------------------------------------------------------------
 QVector<QString> LibraryHandler::findErrorsInDocument(QSharedPointer<Document> document, QString const& path)
 {
-    QVector<QString> errorList;
+    return DocumentValidator::getMessages(findDiagnosticsInDocument(document, path));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findDiagnosticsInDocument()
+//-----------------------------------------------------------------------------
+QVector<ValidationDiagnostic> LibraryHandler::findDiagnosticsInDocument(QSharedPointer<Document> document,
+    QString const& path)
+{
+    QVector<ValidationDiagnostic> diagnostics;
     if (document.isNull())
     {
-        return errorList;
+        return diagnostics;
     }
 
     if (QFileInfo(path).exists() == false)
     {
-        errorList.append(tr("File %1 for the document was not found.").arg(path));
+        diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_ERROR, path,
+            tr("File %1 for the document was not found.").arg(path)));
     }
 
-    validator_.findErrorsIn(document, errorList);
-
-    findErrorsInDependentVLNVReferencences(document, errorList);
+    diagnostics += validator_.findDiagnostics(document);
 
-    findErrorsInDependentDirectories(document, path, errorList);
+    QVector<QString> referenceErrors;
+    findErrorsInDependentVLNVReferencences(document, referenceErrors);
+    for (QString const& error : referenceErrors)
+    {
+        diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_ERROR,
+            document->getVlnv().toString(), error));
+    }
 
-    findErrorsInDependentFiles(document, path, errorList);
+    QVector<QString> fileErrors;
+    findErrorsInDependentDirectories(document, path, fileErrors);
+    findErrorsInDependentFiles(document, path, fileErrors);
+    for (QString const& error : fileErrors)
+    {
+        diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_ERROR, path, error));
+    }
 
-    return errorList;
+    return diagnostics;
 }
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::validateDependentVLNVReferencences()
 //-----------------------------------------------------------------------------
-bool LibraryHandler::validateDependentVLNVReferencences(QSharedPointer<Document> document)
+bool LibraryHandler::validateDependentVLNVReferencences(QSharedPointer<Document> document) const
 {
     for (VLNV const& vlnv : document->getDependentVLNVs())
     {
@@ -1445,7 +2626,8 @@ void LibraryHandler::findErrorsInDependentVLNVReferencences(QSharedPointer<const
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::validateDependentDirectories()
 //-----------------------------------------------------------------------------
-bool LibraryHandler::validateDependentDirectories(QSharedPointer<Document> document, QString const& documentPath)
+bool LibraryHandler::validateDependentDirectories(QSharedPointer<Document> document,
+    QString const& documentPath) const
 {
     for (QString const& directoryPath : document->getDependentDirs())
     {
@@ -1478,7 +2660,8 @@ void LibraryHandler::findErrorsInDependentDirectories(QSharedPointer<const Docum
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::validateDependentFiles()
 //-----------------------------------------------------------------------------
-bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath)
+bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath,
+    int& fileCount) const
 {
     for (QString filePath : document->getDependentFiles())
     {
@@ -1498,7 +2681,7 @@ bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, Q
             }
             else
             {
-                checkResults_.fileCount++;
+                fileCount++;
             }
         }
     }
@@ -1506,6 +2689,35 @@ bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, Q
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findReferencedPaths()
+//-----------------------------------------------------------------------------
+QStringList LibraryHandler::findReferencedPaths(QSharedPointer<Document> document, QString const& documentPath) const
+{
+    QStringList referencedPaths;
+    for (QString const& directoryPath : document->getDependentDirs())
+    {
+        referencedPaths.append(QFileInfo(General::getAbsolutePath(documentPath, directoryPath)).absoluteFilePath());
+    }
+
+    for (QString const& filePath : document->getDependentFiles())
+    {
+        int pos = 0;
+        if (urlTester_.validate(filePath, pos) != QValidator::Acceptable)
+        {
+            QString absolutePath = filePath;
+            if (QFileInfo(filePath).isRelative())
+            {
+                absolutePath = General::getAbsolutePath(documentPath, filePath);
+            }
+
+            referencedPaths.append(QFileInfo(absolutePath).absoluteFilePath());
+        }
+    }
+
+    return referencedPaths;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryData::findErrorsInDependentFiles()
 //-----------------------------------------------------------------------------
@@ -12,11 +12,15 @@
 #ifndef LIBRARYHANDLER_H
 #define LIBRARYHANDLER_H
 
+#include "LibraryFileWatcher.h"
+#include "LibraryIndex.h"
 #include "LibraryInterface.h"
 #include "LibraryLoader.h"
 #include "LibraryTreeWidget.h"
 #include "LibraryTreeModel.h"
 
+#include "DependencyGraph.h"
+#include "DocumentCache.h"
 #include "DocumentFileAccess.h"
 #include "DocumentValidator.h"
 
@@ -30,14 +34,21 @@
 #include <QDir>
 #include <QList>
 #include <QFileInfo>
-#include <QFileSystemWatcher>
+#include <QHash>
 #include <QSharedPointer>
+#include <QAtomicInt>
 #include <QMap>
+#include <QMutex>
 #include <QObject>
+#include <QReadWriteLock>
+#include <QSet>
+#include <QThreadPool>
+#include <QVector>
 
 using FileList = QVector<QFileInfo>;
 
 class Document;
+class LibraryErrorModel;
 class LibraryItem;
 class MessageMediator;
 class TableViewDialog;
@@ -65,7 +76,7 @@ public:
     LibraryHandler(const LibraryHandler &other) = delete;
 
     //! The destructor
-    virtual ~LibraryHandler() = default;
+    virtual ~LibraryHandler();
 
     //! No assignment
     LibraryHandler &operator=(const LibraryHandler &other) = delete;
@@ -90,6 +101,25 @@ public:
     */
     virtual QSharedPointer<Document const> getModelReadOnly(VLNV const& vlnv) override final;
 
+    /*! Get a model that matches given VLNV without blocking the caller.
+     *
+     *      @param [in] vlnv Identifies the desired document.
+     *
+     *      @return The future for a copy of the model that matches the document.
+    */
+    virtual QFuture<QSharedPointer<Document> > getModelAsync(VLNV const& vlnv) override final;
+
+    /*! Reads the given document and all the documents it needs on background threads.
+     *
+     * The needed documents are found from the read documents, level by level, so the result does not depend on
+     * the dependency graph being filled. The documents of each level are read in parallel.
+     *
+     *      @param [in] vlnv The VLNV of the document whose dependencies to read.
+     *
+     *      @return The future that is finished when all the documents have been read.
+    */
+    virtual QFuture<void> prefetchDependencies(VLNV const& vlnv) override final;
+
     /*! Gets all the VLNVs currently in the library.
      *
      *      @return All known VLNVs in the library.
@@ -151,6 +181,14 @@ public:
 
     //! Search for IP-Xact files in the file system and add them to library
     virtual void searchForIPXactFiles() override final;
+
+    /*!
+     *  Requests the sections of the components to be validated in parallel, even if parallel validation is not
+     *  selected in the library settings. Takes effect on the next library search.
+     *
+     *      @param [in] requested   True to request parallel validation, otherwise false.
+     */
+    void requestParallelValidation(bool requested);
     
     /*! Get list of vlnvs that are needed by given document.
      *
@@ -219,6 +257,14 @@ public:
     */
     virtual int getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const override final;
 
+    /*! Check if the specified item has any child items, without finding all of them.
+     *
+     *      @param [in] vlnvToSearch    Identifies the item to check.
+     *
+     *      @return True, if the item has at least one child item, otherwise false.
+    */
+    virtual bool hasChildren(VLNV const& vlnvToSearch) const override final;
+
     /*! Get the VLNV of the design for a given hierarchy reference.
      *
      * This function can be used by calling it with a hierarchy reference found
@@ -261,15 +307,31 @@ public:
 
     LibraryTreeModel* getTreeModel();
 
+    /*! Get the usage counters of the parsed document cache.
+     *
+     *      @return The cache hits, misses, evictions and the current size of the cache.
+    */
+    DocumentCache::Statistics getCacheStatistics() const;
+
 public slots:
 
     /*! Check the library items for validity
      * 
      * This function automatically removes the invalid library items.
+     * The documents are read and validated in worker threads while the progress is shown.
      *
     */
     virtual void onCheckLibraryIntegrity() override final;
 
+    //! Stops a running integrity check. The documents already checked keep their new results.
+    void onCancelIntegrityCheck();
+
+    /*! Discards the library index and scans all the library files again.
+     *
+     * Use when the index is suspected to be out of sync with the files on disk.
+     */
+    void onRebuildLibraryIndex();
+
     /*! Edit an item in the library
      *
      *      @param [in] vlnv Reference to the vlnv that identifies the object to edit.
@@ -468,6 +530,9 @@ signals:
     //! Inform tree model that a vlnv is to be removed from the tree.
     void removeVLNV(VLNV const& vlnv);
 
+    //! Inform that a document has been added, changed or removed in the library.
+    void documentChanged(VLNV const& vlnv);
+
 
 private slots:
     
@@ -499,25 +564,27 @@ private slots:
     //! Closes the integrity report widget.
     void onCloseIntegrityReport();
 
-    /*! Called when an IP-XACT file has changed on disk.
+    /*! Called when files in the library directories have changed on disk.
+    *   The changes are held during an integrity check and applied when it has finished.
     *
-    *      @param [in] path Path to the changed file.
+    *      @param [in] changedFiles    The changed files.
+    *      @param [in] addedFiles      The added files.
+    *      @param [in] removedFiles    The removed files.
     */
-    void onFileChanged(QString const& path);
+    void onLibraryFilesChanged(QStringList const& changedFiles, QStringList const& addedFiles,
+        QStringList const& removedFiles);
 
 private:
 
     //! All relevant data about an IP-XACT document is stored in DocumentInfo.
+    //! The parsed model is kept separately in the document cache, which may evict it.
     struct DocumentInfo
     {
-        QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
 
         //! Constructor.
-        DocumentInfo(QString const& filePath = QString(), 
-            QSharedPointer<Document> doc = QSharedPointer<Document>(),
-            bool valid = false): document(doc), path(filePath), isValid(valid) {}
+        DocumentInfo(QString const& filePath = QString(), bool valid = false): path(filePath), isValid(valid) {}
     };
 
     //! Struct for collecting document statistics e.g. in export.
@@ -527,6 +594,17 @@ private:
         int documentCount = 0;
     };
 
+    //! Struct for the integrity check result of a single document.
+    struct IntegrityResult
+    {
+        bool checked = false;           //<! Flag for documents checked before a possible cancellation.
+        bool isValid = false;           //<! Flag for well-formed content.
+        bool dependenciesRead = false;  //<! Flag for documents that could be read.
+        QVector<VLNV> dependencies;     //<! The VLNVs referenced by the document.
+        int fileCount = 0;              //<! The number of existing files referenced by the document.
+        QStringList referencedPaths;    //<! The local files and directories referenced by the document.
+    };
+
     //! Struct for holding user selection.
     struct InputSelection
     {
@@ -559,6 +637,222 @@ private:
     //! Shows the results of the library integrity check.
     void showIntegrityResults() const;
 
+    //! Finds the documents missing from the dependency graph. Their references are read only when needed.
+    void findUnresolvedDependencies();
+
+    /*! Reads the references of the documents of a type missing from the dependency graph, so they are included
+     *  when finding the documents referencing another.
+     *
+     *      @param [in] type    The type of the documents to read, or INVALID for all the documents.
+    */
+    void resolveDependencies(VLNV::IPXactType type) const;
+
+    /*! Reads the references of the given documents, if they are missing from the dependency graph.
+     *
+     *      @param [in] vlnvs   The documents to read.
+    */
+    void resolveDependencies(QVector<VLNV> const& vlnvs) const;
+
+    /*! Finds the library documents of the given type.
+     *
+     *      @param [in] vlnvs   The VLNVs to filter.
+     *      @param [in] type    The document type to find.
+     *
+     *      @return The VLNVs of the given type found in the library.
+    */
+    QVector<VLNV> filterByType(QVector<VLNV> const& vlnvs, VLNV::IPXactType type) const;
+
+    /*! Finds the components having the given design or design configuration as a hierarchical view.
+     *
+     *      @param [in] vlnv    The design or the design configuration.
+     *
+     *      @return The owning components.
+    */
+    QVector<VLNV> findHierarchyOwners(VLNV const& vlnv) const;
+
+    /*! Finds the items directly below the given item in the library hierarchy.
+     *
+     *      @param [in] vlnv    The item whose children to find.
+     *
+     *      @return The child items.
+    */
+    QVector<VLNV> findHierarchyChildren(VLNV const& vlnv) const;
+
+    /*! Checks the integrity of the documents changed since the previous check.
+     *
+     * Documents unchanged since the previous check keep their stored validity. Changed documents, their
+     * dependents, documents that were invalid, documents whose referenced items, files or directories are
+     * missing and documents checked with other validation rules are checked.
+     */
+    void checkChangedDocuments();
+
+    /*! Checks the integrity of the given documents and stores the results.
+     *
+     *      @param [in] targets     The documents to check.
+     */
+    void checkIntegrity(QVector<LibraryLoader::LoadTarget> const& targets);
+
+    //! Applies the library file changes held during the integrity check.
+    void applyHeldLibraryChanges();
+
+    /*! Updates the references of a document in the dependency graph and the library index.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] path        The path to the document file.
+     *      @param [in] document    The parsed document.
+    */
+    void updateDependencies(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document);
+
+    /*! Re-validates the documents referencing the given VLNV directly or through other documents.
+     *
+     * Called when the document has been changed, added or removed, so only the affected documents are
+     * validated instead of the whole library.
+     *
+     *      @param [in] vlnv    The changed document.
+    */
+    void revalidateDependents(VLNV const& vlnv);
+
+    /*! Re-validates the given documents and updates their status in the views and the integrity report.
+     *
+     *      @param [in] vlnvs   The documents to validate. VLNVs not in the library are skipped.
+    */
+    void revalidateDocuments(QVector<VLNV> const& vlnvs);
+
+    /*! Finds the documents using any of the given documents directly or through other documents.
+     *
+     *      @param [in] vlnvs   The used documents.
+     *
+     *      @return The documents using the given documents, each included once.
+    */
+    QVector<VLNV> findAllDependents(QVector<VLNV> const& vlnvs) const;
+
+    /*! Removes a document from the library and the file system without validating the documents using it.
+     *
+     *      @param [in] vlnv    The document to remove.
+    */
+    void removeDocument(VLNV const& vlnv);
+
+    /*! Removes a document from the library without removing its file or validating the documents using it.
+     *
+     *      @param [in] vlnv    The document to remove.
+    */
+    void removeFromLibrary(VLNV const& vlnv);
+
+    /*! Adds a document found in the file system to the library without validating the documents using it.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *      @param [in] path    The path of the document file.
+    */
+    void addFromFile(VLNV const& vlnv, QString const& path);
+
+    /*! Checks the validity of a document and updates its errors in the open integrity report.
+     *
+     *  Without an open report the check stops at the first error. Otherwise the document is checked only once
+     *  and the validity is derived from the errors found.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] document    The document to check.
+     *      @param [in] path        The path to the document file.
+     *
+     *      @return True, if the document is valid, otherwise false.
+    */
+    bool validateAndReport(VLNV const& vlnv, QSharedPointer<Document> document, QString const& path);
+
+    /*! Sets the errors of a document in the open integrity report.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] errors      The errors in the document.
+    */
+    void updateIntegrityReport(VLNV const& vlnv, QVector<QString> const& errors);
+
+    /*! Reads and validates the given documents in worker threads.
+     *
+     *      @param [in] targets     The documents to check.
+     *
+     *      @return The results in the order of the targets.
+    */
+    QVector<IntegrityResult> checkDocuments(QVector<LibraryLoader::LoadTarget> const& targets);
+
+    /*! Reads and validates a single document. May be called from a worker thread.
+     *
+     *      @param [in] target      The document to check.
+     *      @param [in] validator   The validator owned by the calling thread.
+     *
+     *      @return The result of the check.
+    */
+    IntegrityResult checkDocument(LibraryLoader::LoadTarget const& target, DocumentValidator& validator);
+
+    /*! Reads a document from the given file. Messages are shown only when called from the GUI thread.
+     *
+     *      @param [in] path    The path to the document file.
+     *
+     *      @return The parsed document.
+    */
+    QSharedPointer<Document> readDocumentFile(QString const& path);
+
+    /*! Get the parsed document from the cache or read it from the file, if it is not cached.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *      @param [in] path    The path to the document file.
+     *
+     *      @return The parsed document.
+    */
+    QSharedPointer<Document> findOrReadDocument(VLNV const& vlnv, QString const& path);
+
+    /*! Find the path of a document in the library. Can be called from any thread.
+     *
+     *      @param [in]  vlnv   The VLNV of the document.
+     *      @param [out] path   The path to the document file.
+     *
+     *      @return True, if the document is in the library, otherwise false.
+    */
+    bool findDocumentPath(VLNV const& vlnv, QString& path) const;
+
+    /*! Get the documents needed by a document, reading the document if it is not cached. Can be called from
+     *  any thread.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return The VLNVs needed by the document, or empty if the document is not in the library.
+    */
+    QVector<VLNV> readDependencies(VLNV const& vlnv);
+
+    /*! Adds the current version of a document to the cache, e.g. after the document has been saved. The
+     *  documents read from the file before this are no longer cached.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] path        The path to the document file.
+     *      @param [in] document    The document.
+    */
+    void cacheDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document);
+
+    /*! Adds a document read from its file to the cache, unless the read failed or the cached document has been
+     *  replaced or evicted since the read started. Can be called from any thread.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] path        The path to the document file.
+     *      @param [in] document    The read document.
+     *      @param [in] generation  The generation of the document file when the read started.
+    */
+    void cacheReadDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document,
+        unsigned int generation);
+
+    /*! Removes a document from the cache, e.g. after its file has changed.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *      @param [in] path    The path to the document file.
+    */
+    void evictDocument(VLNV const& vlnv, QString const& path);
+
+    /*! Get the generation of a document file, which changes whenever the cached document of the file is
+     *  replaced or evicted. Can be called from any thread.
+     *
+     *      @param [in] path    The path to the document file.
+     *
+     *      @return The generation of the document file.
+    */
+    unsigned int documentGeneration(QString const& path) const;
+
     /*! Removes all the given objects.
     *
     *      @param [in] removedItems The objects to remove.
@@ -644,6 +938,20 @@ private:
      */
     bool validateDocument(QSharedPointer<Document> document, QString const& documentPath);
 
+    /*!
+     *  Check if the given document is valid IP-XACT using the given validator. May be called from a worker
+     *  thread, as long as each thread uses its own validator.
+     *
+     *      @param [in] document           The document to check.
+     *      @param [in] documentPath       The path to the document file on disk.
+     *      @param [in] validator          The validator for the document content.
+     *      @param [in/out] fileCount      The number of existing files referenced by the documents.
+     *
+     *      @return True, if the document is valid, otherwise false.
+     */
+    bool validateDocument(QSharedPointer<Document> document, QString const& documentPath,
+        DocumentValidator& validator, int& fileCount) const;
+
     /*!
      *  Find errors in the given document.
      *
@@ -654,13 +962,24 @@ private:
      */
     QVector<QString> findErrorsInDocument(QSharedPointer<Document> document,  QString const& path);
 
+    /*!
+     *  Find the problems in the given document with the elements containing them.
+     *
+     *      @param [in] document           The document to check.
+     *      @param [in] documentPath       The path to the document file on disk.
+     *
+     *      @return The problems found in the document.
+     */
+    QVector<ValidationDiagnostic> findDiagnosticsInDocument(QSharedPointer<Document> document,
+        QString const& path);
+
     /*! Check the validity of VLNV references within a document.
      *
      *      @param [in] document    The document to check.
      *
      *      @return True if the VLVN references are valid, otherwise false.
      */
-    bool validateDependentVLNVReferencences(QSharedPointer<Document> document);
+    bool validateDependentVLNVReferencences(QSharedPointer<Document> document) const;
 
     /*!
      *  Finds any errors within a given document VLNV references.
@@ -677,7 +996,7 @@ private:
      *
      *      @return True if the directory references are valid, otherwise false.
      */
-    bool validateDependentDirectories(QSharedPointer<Document> document, QString const& documentPath);
+    bool validateDependentDirectories(QSharedPointer<Document> document, QString const& documentPath) const;
 
     /*!
      *  Finds any errors within a given document directory references.
@@ -691,11 +1010,23 @@ private:
 
     /*! Check the validity of file references within a document.
      *
-     *      @param [in] document    The document to check.
+     *      @param [in] document        The document to check.
+     *      @param [in] documentPath    The path to the document XML file.
+     *      @param [in/out] fileCount   The number of existing files referenced by the documents.
      *
      *      @return True if the file references are valid, otherwise false.
      */
-    bool validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath);
+    bool validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath,
+        int& fileCount) const;
+
+    /*! Finds the local files and directories referenced by a document.
+     *
+     *      @param [in] document        The document whose references to find.
+     *      @param [in] documentPath    The path to the document XML file.
+     *
+     *      @return The absolute paths of the referenced files and directories.
+     */
+    QStringList findReferencedPaths(QSharedPointer<Document> document, QString const& documentPath) const;
 
     /*!
      *  Finds any errors within a given document file references.
@@ -723,6 +1054,9 @@ private:
     //! Loads the library content.
     LibraryLoader loader_;
 
+    //! Persistent index of the library files used to skip reading unchanged files.
+    LibraryIndex index_;
+
     /*! Cache of documents in the library.
      *
      * Key = VLNV that identifies the library object.
@@ -730,12 +1064,49 @@ private:
      */
     QMap<VLNV, DocumentInfo> documentCache_;
 
+    //! Guards the document information, which is also read from the integrity check threads. The information
+    //! is changed only in the GUI thread, so the GUI thread reads it without locking.
+    mutable QReadWriteLock documentLock_;
+
+    //! The parsed documents within the memory budget.
+    DocumentCache parsedDocuments_;
+
+    //! Guards the parsed documents, which are also accessed from the integrity check threads.
+    mutable QMutex cacheMutex_;
+
+    //! The number of times the cached document of each file has been replaced or evicted.
+    QHash<QString, unsigned int> documentGenerations_;
+
+    //! The number of times the whole cache has been cleared.
+    unsigned int cacheClears_;
+
+    //! Flag for canceling a running integrity check.
+    QAtomicInt integrityCheckCanceled_;
+
+    //! Flag for a running integrity check, during which the library changes are held.
+    bool integrityCheckRunning_;
+
+    //! The changed files found during the integrity check.
+    QStringList heldChangedFiles_;
+
+    //! The added files found during the integrity check.
+    QStringList heldAddedFiles_;
+
+    //! The removed files found during the integrity check.
+    QStringList heldRemovedFiles_;
+
     //! Checks if the given string is a URL (invalids are allowed) or not.
     QRegularExpressionValidator urlTester_;
 
     //! Validator for IP-XACT documents in the library.
     DocumentValidator validator_;
 
+    //! If true, parallel validation is used regardless of the library settings.
+    bool parallelValidationRequested_;
+
+    //! If true, the sections of the components are validated in parallel.
+    bool parallelValidation_;
+
     //! The model for the tree view
     LibraryTreeModel* treeModel_;
 
@@ -745,14 +1116,36 @@ private:
     //! Widget for showing integrity report on-demand.
     TableViewDialog* integrityWidget_;
 
+    //! The errors shown in the integrity report, kept up to date while the report is open.
+    LibraryErrorModel* integrityModel_;
+
+    //! The VLNV references between the documents in the library, completed as the references are needed.
+    mutable DependencyGraph dependencyGraph_;
+
+    //! The documents whose references are not yet read into the dependency graph.
+    mutable QSet<VLNV> unresolvedDependencies_;
+
     //! If true then items are being saved and library is not refreshed
     bool saveInProgress_;
 
-    //! Watch for changes in the IP-XACT files.
-    QFileSystemWatcher fileWatch_;
+    //! Watch for changes in the directories of the IP-XACT files.
+    LibraryFileWatcher fileWatch_;
+
+    //! The VLNVs of the documents in the library by absolute file path.
+    QHash<QString, VLNV> documentPaths_;
+
+    //! Flag for deferring the validation of the users of saved documents to the end of a batched update.
+    bool deferRevalidation_;
+
+    //! The saved documents whose users are validated at the end of a batched update.
+    QVector<VLNV> deferredRevalidation_;
 
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
+
+    //! The threads reading documents for the asynchronous requests. Declared last, so the running requests
+    //! are finished before the data they use is destroyed.
+    QThreadPool loadPool_;
 };
 
 #endif // LIBRARYHANDLER_H
@@ -0,0 +1,319 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT documents found in the library locations.
+//-----------------------------------------------------------------------------
+
+#include "LibraryIndex.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QSet>
+#include <QSettings>
+
+namespace
+{
+    //! Identifier written at the start of the index file.
+    const quint32 INDEX_MAGIC = 0x4B324C49;
+
+    //-----------------------------------------------------------------------------
+    // Function: writeVLNV()
+    //-----------------------------------------------------------------------------
+    void writeVLNV(QDataStream& stream, VLNV const& vlnv)
+    {
+        stream << static_cast<qint32>(vlnv.getType()) << vlnv.getVendor() << vlnv.getLibrary() <<
+            vlnv.getName() << vlnv.getVersion();
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: readVLNV()
+    //-----------------------------------------------------------------------------
+    VLNV readVLNV(QDataStream& stream)
+    {
+        qint32 type = VLNV::INVALID;
+        QString vendor;
+        QString library;
+        QString name;
+        QString version;
+        stream >> type >> vendor >> library >> name >> version;
+
+        if (type < VLNV::BUSDEFINITION || type > VLNV::INVALID)
+        {
+            type = VLNV::INVALID;
+        }
+
+        return VLNV(static_cast<VLNV::IPXactType>(type), vendor, library, name, version);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::LibraryIndex()
+//-----------------------------------------------------------------------------
+LibraryIndex::LibraryIndex(QString const& indexPath):
+indexPath_(indexPath),
+entries_(),
+modified_(false)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::defaultIndexPath()
+//-----------------------------------------------------------------------------
+QString LibraryIndex::defaultIndexPath()
+{
+    QFileInfo settingsInfo(QSettings().fileName());
+    return settingsInfo.absolutePath() + QStringLiteral("/LibraryIndex.dat");
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::load()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::load()
+{
+    entries_.clear();
+    modified_ = false;
+
+    QFile indexFile(indexPath());
+    if (indexFile.open(QIODevice::ReadOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION)
+    {
+        return false;
+    }
+
+    quint32 entryCount = 0;
+    stream >> entryCount;
+
+    for (quint32 i = 0; i < entryCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        Entry entry;
+        stream >> entry.path;
+        entry.vlnv = readVLNV(stream);
+        stream >> entry.lastModified >> entry.size >> entry.dependenciesKnown;
+
+        qint32 fileCount = 0;
+        stream >> entry.validityKnown >> entry.isValid >> fileCount >> entry.referencedPaths >>
+            entry.validatorVersion;
+        entry.fileCount = fileCount;
+
+        quint32 dependencyCount = 0;
+        stream >> dependencyCount;
+        for (quint32 j = 0; j < dependencyCount && stream.status() == QDataStream::Ok; ++j)
+        {
+            entry.dependencies.append(readVLNV(stream));
+        }
+
+        entries_.insert(entry.path, entry);
+    }
+
+    // A truncated or otherwise corrupted index is discarded as a whole.
+    if (stream.status() != QDataStream::Ok)
+    {
+        entries_.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::save()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::save() const
+{
+    QString path = indexPath();
+    if (modified_ == false && QFileInfo::exists(path))
+    {
+        return true;
+    }
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile indexFile(path);
+    if (indexFile.open(QIODevice::WriteOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << INDEX_MAGIC << INDEX_VERSION << static_cast<quint32>(entries_.count());
+
+    for (Entry const& entry : entries_)
+    {
+        stream << entry.path;
+        writeVLNV(stream, entry.vlnv);
+        stream << entry.lastModified << entry.size << entry.dependenciesKnown;
+        stream << entry.validityKnown << entry.isValid << static_cast<qint32>(entry.fileCount) <<
+            entry.referencedPaths << entry.validatorVersion;
+
+        stream << static_cast<quint32>(entry.dependencies.count());
+        for (VLNV const& dependency : entry.dependencies)
+        {
+            writeVLNV(stream, dependency);
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok || indexFile.commit() == false)
+    {
+        return false;
+    }
+
+    modified_ = false;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::clear()
+//-----------------------------------------------------------------------------
+void LibraryIndex::clear()
+{
+    entries_.clear();
+    QFile::remove(indexPath());
+    modified_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::findCurrent()
+//-----------------------------------------------------------------------------
+LibraryIndex::Entry const* LibraryIndex::findCurrent(QFileInfo const& fileInfo) const
+{
+    auto entry = entries_.constFind(fileInfo.absoluteFilePath());
+    if (entry == entries_.constEnd() || entry->size != fileInfo.size() ||
+        entry->lastModified != fileInfo.lastModified())
+    {
+        return nullptr;
+    }
+
+    return &(*entry);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::setEntry()
+//-----------------------------------------------------------------------------
+void LibraryIndex::setEntry(QFileInfo const& fileInfo, VLNV const& vlnv)
+{
+    Entry entry;
+    entry.vlnv = vlnv;
+    entry.path = fileInfo.absoluteFilePath();
+    entry.lastModified = fileInfo.lastModified();
+    entry.size = fileInfo.size();
+
+    entries_.insert(entry.path, entry);
+    modified_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::setDependencies()
+//-----------------------------------------------------------------------------
+void LibraryIndex::setDependencies(QString const& path, QVector<VLNV> const& dependencies)
+{
+    auto entry = entries_.find(path);
+    if (entry == entries_.end())
+    {
+        return;
+    }
+
+    if (entry->dependenciesKnown == false || entry->dependencies != dependencies)
+    {
+        entry->dependencies = dependencies;
+        entry->dependenciesKnown = true;
+        modified_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::setValidity()
+//-----------------------------------------------------------------------------
+void LibraryIndex::setValidity(QString const& path, bool isValid, int fileCount,
+    QStringList const& referencedPaths, QString const& validatorVersion)
+{
+    auto entry = entries_.find(path);
+    if (entry == entries_.end())
+    {
+        return;
+    }
+
+    if (entry->validityKnown == false || entry->isValid != isValid || entry->fileCount != fileCount ||
+        entry->referencedPaths != referencedPaths || entry->validatorVersion != validatorVersion)
+    {
+        entry->validityKnown = true;
+        entry->isValid = isValid;
+        entry->fileCount = fileCount;
+        entry->referencedPaths = referencedPaths;
+        entry->validatorVersion = validatorVersion;
+        modified_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::removeEntry()
+//-----------------------------------------------------------------------------
+void LibraryIndex::removeEntry(QString const& path)
+{
+    if (entries_.remove(path) != 0)
+    {
+        modified_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::retainOnly()
+//-----------------------------------------------------------------------------
+void LibraryIndex::retainOnly(QStringList const& existingPaths)
+{
+    QSet<QString> existing = existingPaths.toSet();
+
+    for (auto entry = entries_.begin(); entry != entries_.end(); )
+    {
+        if (existing.contains(entry.key()))
+        {
+            ++entry;
+        }
+        else
+        {
+            entry = entries_.erase(entry);
+            modified_ = true;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::indexPath()
+//-----------------------------------------------------------------------------
+QString LibraryIndex::indexPath() const
+{
+    if (indexPath_.isEmpty())
+    {
+        return defaultIndexPath();
+    }
+
+    return indexPath_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::entries()
+//-----------------------------------------------------------------------------
+QHash<QString, LibraryIndex::Entry> const& LibraryIndex::entries() const
+{
+    return entries_;
+}
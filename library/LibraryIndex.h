@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT documents found in the library locations.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYINDEX_H
+#define LIBRARYINDEX_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class QFileInfo;
+
+//-----------------------------------------------------------------------------
+//! Persistent index of the IP-XACT documents found in the library locations.
+//-----------------------------------------------------------------------------
+class LibraryIndex
+{
+public:
+
+    //! The version of the index file format. Increase when the format changes.
+    static const quint32 INDEX_VERSION = 3;
+
+    //! Indexed data of a single IP-XACT file.
+    struct Entry
+    {
+        VLNV vlnv;                      //!< The VLNV defined in the file.
+        QString path;                   //!< The path to the file.
+        QDateTime lastModified;         //!< The modification time of the file when it was indexed.
+        qint64 size = 0;                //!< The size of the file when it was indexed.
+        bool dependenciesKnown = false; //!< Flag for dependencies extracted from the parsed document.
+        QVector<VLNV> dependencies;     //!< The VLNVs referenced by the document.
+        bool validityKnown = false;     //!< Flag for a validity found in a library integrity check.
+        bool isValid = false;           //!< The validity found in the latest integrity check.
+        int fileCount = 0;              //!< The number of existing files referenced by the document.
+        QStringList referencedPaths;    //!< The local files and directories referenced by the document.
+        QString validatorVersion;       //!< The version of the validation rules used in the check.
+    };
+
+    /*! The constructor.
+     *
+     *      @param [in] indexPath   The path to the index file. If empty, the default location is used.
+     */
+    explicit LibraryIndex(QString const& indexPath = QString());
+
+    //! The destructor.
+    ~LibraryIndex() = default;
+
+    /*! Get the default location of the index file next to the application settings.
+     *
+     *      @return The path to the index file.
+     */
+    static QString defaultIndexPath();
+
+    /*! Reads the index from the index file.
+     *
+     * If the file is missing, corrupted or of a different version, the index is left empty.
+     *
+     *      @return True, if the index was read, otherwise false.
+     */
+    bool load();
+
+    /*! Writes the index to the index file.
+     *
+     *      @return True, if the index was written, otherwise false.
+     */
+    bool save() const;
+
+    //! Removes all entries and the index file.
+    void clear();
+
+    /*! Finds the entry for the given file, if the file has not changed since it was indexed.
+     *
+     *      @param [in] fileInfo    The file to find.
+     *
+     *      @return The up-to-date entry or null, if the file is not indexed or has changed.
+     */
+    Entry const* findCurrent(QFileInfo const& fileInfo) const;
+
+    /*! Adds or replaces the entry for the given file.
+     *
+     * Any previously extracted dependencies and check results are discarded.
+     *
+     *      @param [in] fileInfo    The indexed file.
+     *      @param [in] vlnv        The VLNV defined in the file.
+     */
+    void setEntry(QFileInfo const& fileInfo, VLNV const& vlnv);
+
+    /*! Sets the dependencies of the document in the given file.
+     *
+     *      @param [in] path            The path to the document file.
+     *      @param [in] dependencies    The VLNVs referenced by the document.
+     */
+    void setDependencies(QString const& path, QVector<VLNV> const& dependencies);
+
+    /*! Sets the result of the integrity check of the document in the given file.
+     *
+     *      @param [in] path                The path to the document file.
+     *      @param [in] isValid             Flag for a valid document.
+     *      @param [in] fileCount           The number of existing files referenced by the document.
+     *      @param [in] referencedPaths     The absolute paths of the local files and directories referenced by
+     *                                      the document.
+     *      @param [in] validatorVersion    The version of the validation rules used in the check.
+     */
+    void setValidity(QString const& path, bool isValid, int fileCount, QStringList const& referencedPaths,
+        QString const& validatorVersion);
+
+    /*! Removes the entry of the given file.
+     *
+     *      @param [in] path    The path to the removed file.
+     */
+    void removeEntry(QString const& path);
+
+    /*! Removes the entries of all files not in the given list.
+     *
+     *      @param [in] existingPaths   The paths of the files to keep.
+     */
+    void retainOnly(QStringList const& existingPaths);
+
+    /*! Get the index entries.
+     *
+     *      @return The entries keyed by the file path.
+     */
+    QHash<QString, Entry> const& entries() const;
+
+private:
+
+    //! Get the path to the index file in use.
+    QString indexPath() const;
+
+    //! The path to the index file.
+    QString indexPath_;
+
+    //! The index entries keyed by the file path.
+    QHash<QString, Entry> entries_;
+
+    //! Flag for changes not yet written to the index file.
+    mutable bool modified_;
+};
+
+#endif // LIBRARYINDEX_H
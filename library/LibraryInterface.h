@@ -14,6 +14,7 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QFuture>
 #include <QObject>
 #include <QSharedPointer>
 
@@ -71,6 +72,24 @@ public:
         return getModelReadOnly(vlnv).dynamicCast<T const>();
     }
 
+    /*! Get a model that matches given VLNV without blocking the caller. The document is read on a background
+     *  thread, if it has not been read before. Like getModel(), the provided document is a copy.
+     *
+     *      @param [in] vlnv    Identifies the desired document.
+     *
+     *      @return The future for the model that matches the document.
+    */
+    virtual QFuture<QSharedPointer<Document> > getModelAsync(VLNV const& vlnv) = 0;
+
+    /*! Reads the given document and all the documents it needs on background threads, so that they are
+     *  available without reading when they are requested later.
+     *
+     *      @param [in] vlnv    The VLNV of the document whose dependencies to read.
+     *
+     *      @return The future that is finished when all the documents have been read.
+    */
+    virtual QFuture<void> prefetchDependencies(VLNV const& vlnv) = 0;
+
     /*! Checks if the library already contains the specified VLNV.
      *
      *      @param [in] vlnv    The VLNV that is searched within the library.
@@ -192,6 +211,14 @@ public:
     */
     virtual int getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const = 0;
 
+    /*! Check if the specified item has any child items, without finding all of them.
+     *
+     *      @param [in] vlnvToSearch    Identifies the item to check.
+     *
+     *      @return True, if the item has at least one child item, otherwise false.
+    */
+    virtual bool hasChildren(VLNV const& vlnvToSearch) const = 0;
+
     /*! Get the VLNV of the design for a given hierarchy reference.
      *
      * This function can be used by calling it with a hierarchy reference found
@@ -14,8 +14,12 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QSettings>
+#include <QThread>
+#include <QThreadPool>
 #include <QXmlStreamReader>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::LibraryLoader()
 //-----------------------------------------------------------------------------
@@ -29,20 +33,91 @@ LibraryLoader::LibraryLoader(MessageMediator* messageChannel, QObject* parent) :
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::parseLibrary()
 //-----------------------------------------------------------------------------
-QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary()
+QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(LibraryIndex& index)
 {
-    QVector<LoadTarget> vlnvPaths;
-
-    QStringList locations = QSettings().value("Library/ActiveLocations", QStringList()).toStringList();
+    QSettings settings;
+    QStringList locations = settings.value("Library/ActiveLocations", QStringList()).toStringList();
+    int threadCount = settings.value("Library/ScanThreadCount", QThread::idealThreadCount()).toInt();
 
+    QFileInfoList files;
     for (QString const& location : locations)
     {
-        parseDirectory(location, vlnvPaths);
+        parseDirectory(location, files);
+    }
+
+    QStringList filePaths;
+    filePaths.reserve(files.count());
+
+    // Only the files changed since the last scan are read again.
+    QVector<ScanResult> results(files.count());
+    QVector<int> changedFiles;
+    QStringList changedPaths;
+    for (int i = 0; i < files.count(); ++i)
+    {
+        filePaths.append(files.at(i).absoluteFilePath());
+
+        LibraryIndex::Entry const* entry = index.findCurrent(files.at(i));
+        if (entry)
+        {
+            results[i].vlnv = entry->vlnv;
+        }
+        else
+        {
+            changedFiles.append(i);
+            changedPaths.append(filePaths.last());
+        }
+    }
+
+    QVector<ScanResult> changedResults = scanFiles(changedPaths, threadCount);
+    for (int i = 0; i < changedFiles.count(); ++i)
+    {
+        ScanResult const& result = changedResults.at(i);
+        results[changedFiles.at(i)] = result;
+
+        // Files with messages are not indexed, so the messages are shown again on the next scan.
+        if (result.errorMessage.isEmpty() && result.noticeMessage.isEmpty())
+        {
+            index.setEntry(files.at(changedFiles.at(i)), result.vlnv);
+        }
+    }
+
+    index.retainOnly(filePaths);
+
+    // Results are in the enumeration order regardless of the thread count, so messages
+    // and duplicate VLNV resolution stay the same between runs.
+    QVector<LoadTarget> vlnvPaths;
+    vlnvPaths.reserve(files.count());
+
+    for (int i = 0; i < results.count(); ++i)
+    {
+        ScanResult const& result = results.at(i);
+        if (result.errorMessage.isEmpty() == false)
+        {
+            messageChannel_->showError(result.errorMessage);
+        }
+
+        if (result.noticeMessage.isEmpty() == false)
+        {
+            messageChannel_->showMessage(result.noticeMessage);
+        }
+
+        if (result.vlnv.isValid())
+        {
+            vlnvPaths.append(LoadTarget(result.vlnv, filePaths.at(i)));
+        }
     }
 
     return vlnvPaths;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::findDocumentVLNV()
+//-----------------------------------------------------------------------------
+VLNV LibraryLoader::findDocumentVLNV(QString const& path)
+{
+    return getDocumentVLNV(path).vlnv;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clean()
 //-----------------------------------------------------------------------------
@@ -60,7 +135,7 @@ void LibraryLoader::clean(QStringList changedDirectories)
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::parseDirectory()
 //-----------------------------------------------------------------------------
-void LibraryLoader::parseDirectory(QString const& directoryPath, QVector<LoadTarget>& vlnvPaths)
+void LibraryLoader::parseDirectory(QString const& directoryPath, QFileInfoList& files) const
 {
     QDir directoryHandler(directoryPath);
     directoryHandler.setNameFilters(QStringList(QLatin1String("*.xml")));
@@ -71,40 +146,69 @@ void LibraryLoader::parseDirectory(QString const& directoryPath, QVector<LoadTar
     {
         if (entryInfo.isFile())
         {
-            parseFile(entryInfo.absoluteFilePath(), vlnvPaths);
+            files.append(entryInfo);
         }
         else if (entryInfo.isDir())
         {
-            parseDirectory(entryInfo.absoluteFilePath(), vlnvPaths);
+            parseDirectory(entryInfo.absoluteFilePath(), files);
         }
     }
 }
 
 //-----------------------------------------------------------------------------
-// Function: LibraryLoader::parseFile()
+// Function: LibraryLoader::scanFiles()
 //-----------------------------------------------------------------------------
-void LibraryLoader::parseFile(QString const& filePath, QVector<LoadTarget>& vlnvPaths)
+QVector<LibraryLoader::ScanResult> LibraryLoader::scanFiles(QStringList const& filePaths, int threadCount) const
 {
-    VLNV vlnv = getDocumentVLNV(filePath);
+    QVector<ScanResult> results(filePaths.count());
 
-    if (vlnv.isValid() == false)
+    if (threadCount <= 1 || filePaths.count() <= 1)
     {
-        return;
+        for (int i = 0; i < filePaths.count(); ++i)
+        {
+            results[i] = getDocumentVLNV(filePaths.at(i));
+        }
+
+        return results;
+    }
+
+    // Workers pick the next unread file until all are read. Each result is written to its own slot,
+    // so no locking is needed for the result vector.
+    QAtomicInt nextIndex(0);
+    auto worker = [&filePaths, &results, &nextIndex]()
+    {
+        for (int i = nextIndex.fetchAndAddRelaxed(1); i < filePaths.count(); i = nextIndex.fetchAndAddRelaxed(1))
+        {
+            results[i] = getDocumentVLNV(filePaths.at(i));
+        }
+    };
+
+    int workerCount = qMin(threadCount, filePaths.count());
+
+    QThreadPool scanPool;
+    scanPool.setMaxThreadCount(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        QtConcurrent::run(&scanPool, worker);
     }
 
-    vlnvPaths.append(LoadTarget(vlnv, filePath));
+    scanPool.waitForDone();
+
+    return results;
 }
 
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::getDocumentVLNV()
 //-----------------------------------------------------------------------------
-VLNV LibraryLoader::getDocumentVLNV(QString const& path)
+LibraryLoader::ScanResult LibraryLoader::getDocumentVLNV(QString const& path)
 {
+    ScanResult result;
+
     QFile documentFile(path);
     if (!documentFile.open(QFile::ReadOnly))
     {
-        messageChannel_->showError(QObject::tr("File %1 could not be read.").arg(path));
-        return VLNV();
+        result.errorMessage = QObject::tr("File %1 could not be read.").arg(path);
+        return result;
     }
 
     QXmlStreamReader documentReader(&documentFile);
@@ -113,10 +217,10 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path)
     QString type = documentReader.qualifiedName().toString();
     if (type.startsWith(QLatin1String("spirit:")))
     {
-        messageChannel_->showMessage(QObject::tr("File %1 contains an IP-XACT description not compatible "
-            "with the 1685-2014 standard and could not be read.").arg(path));
+        result.noticeMessage = QObject::tr("File %1 contains an IP-XACT description not compatible "
+            "with the 1685-2014 standard and could not be read.").arg(path);
         documentFile.close();
-        return VLNV();
+        return result;
     }
 
     // Find the first element of the VLVN.
@@ -139,7 +243,8 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path)
 
     documentFile.close();
 
-    return VLNV(VLNV::string2Type(type), vendor, library, name, version);
+    result.vlnv = VLNV(VLNV::string2Type(type), vendor, library, name, version);
+    return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -13,9 +13,11 @@
 #define LIBRARYLOADER_H
 
 #include "DocumentFileAccess.h"
+#include "LibraryIndex.h"
 
 #include <common/ui/MessageMediator.h>
 
+#include <QFileInfo>
 #include <QObject>
 
 class LibraryLoader : public QObject
@@ -51,33 +53,58 @@ public:
 
 	/*! Searches for IP-XACT files and returns any found targets.
 	*
+	* Files unchanged since they were indexed are not read again. The index is updated with the files
+	* that were read and the entries of the files no longer in the library are removed.
+	*
+	*      @param [in/out] index   The index of previously found files.
+	*
 	*      @return The found IP-XACT targets.
 	*/
-    QVector<LoadTarget> parseLibrary();
+    QVector<LoadTarget> parseLibrary(LibraryIndex& index);
+
+	/*! Finds the VLNV defined in the given file without reading the whole file.
+	*
+	*      @param [in] path	The file path to search.
+	*
+	*      @return The VLNV found in the file, or an invalid VLNV if the file is not an IP-XACT document.
+	*/
+    static VLNV findDocumentVLNV(QString const& path);
 
 private:
 
-	/*! Searches through a single directory for IP-XACT files.
+    //! Struct for the result of reading the VLNV from a single file.
+    struct ScanResult
+    {
+        VLNV vlnv;              //!< The VLNV found in the file.
+        QString errorMessage;   //!< Error to report, if the file could not be read.
+        QString noticeMessage;  //!< Notice to report, if the file could not be used.
+    };
+
+	/*! Searches through a single directory for candidate IP-XACT files.
 	*
 	*      @param [in]		directoryPath	The directory path to search.
-	*      @param [in/out]	vlnvPaths		The already found targets where any new IP-XACT files will be added.
+	*      @param [in/out]	files		    The already found files where any new files will be added.
 	*/
-    void parseDirectory(QString const& directoryPath, QVector<LoadTarget>& vlnvPaths);
+    void parseDirectory(QString const& directoryPath, QFileInfoList& files) const;
 
-	/*! Searches through a single file for IP-XACT files.
-	*
-	*      @param [in]		filePath	The file path to search.
-	*      @param [in/out]	vlnvPaths	The already found targets where any new IP-XACT files will be added.
-	*/
-    void parseFile(QString const& filePath, QVector<LoadTarget>& vlnvPaths);
+    /*! Reads the VLNVs from the given files.
+    *
+    *      @param [in]	filePaths	    The files to read.
+    *      @param [in]	threadCount	    The number of worker threads to use.
+    *
+    *      @return The read results in the same order as the given files.
+    */
+    QVector<ScanResult> scanFiles(QStringList const& filePaths, int threadCount) const;
 
     /*! Finds the VLNV in the given file.
     *
+    *   The function does not access any members and is safe to call from multiple threads.
+    *
     *      @param [in]		path	The file path to search.
     *
-    *      @return The VLNV found in the given file.
+    *      @return The VLNV found in the given file and any messages for the user.
     */
-    VLNV getDocumentVLNV(QString const& path);
+    static ScanResult getDocumentVLNV(QString const& path);
 
     /*! Clear the empty directories from the disk within given path.
      *
@@ -15,6 +15,7 @@
 
 #include <QCoreApplication>
 #include <QCommandLineParser>
+#include <QCommandLineOption>
 
 #include <Plugins/PluginSystem/IPlugin.h>
 #include <Plugins/PluginSystem/PluginManager.h>
@@ -30,6 +31,8 @@ CommandLineParser::CommandLineParser(): optionParser_(), preReadDone_(false)
 {
     optionParser_.addHelpOption();
     optionParser_.addVersionOption();
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("parallel-validation"),
+        QStringLiteral("Validates the parts of each component in parallel.")));
 }
 
 //-----------------------------------------------------------------------------
@@ -57,6 +60,14 @@ bool CommandLineParser::helpOrVersionOptionSet() const
     return optionParser_.isSet(QStringLiteral("help")) || optionParser_.isSet(QStringLiteral("version"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::parallelValidationSet()
+//-----------------------------------------------------------------------------
+bool CommandLineParser::parallelValidationSet() const
+{
+    return optionParser_.isSet(QStringLiteral("parallel-validation"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::process()
 //-----------------------------------------------------------------------------
@@ -80,6 +91,9 @@ int CommandLineParser::process(QStringList const& arguments, IPluginUtility* uti
                 QStringList pluginArguments = arguments;
                 pluginArguments.pop_front();
 
+                // The option applies to the library scan before the command, so it is not passed to the plugin.
+                pluginArguments.removeAll(QStringLiteral("--parallel-validation"));
+
                 support->process(pluginArguments, utility);
                 return 0;
             }
@@ -133,7 +147,8 @@ QString CommandLineParser::helpText()
         "\n"
         "Options:\n"
         "  -h, --help  Displays this help.\n"
-        "  -v, --version   Displays version information.\n");
+        "  -v, --version   Displays version information.\n"
+        "  --parallel-validation   Validates the parts of each component in parallel.\n");
 
     return text;
 }
@@ -48,6 +48,13 @@ public:
      */
     bool helpOrVersionOptionSet() const;
 
+    /*!
+     *  Checks if the parallel validation option is set.
+     *
+     *      @return True, if the components should be validated in parallel, otherwise false.
+     */
+    bool parallelValidationSet() const;
+
     /*!
      *  Processes the given command line arguments and executes accordingly.
      *
@@ -163,6 +163,7 @@ int main(int argc, char *argv[])
 
         if (!parser.helpOrVersionOptionSet())
         {
+            library->requestParallelValidation(parser.parallelValidationSet());
             library->searchForIPXactFiles();
         }
 
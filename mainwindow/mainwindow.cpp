@@ -133,6 +133,7 @@ actUndo_(0),
 actRedo_(0),
 actLibraryLocations_(0),
 actLibrarySearch_(0),
+actRebuildIndex_(0),
 actCheckIntegrity_(0),
 generationGroup_(0),
 pluginActionGroup_(0),
@@ -234,6 +235,16 @@ void MainWindow::onLibrarySearch()
     QApplication::restoreOverrideCursor();
 }
 
+//-----------------------------------------------------------------------------
+// Function: mainwindow::onRebuildLibraryIndex()
+//-----------------------------------------------------------------------------
+void MainWindow::onRebuildLibraryIndex()
+{
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    libraryHandler_->onRebuildLibraryIndex();
+    QApplication::restoreOverrideCursor();
+}
+
 //-----------------------------------------------------------------------------
 // Function: restoreSettings()
 //-----------------------------------------------------------------------------
@@ -526,6 +537,11 @@ void MainWindow::setupActions()
         tr("Refresh Library"), this);
     connect(actLibrarySearch_, SIGNAL(triggered()),	this, SLOT(onLibrarySearch()), Qt::UniqueConnection);
 
+    // Rebuild the library index in case it has become out of sync with the files.
+    actRebuildIndex_ = new QAction(QIcon(":/icons/common/graphics/library-refresh.png"),
+        tr("Rebuild Library Index"), this);
+    connect(actRebuildIndex_, SIGNAL(triggered()), this, SLOT(onRebuildLibraryIndex()), Qt::UniqueConnection);
+
     // Check the library integrity
     actCheckIntegrity_ = new QAction(QIcon(":/icons/common/graphics/checkIntegrity.png"),
         tr("View Library Integrity Report"), this);
@@ -774,10 +790,12 @@ void MainWindow::setupMenus()
     RibbonGroup* libGroup = ribbon_->addGroup(tr("Library"));
     libGroup->addAction(actLibraryLocations_);
     libGroup->addAction(actLibrarySearch_);
+    libGroup->addAction(actRebuildIndex_);
     libGroup->addAction(actCheckIntegrity_);
 
     libGroup->widgetForAction(actLibraryLocations_)->installEventFilter(ribbon_);
     libGroup->widgetForAction(actLibrarySearch_)->installEventFilter(ribbon_);
+    libGroup->widgetForAction(actRebuildIndex_)->installEventFilter(ribbon_);
     libGroup->widgetForAction(actCheckIntegrity_)->installEventFilter(ribbon_);
 
     // The "protection" group
@@ -2950,6 +2968,8 @@ void MainWindow::openComponent(VLNV const& vlnv)
     ComponentEditor* editor = new ComponentEditor(libraryHandler_, component, this);
     connect(libraryHandler_, SIGNAL(updatedVLNV(VLNV const&)),
         editor, SLOT(onDocumentUpdated(VLNV const&)), Qt::UniqueConnection);
+    connect(libraryHandler_, SIGNAL(documentChanged(VLNV const&)),
+        editor, SLOT(onLibraryDocumentChanged(VLNV const&)), Qt::UniqueConnection);
 
     connect(editor, SIGNAL(openCSource(QString const&, QSharedPointer<Component>)),
             this , SLOT(openCSource(QString const&, QSharedPointer<Component>)), Qt::UniqueConnection);
@@ -3643,8 +3663,8 @@ bool MainWindow::hasInvalidReferences(QList<VLNV> hierRefs, VLNV const& referenc
         {
             VLNV designVLNV = libraryHandler_->getDesignVLNV(ref);
 
-            QSharedPointer<Document> libComp2 = libraryHandler_->getModel(ref);
-            QSharedPointer<DesignConfiguration> desConf = libComp2.staticCast<DesignConfiguration>();
+            QSharedPointer<Document const> libComp2 = libraryHandler_->getModelReadOnly(ref);
+            QSharedPointer<DesignConfiguration const> desConf = libComp2.staticCast<DesignConfiguration const>();
             VLNV refToDesign = desConf->getDesignRef();
 
             // if the referenced design was not found in the library
@@ -169,6 +169,9 @@ public slots:
 	 */
 	void onLibrarySearch();
 
+    //! Discards the library index and searches the file system for IP-XACT files.
+    void onRebuildLibraryIndex();
+
 	/*!
      *  Called when user selects a component on the draw board.
 	 *
@@ -723,6 +726,9 @@ private:
 	//! Search for IP-Xact files in the file system
 	QAction* actLibrarySearch_;
 
+    //! Discard the library index and read all IP-XACT files again.
+    QAction* actRebuildIndex_;
+
 	//! Check the library integrity
 	QAction* actCheckIntegrity_;
 
@@ -14,7 +14,11 @@ TEMPLATE = subdirs
 CONFIG += testcase
 SUBDIRS += tst_CommandLineParser.pro \
 		   tst_SystemVerilogExpressionParser.pro \
+		   tst_BigInteger.pro \
 		   tst_IPXactSystemVerilogParser.pro \
+		   tst_ParameterDependencyGraph.pro \
+		   tst_ElementValidityCache.pro \
+		   tst_ExpressionFormatter.pro \
 		   tst_ParameterCompleter.pro \
 		   tst_ExpressionEditor.pro \
 		   tst_ValueFormatter.pro \
@@ -31,4 +35,5 @@ SUBDIRS += tst_CommandLineParser.pro \
 		   tst_HierarchicalSaveBuildStrategy.pro \
 		   tst_DocumentTreeBuilder.pro \
 		   tst_DocumentGenerator.pro \
-		   tst_MasterSlavePathSearch.pro
+		   tst_MasterSlavePathSearch.pro \
+		   tst_MemoryConnectionAddressCalculator.pro
@@ -12,7 +12,8 @@ HEADERS += ../../editors/ComponentEditor/common/NullParser.h \
     ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h \
     ../../common/graphicsItems/visualizeritem.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h
 SOURCES += ../../editors/ComponentEditor/common/NullParser.cpp \
     ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.cpp \
     ../../common/graphicsItems/expandableitem.cpp \
@@ -23,4 +24,5 @@ SOURCES += ../../editors/ComponentEditor/common/NullParser.cpp \
     ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.cpp \
     ./tst_AddressBlockGraphItem.cpp \
     ../../common/graphicsItems/visualizeritem.cpp \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp
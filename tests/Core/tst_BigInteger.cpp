@@ -0,0 +1,368 @@
+//-----------------------------------------------------------------------------
+// File: tst_BigInteger.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class BigInteger.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/common/BigInteger.h>
+
+#include <limits>
+
+class tst_BigInteger : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_BigInteger();
+
+private slots:
+
+    void testConversionFromString();
+    void testConversionFromString_data();
+
+    void testArithmetic();
+    void testArithmetic_data();
+
+    void testShifts();
+    void testShifts_data();
+
+    void testBitwiseOperations();
+    void testBitwiseOperations_data();
+
+    void testSigns();
+
+    void testComparisons();
+
+    void testOverflowOf64Bits();
+
+    void testWiderThan64Bits();
+    void testWiderThan64Bits_data();
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::tst_BigInteger()
+//-----------------------------------------------------------------------------
+tst_BigInteger::tst_BigInteger()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testConversionFromString()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testConversionFromString()
+{
+    QFETCH(QString, text);
+    QFETCH(int, base);
+    QFETCH(bool, isValid);
+    QFETCH(QString, expectedDecimal);
+
+    bool ok = !isValid;
+    BigInteger value = BigInteger::fromString(text, base, &ok);
+
+    QCOMPARE(ok, isValid);
+    QCOMPARE(value.toString(), expectedDecimal);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testConversionFromString_data()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testConversionFromString_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("base");
+    QTest::addColumn<bool>("isValid");
+    QTest::addColumn<QString>("expectedDecimal");
+
+    QTest::newRow("Zero") << "0" << 10 << true << "0";
+    QTest::newRow("Negative zero is zero") << "-0" << 10 << true << "0";
+    QTest::newRow("Explicit positive sign") << "+42" << 10 << true << "42";
+    QTest::newRow("Negative decimal") << "-1234" << 10 << true << "-1234";
+    QTest::newRow("Leading zeros") << "000123" << 10 << true << "123";
+    QTest::newRow("Largest signed 64-bit value") << "9223372036854775807" << 10 << true <<
+        "9223372036854775807";
+    QTest::newRow("Decimal wider than 128 bits") << "340282366920938463463374607431768211456" << 10 << true <<
+        "340282366920938463463374607431768211456";
+    QTest::newRow("80-bit hexadecimal in upper case") << "FFFFFFFFFFFFFFFFFFFF" << 16 << true <<
+        "1208925819614629174706175";
+    QTest::newRow("80-bit hexadecimal in lower case") << "ffffffffffffffffffff" << 16 << true <<
+        "1208925819614629174706175";
+    QTest::newRow("70-bit binary") << QString(70, QLatin1Char('1')) << 2 << true << "1180591620717411303423";
+    QTest::newRow("Octal") << "777" << 8 << true << "511";
+
+    QTest::newRow("Empty text is not valid") << "" << 10 << false << "0";
+    QTest::newRow("Sign without digits is not valid") << "-" << 10 << false << "0";
+    QTest::newRow("Digit outside the base is not valid") << "12a" << 10 << false << "0";
+    QTest::newRow("Binary digit 2 is not valid") << "102" << 2 << false << "0";
+    QTest::newRow("Whitespace is not valid") << "1 2" << 10 << false << "0";
+    QTest::newRow("Base over 16 is not valid") << "10" << 17 << false << "0";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testArithmetic()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testArithmetic()
+{
+    QFETCH(QString, first);
+    QFETCH(QString, second);
+    QFETCH(QString, expectedSum);
+    QFETCH(QString, expectedDifference);
+    QFETCH(QString, expectedProduct);
+    QFETCH(QString, expectedQuotient);
+    QFETCH(QString, expectedRemainder);
+
+    BigInteger firstValue = BigInteger::fromString(first);
+    BigInteger secondValue = BigInteger::fromString(second);
+
+    QCOMPARE((firstValue + secondValue).toString(), expectedSum);
+    QCOMPARE((firstValue - secondValue).toString(), expectedDifference);
+    QCOMPARE((firstValue * secondValue).toString(), expectedProduct);
+    QCOMPARE((firstValue / secondValue).toString(), expectedQuotient);
+    QCOMPARE((firstValue % secondValue).toString(), expectedRemainder);
+
+    // The quotient and the remainder always add up to the dividend.
+    QCOMPARE(((firstValue / secondValue) * secondValue + firstValue % secondValue).toString(), first);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testArithmetic_data()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testArithmetic_data()
+{
+    QTest::addColumn<QString>("first");
+    QTest::addColumn<QString>("second");
+    QTest::addColumn<QString>("expectedSum");
+    QTest::addColumn<QString>("expectedDifference");
+    QTest::addColumn<QString>("expectedProduct");
+    QTest::addColumn<QString>("expectedQuotient");
+    QTest::addColumn<QString>("expectedRemainder");
+
+    QTest::newRow("Small positive values") << "7" << "2" << "9" << "5" << "14" << "3" << "1";
+    QTest::newRow("Negative dividend truncates towards zero") << "-7" << "2" << "-5" << "-9" << "-14" << "-3" <<
+        "-1";
+    QTest::newRow("Negative divisor truncates towards zero") << "7" << "-2" << "5" << "9" << "-14" << "-3" << "1";
+
+    QTest::newRow("Sum carries past the largest signed 64-bit value") << "9223372036854775807" << "1" <<
+        "9223372036854775808" << "9223372036854775806" << "9223372036854775807" << "9223372036854775807" << "0";
+    QTest::newRow("Smallest signed 64-bit value divided by minus one") << "-9223372036854775808" << "-1" <<
+        "-9223372036854775809" << "-9223372036854775807" << "9223372036854775808" << "9223372036854775808" <<
+        "0";
+    QTest::newRow("Values of opposite signs cancel out") << "18446744073709551616" << "-18446744073709551617" <<
+        "-1" << "36893488147419103233" << "-340282366920938463481821351505477763072" << "0" <<
+        "18446744073709551616";
+    QTest::newRow("128-bit value divided by a 65-bit value") << "340282366920938463463374607431768211456" <<
+        "18446744073709551616" << "340282366920938463481821351505477763072" <<
+        "340282366920938463444927863358058659840" <<
+        "6277101735386680763835789423207666416102355444464034512896" << "18446744073709551616" << "0";
+    QTest::newRow("Multi-digit values") << "123456789012345678901234567890" << "987654321098765432109876543210" <<
+        "1111111110111111111011111111100" << "-864197532086419753208641975320" <<
+        "121932631137021795226185032733622923332237463801111263526900" << "0" <<
+        "123456789012345678901234567890";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testShifts()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testShifts()
+{
+    QFETCH(QString, value);
+    QFETCH(int, shift);
+    QFETCH(QString, expectedLeftShift);
+    QFETCH(QString, expectedRightShift);
+
+    BigInteger integer = BigInteger::fromString(value);
+
+    QCOMPARE((integer << shift).toString(), expectedLeftShift);
+    QCOMPARE((integer >> shift).toString(), expectedRightShift);
+
+    // A negative shift is a shift in the other direction.
+    QCOMPARE((integer >> -shift).toString(), expectedLeftShift);
+    QCOMPARE((integer << -shift).toString(), expectedRightShift);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testShifts_data()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testShifts_data()
+{
+    QTest::addColumn<QString>("value");
+    QTest::addColumn<int>("shift");
+    QTest::addColumn<QString>("expectedLeftShift");
+    QTest::addColumn<QString>("expectedRightShift");
+
+    QTest::newRow("Shift by zero") << "12345" << 0 << "12345" << "12345";
+    QTest::newRow("Shift within a digit") << "3" << 4 << "48" << "0";
+    QTest::newRow("Shift past 64 bits") << "3" << 70 << "3541774862152233910272" << "0";
+    QTest::newRow("Shift by whole digits") << "1267650600228229401496703205376" << 64 <<
+        "23384026197294446691258957323460528314494920687616" << "68719476736";
+    QTest::newRow("Negative value rounds towards negative infinity") << "-5" << 1 << "-10" << "-3";
+    QTest::newRow("Negative 100-bit value") << "-1267650600228229401496703205376" << 99 <<
+        "-803469022129495137770981046170581301261101496891396417650688" << "-2";
+    QTest::newRow("Minus one stays minus one") << "-1" << 200 <<
+        "-1606938044258990275541962092341162602522202993782792835301376" << "-1";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testBitwiseOperations()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testBitwiseOperations()
+{
+    QFETCH(QString, first);
+    QFETCH(QString, second);
+    QFETCH(QString, expectedAnd);
+    QFETCH(QString, expectedOr);
+    QFETCH(QString, expectedXor);
+
+    BigInteger firstValue = BigInteger::fromString(first);
+    BigInteger secondValue = BigInteger::fromString(second);
+
+    QCOMPARE((firstValue & secondValue).toString(), expectedAnd);
+    QCOMPARE((firstValue | secondValue).toString(), expectedOr);
+    QCOMPARE((firstValue ^ secondValue).toString(), expectedXor);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testBitwiseOperations_data()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testBitwiseOperations_data()
+{
+    QTest::addColumn<QString>("first");
+    QTest::addColumn<QString>("second");
+    QTest::addColumn<QString>("expectedAnd");
+    QTest::addColumn<QString>("expectedOr");
+    QTest::addColumn<QString>("expectedXor");
+
+    QTest::newRow("Small positive values") << "12" << "10" << "8" << "14" << "6";
+    QTest::newRow("Negative value acts as two's complement") << "-12345678901234567890123" <<
+        "1208925819614629174706175" << "1196580140713394606816053" << "-1" << "-1196580140713394606816054";
+    QTest::newRow("Minus one with an 81-bit value") << "-1" << "1208925819614629174706176" <<
+        "1208925819614629174706176" << "-1" << "-1208925819614629174706177";
+    QTest::newRow("Two negative values") << "-6" << "-3" << "-8" << "-1" << "7";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testSigns()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testSigns()
+{
+    BigInteger zero;
+    QVERIFY(zero.isZero());
+    QVERIFY(zero.isNegative() == false);
+    QVERIFY((-zero).isNegative() == false);
+    QCOMPARE(zero.bitLength(), 0);
+
+    BigInteger wide = BigInteger(1) << 70;
+    BigInteger negativeWide = -wide;
+    QVERIFY(negativeWide.isNegative());
+    QCOMPARE(negativeWide.toString(), QString("-1180591620717411303424"));
+    QCOMPARE(negativeWide.toString(16), QString("-400000000000000000"));
+    QCOMPARE((-negativeWide).toString(), wide.toString());
+    QCOMPARE(negativeWide.bitLength(), 71);
+
+    QCOMPARE((~wide).toString(), QString("-1180591620717411303425"));
+    QCOMPARE((~negativeWide).toString(), QString("1180591620717411303423"));
+
+    QVERIFY((wide - wide).isZero());
+    QVERIFY((wide - wide).isNegative() == false);
+    QVERIFY((negativeWide * zero).isNegative() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testComparisons()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testComparisons()
+{
+    BigInteger small = BigInteger::fromString("-18446744073709551616");
+    BigInteger middle(-1);
+    BigInteger large = BigInteger::fromString("18446744073709551616");
+
+    QVERIFY(small < middle);
+    QVERIFY(middle < large);
+    QVERIFY(small < large);
+    QVERIFY(large > small);
+    QVERIFY(small <= small);
+    QVERIFY(large >= large);
+    QVERIFY(small != large);
+    QVERIFY(large == BigInteger::fromUnsigned(std::numeric_limits<quint64>::max()) + BigInteger(1));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testOverflowOf64Bits()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testOverflowOf64Bits()
+{
+    BigInteger largest(std::numeric_limits<qint64>::max());
+    BigInteger smallest(std::numeric_limits<qint64>::min());
+
+    QVERIFY(largest.fitsInLongLong());
+    QVERIFY(smallest.fitsInLongLong());
+    QCOMPARE(largest.toLongLong(), std::numeric_limits<qint64>::max());
+    QCOMPARE(smallest.toLongLong(), std::numeric_limits<qint64>::min());
+    QCOMPARE(smallest.toString(), QString("-9223372036854775808"));
+
+    QVERIFY((largest + BigInteger(1)).fitsInLongLong() == false);
+    QVERIFY((smallest - BigInteger(1)).fitsInLongLong() == false);
+    QVERIFY((-smallest).fitsInLongLong() == false);
+    QCOMPARE((-smallest).toString(), QString("9223372036854775808"));
+
+    // The conversions keep the lowest 64 bits in two's complement.
+    QCOMPARE((largest + BigInteger(1)).toLongLong(), std::numeric_limits<qint64>::min());
+    QCOMPARE(BigInteger(-1).toULongLong(), std::numeric_limits<quint64>::max());
+    QCOMPARE(BigInteger::fromString("18446744073709551621").toULongLong(), quint64(5));
+
+    BigInteger unsignedLargest = BigInteger::fromUnsigned(std::numeric_limits<quint64>::max());
+    QVERIFY(unsignedLargest.fitsInLongLong() == false);
+    QCOMPARE(unsignedLargest.toString(), QString("18446744073709551615"));
+    QCOMPARE(unsignedLargest.toString(16), QString("ffffffffffffffff"));
+    QCOMPARE(unsignedLargest.bitLength(), 64);
+    QCOMPARE((unsignedLargest * unsignedLargest).toString(), QString("340282366920938463426481119284349108225"));
+
+    QCOMPARE((BigInteger(1) << 1100).toDouble(), std::numeric_limits<double>::infinity());
+    QCOMPARE((BigInteger(1) << 64).toDouble(), 18446744073709551616.0);
+
+    // Division by zero gives zero instead of failing.
+    QVERIFY((largest / BigInteger()).isZero());
+    QVERIFY((largest % BigInteger()).isZero());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testWiderThan64Bits()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testWiderThan64Bits()
+{
+    QFETCH(QString, text);
+    QFETCH(bool, isWider);
+
+    QCOMPARE(BigInteger::isWiderThan64Bits(text), isWider);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BigInteger::testWiderThan64Bits_data()
+//-----------------------------------------------------------------------------
+void tst_BigInteger::testWiderThan64Bits_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<bool>("isWider");
+
+    QTest::newRow("Small value fits") << "42" << false;
+    QTest::newRow("Largest signed 64-bit value fits") << "9223372036854775807" << false;
+    QTest::newRow("Smallest signed 64-bit value fits") << "-9223372036854775808" << false;
+    QTest::newRow("2^63 is wider") << "9223372036854775808" << true;
+    QTest::newRow("Value below the smallest signed 64-bit value is wider") << "-9223372036854775809" << true;
+    QTest::newRow("Explicitly positive wide value is wider") << "+18446744073709551616" << true;
+    QTest::newRow("Empty text is not an integer") << "" << false;
+    QTest::newRow("Sign is not an integer") << "-" << false;
+    QTest::newRow("Real number is not an integer") << "18446744073709551616.5" << false;
+    QTest::newRow("Hexadecimal text is not a decimal integer") << "ffffffffffffffffffff" << false;
+}
+
+QTEST_APPLESS_MAIN(tst_BigInteger)
+
+#include "tst_BigInteger.moc"
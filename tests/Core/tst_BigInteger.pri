@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/BigInteger.h
+SOURCES += ../../editors/ComponentEditor/common/BigInteger.cpp \
+    ./tst_BigInteger.cpp
@@ -0,0 +1,41 @@
+#-----------------------------------------------------------------------------
+# File: tst_BigInteger.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for BigInteger.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_BigInteger
+
+QT += core testlib
+QT -= gui widgets
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    DESTDIR = ./debug
+}
+else:unix {
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_BigInteger.pri)
@@ -9,6 +9,7 @@ HEADERS += ../../editors/ComponentEditor/parameters/ComponentParameterColumns.h
     ../../editors/ComponentEditor/common/ParameterFinder.h \
     ../../editors/ComponentEditor/common/ParameterizableTable.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/ComponentEditor/parameters/ComponentParameterModel.h \
     ../../editors/ComponentEditor/common/ReferencingTableModel.h \
     ../../IPXACTmodels/common/validators/ValueFormatter.h
@@ -21,4 +22,5 @@ SOURCES += ../../IPXACTmodels/common/validators/ValueFormatter.cpp \
     ../../editors/ComponentEditor/common/ParameterizableTable.cpp \
     ../../editors/ComponentEditor/common/ReferencingTableModel.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ComponentParameterModel.cpp
@@ -46,6 +46,7 @@ HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../editors/common/StickyNote/StickyNoteMoveCommand.h \
     ../../editors/SystemDesign/UndoCommands/SystemMoveCommands.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../common/widgets/vlnvEditor/VLNVContentMatcher.h \
     ../../common/widgets/vlnvEditor/VLNVDataTree.h \
     ../../editors/HWDesign/AdHocConnectionItem.h \
@@ -240,6 +241,7 @@ SOURCES += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.cpp \
     ../../editors/SystemDesign/SystemComponentItem.cpp \
     ../../editors/SystemDesign/UndoCommands/SystemMoveCommands.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../common/widgets/tabDocument/TabDocument.cpp \
     ../../common/widgets/vlnvEditor/VLNVContentMatcher.cpp \
     ../../common/widgets/vlnvEditor/VLNVDataTree.cpp \
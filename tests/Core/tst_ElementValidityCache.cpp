@@ -0,0 +1,199 @@
+//-----------------------------------------------------------------------------
+// File: tst_ElementValidityCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class ElementValidityCache.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <editors/ComponentEditor/treeStructure/ElementValidityCache.h>
+
+//-----------------------------------------------------------------------------
+//! Element with a settable validity.
+//-----------------------------------------------------------------------------
+struct TestElement
+{
+    explicit TestElement(bool isValid): valid(isValid) {}
+
+    bool valid;
+};
+
+//-----------------------------------------------------------------------------
+//! Validator counting the validated elements.
+//-----------------------------------------------------------------------------
+class CountingValidator
+{
+public:
+
+    CountingValidator(): validatedElements_() {}
+
+    bool validate(QSharedPointer<TestElement> element) const
+    {
+        validatedElements_.append(element);
+        return element->valid;
+    }
+
+    mutable QList<QSharedPointer<TestElement> > validatedElements_;
+};
+
+class tst_ElementValidityCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ElementValidityCache();
+
+private slots:
+
+    void init();
+
+    void testElementsAreValidatedOnce();
+    void testChangedElementIsValidatedAgain();
+    void testAddedElementIsValidated();
+    void testRemovedElementIsForgotten();
+    void testClearValidatesAllElements();
+
+private:
+
+    QList<QSharedPointer<TestElement> > elements_;
+
+    QSharedPointer<CountingValidator> validator_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::tst_ElementValidityCache()
+//-----------------------------------------------------------------------------
+tst_ElementValidityCache::tst_ElementValidityCache():
+elements_(),
+validator_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::init()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::init()
+{
+    elements_.clear();
+    for (int i = 0; i < 4; ++i)
+    {
+        elements_.append(QSharedPointer<TestElement>(new TestElement(true)));
+    }
+
+    validator_ = QSharedPointer<CountingValidator>(new CountingValidator());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::testElementsAreValidatedOnce()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::testElementsAreValidatedOnce()
+{
+    ElementValidityCache<TestElement> cache;
+
+    QVERIFY(cache.validate(elements_, validator_));
+    QCOMPARE(validator_->validatedElements_, elements_);
+
+    validator_->validatedElements_.clear();
+
+    QVERIFY(cache.validate(elements_, validator_));
+    QVERIFY(validator_->validatedElements_.isEmpty());
+
+    foreach (QSharedPointer<TestElement> element, elements_)
+    {
+        QVERIFY(cache.isCached(element));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::testChangedElementIsValidatedAgain()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::testChangedElementIsValidatedAgain()
+{
+    ElementValidityCache<TestElement> cache;
+    QVERIFY(cache.validate(elements_, validator_));
+    validator_->validatedElements_.clear();
+
+    QSharedPointer<TestElement> changedElement = elements_.at(2);
+    changedElement->valid = false;
+
+    // The change is not seen until the element is marked as changed.
+    QVERIFY(cache.validate(elements_, validator_));
+    QVERIFY(validator_->validatedElements_.isEmpty());
+
+    cache.invalidate(changedElement);
+    QVERIFY(!cache.isCached(changedElement));
+    QVERIFY(cache.isCached(elements_.at(1)));
+
+    QVERIFY(!cache.validate(elements_, validator_));
+    QCOMPARE(validator_->validatedElements_, QList<QSharedPointer<TestElement> >() << changedElement);
+
+    validator_->validatedElements_.clear();
+
+    changedElement->valid = true;
+    cache.invalidate(changedElement);
+
+    QVERIFY(cache.validate(elements_, validator_));
+    QCOMPARE(validator_->validatedElements_, QList<QSharedPointer<TestElement> >() << changedElement);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::testAddedElementIsValidated()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::testAddedElementIsValidated()
+{
+    ElementValidityCache<TestElement> cache;
+    QVERIFY(cache.validate(elements_, validator_));
+    validator_->validatedElements_.clear();
+
+    QSharedPointer<TestElement> addedElement(new TestElement(false));
+    elements_.insert(1, addedElement);
+
+    QVERIFY(!cache.validate(elements_, validator_));
+    QCOMPARE(validator_->validatedElements_, QList<QSharedPointer<TestElement> >() << addedElement);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::testRemovedElementIsForgotten()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::testRemovedElementIsForgotten()
+{
+    QSharedPointer<TestElement> invalidElement(new TestElement(false));
+    elements_.append(invalidElement);
+
+    ElementValidityCache<TestElement> cache;
+    QVERIFY(!cache.validate(elements_, validator_));
+    QVERIFY(cache.isCached(invalidElement));
+
+    elements_.removeOne(invalidElement);
+    validator_->validatedElements_.clear();
+
+    QVERIFY(cache.validate(elements_, validator_));
+    QVERIFY(validator_->validatedElements_.isEmpty());
+    QVERIFY(!cache.isCached(invalidElement));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ElementValidityCache::testClearValidatesAllElements()
+//-----------------------------------------------------------------------------
+void tst_ElementValidityCache::testClearValidatesAllElements()
+{
+    ElementValidityCache<TestElement> cache;
+    QVERIFY(cache.validate(elements_, validator_));
+    validator_->validatedElements_.clear();
+
+    cache.clear();
+
+    QVERIFY(cache.validate(elements_, validator_));
+    QCOMPARE(validator_->validatedElements_, elements_);
+}
+
+QTEST_APPLESS_MAIN(tst_ElementValidityCache)
+
+#include "tst_ElementValidityCache.moc"
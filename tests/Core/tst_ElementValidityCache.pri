@@ -0,0 +1,6 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/treeStructure/ElementValidityCache.h
+SOURCES += ./tst_ElementValidityCache.cpp
@@ -7,6 +7,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ParameterFinder.h \
     ../../editors/ComponentEditor/common/ParameterizableTable.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/ComponentEditor/common/CompleterPopupTable.h \
     ../../editors/ComponentEditor/parameters/ComponentParameterModel.h \
     ../../editors/ComponentEditor/common/ExpressionFormatter.h \
@@ -24,4 +25,5 @@ SOURCES += ../../editors/ComponentEditor/common/CompleterPopupTable.cpp \
     ../../editors/ComponentEditor/common/ParameterizableTable.cpp \
     ../../editors/ComponentEditor/common/ReferencingTableModel.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ExpressionEditor.cpp
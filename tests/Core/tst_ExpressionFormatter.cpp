@@ -0,0 +1,217 @@
+//-----------------------------------------------------------------------------
+// File: tst_ExpressionFormatter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class ExpressionFormatter.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/common/ExpressionFormatter.h>
+#include <editors/ComponentEditor/common/ParameterFinder.h>
+
+#include <QHash>
+#include <QStringList>
+
+//-----------------------------------------------------------------------------
+//! Parameter finder with settable names and revision, counting the id lookups.
+//-----------------------------------------------------------------------------
+class TestParameterFinder : public ParameterFinder
+{
+public:
+
+    TestParameterFinder(): names_(), revision_(0), lookups_(0) {}
+
+    virtual QSharedPointer<Parameter> getParameterWithID(QString const& /*parameterId*/) const
+    {
+        return QSharedPointer<Parameter>();
+    }
+
+    virtual bool hasId(QString const& id) const
+    {
+        ++lookups_;
+        return names_.contains(id);
+    }
+
+    virtual QString nameForId(QString const& id) const
+    {
+        return names_.value(id);
+    }
+
+    virtual QString valueForId(QString const& /*id*/) const
+    {
+        return QString();
+    }
+
+    virtual QStringList getAllParameterIds() const
+    {
+        return names_.keys();
+    }
+
+    virtual int getNumberOfParameters() const
+    {
+        return names_.count();
+    }
+
+    virtual void registerParameterModel(QAbstractItemModel const* /*model*/)
+    {
+
+    }
+
+    virtual int getParameterRevision() const
+    {
+        return revision_;
+    }
+
+    QHash<QString, QString> names_;
+
+    int revision_;
+
+    mutable int lookups_;
+};
+
+class tst_ExpressionFormatter : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ExpressionFormatter();
+
+private slots:
+
+    void init();
+
+    void testIdsAreReplacedWithNames();
+    void testCachedExpressionIsNotLookedUp();
+    void testRevisionChangeFormatsAgain();
+    void testUntrackedFinderIsNotCached();
+    void testLeastRecentlyUsedExpressionIsEvicted();
+
+private:
+
+    QSharedPointer<TestParameterFinder> finder_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::tst_ExpressionFormatter()
+//-----------------------------------------------------------------------------
+tst_ExpressionFormatter::tst_ExpressionFormatter():
+finder_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::init()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::init()
+{
+    finder_ = QSharedPointer<TestParameterFinder>(new TestParameterFinder());
+    finder_->names_.insert(QStringLiteral("id_1"), QStringLiteral("first"));
+    finder_->names_.insert(QStringLiteral("id_10"), QStringLiteral("tenth"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::testIdsAreReplacedWithNames()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::testIdsAreReplacedWithNames()
+{
+    ExpressionFormatter formatter(finder_);
+
+    QCOMPARE(formatter.formatReferringExpression(QStringLiteral("id_1 + id_10*2 - id_100")),
+        QStringLiteral("first + tenth*2 - id_100"));
+    QCOMPARE(formatter.formatReferringExpression(QStringLiteral("id_1+id_1")), QStringLiteral("first+first"));
+    QCOMPARE(formatter.formatReferringExpression(QString()), QString());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::testCachedExpressionIsNotLookedUp()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::testCachedExpressionIsNotLookedUp()
+{
+    ExpressionFormatter formatter(finder_);
+
+    QString expression = QStringLiteral("id_1 + id_10 + id_1");
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("first + tenth + first"));
+    QCOMPARE(finder_->lookups_, 2);
+
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("first + tenth + first"));
+    QCOMPARE(finder_->lookups_, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::testRevisionChangeFormatsAgain()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::testRevisionChangeFormatsAgain()
+{
+    ExpressionFormatter formatter(finder_);
+
+    QString expression = QStringLiteral("id_1 + id_2");
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("first + id_2"));
+
+    // Changes are seen only after the finder reports them.
+    finder_->names_.insert(QStringLiteral("id_1"), QStringLiteral("renamed"));
+    finder_->names_.insert(QStringLiteral("id_2"), QStringLiteral("second"));
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("first + id_2"));
+
+    finder_->revision_++;
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("renamed + second"));
+
+    finder_->names_.remove(QStringLiteral("id_2"));
+    finder_->revision_++;
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("renamed + id_2"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::testUntrackedFinderIsNotCached()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::testUntrackedFinderIsNotCached()
+{
+    finder_->revision_ = -1;
+    ExpressionFormatter formatter(finder_);
+
+    QString expression = QStringLiteral("id_1");
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("first"));
+
+    finder_->names_.insert(QStringLiteral("id_1"), QStringLiteral("renamed"));
+    QCOMPARE(formatter.formatReferringExpression(expression), QStringLiteral("renamed"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionFormatter::testLeastRecentlyUsedExpressionIsEvicted()
+//-----------------------------------------------------------------------------
+void tst_ExpressionFormatter::testLeastRecentlyUsedExpressionIsEvicted()
+{
+    ExpressionFormatter formatter(finder_);
+
+    // Fill the cache. Each expression has a single token.
+    const int cacheSize = 4096;
+    for (int i = 0; i < cacheSize; ++i)
+    {
+        formatter.formatReferringExpression(QString::number(i));
+    }
+    QCOMPARE(finder_->lookups_, cacheSize);
+
+    // Using the oldest expression makes the second oldest the least recently used one.
+    formatter.formatReferringExpression(QStringLiteral("0"));
+    QCOMPARE(finder_->lookups_, cacheSize);
+
+    formatter.formatReferringExpression(QStringLiteral("id_1"));
+    QCOMPARE(finder_->lookups_, cacheSize + 1);
+
+    formatter.formatReferringExpression(QStringLiteral("0"));
+    formatter.formatReferringExpression(QStringLiteral("2"));
+    formatter.formatReferringExpression(QString::number(cacheSize - 1));
+    QCOMPARE(finder_->lookups_, cacheSize + 1);
+
+    formatter.formatReferringExpression(QStringLiteral("1"));
+    QCOMPARE(finder_->lookups_, cacheSize + 2);
+}
+
+QTEST_APPLESS_MAIN(tst_ExpressionFormatter)
+
+#include "tst_ExpressionFormatter.moc"
@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/ExpressionFormatter.h \
+    ../../editors/ComponentEditor/common/ExpressionParser.h \
+    ../../editors/ComponentEditor/common/ParameterFinder.h \
+    ../../IPXACTmodels/common/validators/ValueFormatter.h
+SOURCES += ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
+    ../../IPXACTmodels/common/validators/ValueFormatter.cpp \
+    ./tst_ExpressionFormatter.cpp
@@ -12,6 +12,7 @@ HEADERS += ../../common/graphicsItems/expandableitem.h \
     ../../common/graphicsItems/visualizeritem.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/ComponentEditor/common/NullParser.h
 SOURCES += ../../common/graphicsItems/expandableitem.cpp \
     ../../editors/ComponentEditor/visualization/fieldgapitem.cpp \
@@ -23,4 +24,5 @@ SOURCES += ../../common/graphicsItems/expandableitem.cpp \
     ./tst_FieldGraphItem.cpp \
     ../../common/graphicsItems/visualizeritem.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../editors/ComponentEditor/common/NullParser.cpp
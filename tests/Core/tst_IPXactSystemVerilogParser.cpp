@@ -68,8 +68,16 @@ private slots:
     void testExpressionComparison();
     void testExpressionComparison_data();
 
+    void testChangedValueIsEvaluatedAgain();
+    void testRestoredReferenceIsEvaluatedAgain();
+
     void testLongReferenceChainPerformance();
     void testLongReferenceChainPerformance_data();
+
+    void testManyReferencesToDeepParameterPerformance();
+
+    void testReferencesToRegisterParametersPerformance();
+    void testReferencesToRegisterParametersPerformance_data();
 };
 
 //-----------------------------------------------------------------------------
@@ -517,6 +525,80 @@ void tst_IPXactSystemVerilogParser::testExpressionComparison_data()
         "firstValue+secondValue+1==secondValue*2" << 0;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testChangedValueIsEvaluatedAgain()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testChangedValueIsEvaluatedAgain()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("first + 1");
+    testComponent->getParameters()->append(secondParameter);
+
+    QSharedPointer<Parameter> thirdParameter(new Parameter());
+    thirdParameter->setValueId("third");
+    thirdParameter->setValue("second * 2");
+    testComponent->getParameters()->append(thirdParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    QCOMPARE(parser.parseExpression("third"), QString("4"));
+    QCOMPARE(parser.parseExpression("second"), QString("2"));
+
+    firstParameter->setValue("5");
+    QCOMPARE(parser.parseExpression("third"), QString("12"));
+    QCOMPARE(parser.parseExpression("second"), QString("6"));
+
+    secondParameter->setValue("first");
+    QCOMPARE(parser.parseExpression("third"), QString("10"));
+
+    firstParameter->setValue("third");
+    QCOMPARE(parser.parseExpression("third"), QString("x"));
+
+    firstParameter->setValue("2");
+    QCOMPARE(parser.parseExpression("third"), QString("4"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testRestoredReferenceIsEvaluatedAgain()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testRestoredReferenceIsEvaluatedAgain()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("first + 1");
+    testComponent->getParameters()->append(secondParameter);
+
+    QSharedPointer<Parameter> thirdParameter(new Parameter());
+    thirdParameter->setValueId("third");
+    thirdParameter->setValue("second * 2");
+    testComponent->getParameters()->append(thirdParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    QString unresolvedValue = parser.parseExpression("third");
+    QVERIFY(unresolvedValue != QString("4"));
+
+    // E.g. undoing the removal of the referenced parameter.
+    testComponent->getParameters()->prepend(firstParameter);
+    QCOMPARE(parser.parseExpression("third"), QString("4"));
+    QCOMPARE(parser.parseExpression("second"), QString("2"));
+
+    testComponent->getParameters()->removeOne(firstParameter);
+    QCOMPARE(parser.parseExpression("third"), unresolvedValue);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_IPXactSystemVerilogParser::testLongReferenceChainPerformance()
 //-----------------------------------------------------------------------------
@@ -576,6 +658,119 @@ void tst_IPXactSystemVerilogParser::testLongReferenceChainPerformance_data()
     QTest::newRow("Chain of 20 parameters, cached") << 20 << true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testManyReferencesToDeepParameterPerformance()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testManyReferencesToDeepParameterPerformance()
+{
+    QSharedPointer<Component> testComponent(new Component());
+
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("id_0");
+    firstParameter->setValue("'h10");
+    testComponent->getParameters()->append(firstParameter);
+
+    for (int i = 1; i <= 4; i++)
+    {
+        QSharedPointer<Parameter> nextParameter(new Parameter());
+        nextParameter->setValueId("id_" + QString::number(i));
+        nextParameter->setValue(QString("id_%1 * 2").arg(i-1));
+        testComponent->getParameters()->append(nextParameter);
+    }
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ParameterCache(testComponent)));
+
+    // Register offsets of a large memory map, all referencing the deepest parameter.
+    QStringList offsets;
+    for (int i = 0; i < 10000; i++)
+    {
+        offsets.append(QString("id_4 * %1").arg(i));
+    }
+
+    QString lastOffset;
+    QBENCHMARK
+    {
+        foreach (QString const& offset, offsets)
+        {
+            lastOffset = parser.parseExpression(offset);
+        }
+    }
+
+    QCOMPARE(lastOffset, QString::number(256 * 9999));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testReferencesToRegisterParametersPerformance()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testReferencesToRegisterParametersPerformance()
+{
+    QFETCH(int, registerCount);
+    QFETCH(bool, useCache);
+
+    QSharedPointer<Component> testComponent(new Component());
+
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock());
+    for (int i = 0; i < registerCount; i++)
+    {
+        QSharedPointer<Parameter> registerParameter(new Parameter());
+        registerParameter->setValueId("register_id_" + QString::number(i));
+        registerParameter->setValue(QString::number(i));
+
+        QSharedPointer<Register> testRegister(new Register());
+        testRegister->getParameters()->append(registerParameter);
+        testBlock->getRegisterData()->append(testRegister);
+    }
+
+    QSharedPointer<MemoryMap> testMap(new MemoryMap());
+    testMap->getMemoryBlocks()->append(testBlock);
+    testComponent->getMemoryMaps()->append(testMap);
+
+    QSharedPointer<ParameterFinder> finder;
+    if (useCache)
+    {
+        finder = QSharedPointer<ParameterFinder>(new ParameterCache(testComponent));
+    }
+    else
+    {
+        finder = QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent));
+    }
+
+    // Reference the last registers, which are found last in the search.
+    QStringList expressions;
+    for (int i = qMax(0, registerCount - 100); i < registerCount; i++)
+    {
+        expressions.append(QString("register_id_%1 + 1").arg(i));
+    }
+
+    IPXactSystemVerilogParser parser(finder);
+
+    QString lastValue;
+    QBENCHMARK
+    {
+        foreach (QString const& expression, expressions)
+        {
+            lastValue = parser.parseExpression(expression);
+        }
+    }
+
+    QCOMPARE(lastValue, QString::number(registerCount));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testReferencesToRegisterParametersPerformance_data()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testReferencesToRegisterParametersPerformance_data()
+{
+    QTest::addColumn<int>("registerCount");
+    QTest::addColumn<bool>("useCache");
+
+    QTest::newRow("100 registers, no cache") << 100 << false;
+    QTest::newRow("100 registers, cached") << 100 << true;
+
+    QTest::newRow("5000 registers, no cache") << 5000 << false;
+    QTest::newRow("5000 registers, cached") << 5000 << true;
+}
+
 QTEST_MAIN(tst_IPXactSystemVerilogParser)
 
 #include "tst_IPXactSystemVerilogParser.moc"
@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------
+// File: tst_MemoryConnectionAddressCalculator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for MemoryConnectionAddressCalculator.
+//-----------------------------------------------------------------------------
+
+#include <editors/MemoryDesigner/MemoryConnectionAddressCalculator.h>
+
+#include <editors/MemoryDesigner/ConnectivityInterface.h>
+#include <editors/MemoryDesigner/MemoryDesignerConstants.h>
+#include <editors/MemoryDesigner/MemoryItem.h>
+
+#include <QtTest>
+
+class tst_MemoryConnectionAddressCalculator : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_MemoryConnectionAddressCalculator();
+
+private slots:
+
+    void testStartingBaseAddress();
+
+    void testMemoryMapAddressRanges();
+
+    void testRemappedBaseAddress();
+
+    void testPathAddressesBeyond64Bits();
+
+    void testMirroredSlaveRemapsPathAddresses();
+
+private:
+
+    QSharedPointer<ConnectivityInterface> createInterface(QString const& name, QString const& mode,
+        QString const& baseAddress) const;
+
+    QSharedPointer<MemoryItem> createMemoryMap(QString const& name) const;
+
+    void addAddressBlock(QSharedPointer<MemoryItem> mapItem, QString const& name, QString const& address,
+        QString const& range) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::tst_MemoryConnectionAddressCalculator()
+//-----------------------------------------------------------------------------
+tst_MemoryConnectionAddressCalculator::tst_MemoryConnectionAddressCalculator()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::testStartingBaseAddress()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::testStartingBaseAddress()
+{
+    QSharedPointer<ConnectivityInterface> endInterface = createInterface("slave", "slave", "0");
+
+    QSharedPointer<ConnectivityInterface> wideMaster =
+        createInterface("wideMaster", "master", "36893488147419103232");
+    QCOMPARE(MemoryConnectionAddressCalculator::getStartingBaseAddress(wideMaster, endInterface).toString(),
+        QString("36893488147419103232"));
+
+    QSharedPointer<ConnectivityInterface> unknownMaster = createInterface("unknownMaster", "master", "x");
+    QVERIFY(MemoryConnectionAddressCalculator::getStartingBaseAddress(unknownMaster, endInterface).isZero());
+
+    // A local memory map is not offset by the base address of its address space.
+    QVERIFY(MemoryConnectionAddressCalculator::getStartingBaseAddress(wideMaster, wideMaster).isZero());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::testMemoryMapAddressRanges()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::testMemoryMapAddressRanges()
+{
+    QSharedPointer<MemoryItem> mapItem = createMemoryMap("testMap");
+    addAddressBlock(mapItem, "upperBlock", "18446744073709551648", "32");
+    addAddressBlock(mapItem, "lowerBlock", "18446744073709551616", "16");
+
+    // Only the address blocks define the range of the memory map.
+    QSharedPointer<MemoryItem> otherItem(new MemoryItem("otherItem", "register"));
+    otherItem->setAddress("0");
+    otherItem->setRange("36893488147419103232");
+    mapItem->addChild(otherItem);
+
+    QPair<BigInteger, BigInteger> ranges = MemoryConnectionAddressCalculator::getMemoryMapAddressRanges(mapItem);
+    QCOMPARE(ranges.first.toString(), QString("18446744073709551616"));
+    QCOMPARE(ranges.second.toString(), QString("18446744073709551679"));
+
+    QPair<BigInteger, BigInteger> emptyRanges = MemoryConnectionAddressCalculator::getMemoryMapAddressRanges(
+        createMemoryMap("emptyMap"));
+    QVERIFY(emptyRanges.first.isZero());
+    QVERIFY(emptyRanges.second.isZero());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::testRemappedBaseAddress()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::testRemappedBaseAddress()
+{
+    BigInteger mapBaseAddress(256);
+    BigInteger baseAddress = BigInteger::fromString("18446744073709551616");
+    BigInteger chainAddress(4096);
+    BigInteger mirroredChange = BigInteger::fromString("36893488147419103232");
+
+    QCOMPARE(MemoryConnectionAddressCalculator::getRemappedBaseAddress(mapBaseAddress, baseAddress, chainAddress,
+        mirroredChange, false).toString(), QString("55340232221128659200"));
+
+    // The remapped range of a mirrored slave replaces the range of the memory map.
+    QCOMPARE(MemoryConnectionAddressCalculator::getRemappedBaseAddress(mapBaseAddress, baseAddress, chainAddress,
+        mirroredChange, true).toString(), QString("55340232221128658944"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::testPathAddressesBeyond64Bits()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::testPathAddressesBeyond64Bits()
+{
+    QSharedPointer<ConnectivityInterface> masterInterface =
+        createInterface("master", "master", "18446744073709551616");
+
+    QSharedPointer<ConnectivityInterface> slaveInterface = createInterface("slave", "slave", "0");
+    QSharedPointer<MemoryItem> mapItem = createMemoryMap("slaveMap");
+    addAddressBlock(mapItem, "block", "256", "256");
+    slaveInterface->setConnectedMemory(mapItem);
+
+    QVector<QSharedPointer<ConnectivityInterface const> > path;
+    path.append(masterInterface);
+    path.append(slaveInterface);
+
+    MemoryConnectionAddressCalculator::ConnectionPathVariables pathVariables =
+        MemoryConnectionAddressCalculator::calculatePathAddresses(masterInterface, slaveInterface, path);
+
+    QCOMPARE(pathVariables.hasRemapRange_, false);
+    QCOMPARE(pathVariables.baseAddressNumber_.toString(), QString("18446744073709551616"));
+    QCOMPARE(pathVariables.memoryMapBaseAddress_.toString(), QString("256"));
+    QCOMPARE(pathVariables.endAddressNumber_.toString(), QString("18446744073709552127"));
+    QCOMPARE(pathVariables.remappedAddress_.toString(), QString("18446744073709551872"));
+    QCOMPARE(pathVariables.remappedEndAddress_.toString(), QString("18446744073709552127"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::testMirroredSlaveRemapsPathAddresses()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::testMirroredSlaveRemapsPathAddresses()
+{
+    QSharedPointer<ConnectivityInterface> masterInterface =
+        createInterface("master", "master", "18446744073709551616");
+
+    QSharedPointer<ConnectivityInterface> mirroredSlaveInterface =
+        createInterface("mirroredSlave", "mirroredSlave", "");
+    mirroredSlaveInterface->setRemapAddress("36893488147419103232");
+    mirroredSlaveInterface->setRemapRange("4096");
+
+    QSharedPointer<ConnectivityInterface> slaveInterface = createInterface("slave", "slave", "0");
+    QSharedPointer<MemoryItem> mapItem = createMemoryMap("slaveMap");
+    addAddressBlock(mapItem, "block", "256", "256");
+    slaveInterface->setConnectedMemory(mapItem);
+
+    QVector<QSharedPointer<ConnectivityInterface const> > path;
+    path.append(masterInterface);
+    path.append(mirroredSlaveInterface);
+    path.append(slaveInterface);
+
+    MemoryConnectionAddressCalculator::ConnectionPathVariables pathVariables =
+        MemoryConnectionAddressCalculator::calculatePathAddresses(masterInterface, slaveInterface, path);
+
+    QCOMPARE(pathVariables.hasRemapRange_, true);
+    QCOMPARE(pathVariables.mirroredSlaveAddressChange_.toString(), QString("36893488147419103232"));
+    QCOMPARE(pathVariables.memoryMapEndAddress_.toString(), QString("4095"));
+    QCOMPARE(pathVariables.endAddressNumber_.toString(), QString("18446744073709555711"));
+    QCOMPARE(pathVariables.remappedAddress_.toString(), QString("55340232221128654848"));
+    QCOMPARE(pathVariables.remappedEndAddress_.toString(), QString("55340232221128658943"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::createInterface()
+//-----------------------------------------------------------------------------
+QSharedPointer<ConnectivityInterface> tst_MemoryConnectionAddressCalculator::createInterface(QString const& name,
+    QString const& mode, QString const& baseAddress) const
+{
+    QSharedPointer<ConnectivityInterface> testInterface(new ConnectivityInterface(name));
+    testInterface->setMode(mode);
+    testInterface->setBaseAddress(baseAddress);
+
+    return testInterface;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::createMemoryMap()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryItem> tst_MemoryConnectionAddressCalculator::createMemoryMap(QString const& name) const
+{
+    return QSharedPointer<MemoryItem>(new MemoryItem(name, MemoryDesignerConstants::MEMORYMAP_TYPE));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryConnectionAddressCalculator::addAddressBlock()
+//-----------------------------------------------------------------------------
+void tst_MemoryConnectionAddressCalculator::addAddressBlock(QSharedPointer<MemoryItem> mapItem,
+    QString const& name, QString const& address, QString const& range) const
+{
+    QSharedPointer<MemoryItem> blockItem(new MemoryItem(name, MemoryDesignerConstants::ADDRESSBLOCK_TYPE));
+    blockItem->setAddress(address);
+    blockItem->setRange(range);
+
+    mapItem->addChild(blockItem);
+}
+
+QTEST_APPLESS_MAIN(tst_MemoryConnectionAddressCalculator)
+
+#include "tst_MemoryConnectionAddressCalculator.moc"
@@ -0,0 +1,17 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/BigInteger.h \
+    ../../editors/MemoryDesigner/ConnectivityComponent.h \
+    ../../editors/MemoryDesigner/ConnectivityInterface.h \
+    ../../editors/MemoryDesigner/MemoryConnectionAddressCalculator.h \
+    ../../editors/MemoryDesigner/MemoryDesignerConstants.h \
+    ../../editors/MemoryDesigner/MemoryItem.h
+SOURCES += ../../editors/ComponentEditor/common/BigInteger.cpp \
+    ../../editors/MemoryDesigner/ConnectivityComponent.cpp \
+    ../../editors/MemoryDesigner/ConnectivityInterface.cpp \
+    ../../editors/MemoryDesigner/MemoryConnectionAddressCalculator.cpp \
+    ../../editors/MemoryDesigner/MemoryDesignerConstants.cpp \
+    ../../editors/MemoryDesigner/MemoryItem.cpp \
+    ./tst_MemoryConnectionAddressCalculator.cpp
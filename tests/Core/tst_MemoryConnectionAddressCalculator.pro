@@ -0,0 +1,43 @@
+#-----------------------------------------------------------------------------
+# File: tst_MemoryConnectionAddressCalculator.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for MemoryConnectionAddressCalculator.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_MemoryConnectionAddressCalculator
+
+QT += core xml gui testlib
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_MemoryConnectionAddressCalculator.pri)
@@ -11,7 +11,8 @@ HEADERS += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/address
     ../../common/graphicsItems/visualizeritem.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/NullParser.h \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h
 SOURCES += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.cpp \
     ../../common/graphicsItems/expandableitem.cpp \
     ../../common/graphicsItems/graphicsexpandcollapseitem.cpp \
@@ -21,4 +22,5 @@ SOURCES += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/address
     ./tst_MemoryMapGraphItem.cpp \
     ../../common/graphicsItems/visualizeritem.cpp \
     ../../editors/ComponentEditor/common/NullParser.cpp \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp
@@ -0,0 +1,283 @@
+//-----------------------------------------------------------------------------
+// File: tst_ParameterDependencyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class ParameterDependencyGraph.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/common/ListParameterFinder.h>
+#include <editors/ComponentEditor/common/ParameterDependencyGraph.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+class tst_ParameterDependencyGraph : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ParameterDependencyGraph();
+
+private slots:
+
+    void testReferencesAreFound();
+    void testEvaluationOrder();
+    void testCyclesAreReported();
+    void testSelfReferenceIsReported();
+    void testAffectedParameters();
+    void testUpdateParameter();
+    void testEvaluate();
+
+    void testLongReferenceChainPerformance();
+
+private:
+
+    QSharedPointer<Parameter> addParameter(QString const& id, QString const& value);
+
+    QSharedPointer<QList<QSharedPointer<Parameter> > > parameters_;
+
+    QSharedPointer<ListParameterFinder> finder_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::tst_ParameterDependencyGraph()
+//-----------------------------------------------------------------------------
+tst_ParameterDependencyGraph::tst_ParameterDependencyGraph():
+parameters_(new QList<QSharedPointer<Parameter> >()),
+    finder_(new ListParameterFinder())
+{
+    finder_->setParameterList(parameters_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testReferencesAreFound()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testReferencesAreFound()
+{
+    parameters_->clear();
+    addParameter("id_a", "2");
+    addParameter("id_b", "id_a + 1");
+    addParameter("id_c", "id_a * id_b + id_a");
+    addParameter("id_d", "id_unknown + 4");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    QCOMPARE(graph.getParameterIds(), QStringList() << "id_a" << "id_b" << "id_c" << "id_d");
+
+    QCOMPARE(graph.getReferencedParameters("id_a"), QStringList());
+    QCOMPARE(graph.getReferencedParameters("id_b"), QStringList() << "id_a");
+    QCOMPARE(graph.getReferencedParameters("id_c"), QStringList() << "id_a" << "id_b");
+    QCOMPARE(graph.getReferencedParameters("id_d"), QStringList());
+
+    QCOMPARE(graph.getReferencingParameters("id_a"), QStringList() << "id_b" << "id_c");
+    QCOMPARE(graph.getReferencingParameters("id_b"), QStringList() << "id_c");
+    QCOMPARE(graph.getReferencingParameters("id_c"), QStringList());
+
+    QCOMPARE(graph.findCycles().size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testEvaluationOrder()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testEvaluationOrder()
+{
+    parameters_->clear();
+    addParameter("id_d", "id_c + id_b");
+    addParameter("id_c", "id_b * 2");
+    addParameter("id_b", "id_a");
+    addParameter("id_a", "1");
+    addParameter("id_e", "8");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    QCOMPARE(graph.getEvaluationOrder(), QStringList() << "id_a" << "id_e" << "id_b" << "id_c" << "id_d");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testCyclesAreReported()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testCyclesAreReported()
+{
+    parameters_->clear();
+    addParameter("id_a", "id_b + 1");
+    addParameter("id_b", "id_c + id_e");
+    addParameter("id_c", "id_a");
+    addParameter("id_d", "id_a * 2");
+    addParameter("id_e", "4");
+    addParameter("id_f", "id_g");
+    addParameter("id_g", "id_f");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    QList<QStringList> cycles = graph.findCycles();
+    QCOMPARE(cycles.size(), 2);
+    QCOMPARE(cycles.first(), QStringList() << "id_a" << "id_b" << "id_c" << "id_a");
+    QCOMPARE(cycles.last(), QStringList() << "id_f" << "id_g" << "id_f");
+
+    // Parameters in a cycle or depending on one cannot be ordered.
+    QCOMPARE(graph.getEvaluationOrder(), QStringList() << "id_e");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testSelfReferenceIsReported()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testSelfReferenceIsReported()
+{
+    parameters_->clear();
+    addParameter("id_a", "id_a + 1");
+    addParameter("id_b", "id_a");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    QList<QStringList> cycles = graph.findCycles();
+    QCOMPARE(cycles.size(), 1);
+    QCOMPARE(cycles.first(), QStringList() << "id_a" << "id_a");
+
+    QCOMPARE(graph.getAffectedParameters("id_a"), QStringList() << "id_a" << "id_b");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testAffectedParameters()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testAffectedParameters()
+{
+    parameters_->clear();
+    addParameter("id_a", "1");
+    addParameter("id_d", "id_c + id_b");
+    addParameter("id_c", "id_b * 2");
+    addParameter("id_b", "id_a");
+    addParameter("id_e", "id_b");
+    addParameter("id_f", "3");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    QCOMPARE(graph.getAffectedParameters("id_a"), QStringList() << "id_b" << "id_c" << "id_e" << "id_d");
+    QCOMPARE(graph.getAffectedParameters("id_c"), QStringList() << "id_d");
+    QCOMPARE(graph.getAffectedParameters("id_f"), QStringList());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testUpdateParameter()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testUpdateParameter()
+{
+    parameters_->clear();
+    addParameter("id_a", "1");
+    QSharedPointer<Parameter> secondParameter = addParameter("id_b", "id_a");
+    addParameter("id_c", "2");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    secondParameter->setValue("id_c * 4");
+    graph.updateParameter("id_b");
+
+    QCOMPARE(graph.getReferencedParameters("id_b"), QStringList() << "id_c");
+    QCOMPARE(graph.getReferencingParameters("id_a"), QStringList());
+    QCOMPARE(graph.getReferencingParameters("id_c"), QStringList() << "id_b");
+
+    addParameter("id_d", "id_b");
+    graph.updateParameter("id_d");
+
+    QVERIFY(graph.hasParameter("id_d"));
+    QCOMPARE(graph.getAffectedParameters("id_c"), QStringList() << "id_b" << "id_d");
+
+    parameters_->removeAll(secondParameter);
+    finder_->rebuildIndex();
+    graph.updateParameter("id_b");
+
+    QVERIFY(!graph.hasParameter("id_b"));
+    QCOMPARE(graph.getParameterIds(), QStringList() << "id_a" << "id_c" << "id_d");
+    QCOMPARE(graph.getReferencingParameters("id_c"), QStringList());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testEvaluate()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testEvaluate()
+{
+    parameters_->clear();
+    addParameter("id_c", "id_a * id_b");
+    addParameter("id_b", "id_a + 1");
+    addParameter("id_a", "'h10");
+    addParameter("id_d", "id_e");
+    addParameter("id_e", "id_d");
+
+    ParameterDependencyGraph graph(finder_);
+    graph.rebuild();
+
+    IPXactSystemVerilogParser parser(finder_);
+    QHash<QString, QString> values = graph.evaluate(parser);
+
+    QCOMPARE(values.size(), 5);
+    QCOMPARE(values.value("id_a"), QString("16"));
+    QCOMPARE(values.value("id_b"), QString("17"));
+    QCOMPARE(values.value("id_c"), QString("272"));
+    QCOMPARE(values.value("id_d"), QString("x"));
+    QCOMPARE(values.value("id_e"), QString("x"));
+
+    // The evaluated values are available from the parser.
+    QCOMPARE(parser.parseExpression("id_c + 1"), QString("273"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::testLongReferenceChainPerformance()
+//-----------------------------------------------------------------------------
+void tst_ParameterDependencyGraph::testLongReferenceChainPerformance()
+{
+    const int chainLength = 5000;
+
+    parameters_->clear();
+    addParameter("id_0", "0");
+    for (int i = 1; i <= chainLength; i++)
+    {
+        addParameter("id_" + QString::number(i), QString("id_%1 + 1").arg(i - 1));
+    }
+
+    QHash<QString, QString> values;
+    QList<QStringList> cycles;
+    QBENCHMARK
+    {
+        ParameterDependencyGraph graph(finder_);
+        graph.rebuild();
+
+        cycles = graph.findCycles();
+
+        IPXactSystemVerilogParser parser(finder_);
+        values = graph.evaluate(parser);
+    }
+
+    QCOMPARE(cycles.size(), 0);
+    QCOMPARE(values.value("id_" + QString::number(chainLength)), QString::number(chainLength));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterDependencyGraph::addParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_ParameterDependencyGraph::addParameter(QString const& id, QString const& value)
+{
+    QSharedPointer<Parameter> parameter(new Parameter());
+    parameter->setValueId(id);
+    parameter->setName(id.mid(3));
+    parameter->setValue(value);
+    parameters_->append(parameter);
+    finder_->rebuildIndex();
+
+    return parameter;
+}
+
+QTEST_MAIN(tst_ParameterDependencyGraph)
+
+#include "tst_ParameterDependencyGraph.moc"
@@ -0,0 +1,46 @@
+#-----------------------------------------------------------------------------
+# File: tst_ParameterDependencyGraph.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ParameterDependencyGraph.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ParameterDependencyGraph
+
+QT += core xml testlib
+QT -= gui widgets
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$PWD/../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += $$PWD/../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ParameterDependencyGraph.pri)
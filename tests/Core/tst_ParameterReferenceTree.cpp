@@ -16,6 +16,7 @@
 #include <editors/ComponentEditor/parameterReferenceTree/ParameterReferenceTree.h>
 #include <editors/ComponentEditor/parameterReferenceTree/ComponentParameterReferenceTree.h>
 #include <editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h>
+#include <editors/ComponentEditor/referenceCounter/ParameterReferenceIndex.h>
 
 #include <editors/ComponentEditor/common/ExpressionFormatter.h>
 #include <editors/ComponentEditor/common/ComponentParameterFinder.h>
@@ -70,6 +71,11 @@ private slots:
 
     void testReferenceAsAnExpressionInParameter();
     void testMultipleReferencesInSameExpression();
+    void testReferenceToLongerIdIsNotCounted();
+    void testRecalculatedUsageCountsMatchSingleCounts();
+    void testReferenceIndexFindsReferencingElements();
+    void testReferenceIndexFollowsEdits();
+    void testReferenceIndexReportsChangedParameters();
 
     void testReferenceInViewParameterValueAddsFiveRows();
     void testReferenceInViewModuleParameterValueAddsFiveRows();
@@ -614,6 +620,193 @@ void tst_ParameterReferenceTree::testMultipleReferencesInSameExpression()
     QCOMPARE(tree->topLevelItem(0)->child(0)->child(0)->childCount(), 0);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceToLongerIdIsNotCounted()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceToLongerIdIsNotCounted()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Parameter> longerId(new Parameter);
+    longerId->setName("longerParameter");
+    longerId->setValueId("searched_2");
+
+    // No references, only a reference to an id starting with the searched id.
+    QSharedPointer<Parameter> firstRef = createTestParameter("ref", "searched_2 + 1", "", "", "", "");
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(searched);
+    component->getParameters()->append(longerId);
+    component->getParameters()->append(firstRef);
+
+    QScopedPointer<ComponentParameterReferenceTree> tree(createTestTree(component));
+    tree->openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree->topLevelItemCount(), 1);
+    QCOMPARE(tree->topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME),
+        QStringLiteral("No references found."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testRecalculatedUsageCountsMatchSingleCounts()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testRecalculatedUsageCountsMatchSingleCounts()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Parameter> longerId(new Parameter);
+    longerId->setName("longerParameter");
+    longerId->setValueId("searched_2");
+
+    QSharedPointer<Parameter> firstRef = createTestParameter("ref", "searched_2 + searched*searched", "", "", "",
+        "");
+
+    QSharedPointer<Register> testRegister(new Register("testRegister", "searched", "8"));
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock("testBlock", "searched_2"));
+    testBlock->getRegisterData()->append(testRegister);
+
+    QSharedPointer<MemoryMap> testMap(new MemoryMap("testMap"));
+    testMap->getMemoryBlocks()->append(testBlock);
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(searched);
+    component->getParameters()->append(longerId);
+    component->getParameters()->append(firstRef);
+    component->getMemoryMaps()->append(testMap);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    counter.recalculateReferencesToParameters(component->getParameters()->toVector());
+
+    QCOMPARE(searched->getUsageCount(), 3);
+    QCOMPARE(longerId->getUsageCount(), 2);
+    QCOMPARE(firstRef->getUsageCount(), 0);
+
+    QCOMPARE(counter.countReferencesInMemoryMaps("searched"), 1);
+    QCOMPARE(counter.countReferencesInParameters("searched", component->getParameters()), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceIndexFindsReferencingElements()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceIndexFindsReferencingElements()
+{
+    int document = 0;
+    int section = 0;
+    int first = 0;
+    int second = 0;
+
+    ParameterReferenceIndex index;
+    index.beginUpdate();
+    index.indexElement(&document, nullptr);
+    index.indexElement(&section, &document, QStringList("searched"));
+    index.indexElement(&first, &section, QStringList({"searched + searched_2", "searched*2"}));
+    index.indexElement(&second, &document, QStringList("searched_2"));
+    index.endUpdate();
+
+    QCOMPARE(index.countReferences("searched"), 3);
+    QCOMPARE(index.countReferences("searched", &section), 3);
+    QCOMPARE(index.countOwnReferences("searched", &section), 1);
+    QCOMPARE(index.countReferences("searched", &second), 0);
+    QCOMPARE(index.countReferences("searched_2", &document), 2);
+
+    QList<void const*> referencing = index.getReferencingElements("searched");
+    QCOMPARE(referencing.size(), 2);
+    QVERIFY(referencing.contains(&section));
+    QVERIFY(referencing.contains(&first));
+
+    // Elements not indexed in an update are removed along with their references.
+    index.beginUpdate();
+    index.indexElement(&document, nullptr);
+    index.indexElement(&section, &document, QStringList("other"));
+    index.indexElement(&first, &section, QStringList({"searched + searched_2", "searched*2"}));
+    index.endUpdate();
+
+    QCOMPARE(index.countReferences("searched"), 2);
+    QCOMPARE(index.countReferences("searched_2"), 1);
+    QCOMPARE(index.countReferences("other", &document), 1);
+    QVERIFY(!index.contains(&second));
+    QCOMPARE(index.getReferencingElements("searched"), QList<void const*>({ &first }));
+
+    QCOMPARE(ParameterReferenceIndex::countReferencesInExpression("searched", "searched_2+searched+xsearched"), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceIndexFollowsEdits()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceIndexFollowsEdits()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Port> firstPort(new Port("firstPort"));
+    QSharedPointer<Port> secondPort(new Port("secondPort"));
+    secondPort->setLeftBound("searched");
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(searched);
+    component->getPorts()->append(firstPort);
+    component->getPorts()->append(secondPort);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    QCOMPARE(counter.countReferencesInPorts("searched"), 1);
+    QCOMPARE(counter.getReferenceIndex().getReferencingElements("searched"),
+        QList<void const*>({ secondPort.data() }));
+
+    // The editors report the changed references, after which the index is updated.
+    firstPort->setRightBound("searched - 1");
+    counter.increaseReferenceCount("searched");
+
+    QTRY_COMPARE(counter.countReferencesInSinglePort("searched", firstPort), 1);
+    QCOMPARE(counter.countReferencesInPorts("searched"), 2);
+
+    component->getPorts()->removeOne(secondPort);
+    counter.decreaseReferenceCount("searched");
+
+    QTRY_COMPARE(counter.countReferencesInPorts("searched"), 1);
+    QCOMPARE(counter.getReferenceIndex().getReferencingElements("searched"),
+        QList<void const*>({ firstPort.data() }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceIndexReportsChangedParameters()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceIndexReportsChangedParameters()
+{
+    QSharedPointer<Parameter> first = createTestParameter("first", "1", "", "", "", "");
+    first->setValueId("firstId");
+
+    QSharedPointer<Parameter> second = createTestParameter("second", "firstId + 1", "", "", "", "");
+    second->setValueId("secondId");
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(first);
+    component->getParameters()->append(second);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    QStringList initialIds = counter.takeChangedParameterIds();
+    initialIds.sort();
+    QCOMPARE(initialIds, QStringList({ "firstId", "secondId" }));
+    QVERIFY(counter.takeChangedParameterIds().isEmpty());
+
+    // Only the edited parameter is reported, even though its references did not change.
+    first->setValue("2");
+    QCOMPARE(counter.takeChangedParameterIds(), QStringList("firstId"));
+
+    component->getParameters()->removeOne(second);
+    QCOMPARE(counter.takeChangedParameterIds(), QStringList("secondId"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ParameterReferenceTree::testReferenceInViewParameterValueAddsFiveRows()
 //-----------------------------------------------------------------------------
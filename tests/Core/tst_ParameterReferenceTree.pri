@@ -7,6 +7,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ParameterFinder.h \
     ../../editors/ComponentEditor/parameterReferenceTree/ParameterReferenceTree.h \
     ../../editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h \
+    ../../editors/ComponentEditor/referenceCounter/ParameterReferenceIndex.h \
     ../../editors/ComponentEditor/referenceCounter/ReferenceCounter.h \
     ../../editors/ComponentEditor/parameterReferenceTree/ComponentParameterReferenceTree.h \
     ../../editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h \
@@ -16,5 +17,6 @@ SOURCES += ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../editors/ComponentEditor/parameterReferenceTree/ParameterReferenceTree.cpp \
     ./tst_ParameterReferenceTree.cpp \
     ../../editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.cpp \
+    ../../editors/ComponentEditor/referenceCounter/ParameterReferenceIndex.cpp \
     ../../editors/ComponentEditor/parameterReferenceTree/ComponentParameterReferenceTree.cpp \
     ../../editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.cpp
@@ -14,6 +14,7 @@ HEADERS += ../../common/utils.h \
     ../../common/graphicsItems/visualizeritem.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../editors/ComponentEditor/common/NullParser.h
 SOURCES += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.cpp \
     ../../common/graphicsItems/expandableitem.cpp \
@@ -27,4 +28,5 @@ SOURCES += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/address
     ../../common/utils.cpp \
     ../../common/graphicsItems/visualizeritem.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../editors/ComponentEditor/common/NullParser.cpp
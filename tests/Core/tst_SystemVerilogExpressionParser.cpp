@@ -67,8 +67,14 @@ private slots:
     void testBitwiseOperations();
     void testBitwiseOperations_data();
 
+    void testLargeIntegers();
+    void testLargeIntegers_data();
+
     void testParserPerformance();
     void testParserPerformance_data();
+
+    void testCompiledExpressionPerformance();
+    void testCompiledExpressionPerformance_data();
 };
 
 //-----------------------------------------------------------------------------
@@ -913,6 +919,59 @@ void tst_SystemVerilogExpressionParser::testBitwiseOperations_data()
     QTest::newRow("Shift right") << "4'b1000 >> 3" << "1" << true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testLargeIntegers()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testLargeIntegers()
+{
+    testInputs();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testLargeIntegers_data()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testLargeIntegers_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<QString>("expectedResult");
+    QTest::addColumn<bool>("expectedValid");
+
+    QTest::newRow("Sum above 2^53 is exact") << "'h20_0000_0000_0001 + 1" << "9007199254740994" << true;
+    QTest::newRow("Difference above 2^53 is exact") << "9007199254740993 - 1" << "9007199254740992" << true;
+    QTest::newRow("Product above 2^53 is exact") << "3 * 111111111111111111" << "333333333333333333" << true;
+    QTest::newRow("Power above 2^53 is exact") << "2 ** 59 + 1" << "576460752303423489" << true;
+    QTest::newRow("Quotient above 2^53 is exact") << "999999999999999999 / 7" << "142857142857142857" << true;
+    QTest::newRow("Integers above 2^53 are compared exactly") 
+        << "72057594037927935 == 72057594037927934" << "0" << true;
+    QTest::newRow("Clog2 of integer above 2^53") << "$clog2(2**59 + 1)" << "60" << true;
+    QTest::newRow("Shift result longer than a literal is exact") 
+        << "'hFF_FFFF_FFFF_FFFF << 4" << "1152921504606846960" << true;
+    QTest::newRow("Result longer than a literal is a number in further operations") 
+        << "('hFF_FFFF_FFFF_FFFF << 4) + 1" << "1152921504606846961" << true;
+
+    QTest::newRow("128-bit hexadecimal literal") << "128'hFFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF"
+        << "340282366920938463463374607431768211455" << true;
+    QTest::newRow("Decimal literal above 64 bits") << "18446744073709551616" << "18446744073709551616" << true;
+    QTest::newRow("Sum overflowing 64 bits is exact") << "'h7FFF_FFFF_FFFF_FFFF + 1" << "9223372036854775808" << true;
+    QTest::newRow("Shift to bit 127 is exact") << "1 << 127" << "170141183460469231731687303715884105728" << true;
+    QTest::newRow("Right shift of 128-bit value") << "128'hFFFF_0000_0000_0000_0000_0000_0000_0000 >> 112"
+        << "65535" << true;
+    QTest::newRow("Bitwise and of 128-bit values") 
+        << "128'hFFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF & 128'h1_0000_0000_0000_0000" << "18446744073709551616" << true;
+    QTest::newRow("Bitwise or of 128-bit values") << "(1 << 100) | 1" << "1267650600228229401496703205377" << true;
+    QTest::newRow("Bitwise xor of 128-bit values") << "((1 << 100) | 1) ^ (1 << 100)" << "1" << true;
+    QTest::newRow("Bitwise negation of 128-bit value") << "~(1 << 64)" << "-18446744073709551617" << true;
+    QTest::newRow("Power above 64 bits is exact") << "2 ** 100" << "1267650600228229401496703205376" << true;
+    QTest::newRow("Product above 64 bits is exact") 
+        << "'hFFFF_FFFF_FFFF_FFFF * 'hFFFF_FFFF_FFFF_FFFF" << "340282366920938463426481119284349108225" << true;
+    QTest::newRow("Quotient of 128-bit values") << "(1 << 127) / (1 << 63)" << "18446744073709551616" << true;
+    QTest::newRow("Remainder of 128-bit values") << "((1 << 100) + 5) % (1 << 64)" << "5" << true;
+    QTest::newRow("Clog2 of 128-bit value") << "$clog2(1 << 127)" << "127" << true;
+    QTest::newRow("Clog2 of 128-bit value above power of two") << "$clog2((1 << 127) + 1)" << "128" << true;
+    QTest::newRow("128-bit values are compared exactly") << "(1 << 127) + 1 > (1 << 127)" << "1" << true;
+    QTest::newRow("Division of 128-bit value by zero is unknown") << "(1 << 127) / 0" << "x" << false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_SystemVerilogExpressionParser::testParserPerformance()
 //-----------------------------------------------------------------------------
@@ -949,6 +1008,67 @@ void tst_SystemVerilogExpressionParser::testParserPerformance_data()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testCompiledExpressionPerformance()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testCompiledExpressionPerformance()
+{
+    QFETCH(QString, expression);
+    QFETCH(bool, reuseCompiled);
+    QFETCH(QString, expectedResult);
+
+    SystemVerilogExpressionParser parser;
+    SystemVerilogExpressionParser::clearCompiledExpressions();
+
+    QString parserResult;
+    bool isValid = false;
+
+    if (reuseCompiled)
+    {
+        QBENCHMARK
+        {
+            parserResult = parser.parseExpression(expression, &isValid);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            SystemVerilogExpressionParser::clearCompiledExpressions();
+            parserResult = parser.parseExpression(expression, &isValid);
+        }
+    }
+
+    QCOMPARE(parserResult, expectedResult);
+    QCOMPARE(isValid, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testCompiledExpressionPerformance_data()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testCompiledExpressionPerformance_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<bool>("reuseCompiled");
+    QTest::addColumn<QString>("expectedResult");
+
+    QList<QPair<QString, QString> > registerMapExpressions = {
+        { "'h4000_0000 + 'h100 * 4", "1073742848" },
+        { "32'h1000 + 2 * 32'h20 + 'h4", "4164" },
+        { "(8'hFF << 8) | 'h0F", "65295" },
+        { "$clog2(1024) - 1", "9" },
+        { "(16 * 1024) / 32 - 1", "511" }
+    };
+
+    for (QPair<QString, QString> const& testCase : registerMapExpressions)
+    {
+        QTest::newRow(qPrintable(testCase.first + " compiled each time")) << testCase.first << false <<
+            testCase.second;
+        QTest::newRow(qPrintable(testCase.first + " compiled once")) << testCase.first << true <<
+            testCase.second;
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_SystemVerilogExpressionParser)
 
 #include "tst_SystemVerilogExpressionParser.moc"
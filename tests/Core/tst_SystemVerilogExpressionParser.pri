@@ -3,6 +3,8 @@
 # ------------------------------------------------------
 
 HEADERS += ../../editors/ComponentEditor/common/ExpressionParser.h \
-    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h
 SOURCES += ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_SystemVerilogExpressionParser.cpp
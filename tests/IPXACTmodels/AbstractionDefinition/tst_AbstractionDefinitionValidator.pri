@@ -37,6 +37,7 @@ HEADERS += ../../../IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h \
     ../../../IPXACTmodels/common/Qualifier.h \
     ../../../IPXACTmodels/common/Range.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/TimingConstraint.h \
     ../../../IPXACTmodels/common/validators/TimingConstraintValidator.h \
     ../../../IPXACTmodels/AbstractionDefinition/TransactionalAbstraction.h \
@@ -97,6 +98,7 @@ SOURCES += ../../../IPXACTmodels/AbstractionDefinition/AbstractionDefinition.cpp
     ../../../IPXACTmodels/common/Qualifier.cpp \
     ../../../IPXACTmodels/common/Range.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../IPXACTmodels/common/TimingConstraint.cpp \
     ../../../IPXACTmodels/common/validators/TimingConstraintValidator.cpp \
     ../../../IPXACTmodels/AbstractionDefinition/TransactionalAbstraction.cpp \
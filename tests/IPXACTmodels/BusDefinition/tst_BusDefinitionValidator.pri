@@ -19,6 +19,7 @@ HEADERS += ../../../IPXACTmodels/common/Array.h \
     ../../../IPXACTmodels/common/Parameter.h \
     ../../../IPXACTmodels/common/Range.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/VLNV.h \
     ../../../IPXACTmodels/common/Vector.h \
     ../../../IPXACTmodels/BusDefinition/validators/BusDefinitionValidator.h \
@@ -44,6 +45,7 @@ SOURCES += ../../../IPXACTmodels/common/validators/ValueFormatter.cpp \
     ../../../IPXACTmodels/common/Parameter.cpp \
     ../../../IPXACTmodels/common/Range.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../IPXACTmodels/common/VLNV.cpp \
     ../../../IPXACTmodels/common/Vector.cpp \
     ./tst_BusDefinitionValidator.cpp
@@ -13,12 +13,14 @@
 
 #include <IPXACTmodels/Component/validators/AddressBlockValidator.h>
 #include <IPXACTmodels/Component/validators/RegisterValidator.h>
+#include <IPXACTmodels/Component/validators/RegisterFileValidator.h>
 #include <IPXACTmodels/Component/validators/FieldValidator.h>
 #include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
 
 #include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/RegisterFile.h>
 #include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/common/Parameter.h>
 
@@ -62,6 +64,11 @@ private slots:
     void testRegisterOverlapping();
     void testRegisterOverlapping_data();
     void testRegisterIsOverlappingTwoOtherRegisters();
+    void testRegisterOverlappingRegisterFile();
+    void testRegisterOverlappingRegisterFile_data();
+
+    void testRegisterOverlapPerformance();
+    void testRegisterOverlapPerformance_data();
 
 private:
     
@@ -1038,6 +1045,153 @@ void tst_AddressBlockValidator::testRegisterIsOverlappingTwoOtherRegisters()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockValidator::testRegisterOverlappingRegisterFile()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockValidator::testRegisterOverlappingRegisterFile()
+{
+    QFETCH(QString, registerOffset);
+    QFETCH(QString, registerFileOffset);
+    QFETCH(QString, registerFileRange);
+    QFETCH(QString, registerFileDimension);
+    QFETCH(bool, isValid);
+
+    QSharedPointer<Field> testField (new Field("testField"));
+    testField->setBitOffset("0");
+    testField->setBitWidth("1");
+
+    QSharedPointer<Register> testRegister (new Register("testRegister", registerOffset, "8"));
+    testRegister->getFields()->append(testField);
+
+    QSharedPointer<RegisterFile> testRegisterFile (new RegisterFile("testFile", registerFileOffset,
+        registerFileRange));
+    testRegisterFile->setDimension(registerFileDimension);
+
+    QSharedPointer<AddressBlock> testBlock (new AddressBlock("testBlock", "0"));
+    testBlock->setWidth("8");
+    testBlock->setRange("100");
+    testBlock->getRegisterData()->append(testRegister);
+    testBlock->getRegisterData()->append(testRegisterFile);
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ParameterValidator> parameterValidator (
+        new ParameterValidator(parser, QSharedPointer<QList<QSharedPointer<Choice> > > ()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(parser));
+    QSharedPointer<FieldValidator> fieldValidator (new FieldValidator(parser, enumValidator, parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator (new RegisterValidator(parser, fieldValidator,
+        parameterValidator));
+    AddressBlockValidator validator(parser, registerValidator, QSharedPointer<RegisterFileValidator>(),
+        parameterValidator);
+    QCOMPARE(validator.hasValidRegisterData(testBlock, "8"), isValid);
+
+    if (!isValid)
+    {
+        QVector<QString> foundErrors;
+        validator.findErrorsIn(foundErrors, testBlock, "8", "test");
+
+        // Areas beginning at the same address are reported in the order of the register data.
+        QString expectedError = QObject::tr("Registers %1 and %2 overlap within addressBlock %3");
+        if (parser->parseExpression(registerOffset).toInt() <= parser->parseExpression(registerFileOffset).toInt())
+        {
+            expectedError = expectedError.arg(testRegister->name()).arg(testRegisterFile->name());
+        }
+        else
+        {
+            expectedError = expectedError.arg(testRegisterFile->name()).arg(testRegister->name());
+        }
+
+        if (errorIsNotFoundInErrorList(expectedError.arg(testBlock->name()), foundErrors))
+        {
+            QFAIL("No error message found");
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockValidator::testRegisterOverlappingRegisterFile_data()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockValidator::testRegisterOverlappingRegisterFile_data()
+{
+    QTest::addColumn<QString>("registerOffset");
+    QTest::addColumn<QString>("registerFileOffset");
+    QTest::addColumn<QString>("registerFileRange");
+    QTest::addColumn<QString>("registerFileDimension");
+    QTest::addColumn<bool>("isValid");
+
+    QTest::newRow("Register after register file is valid") << "16" << "0" << "16" << "" << true;
+    QTest::newRow("Register before register file is valid") << "0" << "1" << "16" << "" << true;
+    QTest::newRow("Register within register file is not valid") << "8" << "0" << "16" << "" << false;
+    QTest::newRow("Register at the first address of register file is not valid") << "4" << "4" << "16" << "" <<
+        false;
+    QTest::newRow("Register within register file dimensions is not valid") << "40" << "0" << "16" << "4" <<
+        false;
+    QTest::newRow("Register after register file dimensions is valid") << "64" << "0" << "16" << "4" << true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockValidator::testRegisterOverlapPerformance()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockValidator::testRegisterOverlapPerformance()
+{
+    QFETCH(int, registerCount);
+
+    QSharedPointer<Field> testField (new Field("testField"));
+    testField->setBitOffset("0");
+    testField->setBitWidth("1");
+
+    QSharedPointer<AddressBlock> testBlock (new AddressBlock("testBlock", "0"));
+    testBlock->setWidth("32");
+    testBlock->setRange(QString::number(registerCount * 4));
+
+    for (int i = 0; i < registerCount; i++)
+    {
+        QSharedPointer<Register> testRegister (new Register("register" + QString::number(i),
+            QString::number(i * 4), "32"));
+        testRegister->setTypeIdentifier("type" + QString::number(i % 10));
+        testRegister->getFields()->append(testField);
+
+        testBlock->getRegisterData()->append(testRegister);
+    }
+
+    // The last register overlaps the first one.
+    testBlock->getRegisterData()->last()->setAddressOffset("2");
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ParameterValidator> parameterValidator (
+        new ParameterValidator(parser, QSharedPointer<QList<QSharedPointer<Choice> > > ()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(parser));
+    QSharedPointer<FieldValidator> fieldValidator (new FieldValidator(parser, enumValidator, parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator (new RegisterValidator(parser, fieldValidator,
+        parameterValidator));
+    AddressBlockValidator validator(parser, registerValidator, QSharedPointer<RegisterFileValidator>(),
+        parameterValidator);
+
+    QVector<QString> foundErrors;
+    QBENCHMARK
+    {
+        foundErrors.clear();
+        validator.findErrorsIn(foundErrors, testBlock, "8", "test");
+    }
+
+    QString expectedError = QObject::tr("Registers %1 and %2 overlap within addressBlock %3")
+        .arg("register0").arg("register" + QString::number(registerCount - 1)).arg(testBlock->name());
+
+    QCOMPARE(foundErrors.count(expectedError), 1);
+    QCOMPARE(validator.hasValidRegisterData(testBlock, "8"), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockValidator::testRegisterOverlapPerformance_data()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockValidator::testRegisterOverlapPerformance_data()
+{
+    QTest::addColumn<int>("registerCount");
+
+    QTest::newRow("100 registers") << 100;
+    QTest::newRow("1000 registers") << 1000;
+    QTest::newRow("10000 registers") << 10000;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_AddressBlockValidator::errorIsNotFoundInErrorList()
 //-----------------------------------------------------------------------------
@@ -28,6 +28,7 @@ HEADERS += ../../../IPXACTmodels/common/AccessTypes.h \
     ../../../IPXACTmodels/Component/RegisterFile.h \
     ../../../IPXACTmodels/Component/RegisterReader.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/VLNV.h \
     ../../../IPXACTmodels/common/Vector.h \
     ../../../IPXACTmodels/Component/WriteValueConstraint.h \
@@ -71,6 +72,7 @@ SOURCES += ../../../IPXACTmodels/common/AccessTypes.cpp \
     ../../../IPXACTmodels/Component/RegisterFile.cpp \
     ../../../IPXACTmodels/Component/RegisterReader.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../IPXACTmodels/common/VLNV.cpp \
     ../../../IPXACTmodels/common/Vector.cpp \
     ../../../IPXACTmodels/Component/WriteValueConstraint.cpp \
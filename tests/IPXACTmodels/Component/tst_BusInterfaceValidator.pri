@@ -67,6 +67,7 @@ HEADERS += ../../../IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h \
     ../../../IPXACTmodels/Component/Segment.h \
     ../../../IPXACTmodels/Component/SlaveInterface.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/TimingConstraint.h \
     ../../../IPXACTmodels/Component/Transactional.h \
     ../../../IPXACTmodels/AbstractionDefinition/TransactionalAbstraction.h \
@@ -166,6 +167,7 @@ SOURCES += ../../../IPXACTmodels/Design/MonitorInterconnection.cpp \
     ../../../IPXACTmodels/Component/Segment.cpp \
     ../../../IPXACTmodels/Component/SlaveInterface.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../IPXACTmodels/common/TimingConstraint.cpp \
     ../../../IPXACTmodels/Component/Transactional.cpp \
     ../../../IPXACTmodels/AbstractionDefinition/TransactionalAbstraction.cpp \
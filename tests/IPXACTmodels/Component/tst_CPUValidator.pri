@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/Parameter.h \
     ../../../IPXACTmodels/common/validators/ParameterValidator.h \
     ../../../IPXACTmodels/common/NameGroup.h \
@@ -22,6 +23,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../IPXACTmodels/Component/MemoryMapBase.h \
     ../../../IPXACTmodels/Component/Segment.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_CPUValidator.cpp \
     ../../../IPXACTmodels/common/Parameter.cpp \
     ../../../IPXACTmodels/common/validators/ParameterValidator.cpp \
@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/NameGroup.h \
     ../../../IPXACTmodels/common/VLNV.h \
     ../../../IPXACTmodels/Component/validators/ChannelValidator.h \
@@ -29,6 +30,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../IPXACTmodels/Component/Channel.h \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Position.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ChannelValidator.cpp \
     ../../../IPXACTmodels/common/NameGroup.cpp \
     ../../../IPXACTmodels/common/VLNV.cpp \
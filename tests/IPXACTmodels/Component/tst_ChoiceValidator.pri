@@ -4,10 +4,12 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/Choice.h \
     ../../../IPXACTmodels/Component/validators/ChoiceValidator.h \
     ../../../IPXACTmodels/common/Enumeration.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ChoiceValidator.cpp \
     ../../../IPXACTmodels/Component/Choice.cpp \
     ../../../IPXACTmodels/Component/validators/ChoiceValidator.cpp \
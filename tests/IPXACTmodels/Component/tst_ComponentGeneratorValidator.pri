@@ -3,6 +3,7 @@
 # ------------------------------------------------------
 
 HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/NameGroup.h \
     ../../../IPXACTmodels/Component/validators/ComponentGeneratorValidator.h \
     ../../../IPXACTmodels/Component/ComponentGenerator.h \
@@ -19,6 +20,7 @@ HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser
     ../../../IPXACTmodels/common/Vector.h \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Group.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ComponentGeneratorValidator.cpp \
     ../../../IPXACTmodels/common/NameGroup.cpp \
     ../../../IPXACTmodels/Component/validators/ComponentGeneratorValidator.cpp \
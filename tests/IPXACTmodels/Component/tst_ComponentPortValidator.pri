@@ -19,6 +19,7 @@ HEADERS += ../../../IPXACTmodels/common/Array.h \
     ../../../IPXACTmodels/common/Protocol.h \
     ../../../IPXACTmodels/common/Range.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/Transactional.h \
     ../../../IPXACTmodels/common/TransactionalTypes.h \
     ../../../IPXACTmodels/common/VLNV.h \
@@ -46,6 +47,7 @@ SOURCES += ../../../IPXACTmodels/Component/validators/PortTypeValidator.cpp \
     ../../../IPXACTmodels/common/Protocol.cpp \
     ../../../IPXACTmodels/common/Range.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../IPXACTmodels/Component/Transactional.cpp \
     ../../../IPXACTmodels/common/TransactionalTypes.cpp \
     ../../../IPXACTmodels/common/VLNV.cpp \
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include <IPXACTmodels/Component/ComponentReader.h>
+#include <IPXACTmodels/Component/ComponentStreamReader.h>
 
 #include <IPXACTmodels/Component/AddressSpace.h>
 #include <IPXACTmodels/Component/BusInterface.h>
@@ -37,8 +38,32 @@
 #include <IPXACTmodels/kactusExtensions/FileDependency.h>
 
 #include <QtTest>
+#include <QBuffer>
 #include <QDomNode>
 
+//-----------------------------------------------------------------------------
+//! Reads the test documents with the reader selected in the global test data.
+//-----------------------------------------------------------------------------
+class TestComponentReader
+{
+public:
+    QSharedPointer<Component> createComponentFrom(QDomDocument const& document) const
+    {
+        QFETCH_GLOBAL(bool, streaming);
+        if (streaming)
+        {
+            QByteArray content = document.toByteArray(-1);
+            QBuffer buffer(&content);
+
+            ComponentStreamReader streamReader;
+            return streamReader.createComponentFrom(&buffer);
+        }
+
+        ComponentReader domReader;
+        return domReader.createComponentFrom(document);
+    }
+};
+
 class tst_ComponentReader : public QObject
 {
     Q_OBJECT
@@ -47,6 +72,7 @@ public:
     tst_ComponentReader();
 
 private slots:
+    void initTestCase_data();
 
     void readSimpleComponent();
     
@@ -93,6 +119,17 @@ tst_ComponentReader::tst_ComponentReader()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentReader::initTestCase_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentReader::initTestCase_data()
+{
+    QTest::addColumn<bool>("streaming");
+
+    QTest::newRow("DOM reader") << false;
+    QTest::newRow("streaming reader") << true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ComponentReader::readSimpleComponent()
 //-----------------------------------------------------------------------------
@@ -117,7 +154,7 @@ void tst_ComponentReader::readSimpleComponent()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -155,7 +192,7 @@ void tst_ComponentReader::readXMLProcessingInstructions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -194,7 +231,7 @@ void tst_ComponentReader::readXMLNameSpaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -248,7 +285,7 @@ void tst_ComponentReader::readBusInterfaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -294,7 +331,7 @@ void tst_ComponentReader::readIndirectInterfaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -342,7 +379,7 @@ void tst_ComponentReader::readChannels()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -385,7 +422,7 @@ void tst_ComponentReader::readRemapStates()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -427,7 +464,7 @@ void tst_ComponentReader::readAddressSpaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -469,7 +506,7 @@ void tst_ComponentReader::readMemoryMaps()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -511,7 +548,7 @@ void tst_ComponentReader::readViews()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -563,7 +600,7 @@ void tst_ComponentReader::readInstantiations()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -626,7 +663,7 @@ void tst_ComponentReader::readPorts()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -671,7 +708,7 @@ void tst_ComponentReader::readComponentGenerators()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -713,7 +750,7 @@ void tst_ComponentReader::readChoices()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -755,7 +792,7 @@ void tst_ComponentReader::readFileSets()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -796,7 +833,7 @@ void tst_ComponentReader::readCPUs()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -841,7 +878,7 @@ void tst_ComponentReader::readOtherClockDrivers()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -862,7 +899,7 @@ void tst_ComponentReader::readOtherClockDrivers()
 //-----------------------------------------------------------------------------
 void tst_ComponentReader::readResetTypes()
 {
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QString documentContent(
         "<?xml version=\"1.0\"?>"
@@ -945,7 +982,7 @@ void tst_ComponentReader::readParameters()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -990,7 +1027,7 @@ void tst_ComponentReader::readAssertions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1032,7 +1069,7 @@ void tst_ComponentReader::readVendorExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1073,7 +1110,7 @@ void tst_ComponentReader::readKactusAttributes()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1112,7 +1149,7 @@ void tst_ComponentReader::readSwComProperties()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1164,7 +1201,7 @@ void tst_ComponentReader::readSystemViews()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1227,7 +1264,7 @@ void tst_ComponentReader::readComInterfaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1288,7 +1325,7 @@ void tst_ComponentReader::readApiInterfaces()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1338,7 +1375,7 @@ void tst_ComponentReader::readFileDependencies()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
@@ -1382,7 +1419,7 @@ void tst_ComponentReader::readAuthorAndLicense()
     QDomDocument document;
     document.setContent(documentContent);
 
-    ComponentReader componentReader;
+    TestComponentReader componentReader;
 
     QSharedPointer<Component> testComponent = componentReader.createComponentFrom(document);
 
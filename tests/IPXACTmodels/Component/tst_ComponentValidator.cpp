@@ -140,10 +140,17 @@ private slots:
     void testHasValidAssertions();
     void testHasValidAssertions_data();
 
+    void testParallelValidationKeepsErrorOrder();
+
+    void testDiagnosticsAreReportedPerSection();
+
 private:
 
     bool errorIsNotFoundInErrorList(QString const& expectedError, QVector<QString> errorList);
 
+    void verifyDiagnosticsMatchValidation(QSharedPointer<ComponentValidator> validator,
+        QSharedPointer<Component> component);
+
     QSharedPointer<ComponentValidator> createComponentValidator(LibraryMock* mockLibrary);
 };
 
@@ -170,6 +177,7 @@ void tst_ComponentValidator::testHasValidVLNV()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidVLNV(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -267,6 +275,7 @@ void tst_ComponentValidator::testHasValidBusInterfaces()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(mockLibrary);
     QCOMPARE(validator->hasValidBusInterfaces(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -367,6 +376,7 @@ void tst_ComponentValidator::testHasValidIndirectInterfaces()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(mockLibrary);
     QCOMPARE(validator->hasValidIndirectInterfaces(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     delete mockLibrary;
 }
@@ -434,6 +444,7 @@ void tst_ComponentValidator::testHasValidChannels()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidChannels(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -504,6 +515,7 @@ void tst_ComponentValidator::testHasValidRemapStates()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidRemapStates(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
 
     if (!isValid)
@@ -566,6 +578,7 @@ void tst_ComponentValidator::testHasValidAddressSpaces()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidAddressSpaces(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -639,6 +652,7 @@ void tst_ComponentValidator::testHasValidMemoryMaps()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidMemoryMaps(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -698,6 +712,7 @@ void tst_ComponentValidator::testHasValidViews()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidViews(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -758,6 +773,7 @@ void tst_ComponentValidator::testHasValidComponentInstantiations()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidComponentInstantiations(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -833,6 +849,7 @@ void tst_ComponentValidator::testHasValidDesignInstantiations()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(mockLibrary);
     QCOMPARE(validator->hasValidDesignInstantiations(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -919,6 +936,7 @@ void tst_ComponentValidator::testHasValidDesignConfigurationInstantiations()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(mockLibrary);
     QCOMPARE(validator->hasValidDesignConfigurationInstantiations(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -991,6 +1009,7 @@ void tst_ComponentValidator::testHasValidPorts()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidPorts(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1060,6 +1079,7 @@ void tst_ComponentValidator::testHasValidComponentGenerators()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidComponentGenerators(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1137,6 +1157,7 @@ void tst_ComponentValidator::testHasValidChoices()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidChoices(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1212,6 +1233,7 @@ void tst_ComponentValidator::testHasValidFileSets()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidFileSets(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1282,6 +1304,7 @@ void tst_ComponentValidator::testHasValidCPUs()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidCPUs(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1360,6 +1383,7 @@ void tst_ComponentValidator::testHasValidOtherClockDrivers()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidOtherClockDrivers(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1430,6 +1454,7 @@ void tst_ComponentValidator::testHasValidResetTypes()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidResetTypes(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1499,6 +1524,7 @@ void tst_ComponentValidator::testHasValidParameters()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidParameters(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1568,6 +1594,7 @@ void tst_ComponentValidator::testHasValidAssertions()
 
     QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
     QCOMPARE(validator->hasValidAssertions(testComponent), isValid);
+    verifyDiagnosticsMatchValidation(validator, testComponent);
 
     if (!isValid)
     {
@@ -1617,6 +1644,94 @@ void tst_ComponentValidator::testHasValidAssertions_data()
     QTest::newRow("Assertions with the same name is not valid") << "Onibocho" << "1" << true << false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidator::testParallelValidationKeepsErrorOrder()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidator::testParallelValidationKeepsErrorOrder()
+{
+    QSharedPointer<Component> testComponent (new Component(
+        VLNV(VLNV::COMPONENT, "Samurai", "Champloo", "MugenJinFuu", "3.0")));
+
+    // The names repeat, so the duplicates are found across the ranges of ports and memory maps.
+    for (int i = 0; i < 1000; ++i)
+    {
+        QString portName = i % 10 == 0 ? QString() : QStringLiteral("Port_%1").arg(i / 2);
+        DirectionTypes::Direction direction = i % 3 == 0 ? DirectionTypes::DIRECTION_INVALID : DirectionTypes::IN;
+
+        testComponent->getPorts()->append(QSharedPointer<Port>(new Port(portName, direction)));
+    }
+
+    for (int i = 0; i < 40; ++i)
+    {
+        QString mapName = i % 5 == 0 ? QString() : QStringLiteral("Map_%1").arg(i / 3);
+        testComponent->getMemoryMaps()->append(QSharedPointer<MemoryMap>(new MemoryMap(mapName)));
+    }
+
+    testComponent->getViews()->append(QSharedPointer<View>(new View("Jin")));
+    testComponent->getViews()->append(QSharedPointer<View>(new View("")));
+    testComponent->getViews()->append(QSharedPointer<View>(new View("Jin")));
+
+    QVector<QString> sequentialErrors;
+    createComponentValidator(0)->findErrorsIn(sequentialErrors, testComponent);
+
+    QSharedPointer<ComponentValidator> parallelValidator = createComponentValidator(0);
+    parallelValidator->setParallelValidation([]()
+    {
+        return QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser());
+    });
+
+    QVERIFY(parallelValidator->isParallelValidationEnabled());
+
+    QVector<QString> parallelErrors;
+    parallelValidator->findErrorsIn(parallelErrors, testComponent);
+
+    QVERIFY(sequentialErrors.isEmpty() == false);
+    QCOMPARE(parallelErrors, sequentialErrors);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidator::testDiagnosticsAreReportedPerSection()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidator::testDiagnosticsAreReportedPerSection()
+{
+    QSharedPointer<Component> testComponent (new Component(
+        VLNV(VLNV::COMPONENT, "Samurai", "Champloo", "MugenJinFuu", "3.0")));
+
+    testComponent->getViews()->append(QSharedPointer<View>(new View("")));
+
+    QSharedPointer<Parameter> testParameter (new Parameter());
+    testParameter->setName("Fuu");
+    testComponent->getParameters()->append(testParameter);
+
+    QSharedPointer<ComponentValidator> validator = createComponentValidator(0);
+
+    QVector<ValidationDiagnostic> diagnostics;
+    validator->findDiagnosticsIn(diagnostics, testComponent);
+
+    QVector<QString> foundErrors;
+    validator->findErrorsIn(foundErrors, testComponent);
+
+    QCOMPARE(diagnostics.size(), foundErrors.size());
+
+    QString componentPath = testComponent->getVlnv().toString();
+    bool viewErrorFound = false;
+    bool parameterErrorFound = false;
+    for (int i = 0; i < diagnostics.size(); ++i)
+    {
+        ValidationDiagnostic const& diagnostic = diagnostics.at(i);
+        QCOMPARE(diagnostic.message, foundErrors.at(i));
+        QCOMPARE(diagnostic.severity, ValidationDiagnostic::SEVERITY_ERROR);
+
+        viewErrorFound |= diagnostic.elementPath == componentPath + "/views";
+        parameterErrorFound |= diagnostic.elementPath == componentPath + "/parameters";
+    }
+
+    QVERIFY(viewErrorFound);
+    QVERIFY(parameterErrorFound);
+
+    verifyDiagnosticsMatchValidation(validator, testComponent);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ComponentValidator::errorIsNotFoundInErrorList()
 //-----------------------------------------------------------------------------
@@ -1636,6 +1751,24 @@ bool tst_ComponentValidator::errorIsNotFoundInErrorList(QString const& expectedE
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidator::verifyDiagnosticsMatchValidation()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidator::verifyDiagnosticsMatchValidation(QSharedPointer<ComponentValidator> validator,
+    QSharedPointer<Component> component)
+{
+    QVector<ValidationDiagnostic> diagnostics;
+    validator->findDiagnosticsIn(diagnostics, component);
+
+    bool hasErrors = false;
+    foreach (ValidationDiagnostic const& diagnostic, diagnostics)
+    {
+        hasErrors |= diagnostic.severity == ValidationDiagnostic::SEVERITY_ERROR;
+    }
+
+    QCOMPARE(hasErrors, !validator->validate(component));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ComponentValidator::createComponentValidator()
 //-----------------------------------------------------------------------------
@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_ComponentValidator
 
-QT += core gui xml testlib
+QT += core gui xml testlib concurrent
 
 CONFIG += c++11 testcase console
 DEFINES += IPXACTMODELS_LIB
@@ -3,6 +3,7 @@
 # ------------------------------------------------------
 
 HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Group.h \
     ../../../IPXACTmodels/Component/EnumeratedValue.h \
     ../../../IPXACTmodels/Component/validators/EnumeratedValueValidator.h \
@@ -20,6 +21,7 @@ HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser
     ../../../IPXACTmodels/common/validators/ValueFormatter.h \
     ../../../IPXACTmodels/Component/Choice.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_EnumeratedValueValidator.cpp \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Group.cpp \
     ../../../IPXACTmodels/Component/EnumeratedValue.cpp \
@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/WriteValueConstraint.h \
     ../../../IPXACTmodels/Component/Choice.h \
     ../../../IPXACTmodels/Component/EnumeratedValue.h \
@@ -26,6 +27,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../IPXACTmodels/common/validators/ValueFormatter.h
 SOURCES += ../../../IPXACTmodels/common/validators/ValueFormatter.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_FieldValidator.cpp \
     ../../../IPXACTmodels/Component/WriteValueConstraint.cpp \
     ../../../IPXACTmodels/Component/Choice.cpp \
@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/validators/FileValidator.h \
     ../../../IPXACTmodels/Component/validators/FileSetValidator.h \
     ../../../IPXACTmodels/Component/FileSet.h \
@@ -20,6 +21,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../IPXACTmodels/common/FileTypes.h \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Group.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_FileSetValidator.cpp \
     ../../../IPXACTmodels/Component/validators/FileValidator.cpp \
     ../../../IPXACTmodels/Component/validators/FileSetValidator.cpp \
@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/File.h \
     ../../../IPXACTmodels/Component/validators/FileValidator.h \
     ../../../IPXACTmodels/Component/BuildCommand.h \
@@ -16,6 +17,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../IPXACTmodels/common/BooleanValue.h \
     ../../../IPXACTmodels/kactusExtensions/Kactus2Value.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_FileValidator.cpp \
     ../../../IPXACTmodels/Component/File.cpp \
     ../../../IPXACTmodels/Component/validators/FileValidator.cpp \
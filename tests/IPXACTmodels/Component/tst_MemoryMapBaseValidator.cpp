@@ -41,9 +41,15 @@ private slots:
     void testAddressBlocksAreValid();
     void testAddressBlocksOverlap();
     void testAddressBlocksOverlap_data();
+    void testEachOverlappingPairIsReported();
+
+    void testAddressBlockOverlapPerformance();
+    void testAddressBlockOverlapPerformance_data();
 
 private:
 
+    QSharedPointer<MemoryMapBaseValidator> createValidator(QSharedPointer<ExpressionParser> parser);
+
     bool errorIsNotFoundInErrorList(QString const& expectedError, QVector<QString> errorList);
 };
 
@@ -289,6 +295,132 @@ void tst_MemoryMapBaseValidator::testAddressBlocksOverlap_data()
         "10" << "5" << "10" << false;
     QTest::newRow("Block1: baseAddress = 15, range = 10, Block2: baseAddress = 5, range = 10 is valid") << "15" <<
         "10" << "5" << "10" << true;
+    QTest::newRow("Block1: baseAddress = 2^31, range = 16, Block2: baseAddress = 0, range = 16 is valid") <<
+        "2147483648" << "16" << "0" << "16" << true;
+    QTest::newRow("Block1: baseAddress = 2^32, range = 16, Block2: baseAddress = 2^32 + 8, range = 16 is invalid") <<
+        "4294967296" << "16" << "4294967304" << "16" << false;
+    QTest::newRow("Block1: baseAddress = 2^63, range = 16, Block2: baseAddress = 0, range = 16 is valid") <<
+        "9223372036854775808" << "16" << "0" << "16" << true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseValidator::testEachOverlappingPairIsReported()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapBaseValidator::testEachOverlappingPairIsReported()
+{
+    QSharedPointer<AddressBlock> blockOne (new AddressBlock("One", "8"));
+    blockOne->setRange("8");
+    blockOne->setWidth("8");
+
+    QSharedPointer<AddressBlock> blockTwo (new AddressBlock("Two", "0"));
+    blockTwo->setRange("10");
+    blockTwo->setWidth("8");
+
+    QSharedPointer<AddressBlock> blockThree (new AddressBlock("Three", "20"));
+    blockThree->setRange("4");
+    blockThree->setWidth("8");
+
+    QSharedPointer<AddressBlock> blockFour (new AddressBlock("Four", "2"));
+    blockFour->setRange("8");
+    blockFour->setWidth("8");
+
+    QSharedPointer<MemoryMapBase> testMap (new MemoryMapBase("testMap"));
+    testMap->getMemoryBlocks()->append(blockOne);
+    testMap->getMemoryBlocks()->append(blockTwo);
+    testMap->getMemoryBlocks()->append(blockThree);
+    testMap->getMemoryBlocks()->append(blockFour);
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<MemoryMapBaseValidator> validator = createValidator(parser);
+
+    QCOMPARE(validator->hasValidMemoryBlocks(testMap, ""), false);
+
+    QVector<QString> foundErrors;
+    validator->findErrorsIn(foundErrors, testMap, "", "test");
+
+    QVector<QString> overlapErrors;
+    foreach (QString const& error, foundErrors)
+    {
+        if (error.contains(QStringLiteral("overlap")))
+        {
+            overlapErrors.append(error);
+        }
+    }
+
+    QString overlapError = QObject::tr("Address blocks %1 and %2 overlap in memory map testMap");
+
+    QCOMPARE(overlapErrors.size(), 3);
+    QCOMPARE(overlapErrors.at(0), overlapError.arg("One").arg("Two"));
+    QCOMPARE(overlapErrors.at(1), overlapError.arg("One").arg("Four"));
+    QCOMPARE(overlapErrors.at(2), overlapError.arg("Two").arg("Four"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseValidator::testAddressBlockOverlapPerformance()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapBaseValidator::testAddressBlockOverlapPerformance()
+{
+    QFETCH(int, blockCount);
+
+    QSharedPointer<MemoryMapBase> testMap (new MemoryMapBase("testMap"));
+    for (int i = 0; i < blockCount; i++)
+    {
+        QSharedPointer<AddressBlock> testBlock (new AddressBlock("block" + QString::number(i),
+            QString::number(i * 16)));
+        testBlock->setRange("16");
+        testBlock->setWidth("8");
+
+        testMap->getMemoryBlocks()->append(testBlock);
+    }
+
+    // The last block overlaps the first one.
+    testMap->getMemoryBlocks()->last()->setBaseAddress("8");
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<MemoryMapBaseValidator> validator = createValidator(parser);
+
+    QVector<QString> foundErrors;
+    QBENCHMARK
+    {
+        foundErrors.clear();
+        validator->findErrorsIn(foundErrors, testMap, "", "test");
+    }
+
+    QString expectedError = QObject::tr("Address blocks %1 and %2 overlap in memory map %3")
+        .arg("block0").arg("block" + QString::number(blockCount - 1)).arg(testMap->name());
+
+    QCOMPARE(foundErrors.count(expectedError), 1);
+    QCOMPARE(validator->hasValidMemoryBlocks(testMap, ""), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseValidator::testAddressBlockOverlapPerformance_data()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapBaseValidator::testAddressBlockOverlapPerformance_data()
+{
+    QTest::addColumn<int>("blockCount");
+
+    QTest::newRow("100 blocks") << 100;
+    QTest::newRow("1000 blocks") << 1000;
+    QTest::newRow("10000 blocks") << 10000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseValidator::createValidator()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryMapBaseValidator> tst_MemoryMapBaseValidator::createValidator(
+    QSharedPointer<ExpressionParser> parser)
+{
+    QSharedPointer<ParameterValidator> parameterValidator (new ParameterValidator(parser,
+        QSharedPointer<QList<QSharedPointer<Choice> > > ()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(parser));
+    QSharedPointer<FieldValidator> fieldValidator (new FieldValidator(parser, enumValidator, parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator (
+        new RegisterValidator(parser, fieldValidator, parameterValidator));
+    QSharedPointer<AddressBlockValidator> addressBlockValidator (
+        new AddressBlockValidator(parser, registerValidator, parameterValidator));
+
+    return QSharedPointer<MemoryMapBaseValidator>(new MemoryMapBaseValidator(parser, addressBlockValidator));
 }
 
 //-----------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 # ------------------------------------------------------
 
 HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/Component/WriteValueConstraint.h \
     ../../../IPXACTmodels/common/AccessTypes.h \
     ../../../IPXACTmodels/Component/AddressBlock.h \
@@ -40,6 +41,7 @@ HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser
     ../../../IPXACTmodels/common/Enumeration.h \
     ../../../IPXACTmodels/common/validators/ValueFormatter.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_MemoryMapBaseValidator.cpp \
     ../../../IPXACTmodels/common/AccessTypes.cpp \
     ../../../IPXACTmodels/Component/AddressBlock.cpp \
@@ -3,6 +3,7 @@
 # ------------------------------------------------------
 
 HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/AccessTypes.h \
     ../../../IPXACTmodels/Component/AddressBlock.h \
     ../../../IPXACTmodels/Component/validators/AddressBlockValidator.h \
@@ -44,6 +45,7 @@ HEADERS += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser
     ../../../IPXACTmodels/Component/RemapState.h \
     ../../../IPXACTmodels/Component/RemapPort.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_MemoryMapValidator.cpp \
     ../../../IPXACTmodels/common/AccessTypes.cpp \
     ../../../IPXACTmodels/Component/AddressBlock.cpp \
@@ -651,13 +651,21 @@ void tst_RegisterValidator::testFieldsAreWithinRegister()
         QVector<QString> foundErrors;
         validator.findErrorsIn(foundErrors, testRegister, "test");
 
-        QString expectedError = QObject::tr("Field %1 is not contained within %2").arg(fieldOne->name()).
+        QString containmentError = QObject::tr("Field %1 is not contained within %2").arg(fieldOne->name()).
             arg(testRegister->name());
+        QString expectedError = containmentError;
 
         bool offsetValid = false;
         bool bitwidthValid = false;
         parser->parseExpression(bitOffset, &offsetValid);
         parser->parseExpression(bitWidth, &bitwidthValid);
+
+        // Values that cannot be evaluated are reported as invalid, not as outside the register.
+        if (offsetValid == false || bitwidthValid == false)
+        {
+            QVERIFY(foundErrors.contains(containmentError) == false);
+        }
+
         if (offsetValid == false)
         {
             expectedError = QObject::tr("Invalid bit offset set for field %1 within register %2").
@@ -697,6 +705,7 @@ void tst_RegisterValidator::testFieldsAreWithinRegister_data()
         "4000000000000000000000000000000000" << "0" << "10" << false;
     QTest::newRow("Field with long bit width is not within a small register") <<
         "0" << "4000000000000000000000000000000000" << "10" << false;
+    QTest::newRow("Field with unknown bit offset is invalid") << "x" << "4" << "10" << false;
 }
 
 //-----------------------------------------------------------------------------
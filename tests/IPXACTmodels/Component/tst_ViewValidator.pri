@@ -4,6 +4,7 @@
 
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../IPXACTmodels/common/NameGroup.h \
     ../../../IPXACTmodels/Component/WireTypeDef.h \
     ../../../IPXACTmodels/Component/View.h \
@@ -35,6 +36,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../IPXACTmodels/common/Protocol.h \
     ../../../IPXACTmodels/common/BuildModel.h
 SOURCES += ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_ViewValidator.cpp \
     ../../../IPXACTmodels/common/NameGroup.cpp \
     ../../../IPXACTmodels/Component/WireTypeDef.cpp \
@@ -10,14 +10,39 @@
 //-----------------------------------------------------------------------------
 
 #include <IPXACTmodels/Design/DesignReader.h>
+#include <IPXACTmodels/Design/DesignStreamReader.h>
 
 #include <IPXACTmodels/kactusExtensions/Kactus2Placeholder.h>
 
 #include <editors/common/ColumnTypes.h>
 
 #include <QtTest>
+#include <QBuffer>
 #include <QDomNode>
 
+//-----------------------------------------------------------------------------
+//! Reads the test documents with the reader selected in the global test data.
+//-----------------------------------------------------------------------------
+class TestDesignReader
+{
+public:
+    QSharedPointer<Design> createDesignFrom(QDomDocument const& document) const
+    {
+        QFETCH_GLOBAL(bool, streaming);
+        if (streaming)
+        {
+            QByteArray content = document.toByteArray(-1);
+            QBuffer buffer(&content);
+
+            DesignStreamReader streamReader;
+            return streamReader.createDesignFrom(&buffer);
+        }
+
+        DesignReader domReader;
+        return domReader.createDesignFrom(document);
+    }
+};
+
 class tst_DesignReader : public QObject
 {
     Q_OBJECT
@@ -26,6 +51,8 @@ public:
     tst_DesignReader();
 
 private slots:
+    void initTestCase_data();
+
     void testReadSimpleDesign();
     void testReadProcessingInstructions();
 
@@ -61,6 +88,17 @@ tst_DesignReader::tst_DesignReader()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DesignReader::initTestCase_data()
+//-----------------------------------------------------------------------------
+void tst_DesignReader::initTestCase_data()
+{
+    QTest::addColumn<bool>("streaming");
+
+    QTest::newRow("DOM reader") << false;
+    QTest::newRow("streaming reader") << true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_DesignReader::testReadSimpleDesign()
 //-----------------------------------------------------------------------------
@@ -83,7 +121,7 @@ void tst_DesignReader::testReadSimpleDesign()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
 
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
@@ -118,7 +156,7 @@ void tst_DesignReader::testReadProcessingInstructions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
 
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
@@ -169,7 +207,7 @@ void tst_DesignReader::testReadComponentInstances()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getComponentInstances()->size(), 1);
@@ -247,7 +285,7 @@ void tst_DesignReader::testReadComponentInstanceExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getComponentInstances()->size(), 1);
@@ -342,7 +380,7 @@ void tst_DesignReader::testReadInterconnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getInterconnections()->size(), 1);
@@ -423,7 +461,7 @@ void tst_DesignReader::testReadInterconnectionExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getInterconnections()->size(), 1);
@@ -490,7 +528,7 @@ void tst_DesignReader::testReadMonitorInterconnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getMonitorInterconnecions()->size(), 1);
@@ -580,7 +618,7 @@ void tst_DesignReader::testReadAdHocConnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getAdHocConnections()->size(), 1);
@@ -657,7 +695,7 @@ void tst_DesignReader::testReadAdHocConnectionExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader reader;
+    TestDesignReader reader;
     QSharedPointer<Design> testDesign = reader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getAdHocConnections()->size(), 1);
@@ -702,7 +740,7 @@ void tst_DesignReader::testReadParameters()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
 
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
@@ -741,7 +779,7 @@ void tst_DesignReader::testReadAssertions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
 
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
@@ -777,7 +815,7 @@ void tst_DesignReader::testReadVendorExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -815,7 +853,7 @@ void tst_DesignReader::testReadColumns()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -884,7 +922,7 @@ void tst_DesignReader::testReadSWInstances()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getComponentInstances()->size(), 1);
@@ -942,7 +980,7 @@ void tst_DesignReader::testReadPortAdHocVisibilitiesAndPositions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -1005,7 +1043,7 @@ void tst_DesignReader::testReadApiConnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -1060,7 +1098,7 @@ void tst_DesignReader::testReadHierApiConnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -1113,7 +1151,7 @@ void tst_DesignReader::testReadComConnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
@@ -1164,7 +1202,7 @@ void tst_DesignReader::testReadHierComConnections()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignReader designReader;
+    TestDesignReader designReader;
     QSharedPointer<Design> testDesign = designReader.createDesignFrom(document);
 
     QCOMPARE(testDesign->getVendorExtensions()->size(), 2);
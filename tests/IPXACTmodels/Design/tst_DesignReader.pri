@@ -19,9 +19,11 @@ HEADERS += ../../../IPXACTmodels/Design/ActiveInterface.h \
     ../../../IPXACTmodels/kactusExtensions/ConnectionRoute.h \
     ../../../IPXACTmodels/Design/Design.h \
     ../../../IPXACTmodels/Design/DesignReader.h \
+    ../../../IPXACTmodels/Design/DesignStreamReader.h \
     ../../../IPXACTmodels/common/DirectionTypes.h \
     ../../../IPXACTmodels/common/Document.h \
     ../../../IPXACTmodels/common/DocumentReader.h \
+    ../../../IPXACTmodels/common/DocumentStreamParser.h \
     ../../../IPXACTmodels/common/Extendable.h \
     ../../../IPXACTmodels/common/GenericVendorExtension.h \
     ../../../IPXACTmodels/kactusExtensions/HierApiInterconnection.h \
@@ -65,9 +67,11 @@ SOURCES += ../../../IPXACTmodels/Design/ActiveInterface.cpp \
     ../../../IPXACTmodels/kactusExtensions/ConnectionRoute.cpp \
     ../../../IPXACTmodels/Design/Design.cpp \
     ../../../IPXACTmodels/Design/DesignReader.cpp \
+    ../../../IPXACTmodels/Design/DesignStreamReader.cpp \
     ../../../IPXACTmodels/common/DirectionTypes.cpp \
     ../../../IPXACTmodels/common/Document.cpp \
     ../../../IPXACTmodels/common/DocumentReader.cpp \
+    ../../../IPXACTmodels/common/DocumentStreamParser.cpp \
     ../../../IPXACTmodels/common/Extendable.cpp \
     ../../../IPXACTmodels/common/GenericVendorExtension.cpp \
     ../../../IPXACTmodels/kactusExtensions/HierApiInterconnection.cpp \
@@ -131,6 +131,8 @@ private:
 
     QSharedPointer<DesignValidator> createDesignValidator(LibraryInterface* library);
 
+    void verifyDiagnosticsMatchValidation(QSharedPointer<DesignValidator> validator, QSharedPointer<Design> design);
+
     QSharedPointer<ComponentInstanceValidator> createComponentInstanceValidator(LibraryInterface* library);
 
     QSharedPointer<InterconnectionValidator> createInterconnectionValidator(LibraryInterface* library);
@@ -162,6 +164,7 @@ void tst_DesignValidator::testHasValidVLNV()
     QSharedPointer<DesignValidator> validator = createDesignValidator(0);
 
     QCOMPARE(validator->hasValidVLNV(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -461,6 +464,7 @@ void tst_DesignValidator::testHasValidComponentInstances()
     QSharedPointer<DesignValidator> validator = createDesignValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidComponentInstances(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -1049,6 +1053,7 @@ void tst_DesignValidator::testHasValidInterconnections()
     QSharedPointer<DesignValidator> validator = createDesignValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidInterconnections(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -1525,6 +1530,7 @@ void tst_DesignValidator::testHasValidMonitorInterconnections()
     QSharedPointer<DesignValidator> validator = createDesignValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidMonitorInterconnections(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -2050,6 +2056,7 @@ void tst_DesignValidator::testHasValidAdHocConnections()
     QSharedPointer<DesignValidator> validator = createDesignValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidAdHocConnections(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -2116,6 +2123,7 @@ void tst_DesignValidator::testHasValidParameters()
     QSharedPointer<DesignValidator> validator = createDesignValidator(0);
 
     QCOMPARE(validator->hasValidParameters(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -2186,6 +2194,7 @@ void tst_DesignValidator::testHasValidAssertions()
     QSharedPointer<DesignValidator> validator = createDesignValidator(0);
 
     QCOMPARE(validator->hasValidAssertions(testDesign), isValid);
+    verifyDiagnosticsMatchValidation(validator, testDesign);
 
     if (!isValid)
     {
@@ -2253,6 +2262,24 @@ bool tst_DesignValidator::errorIsNotFoundInErrorList(QString const& expectedErro
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidator::verifyDiagnosticsMatchValidation()
+//-----------------------------------------------------------------------------
+void tst_DesignValidator::verifyDiagnosticsMatchValidation(QSharedPointer<DesignValidator> validator,
+    QSharedPointer<Design> design)
+{
+    QVector<ValidationDiagnostic> diagnostics;
+    validator->findDiagnosticsIn(diagnostics, design);
+
+    bool hasErrors = false;
+    foreach (ValidationDiagnostic const& diagnostic, diagnostics)
+    {
+        hasErrors |= diagnostic.severity == ValidationDiagnostic::SEVERITY_ERROR;
+    }
+
+    QCOMPARE(hasErrors, !validator->validate(design));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_DesignValidator::createDesignValidator()
 //-----------------------------------------------------------------------------
@@ -10,10 +10,35 @@
 //-----------------------------------------------------------------------------
 
 #include <IPXACTmodels/designConfiguration/DesignConfigurationReader.h>
+#include <IPXACTmodels/designConfiguration/DesignConfigurationStreamReader.h>
 
 #include <QtTest>
+#include <QBuffer>
 #include <QDomNode>
 
+//-----------------------------------------------------------------------------
+//! Reads the test documents with the reader selected in the global test data.
+//-----------------------------------------------------------------------------
+class TestDesignConfigurationReader
+{
+public:
+    QSharedPointer<DesignConfiguration> createDesignConfigurationFrom(QDomDocument const& document) const
+    {
+        QFETCH_GLOBAL(bool, streaming);
+        if (streaming)
+        {
+            QByteArray content = document.toByteArray(-1);
+            QBuffer buffer(&content);
+
+            DesignConfigurationStreamReader streamReader;
+            return streamReader.createDesignConfigurationFrom(&buffer);
+        }
+
+        DesignConfigurationReader domReader;
+        return domReader.createDesignConfigurationFrom(document);
+    }
+};
+
 class tst_DesignConfigurationReader : public QObject
 {
     Q_OBJECT
@@ -23,6 +48,8 @@ public:
 
 private slots:
 
+    void initTestCase_data();
+
     void testReadSimpleDesignConfiguration();
     void testReadTopComments();
     void testProcessingInstructionsAreParsed();
@@ -47,6 +74,17 @@ tst_DesignConfigurationReader::tst_DesignConfigurationReader()
 {
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DesignConfigurationReader::initTestCase_data()
+//-----------------------------------------------------------------------------
+void tst_DesignConfigurationReader::initTestCase_data()
+{
+    QTest::addColumn<bool>("streaming");
+
+    QTest::newRow("DOM reader") << false;
+    QTest::newRow("streaming reader") << true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_DesignConfigurationReader::readSimpleDesignConfiguration()
 //-----------------------------------------------------------------------------
@@ -68,7 +106,7 @@ void tst_DesignConfigurationReader::testReadSimpleDesignConfiguration()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -106,7 +144,7 @@ void tst_DesignConfigurationReader::testReadTopComments()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -139,7 +177,7 @@ void tst_DesignConfigurationReader::testProcessingInstructionsAreParsed()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -175,7 +213,7 @@ void tst_DesignConfigurationReader::testReadDesignReference()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -223,7 +261,7 @@ void tst_DesignConfigurationReader::testReadGeneratorChainConfigurations()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -302,7 +340,7 @@ void tst_DesignConfigurationReader::testReadInterconnectionConfigurations()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -380,7 +418,7 @@ void tst_DesignConfigurationReader::testReadViewConfigurations()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -430,7 +468,7 @@ void tst_DesignConfigurationReader::testReadParameters()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -472,7 +510,7 @@ void tst_DesignConfigurationReader::testReadAssertions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -511,7 +549,7 @@ void tst_DesignConfigurationReader::testReadVendorExtensions()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -555,7 +593,7 @@ void tst_DesignConfigurationReader::testReadConfigurableElementValues()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -601,7 +639,7 @@ void tst_DesignConfigurationReader::testReadViewOverrides()
     QDomDocument document;
     document.setContent(documentContent);
 
-    DesignConfigurationReader designConfigurationReader;
+    TestDesignConfigurationReader designConfigurationReader;
 
     QSharedPointer<DesignConfiguration> testDesignConfiguration =
         designConfigurationReader.createDesignConfigurationFrom(document);
@@ -26,7 +26,9 @@ HEADERS += ../../../IPXACTmodels/designConfiguration/AbstractorInstance.h \
     ../../../IPXACTmodels/common/GenericVendorExtension.h \
     ../../../IPXACTmodels/common/CommonItemsReader.h \
     ../../../IPXACTmodels/designConfiguration/DesignConfigurationReader.h \
+    ../../../IPXACTmodels/designConfiguration/DesignConfigurationStreamReader.h \
     ../../../IPXACTmodels/common/DocumentReader.h \
+    ../../../IPXACTmodels/common/DocumentStreamParser.h \
     ../../../IPXACTmodels/common/NameGroupReader.h \
     ../../../IPXACTmodels/common/ParameterReader.h \
     ../../../IPXACTmodels/common/VLNV.h
@@ -39,8 +41,10 @@ SOURCES += ../../../IPXACTmodels/common/GenericVendorExtension.cpp \
     ../../../IPXACTmodels/common/ConfigurableVLNVReference.cpp \
     ../../../IPXACTmodels/designConfiguration/DesignConfiguration.cpp \
     ../../../IPXACTmodels/designConfiguration/DesignConfigurationReader.cpp \
+    ../../../IPXACTmodels/designConfiguration/DesignConfigurationStreamReader.cpp \
     ../../../IPXACTmodels/common/Document.cpp \
     ../../../IPXACTmodels/common/DocumentReader.cpp \
+    ../../../IPXACTmodels/common/DocumentStreamParser.cpp \
     ../../../IPXACTmodels/common/Extendable.cpp \
     ../../../IPXACTmodels/common/VLNV.cpp \
     ../../../IPXACTmodels/designConfiguration/InterconnectionConfiguration.cpp \
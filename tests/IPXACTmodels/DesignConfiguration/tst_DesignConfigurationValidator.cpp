@@ -101,6 +101,9 @@ private:
 
     QSharedPointer<DesignConfigurationValidator> createDesignConfigurationValidator(LibraryInterface* library);
 
+    void verifyDiagnosticsMatchValidation(QSharedPointer<DesignConfigurationValidator> validator,
+        QSharedPointer<DesignConfiguration> configuration);
+
     QSharedPointer<InterconnectionConfigurationValidator> createInterconnectionConfigurationValidator(
         LibraryInterface* library);
 
@@ -130,6 +133,7 @@ void tst_DesignConfigurationValidator::testHasValidVLNV()
 
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(0);
     QCOMPARE(validator->hasValidVLNV(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -220,6 +224,7 @@ void tst_DesignConfigurationValidator::testHasValidDesignReference()
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidDesignReference(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -321,6 +326,7 @@ void tst_DesignConfigurationValidator::testHasValidGeneratorChainConfigurations(
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(0);
 
     QCOMPARE(validator->hasValidGeneratorChainConfigurations(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -967,6 +973,7 @@ void tst_DesignConfigurationValidator::testHasValidInterconnectionConfigurations
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidInterconnectionConfigurations(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -1274,6 +1281,7 @@ void tst_DesignConfigurationValidator::testHasValidViewConfigurations()
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(mockLibrary);
 
     QCOMPARE(validator->hasValidViewConfigurations(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -1355,6 +1363,7 @@ void tst_DesignConfigurationValidator::testHasValidParameters()
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(0);
 
     QCOMPARE(validator->hasValidParameters(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -1426,6 +1435,7 @@ void tst_DesignConfigurationValidator::testHasValidAssertions()
     QSharedPointer<DesignConfigurationValidator> validator = createDesignConfigurationValidator(0);
 
     QCOMPARE(validator->hasValidAssertions(testConfiguration), isValid);
+    verifyDiagnosticsMatchValidation(validator, testConfiguration);
 
     if (!isValid)
     {
@@ -1494,6 +1504,24 @@ bool tst_DesignConfigurationValidator::errorIsNotFoundInErrorList(QString const&
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DesignConfigurationValidator::verifyDiagnosticsMatchValidation()
+//-----------------------------------------------------------------------------
+void tst_DesignConfigurationValidator::verifyDiagnosticsMatchValidation(
+    QSharedPointer<DesignConfigurationValidator> validator, QSharedPointer<DesignConfiguration> configuration)
+{
+    QVector<ValidationDiagnostic> diagnostics;
+    validator->findDiagnosticsIn(diagnostics, configuration);
+
+    bool hasErrors = false;
+    foreach (ValidationDiagnostic const& diagnostic, diagnostics)
+    {
+        hasErrors |= diagnostic.severity == ValidationDiagnostic::SEVERITY_ERROR;
+    }
+
+    QCOMPARE(hasErrors, !validator->validate(configuration));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_DesignConfigurationValidator::createDesignConfigurationValidator()
 //-----------------------------------------------------------------------------
@@ -14,6 +14,8 @@
 #include <IPXACTmodels/common/Document.h>
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QFutureInterface>
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::LibraryMock()
 //-----------------------------------------------------------------------------
@@ -65,6 +67,27 @@ QSharedPointer<Document const> LibraryMock::getModelReadOnly(const VLNV& vlnv)
     return components_.value(vlnv, QSharedPointer<Document>(0));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::getModelAsync()
+//-----------------------------------------------------------------------------
+QFuture<QSharedPointer<Document> > LibraryMock::getModelAsync(const VLNV& vlnv)
+{
+    QSharedPointer<Document> component = getModel(vlnv);
+
+    QFutureInterface<QSharedPointer<Document> > result;
+    result.reportStarted();
+    result.reportFinished(&component);
+    return result.future();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::prefetchDependencies()
+//-----------------------------------------------------------------------------
+QFuture<void> LibraryMock::prefetchDependencies(const VLNV& /*vlnv*/)
+{
+    return QFuture<void>();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::contains()
 //-----------------------------------------------------------------------------
@@ -185,6 +208,14 @@ int LibraryMock::getChildren(QList<VLNV>& /*list*/, const VLNV& /*vlnvToSearch*/
     return 0;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::hasChildren()
+//-----------------------------------------------------------------------------
+bool LibraryMock::hasChildren(const VLNV& /*vlnvToSearch*/) const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::getDesignVLNV()
 //-----------------------------------------------------------------------------
@@ -63,6 +63,24 @@ public:
     */
     virtual QSharedPointer<Document const> getModelReadOnly(const VLNV& vlnv);
 
+    /*!
+    *  Method description.
+    *
+    *      @param [in]    Description.
+    *
+    *      @return Description.
+    */
+    virtual QFuture<QSharedPointer<Document> > getModelAsync(const VLNV& vlnv);
+
+    /*!
+    *  Method description.
+    *
+    *      @param [in]    Description.
+    *
+    *      @return Description.
+    */
+    virtual QFuture<void> prefetchDependencies(const VLNV& vlnv);
+
     /*!
     *  Method description.
     *
@@ -189,6 +207,15 @@ public:
     */
     virtual int getChildren(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
 
+    /*!
+    *  Method description.
+    *
+    *      @param [in]    Description.
+    *
+    *      @return Description.
+    */
+    virtual bool hasChildren(const VLNV& vlnvToSearch) const;
+
     /*!
     *  Method description.
     *
@@ -21,6 +21,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../editors/MemoryDesigner/MemoryItem.h \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../editors/common/ComponentInstanceParameterFinder.h \
     ../../MockObjects/LibraryMock.h \
     ../../../editors/ComponentEditor/common/ParameterCache.h \
@@ -42,6 +43,7 @@ SOURCES += ../../../editors/common/ComponentInstanceParameterFinder.cpp \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../editors/ComponentEditor/common/ParameterCache.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_LinuxDeviceTreeGenerator.cpp \
     ../../../editors/MemoryDesigner/MemoryConnectionAddressCalculator.cpp \
     ../../../editors/MemoryDesigner/MemoryDesignerConstants.cpp
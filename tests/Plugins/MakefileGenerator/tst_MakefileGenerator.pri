@@ -11,6 +11,7 @@ HEADERS += ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.h \
     ../../../Plugins/MakefileGenerator/SWStackParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../editors/ComponentEditor/common/SystemVerilogSyntax.h \
     ../../MockObjects/LibraryMock.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h
@@ -23,5 +24,6 @@ SOURCES += ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.cpp \
     ../../../Plugins/MakefileGenerator/SWStackParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_MakefileGenerator.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.cpp
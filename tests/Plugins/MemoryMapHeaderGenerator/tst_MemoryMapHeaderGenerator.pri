@@ -13,6 +13,7 @@ HEADERS += ../../../Plugins/MemoryMapHeaderGenerator/BaseMemoryMapHeaderWriter.h
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.h \
     ../../../Plugins/MemoryMapHeaderGenerator/SystemMemoryMapHeaderWriter.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../common/utils.h \
     ../../MockObjects/LibraryMock.h \
     ../../../Plugins/MemoryMapHeaderGenerator/fileSaveDialog/filesavedialog.h \
@@ -35,6 +36,7 @@ SOURCES += ../../../Plugins/MemoryMapHeaderGenerator/BaseMemoryMapHeaderWriter.c
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.cpp \
     ../../../Plugins/MemoryMapHeaderGenerator/SystemMemoryMapHeaderWriter.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../Plugins/MemoryMapHeaderGenerator/fileSaveDialog/filesavedialog.cpp \
     ../../../Plugins/MemoryMapHeaderGenerator/fileSaveDialog/filesavedialogview.cpp \
     ../../../Plugins/MemoryMapHeaderGenerator/globalheadersavemodel.cpp \
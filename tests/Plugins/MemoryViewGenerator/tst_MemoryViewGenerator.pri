@@ -24,6 +24,7 @@ HEADERS += ../../../editors/common/ComponentInstanceParameterFinder.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../../MockObjects/LibraryMock.h \
     ../../../Plugins/MemoryViewGenerator/MemoryViewGeneratorPlugin.h \
@@ -52,5 +53,6 @@ SOURCES += ../../../editors/common/ComponentInstanceParameterFinder.cpp \
     ../../../editors/ComponentEditor/common/ParameterCache.cpp \
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ./tst_MemoryViewGenerator.cpp
@@ -24,6 +24,7 @@ HEADERS += ../../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../../Plugins/common/PortSorter/PortSorter.h \
     ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogPortWriter.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.h \
     ../../../editors/common/TopComponentParameterFinder.h \
     ../../../Plugins/VerilogGenerator/VerilogAssignmentWriter/VerilogAssignmentWriter.h \
@@ -57,6 +58,7 @@ SOURCES += ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefault
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.cpp \
     ../../../editors/common/TopComponentParameterFinder.cpp \
     ../../../Plugins/VerilogGenerator/VerilogAssignmentWriter/VerilogAssignmentWriter.cpp \
@@ -15,6 +15,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../editors/ComponentEditor/common/ParameterFinder.h \
     ../../../Plugins/common/PortSorter/PortSorter.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../MockObjects/LibraryMock.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h \
     ../../../editors/common/TopComponentParameterFinder.h
@@ -30,4 +31,5 @@ SOURCES += ../../../editors/common/TopComponentParameterFinder.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ./tst_HDLParser.cpp
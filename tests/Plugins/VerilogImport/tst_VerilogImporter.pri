@@ -15,6 +15,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../common/NameGenerationPolicy.h \
     ../../../editors/ComponentEditor/common/NullParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogPortParser.h \
     ../../../wizards/ComponentWizard/ImportEditor/ImportHighlighter.h \
@@ -26,6 +27,7 @@ SOURCES += ../../../editors/ComponentEditor/common/ComponentParameterFinder.cpp
     ../../../common/NameGenerationPolicy.cpp \
     ../../../editors/ComponentEditor/common/NullParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../Plugins/VerilogImport/VerilogImporter.cpp \
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogPortParser.cpp \
@@ -5,10 +5,12 @@
 HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h
 SOURCES += ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ./tst_VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp
@@ -8,6 +8,7 @@ HEADERS += ../../../editors/ComponentEditor/common/NullParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../../editors/ComponentEditor/common/BigInteger.h \
     ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/ComponentParameterFinder.h
 SOURCES += ../../../editors/ComponentEditor/common/NullParser.cpp \
@@ -15,4 +16,5 @@ SOURCES += ../../../editors/ComponentEditor/common/NullParser.cpp \
     ./tst_VerilogPortParser.cpp \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../../editors/ComponentEditor/common/ComponentParameterFinder.cpp
@@ -14,6 +14,16 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
 #include <library/LibraryHandler.h>
+#include <library/DependencyGraph.h>
+#include <library/DocumentValidator.h>
+#include <library/HierarchyView/hierarchymodel.h>
+#include <library/LibraryErrorModel.h>
+#include <library/LibraryFileWatcher.h>
+#include <library/LibraryIndex.h>
+
+#include <IPXACTmodels/Catalog/Catalog.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/common/Parameter.h>
 
 void noMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg) {}
 
@@ -32,6 +42,9 @@ private:
 
     MessagePasser messageChannel_;
 
+    //! Directory for the settings and the library index written by the tests.
+    QTemporaryDir settingsDirectory_;
+
 private slots:
 
     void initTestcase();
@@ -42,10 +55,64 @@ private slots:
 
     void testLibraryGetModel();
 
+    void testModelIsReadAsynchronously();
+
+    void testDependenciesArePrefetched();
+
+    void testPrefetchOfMissingDocumentFinishes();
+
+    void testFailedReadIsNotCached();
+
+    void testDocumentCacheEvictsLeastRecentlyUsed();
+
+    void testDocumentCacheCountsHitsAndMisses();
+
+    void testParallelIntegrityCheckMatchesSequential();
+
+    void testParallelIntegrityCheckPerformance();
+
+    void testDependencyGraphFindsDependents();
+
+    void testErrorModelReplacesItemErrors();
+
+    void testOwnersAreFoundFromDependencies();
+
+    void testHierarchyChildrenAreFetchedOnDemand();
+
+    void testHasChildrenMatchesChildren();
+
     void testDocumentsInLocationAreRead();
+
+    void testParallelScanFindsSameDocuments();
+
+    void testIndexIsWrittenAndRead();
+
+    void testCorruptedIndexIsDiscarded();
+
+    void testRebuildIndexFindsSameDocuments();
+
+    void testStoredValidityMatchesFullCheck();
+
+    void testDeletedFileInvalidatesStoredValidity();
+
+    void testDiagnosticsMatchValidation();
+
+    void testCatalogDiagnostics();
+
+    void testParameterCyclesAreReportedAsWarnings();
+
+    void testOnlyErrorDiagnosticsInvalidateDocument();
+
+    void testFileWatcherReportsChangesInBatch();
+
+    void testFileWatcherDetectsEditInPlace();
+
+    void testFileWatcherWatchesNewSubdirectories();
 };
 
-tst_LibraryHandler::tst_LibraryHandler()
+tst_LibraryHandler::tst_LibraryHandler():
+messageChannel_(),
+settingsDirectory_()
 {
 
 }
@@ -103,6 +170,353 @@ void tst_LibraryHandler::testLibraryGetModel()
     QVERIFY(model.isNull() == false);
 }
 
+void tst_LibraryHandler::testDocumentCacheEvictsLeastRecentlyUsed()
+{
+    DocumentCache cache(300);
+
+    VLNV first(VLNV::COMPONENT, QStringLiteral("tut.fi:test:first:1.0"));
+    VLNV second(VLNV::COMPONENT, QStringLiteral("tut.fi:test:second:1.0"));
+    VLNV third(VLNV::COMPONENT, QStringLiteral("tut.fi:test:third:1.0"));
+    VLNV fourth(VLNV::COMPONENT, QStringLiteral("tut.fi:test:fourth:1.0"));
+
+    cache.insert(first, QSharedPointer<Document>(new Component(first)), 100);
+    cache.insert(second, QSharedPointer<Document>(new Component(second)), 100);
+    cache.insert(third, QSharedPointer<Document>(new Component(third)), 100);
+
+    QVERIFY(cache.find(first).isNull() == false);
+
+    cache.insert(fourth, QSharedPointer<Document>(new Component(fourth)), 100);
+
+    QVERIFY(cache.contains(first));
+    QVERIFY(cache.contains(second) == false);
+    QVERIFY(cache.contains(third));
+    QVERIFY(cache.contains(fourth));
+
+    DocumentCache::Statistics statistics = cache.statistics();
+    QCOMPARE(statistics.hits, quint64(1));
+    QCOMPARE(statistics.misses, quint64(0));
+    QCOMPARE(statistics.evictions, quint64(1));
+    QCOMPARE(statistics.documentCount, 3);
+    QCOMPARE(statistics.usedBytes, qint64(300));
+
+    cache.setBudget(150);
+    QCOMPARE(cache.statistics().documentCount, 1);
+    QVERIFY(cache.contains(fourth));
+
+    QVERIFY(cache.find(second).isNull());
+    QCOMPARE(cache.statistics().misses, quint64(1));
+}
+
+void tst_LibraryHandler::testModelIsReadAsynchronously()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    VLNV validItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+
+    QFuture<QSharedPointer<Document> > request = library->getModelAsync(validItem);
+    QSharedPointer<Document> model = request.result();
+
+    QVERIFY(model.isNull() == false);
+    QCOMPARE(model->getVlnv(), validItem);
+    QVERIFY(model != library->getModelReadOnly(validItem));
+
+    VLNV nonExistingItem(VLNV::COMPONENT, QStringLiteral("tut.fi:testLibrary:noItem:0"));
+    QVERIFY(library->getModelAsync(nonExistingItem).result().isNull());
+}
+
+void tst_LibraryHandler::testDependenciesArePrefetched()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    QList<VLNV> owners;
+    library->getOwners(owners, VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0")));
+    QVERIFY(owners.isEmpty() == false);
+
+    VLNV topItem = owners.first();
+
+    QBENCHMARK
+    {
+        library->prefetchDependencies(topItem).waitForFinished();
+    }
+
+    DocumentCache::Statistics afterPrefetch = library->getCacheStatistics();
+
+    QList<VLNV> neededVLNVs;
+    library->getNeededVLNVs(topItem, neededVLNVs);
+    for (VLNV const& neededVLNV : neededVLNVs)
+    {
+        if (library->contains(neededVLNV))
+        {
+            library->getModelReadOnly(neededVLNV);
+        }
+    }
+
+    QCOMPARE(library->getCacheStatistics().misses, afterPrefetch.misses);
+}
+
+void tst_LibraryHandler::testPrefetchOfMissingDocumentFinishes()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    DocumentCache::Statistics beforePrefetch = library->getCacheStatistics();
+
+    QFuture<void> prefetch =
+        library->prefetchDependencies(VLNV(VLNV::DESIGN, QStringLiteral("tut.fi:testLibrary:noItem:0")));
+    prefetch.waitForFinished();
+
+    QVERIFY(prefetch.isFinished());
+    QCOMPARE(library->getCacheStatistics().misses, beforePrefetch.misses);
+}
+
+void tst_LibraryHandler::testFailedReadIsNotCached()
+{
+    QTemporaryDir libraryDirectory;
+    QString documentPath = libraryDirectory.filePath(QStringLiteral("broken.xml"));
+
+    QFile documentFile(documentPath);
+    QVERIFY(documentFile.open(QIODevice::WriteOnly));
+    documentFile.write("<?xml version=\"1.0\"?>\n<ipxact:component xmlns:ipxact=\"http://www.accellera.org/XMLSchema/"
+        "IPXACT/1685-2014\"><ipxact:vendor>tut.fi</ipxact:vendor><ipxact:library>test</ipxact:library>"
+        "<ipxact:name>broken</ipxact:name><ipxact:version>1.0</ipxact:version>");
+    documentFile.close();
+
+    QSettings settings;
+    settings.setValue("Library/ActiveLocations", QStringList(libraryDirectory.path()));
+
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    library->searchForIPXactFiles();
+
+    VLNV brokenItem(VLNV::COMPONENT, QStringLiteral("tut.fi:test:broken:1.0"));
+    QVERIFY(library->contains(brokenItem));
+
+    // The component element is never closed, so the document cannot be read.
+    library->prefetchDependencies(brokenItem).waitForFinished();
+
+    QCOMPARE(library->getCacheStatistics().documentCount, 0);
+    QVERIFY(library->getModelReadOnly(brokenItem).isNull());
+    QCOMPARE(library->getCacheStatistics().documentCount, 0);
+
+    setupTestLibrary();
+}
+
+void tst_LibraryHandler::testDocumentCacheCountsHitsAndMisses()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    VLNV validItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+
+    DocumentCache::Statistics before = library->getCacheStatistics();
+
+    QSharedPointer<Document const> firstRead = library->getModelReadOnly(validItem);
+    QSharedPointer<Document const> secondRead = library->getModelReadOnly(validItem);
+
+    DocumentCache::Statistics after = library->getCacheStatistics();
+
+    QVERIFY(firstRead.isNull() == false);
+    QCOMPARE(firstRead, secondRead);
+    QCOMPARE((after.hits + after.misses) - (before.hits + before.misses), quint64(2));
+    QVERIFY(after.hits > before.hits);
+}
+
+void tst_LibraryHandler::testParallelIntegrityCheckMatchesSequential()
+{
+    setupTestLibrary();
+
+    QSettings settings;
+    settings.setValue("Library/ScanThreadCount", 1);
+
+    QScopedPointer<LibraryHandler> sequentialLibrary(createLibraryHandler());
+    sequentialLibrary->searchForIPXactFiles();
+    sequentialLibrary->onCheckLibraryIntegrity();
+
+    settings.setValue("Library/ScanThreadCount", 4);
+
+    QScopedPointer<LibraryHandler> parallelLibrary(createLibraryHandler());
+    parallelLibrary->searchForIPXactFiles();
+    parallelLibrary->onCheckLibraryIntegrity();
+
+    settings.remove("Library/ScanThreadCount");
+
+    QCOMPARE(parallelLibrary->getAllVLNVs(), sequentialLibrary->getAllVLNVs());
+    for (VLNV const& vlnv : sequentialLibrary->getAllVLNVs())
+    {
+        QCOMPARE(parallelLibrary->isValid(vlnv), sequentialLibrary->isValid(vlnv));
+    }
+}
+
+void tst_LibraryHandler::testParallelIntegrityCheckPerformance()
+{
+    setupTestLibrary();
+
+    QSettings settings;
+    settings.setValue("Library/ScanThreadCount", 4);
+
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    library->searchForIPXactFiles();
+    QBENCHMARK
+    {
+        library->onCheckLibraryIntegrity();
+    }
+
+    settings.remove("Library/ScanThreadCount");
+}
+
+void tst_LibraryHandler::testDependencyGraphFindsDependents()
+{
+    VLNV bus(VLNV::BUSDEFINITION, QStringLiteral("tut.fi:test:bus:1.0"));
+    VLNV component(VLNV::COMPONENT, QStringLiteral("tut.fi:test:component:1.0"));
+    VLNV design(VLNV::DESIGN, QStringLiteral("tut.fi:test:design:1.0"));
+    VLNV configuration(VLNV::DESIGNCONFIGURATION, QStringLiteral("tut.fi:test:configuration:1.0"));
+
+    DependencyGraph graph;
+    graph.setDependencies(component, QVector<VLNV>({ bus, bus }));
+    graph.setDependencies(design, QVector<VLNV>({ component }));
+    graph.setDependencies(configuration, QVector<VLNV>({ design }));
+
+    QCOMPARE(graph.getDependencies(component), QVector<VLNV>({ bus }));
+    QCOMPARE(graph.getDependents(bus), QVector<VLNV>({ component }));
+    QCOMPARE(graph.getAllDependents(bus), QVector<VLNV>({ component, design, configuration }));
+    QCOMPARE(graph.getAllDependencies(configuration), QVector<VLNV>({ design, component, bus }));
+
+    graph.setDependencies(design, QVector<VLNV>());
+    QVERIFY(graph.getDependents(component).isEmpty());
+    QCOMPARE(graph.getAllDependents(bus), QVector<VLNV>({ component }));
+
+    // References to a removed document are kept, so its users are found when it is added again.
+    graph.removeDocument(bus);
+    QCOMPARE(graph.getDependents(bus), QVector<VLNV>({ component }));
+
+    graph.removeDocument(component);
+    QVERIFY(graph.contains(component) == false);
+    QVERIFY(graph.getDependents(bus).isEmpty());
+}
+
+void tst_LibraryHandler::testOwnersAreFoundFromDependencies()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    VLNV validItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+
+    int count = 0;
+    QBENCHMARK
+    {
+        count = library->referenceCount(validItem);
+    }
+
+    QList<VLNV> owners;
+    QCOMPARE(library->getOwners(owners, validItem), count);
+
+    // The owners are the components having the item in their hierarchy.
+    for (VLNV const& owner : owners)
+    {
+        QList<VLNV> children;
+        library->getChildren(children, owner);
+        QVERIFY(children.contains(validItem));
+
+        if (library->getDocumentType(owner) == VLNV::COMPONENT)
+        {
+            QList<VLNV> designs;
+            for (VLNV const& child : children)
+            {
+                VLNV::IPXactType childType = library->getDocumentType(child);
+                if (childType == VLNV::DESIGN || childType == VLNV::DESIGNCONFIGURATION)
+                {
+                    designs.append(child);
+                }
+            }
+
+            QVERIFY(designs.isEmpty() == false);
+        }
+    }
+}
+
+void tst_LibraryHandler::testHierarchyChildrenAreFetchedOnDemand()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    HierarchyModel* model = library->getHierarchyModel();
+    QBENCHMARK
+    {
+        model->onResetModel();
+    }
+
+    QVERIFY(model->rowCount() > 0);
+
+    int expandedItems = 0;
+    for (int row = 0; row < model->rowCount(); ++row)
+    {
+        QModelIndex index = model->index(row, HierarchyModel::OBJECT_COLUMN);
+        if (model->hasChildren(index))
+        {
+            QVERIFY(model->canFetchMore(index));
+            QCOMPARE(model->rowCount(index), 0);
+
+            model->fetchMore(index);
+            QVERIFY(model->canFetchMore(index) == false);
+
+            if (model->rowCount(index) > 0)
+            {
+                expandedItems++;
+            }
+        }
+    }
+
+    QVERIFY(expandedItems > 0);
+}
+
+void tst_LibraryHandler::testErrorModelReplacesItemErrors()
+{
+    LibraryErrorModel model(0);
+    model.addErrors(QVector<QString>({ QStringLiteral("first error"), QStringLiteral("second error") }),
+        QStringLiteral("first"));
+    model.addErrors(QVector<QString>({ QStringLiteral("other error") }), QStringLiteral("second"));
+
+    QCOMPARE(model.rowCount(), 3);
+
+    model.setErrors(QVector<QString>({ QStringLiteral("changed error") }), QStringLiteral("first"));
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.index(0, 1).data().toString(), QStringLiteral("other error"));
+    QCOMPARE(model.index(1, 1).data().toString(), QStringLiteral("changed error"));
+
+    model.setErrors(QVector<QString>(), QStringLiteral("second"));
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.index(0, 2).data().toString(), QStringLiteral("first"));
+}
+
+void tst_LibraryHandler::testHasChildrenMatchesChildren()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    for (VLNV const& vlnv : library->getAllVLNVs())
+    {
+        QList<VLNV> children;
+        QCOMPARE(library->hasChildren(vlnv), library->getChildren(children, vlnv) > 0);
+    }
+
+    QVERIFY(library->hasChildren(VLNV(VLNV::COMPONENT, "tut.fi", "lib", "missing", "1.0")) == false);
+}
+
 void tst_LibraryHandler::testDocumentsInLocationAreRead()
 {
     QScopedPointer<LibraryHandler> library(createLibraryHandler());
@@ -119,6 +533,411 @@ void tst_LibraryHandler::testDocumentsInLocationAreRead()
     QVERIFY(library->getAllVLNVs().count() != 0);
 }
 
+void tst_LibraryHandler::testParallelScanFindsSameDocuments()
+{
+    setupTestLibrary();
+
+    QSettings settings;
+    settings.setValue("Library/ScanThreadCount", 1);
+
+    QScopedPointer<LibraryHandler> sequentialLibrary(createLibraryHandler());
+    sequentialLibrary->searchForIPXactFiles();
+
+    settings.setValue("Library/ScanThreadCount", 4);
+
+    QScopedPointer<LibraryHandler> parallelLibrary(createLibraryHandler());
+    QBENCHMARK
+    {
+        parallelLibrary->searchForIPXactFiles();
+    }
+
+    settings.remove("Library/ScanThreadCount");
+
+    QCOMPARE(parallelLibrary->getAllVLNVs(), sequentialLibrary->getAllVLNVs());
+    for (VLNV const& vlnv : sequentialLibrary->getAllVLNVs())
+    {
+        QCOMPARE(parallelLibrary->getPath(vlnv), sequentialLibrary->getPath(vlnv));
+    }
+}
+
+void tst_LibraryHandler::testIndexIsWrittenAndRead()
+{
+    QTemporaryDir indexDirectory;
+    QString indexPath = indexDirectory.filePath(QStringLiteral("LibraryIndex.dat"));
+
+    QTemporaryFile documentFile;
+    QVERIFY(documentFile.open());
+    documentFile.write("<ipxact:component/>");
+    documentFile.flush();
+
+    QFileInfo documentInfo(documentFile.fileName());
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:testLibrary:indexed:1.0"));
+    VLNV busVLNV(VLNV::BUSDEFINITION, QStringLiteral("tut.fi:testLibrary:bus:1.0"));
+
+    LibraryIndex writtenIndex(indexPath);
+    writtenIndex.setEntry(documentInfo, componentVLNV);
+    writtenIndex.setDependencies(documentInfo.absoluteFilePath(), QVector<VLNV>() << busVLNV);
+    writtenIndex.setValidity(documentInfo.absoluteFilePath(), true, 3, QStringList(QStringLiteral("/tmp/rtl.v")),
+        QStringLiteral("1.0/1"));
+    QVERIFY(writtenIndex.save());
+
+    LibraryIndex readIndex(indexPath);
+    QVERIFY(readIndex.load());
+
+    LibraryIndex::Entry const* entry = readIndex.findCurrent(documentInfo);
+    QVERIFY(entry != nullptr);
+    QCOMPARE(entry->vlnv, componentVLNV);
+    QCOMPARE(entry->vlnv.getType(), VLNV::COMPONENT);
+    QVERIFY(entry->dependenciesKnown);
+    QCOMPARE(entry->dependencies, QVector<VLNV>() << busVLNV);
+    QVERIFY(entry->validityKnown);
+    QVERIFY(entry->isValid);
+    QCOMPARE(entry->fileCount, 3);
+    QCOMPARE(entry->referencedPaths, QStringList(QStringLiteral("/tmp/rtl.v")));
+    QCOMPARE(entry->validatorVersion, QStringLiteral("1.0/1"));
+
+    documentFile.write("<!-- changed -->");
+    documentFile.flush();
+
+    QVERIFY(readIndex.findCurrent(QFileInfo(documentFile.fileName())) == nullptr);
+}
+
+void tst_LibraryHandler::testCorruptedIndexIsDiscarded()
+{
+    QTemporaryDir indexDirectory;
+    QString indexPath = indexDirectory.filePath(QStringLiteral("LibraryIndex.dat"));
+
+    QTemporaryFile documentFile;
+    QVERIFY(documentFile.open());
+    QFileInfo documentInfo(documentFile.fileName());
+
+    LibraryIndex writtenIndex(indexPath);
+    writtenIndex.setEntry(documentInfo, VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:testLibrary:indexed:1.0")));
+    QVERIFY(writtenIndex.save());
+
+    QFile indexFile(indexPath);
+    QVERIFY(indexFile.open(QIODevice::ReadWrite));
+    indexFile.resize(indexFile.size() / 2);
+    indexFile.close();
+
+    LibraryIndex readIndex(indexPath);
+    QVERIFY(readIndex.load() == false);
+    QVERIFY(readIndex.entries().isEmpty());
+}
+
+void tst_LibraryHandler::testRebuildIndexFindsSameDocuments()
+{
+    setupTestLibrary();
+
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    library->searchForIPXactFiles();
+
+    QList<VLNV> indexedVLNVs = library->getAllVLNVs();
+
+    QBENCHMARK
+    {
+        library->onRebuildLibraryIndex();
+    }
+
+    QCOMPARE(library->getAllVLNVs(), indexedVLNVs);
+}
+
+void tst_LibraryHandler::testStoredValidityMatchesFullCheck()
+{
+    setupTestLibrary();
+
+    QScopedPointer<LibraryHandler> checkedLibrary(createLibraryHandler());
+    checkedLibrary->searchForIPXactFiles();
+    checkedLibrary->onCheckLibraryIntegrity();
+
+    // The second library reads the validity of the unchanged documents from the index.
+    QScopedPointer<LibraryHandler> indexedLibrary(createLibraryHandler());
+    indexedLibrary->searchForIPXactFiles();
+
+    QCOMPARE(indexedLibrary->getAllVLNVs(), checkedLibrary->getAllVLNVs());
+    for (VLNV const& vlnv : checkedLibrary->getAllVLNVs())
+    {
+        QCOMPARE(indexedLibrary->isValid(vlnv), checkedLibrary->isValid(vlnv));
+    }
+}
+
+void tst_LibraryHandler::testDeletedFileInvalidatesStoredValidity()
+{
+    QTemporaryDir libraryDirectory;
+    QString documentPath = libraryDirectory.filePath(QStringLiteral("component.xml"));
+    QString sourcePath = libraryDirectory.filePath(QStringLiteral("rtl.v"));
+
+    QFile documentFile(documentPath);
+    QVERIFY(documentFile.open(QIODevice::WriteOnly));
+    documentFile.write("<?xml version=\"1.0\"?>\n<ipxact:component xmlns:ipxact=\"http://www.accellera.org/XMLSchema/"
+        "IPXACT/1685-2014\"><ipxact:vendor>tut.fi</ipxact:vendor><ipxact:library>test</ipxact:library>"
+        "<ipxact:name>referencing</ipxact:name><ipxact:version>1.0</ipxact:version><ipxact:fileSets>"
+        "<ipxact:fileSet><ipxact:name>rtl</ipxact:name><ipxact:file><ipxact:name>rtl.v</ipxact:name>"
+        "<ipxact:fileType>verilogSource</ipxact:fileType></ipxact:file></ipxact:fileSet></ipxact:fileSets>"
+        "</ipxact:component>");
+    documentFile.close();
+
+    QFile sourceFile(sourcePath);
+    QVERIFY(sourceFile.open(QIODevice::WriteOnly));
+    sourceFile.close();
+
+    QSettings settings;
+    settings.setValue("Library/ActiveLocations", QStringList(libraryDirectory.path()));
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:test:referencing:1.0"));
+
+    QScopedPointer<LibraryHandler> checkedLibrary(createLibraryHandler());
+    checkedLibrary->searchForIPXactFiles();
+    QVERIFY(checkedLibrary->isValid(componentVLNV));
+    checkedLibrary.reset();
+
+    // The component file is unchanged, but the file it references is gone.
+    QVERIFY(QFile::remove(sourcePath));
+
+    QScopedPointer<LibraryHandler> indexedLibrary(createLibraryHandler());
+    indexedLibrary->searchForIPXactFiles();
+    QVERIFY(indexedLibrary->isValid(componentVLNV) == false);
+
+    setupTestLibrary();
+}
+
+void tst_LibraryHandler::testDiagnosticsMatchValidation()
+{
+    setupTestLibrary();
+
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    library->searchForIPXactFiles();
+
+    DocumentValidator validator(library.data());
+    for (VLNV const& vlnv : library->getAllVLNVs())
+    {
+        QSharedPointer<Document> document = library->getModel(vlnv);
+        QVERIFY(document.isNull() == false);
+
+        QVector<ValidationDiagnostic> diagnostics = validator.findDiagnostics(document);
+        QCOMPARE(DocumentValidator::hasErrors(diagnostics), !validator.validate(document));
+        QCOMPARE(DocumentValidator::getMessages(diagnostics).size(), diagnostics.size());
+    }
+}
+
+void tst_LibraryHandler::testCatalogDiagnostics()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    DocumentValidator validator(library.data());
+
+    QSharedPointer<Catalog> validCatalog(new Catalog(VLNV(VLNV::CATALOG, "tut.fi", "cat", "valid", "1.0")));
+    QVERIFY(validator.findDiagnostics(validCatalog).isEmpty());
+
+    VLNV invalidVLNV(VLNV::CATALOG, "", "cat", "invalid", "1.0");
+    QSharedPointer<Catalog> invalidCatalog(new Catalog(invalidVLNV));
+
+    QVector<ValidationDiagnostic> diagnostics = validator.findDiagnostics(invalidCatalog);
+    QVERIFY(DocumentValidator::hasErrors(diagnostics));
+    QCOMPARE(validator.validate(invalidCatalog), false);
+
+    QVector<QString> errors;
+    validator.findErrorsIn(invalidCatalog, errors);
+    QCOMPARE(DocumentValidator::getMessages(diagnostics), errors);
+
+    for (ValidationDiagnostic const& diagnostic : diagnostics)
+    {
+        QCOMPARE(diagnostic.elementPath, invalidVLNV.toString());
+    }
+}
+
+void tst_LibraryHandler::testParameterCyclesAreReportedAsWarnings()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+    DocumentValidator validator(library.data());
+
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "lib", "cyclic", "1.0");
+    QSharedPointer<Component> component(new Component(componentVLNV));
+
+    QStringList names({ "first", "second", "third" });
+    QStringList values({ "ID_second", "ID_first", "ID_first + 1" });
+    for (int i = 0; i < names.size(); ++i)
+    {
+        QSharedPointer<Parameter> parameter(new Parameter());
+        parameter->setName(names.at(i));
+        parameter->setValueId("ID_" + names.at(i));
+        parameter->setValue(values.at(i));
+        component->getParameters()->append(parameter);
+    }
+
+    QVector<ValidationDiagnostic> diagnostics = validator.findDiagnostics(component);
+
+    QVector<ValidationDiagnostic> cycleWarnings;
+    for (ValidationDiagnostic const& diagnostic : diagnostics)
+    {
+        if (diagnostic.severity == ValidationDiagnostic::SEVERITY_WARNING)
+        {
+            cycleWarnings.append(diagnostic);
+        }
+    }
+
+    // Only the parameters referencing each other are in the cycle, not the ones depending on it.
+    QCOMPARE(cycleWarnings.size(), 1);
+    QCOMPARE(cycleWarnings.first().elementPath, componentVLNV.toString() + "/parameters");
+    QVERIFY(cycleWarnings.first().message.contains("first -> second -> first"));
+    QCOMPARE(DocumentValidator::hasErrors(diagnostics), !validator.validate(component));
+}
+
+void tst_LibraryHandler::testOnlyErrorDiagnosticsInvalidateDocument()
+{
+    QVector<ValidationDiagnostic> diagnostics;
+    QVERIFY(DocumentValidator::hasErrors(diagnostics) == false);
+    QVERIFY(DocumentValidator::getMessages(diagnostics).isEmpty());
+
+    diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_WARNING, "tut.fi:lib:a:1.0", "First"));
+    QVERIFY(DocumentValidator::hasErrors(diagnostics) == false);
+
+    diagnostics.append(ValidationDiagnostic(ValidationDiagnostic::SEVERITY_ERROR, "tut.fi:lib:a:1.0/ports",
+        "Second"));
+    QVERIFY(DocumentValidator::hasErrors(diagnostics));
+
+    QCOMPARE(DocumentValidator::getMessages(diagnostics), QVector<QString>({ "First", "Second" }));
+}
+
+void tst_LibraryHandler::testFileWatcherReportsChangesInBatch()
+{
+    QTemporaryDir libraryDirectory;
+    QString changedPath = libraryDirectory.filePath(QStringLiteral("changed.xml"));
+    QString removedPath = libraryDirectory.filePath(QStringLiteral("removed.xml"));
+    QString addedPath = libraryDirectory.filePath(QStringLiteral("added.xml"));
+
+    for (QString const& path : QStringList({ changedPath, removedPath }))
+    {
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("<ipxact:component/>");
+    }
+
+    LibraryFileWatcher watcher;
+    watcher.addFile(changedPath);
+    watcher.addFile(removedPath);
+    QCOMPARE(watcher.directories(), QStringList(QFileInfo(libraryDirectory.path()).absoluteFilePath()));
+
+    QSignalSpy changeSpy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QFile changedFile(changedPath);
+    QVERIFY(changedFile.open(QIODevice::Append));
+    changedFile.write("<!-- changed -->");
+    changedFile.close();
+    watcher.onDirectoryChanged(libraryDirectory.path());
+
+    QVERIFY(QFile::remove(removedPath));
+    watcher.onDirectoryChanged(libraryDirectory.path());
+
+    QFile addedFile(addedPath);
+    QVERIFY(addedFile.open(QIODevice::WriteOnly));
+    addedFile.close();
+    QFile ignoredFile(libraryDirectory.filePath(QStringLiteral("ignored.txt")));
+    QVERIFY(ignoredFile.open(QIODevice::WriteOnly));
+    ignoredFile.close();
+    watcher.onDirectoryChanged(libraryDirectory.path());
+
+    QCOMPARE(changeSpy.count(), 0);
+    watcher.reportPendingChanges();
+    QCOMPARE(changeSpy.count(), 1);
+
+    QList<QVariant> arguments = changeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toStringList(), QStringList(QFileInfo(changedPath).absoluteFilePath()));
+    QCOMPARE(arguments.at(1).toStringList(), QStringList(QFileInfo(addedPath).absoluteFilePath()));
+    QCOMPARE(arguments.at(2).toStringList(), QStringList(QFileInfo(removedPath).absoluteFilePath()));
+
+    // Without new changes nothing is reported.
+    watcher.onDirectoryChanged(libraryDirectory.path());
+    watcher.reportPendingChanges();
+    QCOMPARE(changeSpy.count(), 0);
+
+    // The directory stays watched after its last library file is removed, so the files added later are found.
+    QVERIFY(QFile::remove(changedPath));
+    QVERIFY(QFile::remove(addedPath));
+    watcher.onDirectoryChanged(libraryDirectory.path());
+    watcher.reportPendingChanges();
+    QCOMPARE(changeSpy.count(), 1);
+    changeSpy.clear();
+    QCOMPARE(watcher.directories(), QStringList(QFileInfo(libraryDirectory.path()).absoluteFilePath()));
+
+    QString laterPath = libraryDirectory.filePath(QStringLiteral("later.xml"));
+    QFile laterFile(laterPath);
+    QVERIFY(laterFile.open(QIODevice::WriteOnly));
+    laterFile.close();
+    watcher.onDirectoryChanged(libraryDirectory.path());
+    watcher.reportPendingChanges();
+
+    QCOMPARE(changeSpy.count(), 1);
+    QCOMPARE(changeSpy.takeFirst().at(1).toStringList(), QStringList(QFileInfo(laterPath).absoluteFilePath()));
+}
+
+void tst_LibraryHandler::testFileWatcherDetectsEditInPlace()
+{
+    QTemporaryDir libraryDirectory;
+    QString filePath = QFileInfo(libraryDirectory.filePath(QStringLiteral("edited.xml"))).absoluteFilePath();
+
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("<ipxact:component/>");
+    file.close();
+
+    LibraryFileWatcher watcher;
+    watcher.setDelay(50);
+    watcher.addFile(filePath);
+
+    QSignalSpy changeSpy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    // Rewriting the content does not change the directory, so only the file watch reports the edit.
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Append));
+    file.write("<!-- edited -->");
+    file.close();
+
+    QTRY_COMPARE_WITH_TIMEOUT(changeSpy.count(), 1, 5000);
+
+    QList<QVariant> arguments = changeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toStringList(), QStringList(filePath));
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QVERIFY(arguments.at(2).toStringList().isEmpty());
+}
+
+void tst_LibraryHandler::testFileWatcherWatchesNewSubdirectories()
+{
+    QTemporaryDir libraryDirectory;
+    QString filePath = libraryDirectory.filePath(QStringLiteral("existing.xml"));
+
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+
+    LibraryFileWatcher watcher;
+    watcher.setDelay(50);
+    watcher.addFile(filePath);
+
+    QSignalSpy changeSpy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QVERIFY(QDir(libraryDirectory.path()).mkdir(QStringLiteral("newVersion")));
+    QString subdirectoryPath =
+        QFileInfo(libraryDirectory.filePath(QStringLiteral("newVersion"))).absoluteFilePath();
+
+    QString addedPath = subdirectoryPath + QStringLiteral("/added.xml");
+    QFile addedFile(addedPath);
+    QVERIFY(addedFile.open(QIODevice::WriteOnly));
+    addedFile.close();
+
+    QTRY_VERIFY_WITH_TIMEOUT(changeSpy.isEmpty() == false, 5000);
+    QCOMPARE(changeSpy.takeFirst().at(1).toStringList(), QStringList(addedPath));
+    QVERIFY(watcher.directories().contains(subdirectoryPath));
+
+    // The files added to the new subdirectory afterwards are reported as well.
+    QString laterPath = subdirectoryPath + QStringLiteral("/later.xml");
+    QFile laterFile(laterPath);
+    QVERIFY(laterFile.open(QIODevice::WriteOnly));
+    laterFile.close();
+
+    QTRY_VERIFY_WITH_TIMEOUT(changeSpy.isEmpty() == false, 5000);
+    QCOMPARE(changeSpy.takeFirst().at(1).toStringList(), QStringList(laterPath));
+}
+
 LibraryHandler* tst_LibraryHandler::createLibraryHandler()
 {
     return new LibraryHandler(0, &messageChannel_, 0);
@@ -130,17 +949,23 @@ void tst_LibraryHandler::setupTestLibrary()
     QCoreApplication::setOrganizationName(QStringLiteral("TUT"));
     QCoreApplication::setApplicationName(QStringLiteral("Kactus2_tests"));
 
+    // Keep the settings and the library index of the tests out of the user settings.
+    QSettings::setDefaultFormat(QSettings::IniFormat);
+    QSettings::setPath(QSettings::IniFormat, QSettings::UserScope, settingsDirectory_.path());
+
     QSettings settings;
-    settings.setPath(QSettings::IniFormat, QSettings::UserScope, "tests.ini");
     settings.setValue("Library/ActiveLocations", QStringList("C:/dev/k2lib/ipxactexamplelib"));
 }
 
 void tst_LibraryHandler::initTestcase()
 {
     qInstallMessageHandler(noMessageOutput);
+
+    QVERIFY(settingsDirectory_.isValid());
+    setupTestLibrary();
 }
 
 
-QTEST_APPLESS_MAIN(tst_LibraryHandler)
+QTEST_MAIN(tst_LibraryHandler)
 
 #include "tst_LibraryHandler.moc"
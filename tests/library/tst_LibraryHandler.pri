@@ -12,15 +12,20 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../library/DocumentFileAccess.h \
     ../../library/DocumentValidator.h \
     ../../library/LibraryLoader.h \
+    ../../library/LibraryIndex.h \
+    ../../library/LibraryFileWatcher.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../library/LibraryInterface.h \
+    ../../library/DocumentCache.h \
+    ../../library/DependencyGraph.h \
     ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsColumns.h \
     ../../common/widgets/assistedLineEdit/LineContentAssistWidget.h \
     ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../common/ui/MessageMediator.h \
     ../../common/dialogs/ObjectExportDialog/ObjectSelectionListItem.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/BigInteger.h \
     ../../library/TableViewDialog.h \
     ../../library/LibraryItemSelectionFactory.h \
     ../../common/widgets/vlnvEditor/VLNVContentMatcher.h \
@@ -36,6 +41,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/dialogs/ObjectExportDialog/ObjectExportDialog.h \
     ../../common/dialogs/ObjectExportDialog/ObjectSelectionDialog.h \
     ../../editors/ComponentEditor/common/ParameterCache.h \
+    ../../editors/ComponentEditor/common/ParameterDependencyGraph.h \
     ../../library/HierarchyView/hierarchyitem.h \
     ../../library/HierarchyView/hierarchymodel.h \
     ../../common/widgets/LibrarySelectorWidget/LibraryPathEditor/librarypatheditor.h \
@@ -50,8 +56,12 @@ SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../common/ui/ConsoleMediator.cpp \
     ../../library/DocumentFileAccess.cpp \
+    ../../library/DocumentCache.cpp \
+    ../../library/DependencyGraph.cpp \
     ../../library/DocumentValidator.cpp \
     ../../library/LibraryLoader.cpp \
+    ../../library/LibraryIndex.cpp \
+    ../../library/LibraryFileWatcher.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
     ../../library/LibraryErrorModel.cpp \
@@ -66,7 +76,9 @@ SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../common/dialogs/ObjectExportDialog/ObjectSelectionDialog.cpp \
     ../../common/dialogs/ObjectExportDialog/ObjectSelectionListItem.cpp \
     ../../editors/ComponentEditor/common/ParameterCache.cpp \
+    ../../editors/ComponentEditor/common/ParameterDependencyGraph.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/BigInteger.cpp \
     ../../library/TableViewDialog.cpp \
     ../../library/LibraryItemSelectionFactory.cpp \
     ../../common/widgets/vlnvEditor/VLNVContentMatcher.cpp \